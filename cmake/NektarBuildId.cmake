@@ -0,0 +1,29 @@
+#
+# Generates a source file defining an identifier of the library build.
+#
+# The identifier is an MD5 hash of the contents of every source file under
+# SOURCE_DIR together with BUILD_FLAGS, so it changes whenever the library
+# sources or the compiler and its flags change, but not when the library is
+# rebuilt from identical sources. It is run as a script (cmake -P) at every
+# build, and the output file is only rewritten if the identifier changes.
+#
+# Required variables:
+#   SOURCE_DIR   Directory to search recursively for source files.
+#   BUILD_FLAGS  Compiler identification and flags.
+#   INPUT_FILE   Template passed to configure_file, using @NEKTAR_BUILD_ID@.
+#   OUTPUT_FILE  File to generate.
+#
+
+FILE(GLOB_RECURSE BUILD_ID_SOURCES
+    "${SOURCE_DIR}/*.cpp" "${SOURCE_DIR}/*.h" "${SOURCE_DIR}/*.hpp")
+LIST(SORT BUILD_ID_SOURCES)
+
+SET(BUILD_ID_INPUT "${BUILD_FLAGS}")
+FOREACH(SRC ${BUILD_ID_SOURCES})
+    FILE(MD5 "${SRC}" SRC_HASH)
+    SET(BUILD_ID_INPUT "${BUILD_ID_INPUT};${SRC_HASH}")
+ENDFOREACH()
+
+STRING(MD5 NEKTAR_BUILD_ID "${BUILD_ID_INPUT}")
+
+CONFIGURE_FILE("${INPUT_FILE}" "${OUTPUT_FILE}" @ONLY)
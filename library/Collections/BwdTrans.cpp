@@ -36,6 +36,8 @@
 #include <loki/Singleton.h>
 #include <Collections/Operator.h>
 #include <Collections/Collection.h>
+#include <Collections/SumFacSIMD.h>
+#include <StdRegions/StdPyrExp.h>
 
 namespace Nektar {
 namespace Collections {
@@ -364,14 +366,11 @@ class BwdTrans_SumFac_Quad : public Operator
             }
             else if(m_colldir0)
             {
-                Array<OneD, const NekDouble> base1
-                        = m_stdExp->GetBasis(1)->GetBdata();
-
                 for(i = 0; i < m_numElmt; ++i)
                 {
                     Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nmodes1,
                                 1.0, &input[i*m_nquad0*m_nmodes1], m_nquad0,
-                                     base1.get(), m_nquad1, 0.0,
+                                     m_base1.get(), m_nquad1, 0.0,
                                      &output[i*m_nquad0*m_nquad1], m_nquad0);
                 }
             }
@@ -384,7 +383,7 @@ class BwdTrans_SumFac_Quad : public Operator
             }
             else
             {
-                ASSERTL1(wsp.num_elements() == m_wspSize,
+                ASSERTL1(wsp.num_elements() >= m_wspSize,
                          "Incorrect workspace size");
 
                 // Those two calls correpsond to the operation
@@ -459,7 +458,7 @@ class BwdTrans_SumFac_Tri : public Operator
                       Array<OneD,       NekDouble> &wsp)
         {
 
-            ASSERTL1(wsp.num_elements() == m_wspSize,
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
                      "Incorrect workspace size");
 
             int ncoeffs = m_stdExp->GetNcoeffs();
@@ -562,7 +561,7 @@ class BwdTrans_SumFac_Hex : public Operator
             }
             else
             {
-                ASSERTL1(wsp.num_elements() == m_wspSize,
+                ASSERTL1(wsp.num_elements() >= m_wspSize,
                          "Incorrect workspace size");
 
                 // Assign second half of workspace for 2nd DGEMM operation.
@@ -657,7 +656,7 @@ class BwdTrans_SumFac_Tet : public Operator
                       Array<OneD,       NekDouble> &output2,
                       Array<OneD,       NekDouble> &wsp)
         {
-            ASSERTL1(wsp.num_elements() == m_wspSize,
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
                      "Incorrect workspace size");
 
             Array<OneD, NekDouble > tmp  = wsp;
@@ -822,7 +821,7 @@ class BwdTrans_SumFac_Prism : public Operator
                       Array<OneD,       NekDouble> &output2,
                       Array<OneD,       NekDouble> &wsp)
         {
-            ASSERTL1(wsp.num_elements() == m_wspSize,
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
                     "Incorrect workspace size");
 
             // Assign second half of workspace for 2nd DGEMM operation.
@@ -935,5 +934,223 @@ OperatorKey BwdTrans_SumFac_Prism::m_type = GetOperatorFactory().
         OperatorKey(ePrism, eBwdTrans, eSumFac,false),
         BwdTrans_SumFac_Prism::create, "BwdTrans_SumFac_Prism");
 
+
+/**
+ * @brief Backward transform operator using sum-factorisation (Pyr)
+ */
+class BwdTrans_SumFac_Pyr : public Operator
+{
+    public:
+        OPERATOR_CREATE(BwdTrans_SumFac_Pyr)
+
+        virtual ~BwdTrans_SumFac_Pyr()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
+                    "Incorrect workspace size");
+
+            int totmodes  = m_stdExp->GetNcoeffs();
+
+            // Workspace for the summation over the '2' direction, the
+            // summation over the '1' direction and the gathered coefficients
+            // and base2 columns of a single (p,q) pair.
+            Array<OneD, NekDouble> wsp1
+                    = wsp  + m_nmodes0*m_nmodes1*m_nquad2*m_numElmt;
+            Array<OneD, NekDouble> wsp2
+                    = wsp1 + m_nmodes0*m_nquad1*m_nquad2*m_numElmt;
+            Array<OneD, NekDouble> wsp3
+                    = wsp2 + m_nmodes2*m_numElmt;
+
+            // Perform summation over '2' direction for each (p,q) pair
+            int mode = 0;
+            for (int i = 0; i < m_nmodes0*m_nmodes1; ++i)
+            {
+                int nr = m_nModesPQ[i];
+
+                for (int r = 0; r < nr; ++r)
+                {
+                    Vmath::Vcopy(m_nquad2,
+                                 m_base2.get() + m_zModeMap[mode+r]*m_nquad2, 1,
+                                 wsp3.get()    + r*m_nquad2,                  1);
+                    Vmath::Vcopy(m_numElmt,
+                                 input.get() + m_coeffMap[mode+r], totmodes,
+                                 wsp2.get()  + r,                  nr);
+                }
+
+                Blas::Dgemm('N', 'N', m_nquad2, m_numElmt, nr,
+                            1.0, wsp3.get(), m_nquad2,
+                                 wsp2.get(), nr,
+                            0.0, &wsp[i*m_nquad2*m_numElmt], m_nquad2);
+
+                mode += nr;
+            }
+
+            // fix for modified basis by splitting top vertex mode into the
+            // (p,q) = (0,1), (1,0) and (1,1) components
+            for (int i = 0; i < m_numElmt; ++i)
+            {
+                Blas::Daxpy(m_nquad2, input[4+i*totmodes],
+                            m_base2.get()+m_nquad2, 1,
+                            &wsp[m_nquad2*m_numElmt + i*m_nquad2], 1);
+                Blas::Daxpy(m_nquad2, input[4+i*totmodes],
+                            m_base2.get()+m_nquad2, 1,
+                            &wsp[m_nmodes1*m_nquad2*m_numElmt + i*m_nquad2], 1);
+                Blas::Daxpy(m_nquad2, input[4+i*totmodes],
+                            m_base2.get()+m_nquad2, 1,
+                            &wsp[(m_nmodes1+1)*m_nquad2*m_numElmt
+                                 + i*m_nquad2], 1);
+            }
+
+            // Perform summation over '1' direction
+            for (int i = 0; i < m_nmodes0; ++i)
+            {
+                Blas::Dgemm('N', 'T', m_nquad1, m_nquad2*m_numElmt, m_nmodes1,
+                            1.0, m_base1.get(), m_nquad1,
+                            &wsp[i*m_nmodes1*m_nquad2*m_numElmt],
+                            m_nquad2*m_numElmt,
+                            0.0, &wsp1[i*m_nquad1*m_nquad2*m_numElmt],
+                            m_nquad1);
+            }
+
+            // Perform summation over '0' direction
+            Blas::Dgemm('N', 'T', m_nquad0, m_nquad1*m_nquad2*m_numElmt,
+                        m_nmodes0, 1.0, m_base0.get(),  m_nquad0,
+                        wsp1.get(), m_nquad1*m_nquad2*m_numElmt,
+                        0.0, output.get(), m_nquad0);
+        }
+
+
+    protected:
+        const int                       m_nquad0;
+        const int                       m_nquad1;
+        const int                       m_nquad2;
+        const int                       m_nmodes0;
+        const int                       m_nmodes1;
+        const int                       m_nmodes2;
+        Array<OneD, const NekDouble>    m_base0;
+        Array<OneD, const NekDouble>    m_base1;
+        Array<OneD, const NekDouble>    m_base2;
+        Array<OneD, int>                m_nModesPQ;
+        Array<OneD, int>                m_coeffMap;
+        Array<OneD, int>                m_zModeMap;
+
+    private:
+        BwdTrans_SumFac_Pyr(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator  (pCollExp, pGeomData),
+              m_nquad0  (m_stdExp->GetNumPoints(0)),
+              m_nquad1  (m_stdExp->GetNumPoints(1)),
+              m_nquad2  (m_stdExp->GetNumPoints(2)),
+              m_nmodes0 (m_stdExp->GetBasisNumModes(0)),
+              m_nmodes1 (m_stdExp->GetBasisNumModes(1)),
+              m_nmodes2 (m_stdExp->GetBasisNumModes(2)),
+              m_base0   (m_stdExp->GetBasis(0)->GetBdata()),
+              m_base1   (m_stdExp->GetBasis(1)->GetBdata()),
+              m_base2   (m_stdExp->GetBasis(2)->GetBdata())
+        {
+            StdRegions::StdPyrExpSharedPtr pyr =
+                boost::dynamic_pointer_cast<StdRegions::StdPyrExp>(m_stdExp);
+            ASSERTL0(pyr, "Expected a pyramid expansion");
+            pyr->GetSumFacModeMap(m_nModesPQ, m_coeffMap, m_zModeMap);
+
+            ASSERTL0(m_nModesPQ.num_elements() == m_nmodes0*m_nmodes1,
+                     "Pyramid mode map does not contain all (p,q) pairs");
+
+            m_wspSize = m_numElmt*m_nmodes0*(m_nmodes1*m_nquad2
+                                                + m_nquad1*m_nquad2)
+                      + m_nmodes2*(m_numElmt + m_nquad2);
+        }
+};
+
+/// Factory initialisation for the BwdTrans_SumFac_Pyr operator
+OperatorKey BwdTrans_SumFac_Pyr::m_type = GetOperatorFactory().
+    RegisterCreatorFunction(
+        OperatorKey(ePyramid, eBwdTrans, eSumFac,false),
+        BwdTrans_SumFac_Pyr::create, "BwdTrans_SumFac_Pyr");
+
+
+/**
+ * @brief Backward transform operator using sum-factorisation on blocks of
+ * interleaved elements (Quad, Hex)
+ */
+class BwdTrans_SumFacSIMD : public Operator
+{
+    public:
+        OPERATOR_CREATE(BwdTrans_SumFacSIMD)
+
+        virtual ~BwdTrans_SumFacSIMD()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
+                     "Incorrect workspace size");
+
+            const int nCoeffs = m_stdExp->GetNcoeffs();
+            const int nPhys   = m_stdExp->GetTotPoints();
+
+            NekDouble *in  = wsp.get();
+            NekDouble *out = in  + m_nBlocks*kSIMDWidth*nCoeffs;
+            NekDouble *tmp = out + m_nBlocks*kSIMDWidth*nPhys;
+
+            SIMDInterleave(m_numElmt, nCoeffs, input.get(), in);
+            SIMDTensorContract(m_nBlocks, m_dim, m_nmodes, m_nquad,
+                               m_base, false, in, out, tmp);
+            SIMDDeinterleave(m_numElmt, nPhys, out, output.get());
+        }
+
+    protected:
+        int                             m_dim;
+        int                             m_nBlocks;
+        int                             m_nquad[3];
+        int                             m_nmodes[3];
+        const NekDouble                *m_base[3];
+
+    private:
+        BwdTrans_SumFacSIMD(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator (pCollExp, pGeomData),
+              m_dim    (m_stdExp->GetShapeDimension()),
+              m_nBlocks(SIMDNumBlocks(m_numElmt))
+        {
+            for (int i = 0; i < m_dim; ++i)
+            {
+                m_nquad[i]  = m_stdExp->GetNumPoints(i);
+                m_nmodes[i] = m_stdExp->GetBasisNumModes(i);
+                m_base[i]   = m_stdExp->GetBasis(i)->GetBdata().get();
+            }
+
+            m_wspSize = m_nBlocks*kSIMDWidth*(m_stdExp->GetNcoeffs() +
+                                              m_stdExp->GetTotPoints())
+                      + SIMDTensorWspSize(m_nBlocks, m_dim, m_nmodes, m_nquad);
+        }
+};
+
+/// Factory initialisation for the BwdTrans_SumFacSIMD operators
+OperatorKey BwdTrans_SumFacSIMD::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eBwdTrans, eSumFacSIMD,false),
+        BwdTrans_SumFacSIMD::create, "BwdTrans_SumFacSIMD_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eBwdTrans, eSumFacSIMD,false),
+        BwdTrans_SumFacSIMD::create, "BwdTrans_SumFacSIMD_Hex")
+};
+
 }
 }
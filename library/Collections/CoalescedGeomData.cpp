@@ -41,6 +41,127 @@ using namespace std;
 namespace Nektar {
 namespace Collections {
 
+/**
+ * @param   nComp       Number of components.
+ * @param   nq          Number of quadrature points per element.
+ * @param   deformed    Whether each element stores a value per quadrature
+ *                      point.
+ * @param   weights     Optional weights of the quadrature points, applied to
+ *                      the constants of regular elements.
+ */
+CompactGeomData::CompactGeomData(
+        int nComp, int nq, const vector<bool> &deformed,
+        const Array<OneD, const NekDouble> &weights)
+    : m_nComp      (nComp),
+      m_nq         (nq),
+      m_allDeformed(true),
+      m_offset     (deformed.size() + 1, 0),
+      m_weights    (weights)
+{
+    for (int e = 0; e < deformed.size(); ++e)
+    {
+        m_offset[e+1] = m_offset[e] + (deformed[e] ? nq : 1);
+        m_allDeformed = m_allDeformed && deformed[e];
+    }
+
+    m_compSize = m_offset[deformed.size()];
+    m_data     = Array<OneD, NekDouble>(m_nComp*m_compSize, 0.0);
+}
+
+void CompactGeomData::Expand(int c, NekDouble *out) const
+{
+    const int nElmt = m_offset.size() - 1;
+
+    for (int e = 0; e < nElmt; ++e)
+    {
+        const NekDouble *fac = GetData(c, e);
+        if (IsDeformed(e))
+        {
+            Vmath::Vcopy(m_nq, fac, 1, out + e*m_nq, 1);
+        }
+        else if (m_weights.num_elements())
+        {
+            Vmath::Smul(m_nq, fac[0], m_weights.get(), 1, out + e*m_nq, 1);
+        }
+        else
+        {
+            Vmath::Fill(m_nq, fac[0], out + e*m_nq, 1);
+        }
+    }
+}
+
+void CompactGeomData::Vmul(
+        int c, const NekDouble *in, NekDouble *out) const
+{
+    const int nElmt = m_offset.size() - 1;
+
+    if (m_allDeformed)
+    {
+        Vmath::Vmul(nElmt*m_nq, GetData(c, 0), 1, in, 1, out, 1);
+        return;
+    }
+
+    for (int e = 0; e < nElmt; ++e)
+    {
+        const NekDouble *fac = GetData(c, e);
+        if (IsDeformed(e))
+        {
+            Vmath::Vmul(m_nq, fac, 1, in + e*m_nq, 1, out + e*m_nq, 1);
+        }
+        else if (m_weights.num_elements())
+        {
+            const NekDouble *w = m_weights.get();
+            const NekDouble *x = in  + e*m_nq;
+            NekDouble       *y = out + e*m_nq;
+            for (int i = 0; i < m_nq; ++i)
+            {
+                y[i] = fac[0]*w[i]*x[i];
+            }
+        }
+        else
+        {
+            Vmath::Smul(m_nq, fac[0], in + e*m_nq, 1, out + e*m_nq, 1);
+        }
+    }
+}
+
+void CompactGeomData::Vvtvp(
+        int c, const NekDouble *in, NekDouble *out) const
+{
+    const int nElmt = m_offset.size() - 1;
+
+    if (m_allDeformed)
+    {
+        Vmath::Vvtvp(nElmt*m_nq, GetData(c, 0), 1, in, 1, out, 1, out, 1);
+        return;
+    }
+
+    for (int e = 0; e < nElmt; ++e)
+    {
+        const NekDouble *fac = GetData(c, e);
+        if (IsDeformed(e))
+        {
+            Vmath::Vvtvp(m_nq, fac, 1, in + e*m_nq, 1,
+                         out + e*m_nq, 1, out + e*m_nq, 1);
+        }
+        else if (m_weights.num_elements())
+        {
+            const NekDouble *w = m_weights.get();
+            const NekDouble *x = in  + e*m_nq;
+            NekDouble       *y = out + e*m_nq;
+            for (int i = 0; i < m_nq; ++i)
+            {
+                y[i] += fac[0]*w[i]*x[i];
+            }
+        }
+        else
+        {
+            Vmath::Svtvp(m_nq, fac[0], in + e*m_nq, 1,
+                         out + e*m_nq, 1, out + e*m_nq, 1);
+        }
+    }
+}
+
 CoalescedGeomData::CoalescedGeomData(void)
 {
 }
@@ -49,105 +170,112 @@ CoalescedGeomData::~CoalescedGeomData(void)
 {
 }
 
-const Array<OneD, const NekDouble> &CoalescedGeomData::GetJac(
+/**
+ * Jacobian of the collection in compact form. Regular elements store their
+ * constant Jacobian only.
+ */
+CompactGeomDataSharedPtr CoalescedGeomData::GetCompactJac(
         vector<StdRegions::StdExpansionSharedPtr> &pCollExp)
 {
-
-    if(m_oneDGeomData.count(eJac) == 0)
+    if(m_compactGeomData.count(eJac) == 0)
     {
-
         LibUtilities::PointsKeyVector ptsKeys = pCollExp[0]->GetPointsKeys();
         int nElmts = pCollExp.size();
 
-        // set up Cached Jacobians to be continuous
         int npts = 1;
         for (int i = 0; i < ptsKeys.size(); ++i)
         {
             npts   *= ptsKeys[i].GetNumPoints();
         }
 
+        vector<bool> deformed(nElmts);
+        for(int i = 0; i < nElmts; ++i)
+        {
+            deformed[i] = pCollExp[i]->GetMetricInfo()->GetGtype() ==
+                SpatialDomains::eDeformed;
+        }
 
-        Array<OneD, NekDouble> newjac(npts*nElmts);
+        CompactGeomDataSharedPtr newjac = MemoryManager<CompactGeomData>
+            ::AllocateSharedPtr(1, npts, deformed);
 
-        //copy Jacobians into a continuous list and set new chatched value
-        int cnt = 0;
         for(int i = 0; i < nElmts; ++i)
         {
             const Array<OneD, const NekDouble> jac =
                                 pCollExp[i]->GetMetricInfo()->GetJac(ptsKeys);
-
-            if (pCollExp[i]->GetMetricInfo()->GetGtype() ==
-                    SpatialDomains::eDeformed)
-            {
-                Vmath::Vcopy(npts, &jac[0], 1, &newjac[cnt], 1);
-            }
-            else
-            {
-                Vmath::Fill(npts, jac[0], &newjac[cnt], 1);
-            }
-
-            cnt += npts;
+            Vmath::Vcopy(deformed[i] ? npts : 1, &jac[0], 1,
+                         newjac->GetData(0, i), 1);
         }
 
-        m_oneDGeomData[eJac] = newjac;
+        m_compactGeomData[eJac] = newjac;
     }
 
-    return m_oneDGeomData[eJac];
+    return m_compactGeomData[eJac];
 }
 
 
-
-const Array<OneD, const NekDouble> &CoalescedGeomData::GetJacWithStdWeights(
+/**
+ * Jacobian of the collection multiplied by the quadrature weights of the
+ * standard element. Regular elements store their constant Jacobian only, to
+ * which the weights are applied on use.
+ */
+CompactGeomDataSharedPtr CoalescedGeomData::GetCompactJacWithStdWeights(
         vector<StdRegions::StdExpansionSharedPtr> &pCollExp)
 {
-    if(m_oneDGeomData.count(eJacWithStdWeights) == 0)
+    if(m_compactGeomData.count(eJacWithStdWeights) == 0)
     {
         LibUtilities::PointsKeyVector ptsKeys = pCollExp[0]->GetPointsKeys();
         int nElmts = pCollExp.size();
 
-        // set up Cached Jacobians to be continuous
         int npts = 1;
         for (int i = 0; i < ptsKeys.size(); ++i)
         {
             npts   *= ptsKeys[i].GetNumPoints();
         }
 
+        vector<bool> deformed(nElmts);
+        for(int i = 0; i < nElmts; ++i)
+        {
+            deformed[i] = pCollExp[i]->GetMetricInfo()->GetGtype() ==
+                SpatialDomains::eDeformed;
+        }
+
+        Array<OneD, NekDouble> weights(npts, 1.0);
+        pCollExp[0]->MultiplyByStdQuadratureMetric(weights, weights);
 
-        Array<OneD, NekDouble> newjac(npts*nElmts), tmp;
+        CompactGeomDataSharedPtr newjac = MemoryManager<CompactGeomData>
+            ::AllocateSharedPtr(1, npts, deformed, weights);
 
-        //copy Jacobians into a continuous list and set new chatched value
-        int cnt = 0;
         for(int i = 0; i < nElmts; ++i)
         {
             const Array<OneD, const NekDouble> jac =
                             pCollExp[i]->GetMetricInfo()->GetJac(ptsKeys);
 
-            if (pCollExp[i]->GetMetricInfo()->GetGtype() ==
-                    SpatialDomains::eDeformed)
+            if (deformed[i])
             {
-                Vmath::Vcopy(npts, &jac[0], 1, &newjac[cnt], 1);
+                NekDouble *data = newjac->GetData(0, i);
+                Vmath::Vmul(npts, &jac[0], 1, weights.get(), 1, data, 1);
             }
             else
             {
-                Vmath::Fill(npts, jac[0], &newjac[cnt], 1);
+                newjac->GetData(0, i)[0] = jac[0];
             }
-
-            pCollExp[0]->MultiplyByStdQuadratureMetric(newjac + cnt,
-                                                       tmp = newjac + cnt);
-            cnt += npts;
         }
 
-        m_oneDGeomData[eJacWithStdWeights] = newjac;
+        m_compactGeomData[eJacWithStdWeights] = newjac;
     }
 
-    return m_oneDGeomData[eJacWithStdWeights];
+    return m_compactGeomData[eJacWithStdWeights];
 }
 
 
-const Array<TwoD, const NekDouble> &CoalescedGeomData::GetDerivFactors(
+/**
+ * Derivative factors of the collection in compact form. The factors of
+ * regular elements are not expanded to the quadrature points.
+ */
+CompactGeomDataSharedPtr CoalescedGeomData::GetCompactDerivFactors(
         vector<StdRegions::StdExpansionSharedPtr> &pCollExp)
 {
-    if(m_twoDGeomData.count(eDerivFactors) == 0)
+    if(m_compactGeomData.count(eDerivFactors) == 0)
     {
         LibUtilities::PointsKeyVector ptsKeys = pCollExp[0]->GetPointsKeys();
 
@@ -155,45 +283,39 @@ const Array<TwoD, const NekDouble> &CoalescedGeomData::GetDerivFactors(
         const int coordim = pCollExp[0]->GetCoordim();
         int dim = ptsKeys.size();
 
-        // set up Cached Jacobians to be continuous
         int npts = 1;
         for (int i = 0; i < dim; ++i)
         {
             npts   *= ptsKeys[i].GetNumPoints();
         }
 
+        vector<bool> deformed(nElmts);
+        for(int i = 0; i < nElmts; ++i)
+        {
+            deformed[i] = pCollExp[i]->GetMetricInfo()->GetGtype() ==
+                SpatialDomains::eDeformed;
+        }
 
-        Array<TwoD, NekDouble> newDFac(dim*coordim,npts*nElmts);
+        CompactGeomDataSharedPtr newDFac = MemoryManager<CompactGeomData>
+            ::AllocateSharedPtr(dim*coordim, npts, deformed);
 
-        //copy Jacobians into a continuous list and set new chatched value
-        int cnt = 0;
         for(int i = 0; i < nElmts; ++i)
         {
             const Array<TwoD, const NekDouble> Dfac =
                     pCollExp[i]->GetMetricInfo()->GetDerivFactors(ptsKeys);
+            const int nvals = deformed[i] ? npts : 1;
 
-            if (pCollExp[i]->GetMetricInfo()->GetGtype() ==
-                    SpatialDomains::eDeformed)
-            {
-                for (int j = 0; j < dim*coordim; ++j)
-                {
-                    Vmath::Vcopy(npts, &Dfac[j][0], 1, &newDFac[j][cnt], 1);
-                }
-            }
-            else
+            for (int j = 0; j < dim*coordim; ++j)
             {
-                for (int j = 0; j < dim*coordim; ++j)
-                {
-                    Vmath::Fill(npts, Dfac[j][0], &newDFac[j][cnt], 1);
-                }
+                Vmath::Vcopy(nvals, &Dfac[j][0], 1,
+                             newDFac->GetData(j, i), 1);
             }
-            cnt += npts;
         }
 
-        m_twoDGeomData[eDerivFactors] = newDFac;
+        m_compactGeomData[eDerivFactors] = newDFac;
     }
 
-    return m_twoDGeomData[eDerivFactors];
+    return m_compactGeomData[eDerivFactors];
 }
 
 }
@@ -51,6 +51,84 @@ enum GeomData
     eDerivFactors
 };
 
+/**
+ * @brief Metric terms of a collection stored in a single structure-of-arrays
+ * buffer.
+ *
+ * Each component (e.g. a derivative factor) occupies a contiguous block of
+ * the buffer. Within a block, regular elements store a single constant and
+ * deformed elements store one value per quadrature point, so that affine
+ * meshes require storage proportional to the number of elements only.
+ *
+ * If weights are given, the constant of a regular element is multiplied by
+ * the weight of each quadrature point when applied, whereas the values of
+ * deformed elements are stored with the weights included.
+ */
+class CompactGeomData
+{
+    public:
+        CompactGeomData(int nComp, int nq,
+                        const std::vector<bool> &deformed,
+                        const Array<OneD, const NekDouble> &weights =
+                            NullNekDouble1DArray);
+
+        /// Return the number of components.
+        int GetNumComponents() const
+        {
+            return m_nComp;
+        }
+
+        /// Return true if element @a e stores a value per quadrature point.
+        bool IsDeformed(int e) const
+        {
+            return m_offset[e+1] - m_offset[e] > 1;
+        }
+
+        /// Return the values of component @a c of element @a e.
+        NekDouble *GetData(int c, int e)
+        {
+            return m_data.get() + c*m_compSize + m_offset[e];
+        }
+
+        const NekDouble *GetData(int c, int e) const
+        {
+            return m_data.get() + c*m_compSize + m_offset[e];
+        }
+
+        /// Return the number of values held over all components.
+        int GetStorageSize() const
+        {
+            return m_nComp*m_compSize;
+        }
+
+        /// Write component @a c at every quadrature point of every element.
+        void Expand(int c, NekDouble *out) const;
+
+        /// Compute out = comp(c) * in over all elements.
+        void Vmul(int c, const NekDouble *in, NekDouble *out) const;
+
+        /// Compute out = comp(c) * in + out over all elements.
+        void Vvtvp(int c, const NekDouble *in, NekDouble *out) const;
+
+    private:
+        /// Number of components.
+        int                    m_nComp;
+        /// Number of quadrature points per element.
+        int                    m_nq;
+        /// Number of values stored per component.
+        int                    m_compSize;
+        /// Whether every element of the collection is deformed.
+        bool                   m_allDeformed;
+        /// Offset of each element within a component block.
+        std::vector<int>       m_offset;
+        /// Component-major storage of the metric terms.
+        Array<OneD, NekDouble> m_data;
+        /// Quadrature weights applied to regular elements, if any.
+        Array<OneD, const NekDouble> m_weights;
+};
+
+typedef boost::shared_ptr<CompactGeomData> CompactGeomDataSharedPtr;
+
 class CoalescedGeomData
 {
     public:
@@ -58,18 +136,17 @@ class CoalescedGeomData
 
         virtual ~CoalescedGeomData(void);
 
-        const Array<OneD, const NekDouble> &GetJac(
+        CompactGeomDataSharedPtr GetCompactJac(
                 std::vector<StdRegions::StdExpansionSharedPtr> &pColLExp);
 
-        const Array<OneD, const NekDouble> &GetJacWithStdWeights(
+        CompactGeomDataSharedPtr GetCompactJacWithStdWeights(
                 std::vector<StdRegions::StdExpansionSharedPtr> &pColLExp);
 
-        const Array<TwoD, const NekDouble> &GetDerivFactors(
+        CompactGeomDataSharedPtr GetCompactDerivFactors(
                 std::vector<StdRegions::StdExpansionSharedPtr> &pColLExp);
 
     private:
-        std::map<GeomData,Array<OneD, NekDouble> > m_oneDGeomData;
-        std::map<GeomData,Array<TwoD, NekDouble> > m_twoDGeomData;
+        std::map<GeomData,CompactGeomDataSharedPtr> m_compactGeomData;
 };
 
 typedef boost::shared_ptr<CoalescedGeomData>   CoalescedGeomDataSharedPtr;
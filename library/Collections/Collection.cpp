@@ -50,6 +50,7 @@ Collection::Collection(
 
     // Initialise geometry data.
     m_geomData = MemoryManager<CoalescedGeomData>::AllocateSharedPtr();
+    m_collExp  = pCollExp;
 
     // Loop over all operator types.
     for (int i = 0; i < SIZE_OperatorType; ++i)
@@ -68,12 +69,34 @@ Collection::Collection(
             ASSERTL0(GetOperatorFactory().ModuleExists(opKey),
                  "Requested unknown operator "+ss.str());
 
+            // The Helmholtz operator builds its own set of sub-operators,
+            // so only create it if it is applied.
+            if (opType == eHelmholtz)
+            {
+                m_deferredOps[opType] = opKey;
+                continue;
+            }
+
             m_ops[opType] = GetOperatorFactory().CreateInstance(
                                                 opKey, pCollExp, m_geomData);
         }
     }
 }
 
+/**
+ * @brief Create an operator whose construction was deferred until first
+ * use.
+ */
+OperatorSharedPtr Collection::CreateDeferredOperator(const OperatorType &op)
+{
+    boost::unordered_map<OperatorType, OperatorKey>::iterator it =
+                                                    m_deferredOps.find(op);
+    ASSERTL0(it != m_deferredOps.end(), "Operator not available in collection.");
+
+    return GetOperatorFactory().CreateInstance(
+                                        it->second, m_collExp, m_geomData);
+}
+
 }
 }
 
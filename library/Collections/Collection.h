@@ -79,11 +79,24 @@ class Collection
 
         inline bool HasOperator(const OperatorType &op);
 
+        inline void UpdateFactors(
+                const OperatorType                           &op,
+                const StdRegions::ConstFactorMap             &factors);
+
     protected:
         StdRegions::StdExpansionSharedPtr                     m_stdExp;
         vector<SpatialDomains::GeometrySharedPtr>             m_geom;
         boost::unordered_map<OperatorType, OperatorSharedPtr> m_ops;
         CoalescedGeomDataSharedPtr                            m_geomData;
+        /// Expansions of the collection, kept for deferred operators.
+        vector<StdRegions::StdExpansionSharedPtr>             m_collExp;
+        /// Keys of operators which are only created on first use.
+        boost::unordered_map<OperatorType, OperatorKey>       m_deferredOps;
+
+        COLLECTIONS_EXPORT OperatorSharedPtr CreateDeferredOperator(
+                const OperatorType                           &op);
+
+        inline OperatorSharedPtr &GetOperator(const OperatorType &op);
 
 };
 
@@ -99,9 +112,9 @@ inline void Collection::ApplyOperator(
         const Array<OneD, const NekDouble> &inarray,
               Array<OneD,       NekDouble> &output)
 {
-    Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
-    (*m_ops[op])(inarray, output, NullNekDouble1DArray,
-                 NullNekDouble1DArray, wsp);
+    OperatorSharedPtr &oper = GetOperator(op);
+    Array<OneD, NekDouble> wsp(oper->GetWspSize());
+    (*oper)(inarray, output, NullNekDouble1DArray, NullNekDouble1DArray, wsp);
 }
 
 
@@ -114,8 +127,9 @@ inline void Collection::ApplyOperator(
               Array<OneD,       NekDouble> &output0,
               Array<OneD,       NekDouble> &output1)
 {
-    Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
-    (*m_ops[op])(inarray, output0, output1, NullNekDouble1DArray, wsp);
+    OperatorSharedPtr &oper = GetOperator(op);
+    Array<OneD, NekDouble> wsp(oper->GetWspSize());
+    (*oper)(inarray, output0, output1, NullNekDouble1DArray, wsp);
 }
 
 
@@ -129,13 +143,37 @@ inline void Collection::ApplyOperator(
               Array<OneD,       NekDouble> &output1,
               Array<OneD,       NekDouble> &output2)
 {
-    Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
-    (*m_ops[op])(inarray, output0, output1, output2, wsp);
+    OperatorSharedPtr &oper = GetOperator(op);
+    Array<OneD, NekDouble> wsp(oper->GetWspSize());
+    (*oper)(inarray, output0, output1, output2, wsp);
 }
 
 inline bool Collection::HasOperator(const OperatorType &op)
 {
-    return (m_ops.find(op) != m_ops.end());
+    return (m_ops.find(op) != m_ops.end() ||
+            m_deferredOps.find(op) != m_deferredOps.end());
+}
+
+inline void Collection::UpdateFactors(
+        const OperatorType                 &op,
+        const StdRegions::ConstFactorMap   &factors)
+{
+    GetOperator(op)->UpdateFactors(factors);
+}
+
+/**
+ * @brief Return the operator of the given type, creating it first if its
+ * construction was deferred.
+ */
+inline OperatorSharedPtr &Collection::GetOperator(const OperatorType &op)
+{
+    boost::unordered_map<OperatorType, OperatorSharedPtr>::iterator it =
+                                                            m_ops.find(op);
+    if (it != m_ops.end())
+    {
+        return it->second;
+    }
+    return (m_ops[op] = CreateDeferredOperator(op));
 }
 
 }
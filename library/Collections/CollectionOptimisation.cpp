@@ -33,8 +33,15 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <fstream>
+#include <set>
+#include <sstream>
+
+#include <boost/algorithm/string.hpp>
+
 #include <Collections/CollectionOptimisation.h>
 #include <LibUtilities/BasicUtils/ParseUtils.hpp>
+#include <LibUtilities/BasicConst/BuildId.h>
 
 namespace Nektar
 {
@@ -44,6 +51,75 @@ namespace Collections
 // static manager for Operator ImplementationMap
 map<OpImpTimingKey,OperatorImpMap> CollectionOptimisation::m_opImpMap;
 
+// static manager for the on-disk autotuning cache, indexed by file name
+map<string, map<string, OperatorImpMap> >
+                                CollectionOptimisation::m_cachedImpMap;
+
+// autotuning results not yet agreed between processes
+vector<CollectionOptimisation::PendingCacheEntry>
+                                CollectionOptimisation::m_pendingCache;
+
+/**
+ * @brief Return the model name of the host CPU, since autotuning results are
+ * not transferable between machines.
+ */
+static string GetCpuModel()
+{
+    static string model;
+
+    if (model.empty())
+    {
+        model = "unknown";
+
+        ifstream cpuinfo("/proc/cpuinfo");
+        string   line;
+        while (getline(cpuinfo, line))
+        {
+            if (boost::starts_with(line, "model name"))
+            {
+                size_t pos = line.find(':');
+                if (pos != string::npos)
+                {
+                    model = boost::trim_copy(line.substr(pos+1));
+                }
+                break;
+            }
+        }
+
+        // Separators used in the cache file must not appear in the key.
+        boost::replace_all(model, "|",  " ");
+        boost::replace_all(model, "\t", " ");
+    }
+
+    return model;
+}
+
+/**
+ * @brief Return a string identifying this build of the library, so that
+ * cached timings are discarded whenever the library sources or compiler
+ * flags change.
+ */
+static string GetBuildHash()
+{
+    return NekConstants::kBuildId;
+}
+
+/**
+ * @brief Pack a string into an array of unsigned integers for communication.
+ */
+static void PackString(const string &str, vector<unsigned int> &data)
+{
+    data.assign(str.begin(), str.end());
+}
+
+/**
+ * @brief Unpack a string packed by PackString.
+ */
+static string UnpackString(const vector<unsigned int> &data)
+{
+    return string(data.begin(), data.end());
+}
+
 CollectionOptimisation::CollectionOptimisation(
         LibUtilities::SessionReaderSharedPtr pSession,
         ImplementationType defaultType)
@@ -58,6 +134,8 @@ CollectionOptimisation::CollectionOptimisation(
 
     m_setByXml    = false;
     m_autotune    = false;
+    m_parallel    = (pSession.get()) &&
+                    (pSession->GetComm()->GetSize() > 1);
     m_maxCollSize = 0;
     m_defaultType = defaultType == eNoImpType ? eIterPerExp : defaultType;
 
@@ -168,6 +246,25 @@ CollectionOptimisation::CollectionOptimisation(
                 }
             }
 
+            // Autotuning results are cached on disk so that subsequent runs
+            // only need to time collections which have not been seen
+            // before. CACHE="none" disables the cache.
+            if (m_autotune)
+            {
+                const char *cacheFile = xmlCol->Attribute("CACHE");
+                m_cacheFile = (cacheFile ? string(cacheFile)
+                                         : string("collections.cache"));
+
+                if (boost::iequals(m_cacheFile, "none"))
+                {
+                    m_cacheFile = "";
+                }
+                else
+                {
+                    LoadCache();
+                }
+            }
+
             // Now process operator-specific implementation selections
             TiXmlElement *elmt = xmlCol->FirstChildElement();
             while (elmt)
@@ -310,6 +407,18 @@ OperatorImpMap  CollectionOptimisation::GetOperatorImpMap(
             impType = it2->second;
         }
 
+        // The interleaved kernels only exist for some shapes; fall back to
+        // the standard sum-factorisation operator for the others.
+        if (impType == eSumFacSIMD)
+        {
+            OperatorKey simdKey(pExp->DetShapeType(), it->first, impType,
+                                pExp->IsNodalNonTensorialExp());
+            if (!GetOperatorFactory().ModuleExists(simdKey))
+            {
+                impType = eSumFac;
+            }
+        }
+
         ret[it->first] = impType;
     }
 
@@ -333,6 +442,36 @@ OperatorImpMap CollectionOptimisation::SetWithTimings(
         return ret;
     }
 
+    // check to see if defined by a previous run
+    string cacheKey;
+    if (m_cacheFile.size())
+    {
+        cacheKey = GetCacheKey(pCollExp);
+
+        map<string, OperatorImpMap> &cache = m_cachedImpMap[m_cacheFile];
+        map<string, OperatorImpMap>::iterator cIt = cache.find(cacheKey);
+        if (cIt != cache.end())
+        {
+            ret = cIt->second;
+
+            if(verbose)
+            {
+                cout << "Collection Implemenation for "
+                     << LibUtilities::ShapeTypeMap[pExp->DetShapeType()]
+                     << " ( ";
+                for(int i = 0; i < pExp->GetNumBases(); ++i)
+                {
+                    cout << pExp->GetBasis(i)->GetNumModes() <<" ";
+                }
+                cout << ")" <<  " for ngeoms = " << pCollExp.size()
+                     << " read from " << m_cacheFile << endl;
+            }
+
+            m_opImpMap[OpKey] = ret;
+            return ret;
+        }
+    }
+
     int maxsize = pCollExp.size()*max(pExp->GetNcoeffs(),pExp->GetTotPoints());
     Array<OneD, NekDouble> inarray(maxsize,1.0);
     Array<OneD, NekDouble> outarray1(maxsize);
@@ -457,8 +596,317 @@ OperatorImpMap CollectionOptimisation::SetWithTimings(
 
     // store map for use by another expansion.
     m_opImpMap[OpKey] = ret;
+
+    // and for use by subsequent runs. In parallel, processes may time the
+    // same collection differently, so the result is only cached once the
+    // processes have agreed on it in SynchroniseCache.
+    if (m_cacheFile.size())
+    {
+        if (m_parallel)
+        {
+            m_pendingCache.push_back(
+                        PendingCacheEntry(m_cacheFile, cacheKey, OpKey, ret));
+        }
+        else
+        {
+            AppendToCache(m_cacheFile, cacheKey, ret);
+        }
+    }
+
     return ret;
 }
 
+/**
+ * @brief Construct the key under which the autotuning result for a
+ * collection is stored in the cache file.
+ *
+ * The key combines the host CPU model, the library build, the element shape
+ * and the basis keys of each direction. As for OpImpTimingKey, collections
+ * of 100 or more elements share a single entry.
+ */
+string CollectionOptimisation::GetCacheKey(
+        vector<StdRegions::StdExpansionSharedPtr> &pCollExp)
+{
+    StdRegions::StdExpansionSharedPtr pExp = pCollExp[0];
+    stringstream key;
+
+    key << GetCpuModel() << "|" << GetBuildHash() << "|"
+        << LibUtilities::ShapeTypeMap[pExp->DetShapeType()]
+        << (pExp->IsNodalNonTensorialExp() ? "-Nodal" : "");
+
+    for (int i = 0; i < pExp->GetNumBases(); ++i)
+    {
+        const LibUtilities::BasisKey &bkey = pExp->GetBasis(i)->GetBasisKey();
+        key << "|" << LibUtilities::BasisTypeMap[bkey.GetBasisType()]
+            << ":" << bkey.GetNumModes()
+            << ":" << LibUtilities::kPointsTypeStr[bkey.GetPointsType()]
+            << ":" << bkey.GetNumPoints();
+    }
+
+    if (pCollExp.size() < 100)
+    {
+        key << "|" << pCollExp.size();
+    }
+    else
+    {
+        key << "|100+";
+    }
+
+    return key.str();
+}
+
+/**
+ * @brief Read the cache file into #m_cachedImpMap.
+ *
+ * Each line of the file holds a key generated by GetCacheKey, a tab and a
+ * space-separated list of Operator=ImplementationType pairs. Entries which
+ * cannot be parsed, or which do not cover every operator, are ignored and
+ * will be re-tuned.
+ */
+void CollectionOptimisation::LoadCache()
+{
+    if (m_cachedImpMap.count(m_cacheFile) > 0)
+    {
+        return;
+    }
+
+    map<string, OperatorImpMap> &cache = m_cachedImpMap[m_cacheFile];
+
+    ifstream in(m_cacheFile.c_str());
+    string   line;
+    while (getline(in, line))
+    {
+        string         key;
+        OperatorImpMap impMap;
+        if (ParseCacheEntry(line, key, impMap))
+        {
+            cache[key] = impMap;
+        }
+    }
+}
+
+/**
+ * @brief Format a cache entry as a single line of the cache file, without
+ * the trailing newline.
+ */
+string CollectionOptimisation::FormatCacheEntry(
+        const string         &key,
+        const OperatorImpMap &impMap)
+{
+    stringstream entry;
+    entry << key << "\t";
+
+    OperatorImpMap::const_iterator it;
+    for (it = impMap.begin(); it != impMap.end(); ++it)
+    {
+        entry << " " << OperatorTypeMap[it->first] << "="
+              << ImplementationTypeMap[it->second];
+    }
+
+    return entry.str();
+}
+
+/**
+ * @brief Parse a line of the cache file. Returns false if the line cannot be
+ * parsed or does not cover every operator.
+ */
+bool CollectionOptimisation::ParseCacheEntry(
+        const string   &line,
+        string         &key,
+        OperatorImpMap &impMap)
+{
+    map<string, OperatorType> opTypes;
+    for (int i = 0; i < SIZE_OperatorType; ++i)
+    {
+        opTypes[OperatorTypeMap[i]] = (OperatorType)i;
+    }
+
+    map<string, ImplementationType> impTypes;
+    for (int i = 1; i < SIZE_ImplementationType; ++i)
+    {
+        impTypes[ImplementationTypeMap[i]] = (ImplementationType)i;
+    }
+
+    size_t pos = line.find('\t');
+    if (pos == string::npos)
+    {
+        return false;
+    }
+
+    vector<string> entries;
+    string         impStr = boost::trim_copy(line.substr(pos+1));
+    boost::split(entries, impStr, boost::is_any_of(" "),
+                 boost::token_compress_on);
+
+    impMap.clear();
+    bool valid = true;
+    for (int i = 0; i < entries.size() && valid; ++i)
+    {
+        size_t eq = entries[i].find('=');
+        valid = eq != string::npos &&
+                opTypes .count(entries[i].substr(0, eq)) > 0 &&
+                impTypes.count(entries[i].substr(eq+1))  > 0;
+
+        if (valid)
+        {
+            impMap[opTypes[entries[i].substr(0, eq)]] =
+                impTypes[entries[i].substr(eq+1)];
+        }
+    }
+
+    key = line.substr(0, pos);
+    return valid && impMap.size() == SIZE_OperatorType;
+}
+
+/**
+ * @brief Add an autotuning result to the cache and append it to the cache
+ * file. Each entry is written as a single line so that separate runs sharing
+ * the file do not corrupt it.
+ */
+void CollectionOptimisation::AppendToCache(
+        const string         &file,
+        const string         &key,
+        const OperatorImpMap &impMap)
+{
+    m_cachedImpMap[file][key] = impMap;
+
+    ofstream out(file.c_str(), ios::out | ios::app);
+    if (!out)
+    {
+        NEKERROR(ErrorUtil::ewarning,
+                 ("Unable to write collection cache file " + file).c_str());
+        return;
+    }
+
+    out << FormatCacheEntry(key, impMap) << endl;
+}
+
+/**
+ * @brief Agree on the autotuning results of a parallel run and add them to
+ * the cache.
+ *
+ * Each process may have timed different collections, and processes timing
+ * the same collection may choose different implementations. The pending
+ * results of all processes are gathered on rank 0, which keeps the result
+ * of the lowest rank for each key and appends the new entries to the cache
+ * file. The agreed results are then broadcast, and used for any subsequent
+ * collections of the same type on every process.
+ *
+ * This must be called collectively on @a pComm; it is called by
+ * EquationSystem once the fields have been set up. In serial, results are
+ * written directly and this has no effect.
+ */
+void CollectionOptimisation::SynchroniseCache(
+        const LibUtilities::CommSharedPtr &pComm)
+{
+    const int rank  = pComm->GetRank();
+    const int nProc = pComm->GetSize();
+
+    int nPending = m_pendingCache.size();
+    pComm->AllReduce(nPending, LibUtilities::ReduceSum);
+    if (nPending == 0)
+    {
+        return;
+    }
+
+    // Each pending entry is sent as a line holding the cache file name, a
+    // tab and the cache entry.
+    string local;
+    for (int i = 0; i < m_pendingCache.size(); ++i)
+    {
+        local += m_pendingCache[i].m_file + "\t"
+               + FormatCacheEntry(m_pendingCache[i].m_key,
+                                  m_pendingCache[i].m_impMap) + "\n";
+    }
+
+    vector<unsigned int> data;
+    if (rank == 0)
+    {
+        string all = local;
+        for (int p = 1; p < nProc; ++p)
+        {
+            vector<unsigned int> size(1);
+            pComm->Recv(p, size);
+
+            if (size[0] > 0)
+            {
+                vector<unsigned int> recv(size[0]);
+                pComm->Recv(p, recv);
+                all += UnpackString(recv);
+            }
+        }
+
+        // Keep the first result for each key, i.e. that of the lowest rank,
+        // and write the new entries.
+        stringstream         in(all);
+        string               line, agreed;
+        set<string>          seen;
+        while (getline(in, line))
+        {
+            size_t         pos  = line.find('\t');
+            string         file = line.substr(0, pos);
+            string         key;
+            OperatorImpMap impMap;
+
+            if (!ParseCacheEntry(line.substr(pos+1), key, impMap) ||
+                !seen.insert(file + "\t" + key).second)
+            {
+                continue;
+            }
+
+            if (m_cachedImpMap[file].count(key) == 0)
+            {
+                AppendToCache(file, key, impMap);
+            }
+            agreed += line + "\n";
+        }
+
+        PackString(agreed, data);
+    }
+    else
+    {
+        PackString(local, data);
+
+        vector<unsigned int> size(1, data.size());
+        pComm->Send(0, size);
+        if (size[0] > 0)
+        {
+            pComm->Send(0, data);
+        }
+    }
+
+    pComm->Bcast(data, 0);
+
+    // Use the agreed results from now on.
+    stringstream in(UnpackString(data));
+    string       line;
+    map<string, OperatorImpMap> agreed;
+    while (getline(in, line))
+    {
+        size_t         pos  = line.find('\t');
+        string         file = line.substr(0, pos);
+        string         key;
+        OperatorImpMap impMap;
+
+        if (ParseCacheEntry(line.substr(pos+1), key, impMap))
+        {
+            m_cachedImpMap[file][key] = impMap;
+            agreed[file + "\t" + key] = impMap;
+        }
+    }
+
+    for (int i = 0; i < m_pendingCache.size(); ++i)
+    {
+        map<string, OperatorImpMap>::iterator it = agreed.find(
+            m_pendingCache[i].m_file + "\t" + m_pendingCache[i].m_key);
+        if (it != agreed.end())
+        {
+            m_opImpMap[m_pendingCache[i].m_opKey] = it->second;
+        }
+    }
+
+    m_pendingCache.clear();
+}
+
 }
 }
@@ -151,15 +151,61 @@ class CollectionOptimisation
             return m_setByXml;
         }
 
+        /// Name of the on-disk autotuning cache, empty if not in use.
+        const string &GetCacheFile()
+        {
+            return m_cacheFile;
+        }
+
+        /// Agree on autotuning results across processes and cache them.
+        COLLECTIONS_EXPORT static void SynchroniseCache(
+                const LibUtilities::CommSharedPtr &pComm);
+
     private:
         typedef pair<LibUtilities::ShapeType, int> ElmtOrder;
 
+        /// Autotuning result awaiting agreement between processes.
+        struct PendingCacheEntry
+        {
+            PendingCacheEntry(const string         &pFile,
+                              const string         &pKey,
+                              const OpImpTimingKey &pOpKey,
+                              const OperatorImpMap &pImpMap)
+                : m_file(pFile), m_key(pKey), m_opKey(pOpKey),
+                  m_impMap(pImpMap)
+            {
+            }
+
+            string         m_file;
+            string         m_key;
+            OpImpTimingKey m_opKey;
+            OperatorImpMap m_impMap;
+        };
+
         static map<OpImpTimingKey,OperatorImpMap> m_opImpMap;
+        /// Autotuning results read from (or written to) each cache file.
+        static map<string, map<string, OperatorImpMap> > m_cachedImpMap;
+        /// Autotuning results not yet agreed between processes.
+        static vector<PendingCacheEntry> m_pendingCache;
+        string m_cacheFile;
+        bool m_parallel;
         map<OperatorType, map<ElmtOrder, ImplementationType> > m_global;
         bool m_setByXml;
         bool m_autotune;
         ImplementationType m_defaultType;
         unsigned int m_maxCollSize;
+
+        string GetCacheKey(
+                vector<StdRegions::StdExpansionSharedPtr> &pCollExp);
+        void LoadCache();
+        static string FormatCacheEntry(
+                const string &key, const OperatorImpMap &impMap);
+        static bool ParseCacheEntry(
+                const string &line, string &key, OperatorImpMap &impMap);
+        static void AppendToCache(
+                const string         &file,
+                const string         &key,
+                const OperatorImpMap &impMap);
 };
 
 }
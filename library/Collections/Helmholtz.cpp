@@ -0,0 +1,456 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: Helmholtz.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Helmholtz operator implementations
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <loki/Singleton.h>
+#include <Collections/Operator.h>
+#include <Collections/Collection.h>
+
+namespace Nektar {
+namespace Collections {
+
+using LibUtilities::eSegment;
+using LibUtilities::eQuadrilateral;
+using LibUtilities::eTriangle;
+using LibUtilities::eHexahedron;
+using LibUtilities::eTetrahedron;
+using LibUtilities::ePrism;
+using LibUtilities::ePyramid;
+
+/**
+ * @brief Helmholtz operator using LocalRegions implementation.
+ */
+class Helmholtz_NoCollection : public Operator
+{
+    public:
+        OPERATOR_CREATE(Helmholtz_NoCollection)
+
+        virtual ~Helmholtz_NoCollection()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            const int nCoeffs = m_expList[0]->GetNcoeffs();
+            Array<OneD, NekDouble> tmp;
+
+            for (int i = 0; i < m_numElmt; ++i)
+            {
+                StdRegions::StdMatrixKey mkey(StdRegions::eHelmholtz,
+                                              m_expList[i]->DetShapeType(),
+                                              *m_expList[i], m_factors);
+                m_expList[i]->GeneralMatrixOp(input + i*nCoeffs,
+                                              tmp = output + i*nCoeffs,
+                                              mkey);
+            }
+        }
+
+        virtual void UpdateFactors(StdRegions::ConstFactorMap factors)
+        {
+            m_factors = factors;
+        }
+
+    protected:
+        vector<StdRegions::StdExpansionSharedPtr> m_expList;
+        StdRegions::ConstFactorMap                m_factors;
+
+    private:
+        Helmholtz_NoCollection(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator(pCollExp, pGeomData)
+        {
+            m_expList = pCollExp;
+            m_factors[StdRegions::eFactorLambda] = 0.0;
+        }
+};
+
+/// Factory initialisation for the Helmholtz_NoCollection operators
+OperatorKey Helmholtz_NoCollection::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eHelmholtz, eNoCollection,false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eNoCollection,false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eNoCollection,true),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eHelmholtz, eNoCollection,false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eNoCollection,false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eNoCollection,true),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eHelmholtz, eNoCollection,false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eNoCollection,false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eNoCollection,true),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eHelmholtz, eNoCollection,false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Hex"),
+};
+
+
+/**
+ * @brief Matrix-free Helmholtz operator built from the other collection
+ * operators.
+ *
+ * The action \f$ (L + \lambda M) \hat{u} \f$ is evaluated as
+ * \f[ \sum_i (\partial_{x_i} \phi, \partial_{x_i} u) + \lambda (\phi, u) \f]
+ * by applying BwdTrans, PhysDeriv, IProductWRTDerivBase and
+ * IProductWRTBase operators of a single implementation type to the whole
+ * collection, so that no elemental matrices are formed.
+ */
+class Helmholtz_Helper : public Operator
+{
+    public:
+        virtual ~Helmholtz_Helper()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL1(wsp.num_elements() == m_wspSize,
+                     "Incorrect workspace size");
+
+            const int nPhys   = m_stdExp->GetTotPoints()*m_numElmt;
+            const int nCoeffs = m_stdExp->GetNcoeffs()   *m_numElmt;
+
+            Array<OneD, NekDouble> phys = wsp;
+            Array<OneD, NekDouble> tmp  = wsp + nPhys;
+            Array<OneD, Array<OneD, NekDouble> > deriv(3);
+            for (int i = 0; i < m_coordim; ++i)
+            {
+                deriv[i] = tmp + nCoeffs + i*nPhys;
+            }
+            // Shared by the sub-operators, each using its leading entries.
+            Array<OneD, NekDouble> opWsp = tmp + nCoeffs + m_coordim*nPhys;
+
+            // u = B u_hat
+            (*m_bwdTrans)(input, phys, NullNekDouble1DArray,
+                          NullNekDouble1DArray, opWsp);
+
+            // d u/d x_i
+            (*m_physDeriv)(phys, deriv[0], deriv[1], deriv[2], opWsp);
+
+            // sum_i (d phi/d x_i, d u/d x_i)
+            switch (m_coordim)
+            {
+                case 1:
+                    (*m_iprodDeriv)(deriv[0], output, NullNekDouble1DArray,
+                                    NullNekDouble1DArray, opWsp);
+                    break;
+                case 2:
+                    (*m_iprodDeriv)(deriv[0], deriv[1], output,
+                                    NullNekDouble1DArray, opWsp);
+                    break;
+                case 3:
+                    (*m_iprodDeriv)(deriv[0], deriv[1], deriv[2], output,
+                                    opWsp);
+                    break;
+                default:
+                    ASSERTL0(false, "Unknown coordinate dimension");
+            }
+
+            // lambda (phi, u)
+            if (m_lambda != 0.0)
+            {
+                (*m_iprod)(phys, tmp, NullNekDouble1DArray,
+                           NullNekDouble1DArray, opWsp);
+                Vmath::Svtvp(nCoeffs, m_lambda, tmp, 1, output, 1, output, 1);
+            }
+        }
+
+        virtual void UpdateFactors(StdRegions::ConstFactorMap factors)
+        {
+            StdRegions::ConstFactorMap::const_iterator x =
+                factors.find(StdRegions::eFactorLambda);
+            m_lambda = (x == factors.end()) ? 0.0 : x->second;
+        }
+
+    protected:
+        OperatorSharedPtr               m_bwdTrans;
+        OperatorSharedPtr               m_physDeriv;
+        OperatorSharedPtr               m_iprod;
+        OperatorSharedPtr               m_iprodDeriv;
+        NekDouble                       m_lambda;
+        int                             m_coordim;
+
+        Helmholtz_Helper(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData,
+                ImplementationType                        pImpType)
+            : Operator (pCollExp, pGeomData),
+              m_lambda (0.0),
+              m_coordim(pCollExp[0]->GetCoordim())
+        {
+            LibUtilities::ShapeType shape = pCollExp[0]->DetShapeType();
+            bool nodal = pCollExp[0]->IsNodalNonTensorialExp();
+
+            m_bwdTrans   = GetOperatorFactory().CreateInstance(
+                OperatorKey(shape, eBwdTrans, pImpType, nodal),
+                pCollExp, pGeomData);
+            m_physDeriv  = GetOperatorFactory().CreateInstance(
+                OperatorKey(shape, ePhysDeriv, pImpType, nodal),
+                pCollExp, pGeomData);
+            m_iprod      = GetOperatorFactory().CreateInstance(
+                OperatorKey(shape, eIProductWRTBase, pImpType, nodal),
+                pCollExp, pGeomData);
+            m_iprodDeriv = GetOperatorFactory().CreateInstance(
+                OperatorKey(shape, eIProductWRTDerivBase, pImpType, nodal),
+                pCollExp, pGeomData);
+
+            int maxWsp = max(max(m_bwdTrans ->GetWspSize(),
+                                 m_physDeriv->GetWspSize()),
+                             max(m_iprod     ->GetWspSize(),
+                                 m_iprodDeriv->GetWspSize()));
+
+            m_wspSize = m_numElmt*((m_coordim+1)*m_stdExp->GetTotPoints()
+                                   + m_stdExp->GetNcoeffs()) + maxWsp;
+        }
+};
+
+
+/**
+ * @brief Helmholtz operator using standard matrix approach
+ */
+class Helmholtz_StdMat : public Helmholtz_Helper
+{
+    public:
+        OPERATOR_CREATE(Helmholtz_StdMat)
+
+        virtual ~Helmholtz_StdMat()
+        {
+        }
+
+    private:
+        Helmholtz_StdMat(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Helmholtz_Helper(pCollExp, pGeomData, eStdMat)
+        {
+        }
+};
+
+/// Factory initialisation for the Helmholtz_StdMat operators
+OperatorKey Helmholtz_StdMat::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eHelmholtz, eStdMat,false),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eStdMat,false),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eStdMat,true),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eHelmholtz, eStdMat,false),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eStdMat,false),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eStdMat,true),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eHelmholtz, eStdMat,false),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eStdMat,false),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eStdMat,true),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eHelmholtz, eStdMat,false),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_Hex"),
+};
+
+
+/**
+ * @brief Helmholtz operator using element-wise operation
+ */
+class Helmholtz_IterPerExp : public Helmholtz_Helper
+{
+    public:
+        OPERATOR_CREATE(Helmholtz_IterPerExp)
+
+        virtual ~Helmholtz_IterPerExp()
+        {
+        }
+
+    private:
+        Helmholtz_IterPerExp(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Helmholtz_Helper(pCollExp, pGeomData, eIterPerExp)
+        {
+        }
+};
+
+/// Factory initialisation for the Helmholtz_IterPerExp operators
+OperatorKey Helmholtz_IterPerExp::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eHelmholtz, eIterPerExp,false),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eIterPerExp,false),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eIterPerExp,true),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eHelmholtz, eIterPerExp,false),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eIterPerExp,false),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eIterPerExp,true),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eHelmholtz, eIterPerExp,false),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eIterPerExp,false),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eIterPerExp,true),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eHelmholtz, eIterPerExp,false),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_Hex"),
+};
+
+
+/**
+ * @brief Helmholtz operator using sum-factorisation
+ */
+class Helmholtz_SumFac : public Helmholtz_Helper
+{
+    public:
+        OPERATOR_CREATE(Helmholtz_SumFac)
+
+        virtual ~Helmholtz_SumFac()
+        {
+        }
+
+    private:
+        Helmholtz_SumFac(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Helmholtz_Helper(pCollExp, pGeomData, eSumFac)
+        {
+        }
+};
+
+/// Factory initialisation for the Helmholtz_SumFac operators
+OperatorKey Helmholtz_SumFac::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eHelmholtz, eSumFac,false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eSumFac,false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eHelmholtz, eSumFac,false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eSumFac,false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eSumFac,false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eHelmholtz, eSumFac,false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eHelmholtz, eSumFac,false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Hex"),
+};
+
+
+/**
+ * @brief Helmholtz operator using sum-factorisation on blocks of interleaved
+ * elements
+ */
+class Helmholtz_SumFacSIMD : public Helmholtz_Helper
+{
+    public:
+        OPERATOR_CREATE(Helmholtz_SumFacSIMD)
+
+        virtual ~Helmholtz_SumFacSIMD()
+        {
+        }
+
+    private:
+        Helmholtz_SumFacSIMD(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Helmholtz_Helper(pCollExp, pGeomData, eSumFacSIMD)
+        {
+        }
+};
+
+/// Factory initialisation for the Helmholtz_SumFacSIMD operators
+OperatorKey Helmholtz_SumFacSIMD::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eHelmholtz, eSumFacSIMD,false),
+        Helmholtz_SumFacSIMD::create, "Helmholtz_SumFacSIMD_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eHelmholtz, eSumFacSIMD,false),
+        Helmholtz_SumFacSIMD::create, "Helmholtz_SumFacSIMD_Hex"),
+};
+
+}
+}
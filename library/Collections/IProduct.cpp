@@ -49,7 +49,7 @@ void QuadIProduct(bool colldir0, bool colldir1, int numElmt,
                   int  nmodes0,  int  nmodes1,
                   const Array<OneD, const NekDouble> &base0,
                   const Array<OneD, const NekDouble> &base1,
-                  const Array<OneD, const NekDouble> &jac,
+                  const CompactGeomDataSharedPtr     &jac,
                   const Array<OneD, const NekDouble> &input,
                   Array<OneD, NekDouble> &output,
                   Array<OneD, NekDouble> &wsp)
@@ -57,7 +57,7 @@ void QuadIProduct(bool colldir0, bool colldir1, int numElmt,
     int totpoints = nquad0*nquad1;
     int totmodes  = nmodes0*nmodes1;
 
-    Vmath::Vmul(numElmt*totpoints,jac,1,input,1,wsp,1);
+    jac->Vmul(0, input.get(), wsp.get());
 
     if(colldir0 && colldir1)
     {
@@ -134,7 +134,7 @@ void TriIProduct(bool sortTopVertex, int numElmt, int  nquad0,
                  int nquad1, int nmodes0, int  nmodes1,
                  const Array<OneD, const NekDouble> &base0,
                  const Array<OneD, const NekDouble> &base1,
-                 const Array<OneD, const NekDouble> &jac,
+                 const CompactGeomDataSharedPtr     &jac,
                  const Array<OneD, const NekDouble> &input,
                  Array<OneD, NekDouble> &output,
                  Array<OneD, NekDouble> &wsp)
@@ -143,7 +143,7 @@ void TriIProduct(bool sortTopVertex, int numElmt, int  nquad0,
                                                     nmodes0, nmodes1);
     int totpoints = nquad0*nquad1;
 
-    Vmath::Vmul(numElmt*totpoints,jac,1,input,1,wsp,1);
+    jac->Vmul(0, input.get(), wsp.get());
 
     Array<OneD, NekDouble> wsp1 = wsp + max(totpoints,totmodes)*numElmt;
 
@@ -180,7 +180,7 @@ void HexIProduct(bool colldir0, bool colldir1, bool colldir2, int numElmt,
                  const Array<OneD, const NekDouble> &base0,
                  const Array<OneD, const NekDouble> &base1,
                  const Array<OneD, const NekDouble> &base2,
-                 const Array<OneD, const NekDouble> &jac,
+                 const CompactGeomDataSharedPtr     &jac,
                  const Array<OneD, const NekDouble> &input,
                  Array<OneD, NekDouble> &output,
                  Array<OneD, NekDouble> &wsp)
@@ -192,11 +192,11 @@ void HexIProduct(bool colldir0, bool colldir1, bool colldir2, int numElmt,
     if(colldir0 && colldir1 && colldir2)
     {
 
-        Vmath::Vmul(numElmt*totpoints,jac,1,input,1,output,1);
+        jac->Vmul(0, input.get(), output.get());
     }
     else
     {
-        Vmath::Vmul(numElmt*totpoints,jac,1,input,1,wsp,1);
+        jac->Vmul(0, input.get(), wsp.get());
 
         // Assign second half of workspace for 2nd DGEMM operation.
         Array<OneD, NekDouble> wsp1 = wsp  + totpoints*numElmt;
@@ -357,7 +357,7 @@ void PrismIProduct(bool sortTopVertex, int numElmt,
                  const Array<OneD, const NekDouble> &base0,
                  const Array<OneD, const NekDouble> &base1,
                  const Array<OneD, const NekDouble> &base2,
-                 const Array<OneD, const NekDouble> &jac,
+                 const CompactGeomDataSharedPtr     &jac,
                  const Array<OneD, const NekDouble> &input,
                  Array<OneD, NekDouble> &output,
                  Array<OneD, NekDouble> &wsp)
@@ -368,7 +368,7 @@ void PrismIProduct(bool sortTopVertex, int numElmt,
     int cnt;
     int mode, mode1;
 
-    Vmath::Vmul(numElmt*totpoints,jac,1,input,1,wsp,1);
+    jac->Vmul(0, input.get(), wsp.get());
 
     Array<OneD, NekDouble> wsp1 = wsp + numElmt * nquad2
                                                 * (max(nquad0*nquad1,
@@ -429,7 +429,7 @@ void TetIProduct(bool sortTopEdge, int numElmt,
                  const Array<OneD, const NekDouble> &base0,
                  const Array<OneD, const NekDouble> &base1,
                  const Array<OneD, const NekDouble> &base2,
-                 const Array<OneD, const NekDouble> &jac,
+                 const CompactGeomDataSharedPtr     &jac,
                  const Array<OneD, const NekDouble> &input,
                  Array<OneD, NekDouble> &output,
                  Array<OneD, NekDouble> &wsp)
@@ -440,7 +440,7 @@ void TetIProduct(bool sortTopEdge, int numElmt,
     int cnt;
     int mode, mode1;
 
-    Vmath::Vmul(numElmt*totpoints,jac,1,input,1,wsp,1);
+    jac->Vmul(0, input.get(), wsp.get());
 
     Array<OneD, NekDouble> wsp1 = wsp +
         nquad2*numElmt*(max(nquad0*nquad1,nmodes0*(2*nmodes1-nmodes0+1)/2));
@@ -517,5 +517,102 @@ void TetIProduct(bool sortTopEdge, int numElmt,
 
 }
 
+
+/**
+ * Sum-factorised inner product over a collection of pyramids. Since the
+ * pyramidal modes are not ordered hierarchically, the final summation over
+ * the '2' direction is carried out for each \f$ (p,q) \f$ pair using the
+ * mode map supplied by StdPyrExp::GetSumFacModeMap. The workspace must be of
+ * size numElmt*(max(nquad0*nquad1, nmodes0*nmodes1)*nquad2 +
+ * nmodes0*nquad1*nquad2 + nmodes2) + nquad2*nmodes2.
+ */
+void PyrIProduct(int numElmt,
+                 int nquad0,  int  nquad1,  int nquad2,
+                 int nmodes0, int  nmodes1, int nmodes2,
+                 const Array<OneD, const int>       &nModesPQ,
+                 const Array<OneD, const int>       &coeffMap,
+                 const Array<OneD, const int>       &zModeMap,
+                 const Array<OneD, const NekDouble> &base0,
+                 const Array<OneD, const NekDouble> &base1,
+                 const Array<OneD, const NekDouble> &base2,
+                 const CompactGeomDataSharedPtr     &jac,
+                 const Array<OneD, const NekDouble> &input,
+                 Array<OneD, NekDouble> &output,
+                 Array<OneD, NekDouble> &wsp)
+{
+    int totmodes  = LibUtilities::StdPyrData::getNumberOfCoefficients(
+                                                    nmodes0,nmodes1,nmodes2);
+    int totpoints = nquad0*nquad1*nquad2;
+
+    ASSERTL1(nModesPQ.num_elements() == nmodes0*nmodes1,
+             "Pyramid mode map does not contain all (p,q) pairs");
+
+    jac->Vmul(0, input.get(), wsp.get());
+
+    Array<OneD, NekDouble> wsp1 = wsp +
+        nquad2*numElmt*(max(nquad0*nquad1,nmodes0*nmodes1));
+    Array<OneD, NekDouble> wsp2 = wsp1 + nmodes0*nquad1*nquad2*numElmt;
+    Array<OneD, NekDouble> wsp3 = wsp2 + nmodes2*numElmt;
+
+    // Perform iproduct  with respect to the  '0' direction
+    Blas::Dgemm('T', 'N', nquad1*nquad2*numElmt, nmodes0, nquad0,
+                1.0, wsp.get(), nquad0, base0.get(),
+                nquad0, 0.0, wsp1.get(), nquad1*nquad2*numElmt);
+
+    // Inner product with respect to the '1' direction
+    for(int i = 0; i < nmodes0; ++i)
+    {
+        Blas::Dgemm('T', 'N', nquad2*numElmt, nmodes1, nquad1,
+                    1.0, wsp1.get() + i*nquad1*nquad2*numElmt, nquad1,
+                    base1.get(), nquad1,
+                    0.0, wsp.get() + i*nmodes1*nquad2*numElmt,
+                    nquad2*numElmt);
+    }
+
+    // Inner product with respect to the '2' direction. For each (p,q) pair
+    // gather the required columns of base2 into wsp3, evaluate the inner
+    // products into wsp2 and scatter them into the output.
+    int mode = 0;
+    for(int i = 0; i < nmodes0*nmodes1; ++i)
+    {
+        int nr = nModesPQ[i];
+
+        for(int r = 0; r < nr; ++r)
+        {
+            Vmath::Vcopy(nquad2, base2.get() + zModeMap[mode+r]*nquad2, 1,
+                                 wsp3.get()  + r*nquad2,                1);
+        }
+
+        Blas::Dgemm('T', 'N', nr, numElmt, nquad2,
+                    1.0, wsp3.get(), nquad2,
+                         wsp.get() + i*nquad2*numElmt, nquad2,
+                    0.0, wsp2.get(), nr);
+
+        for(int r = 0; r < nr; ++r)
+        {
+            Vmath::Vcopy(numElmt, wsp2.get()   + r,              nr,
+                                  output.get() + coeffMap[mode+r], totmodes);
+        }
+
+        mode += nr;
+    }
+
+    // fix for modified basis for top singular vertex component. The
+    // (1+c)/2 (1-b)/2 (1-a)/2 component has already been evaluated, so add
+    // in the (p,q) = (0,1), (1,0) and (1,1) components.
+    for(int n = 0; n < numElmt; ++n)
+    {
+        output[4+n*totmodes] += Blas::Ddot(nquad2,
+                         base2.get()+nquad2,1,
+                         &wsp[nquad2*numElmt + n*nquad2],1);
+        output[4+n*totmodes] += Blas::Ddot(nquad2,
+                         base2.get()+nquad2,1,
+                         &wsp[nmodes1*nquad2*numElmt + n*nquad2],1);
+        output[4+n*totmodes] += Blas::Ddot(nquad2,
+                         base2.get()+nquad2,1,
+                         &wsp[(nmodes1+1)*nquad2*numElmt + n*nquad2],1);
+    }
+}
+
 }
 }
@@ -36,6 +36,8 @@
 #ifndef NEKTAR_LIBRARY_COLLECTIONS_IPRODUCT_H
 #define NEKTAR_LIBRARY_COLLECTIONS_IPRODUCT_H
 
+#include <Collections/CoalescedGeomData.h>
+
 namespace Nektar
 {
 namespace Collections
@@ -46,7 +48,7 @@ void QuadIProduct(bool colldir0, bool colldir1, int numElmt,
                   int  nmodes0,  int  nmodes1,
                   const Array<OneD, const NekDouble> &base0,
                   const Array<OneD, const NekDouble> &base1,
-                  const Array<OneD, const NekDouble> &jac,
+                  const CompactGeomDataSharedPtr     &jac,
                   const Array<OneD, const NekDouble> &input,
                   Array<OneD, NekDouble> &output,
                   Array<OneD, NekDouble> &wsp);
@@ -55,7 +57,7 @@ void TriIProduct(bool sortTopVertex, int numElmt, int  nquad0,
                  int nquad1, int nmodes0, int  nmodes1,
                  const Array<OneD, const NekDouble> &base0,
                  const Array<OneD, const NekDouble> &base1,
-                 const Array<OneD, const NekDouble> &jac,
+                 const CompactGeomDataSharedPtr     &jac,
                  const Array<OneD, const NekDouble> &input,
                  Array<OneD, NekDouble> &output,
                  Array<OneD, NekDouble> &wsp);
@@ -66,7 +68,7 @@ void HexIProduct(bool colldir0, bool colldir1, bool colldir2, int numElmt,
                  const Array<OneD, const NekDouble> &base0,
                  const Array<OneD, const NekDouble> &base1,
                  const Array<OneD, const NekDouble> &base2,
-                 const Array<OneD, const NekDouble> &jac,
+                 const CompactGeomDataSharedPtr     &jac,
                  const Array<OneD, const NekDouble> &input,
                  Array<OneD, NekDouble> &output,
                  Array<OneD, NekDouble> &wsp);
@@ -77,7 +79,7 @@ void PrismIProduct(bool sortTopVert, int numElmt,
                  const Array<OneD, const NekDouble> &base0,
                  const Array<OneD, const NekDouble> &base1,
                  const Array<OneD, const NekDouble> &base2,
-                 const Array<OneD, const NekDouble> &jac,
+                 const CompactGeomDataSharedPtr     &jac,
                  const Array<OneD, const NekDouble> &input,
                  Array<OneD, NekDouble> &output,
                    Array<OneD, NekDouble> &wsp);
@@ -88,7 +90,21 @@ void TetIProduct(bool sortTopEdge, int numElmt,
                  const Array<OneD, const NekDouble> &base0,
                  const Array<OneD, const NekDouble> &base1,
                  const Array<OneD, const NekDouble> &base2,
-                 const Array<OneD, const NekDouble> &jac,
+                 const CompactGeomDataSharedPtr     &jac,
+                 const Array<OneD, const NekDouble> &input,
+                 Array<OneD, NekDouble> &output,
+                 Array<OneD, NekDouble> &wsp);
+
+void PyrIProduct(int numElmt,
+                 int  nquad0,   int  nquad1,   int  nquad2,
+                 int  nmodes0,  int  nmodes1,  int  nmodes2,
+                 const Array<OneD, const int>       &nModesPQ,
+                 const Array<OneD, const int>       &coeffMap,
+                 const Array<OneD, const int>       &zModeMap,
+                 const Array<OneD, const NekDouble> &base0,
+                 const Array<OneD, const NekDouble> &base1,
+                 const Array<OneD, const NekDouble> &base2,
+                 const CompactGeomDataSharedPtr     &jac,
                  const Array<OneD, const NekDouble> &input,
                  Array<OneD, NekDouble> &output,
                  Array<OneD, NekDouble> &wsp);
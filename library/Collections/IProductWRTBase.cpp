@@ -37,6 +37,8 @@
 #include <Collections/Operator.h>
 #include <Collections/Collection.h>
 #include <Collections/IProduct.h>
+#include <Collections/SumFacSIMD.h>
+#include <StdRegions/StdPyrExp.h>
 
 namespace Nektar {
 namespace Collections {
@@ -68,10 +70,10 @@ class IProductWRTBase_StdMat : public Operator
                       Array<OneD,       NekDouble> &output2,
                       Array<OneD,       NekDouble> &wsp)
         {
-            ASSERTL1(wsp.num_elements() == m_wspSize,
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
                      "Incorrect workspace size");
 
-            Vmath::Vmul(m_jac.num_elements(),m_jac,1,input,1,wsp,1);
+            m_jac->Vmul(0, input.get(), wsp.get());
 
             Blas::Dgemm('N', 'N', m_mat->GetRows(), m_numElmt,
                         m_mat->GetColumns(), 1.0, m_mat->GetRawPtr(),
@@ -81,7 +83,7 @@ class IProductWRTBase_StdMat : public Operator
 
     protected:
         DNekMatSharedPtr                m_mat;
-        Array<OneD, const NekDouble>    m_jac;
+        CompactGeomDataSharedPtr        m_jac;
 
     private:
         IProductWRTBase_StdMat(
@@ -89,7 +91,7 @@ class IProductWRTBase_StdMat : public Operator
                 CoalescedGeomDataSharedPtr                pGeomData)
             : Operator(pCollExp, pGeomData)
         {
-            m_jac = pGeomData->GetJac(pCollExp);
+            m_jac = pGeomData->GetCompactJac(pCollExp);
             StdRegions::StdMatrixKey key(StdRegions::eIProductWRTBase,
                                          m_stdExp->DetShapeType(), *m_stdExp);
             m_mat = m_stdExp->GetStdMatrix(key);
@@ -151,14 +153,14 @@ class IProductWRTBase_IterPerExp : public Operator
                       Array<OneD,       NekDouble> &output2,
                       Array<OneD,       NekDouble> &wsp)
         {
-            ASSERTL1(wsp.num_elements() == m_wspSize,
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
                      "Incorrect workspace size");
 
             const int nCoeffs = m_stdExp->GetNcoeffs();
             const int nPhys   = m_stdExp->GetTotPoints();
             Array<OneD, NekDouble> tmp;
 
-            Vmath::Vmul(m_jac.num_elements(),m_jac,1,input,1,wsp,1);
+            m_jac->Vmul(0, input.get(), wsp.get());
 
             for (int i = 0; i < m_numElmt; ++i)
             {
@@ -169,7 +171,7 @@ class IProductWRTBase_IterPerExp : public Operator
         }
 
     protected:
-        Array<OneD, NekDouble> m_jac;
+        CompactGeomDataSharedPtr m_jac;
 
     private:
         IProductWRTBase_IterPerExp(
@@ -184,7 +186,7 @@ class IProductWRTBase_IterPerExp : public Operator
                 nqtot *= PtsKey[i].GetNumPoints();
             }
 
-            m_jac = pGeomData->GetJacWithStdWeights(pCollExp);
+            m_jac = pGeomData->GetCompactJacWithStdWeights(pCollExp);
 
             m_wspSize = nqtot*m_numElmt;
         }
@@ -348,11 +350,11 @@ class IProductWRTBase_SumFac_Seg : public Operator
 
             if(m_colldir0)
             {
-                Vmath::Vmul(m_numElmt*m_nquad0,m_jac,1,input,1,output,1);
+                m_jac->Vmul(0, input.get(), output.get());
             }
             else
             {
-                Vmath::Vmul(m_numElmt*m_nquad0,m_jac,1,input,1,wsp,1);
+                m_jac->Vmul(0, input.get(), wsp.get());
 
                 // out = B0*in;
                 Blas::Dgemm('T','N', m_nmodes0, m_numElmt, m_nquad0,
@@ -366,7 +368,7 @@ class IProductWRTBase_SumFac_Seg : public Operator
         const int                       m_nquad0;
         const int                       m_nmodes0;
         const bool                      m_colldir0;
-        Array<OneD, const NekDouble>    m_jac;
+        CompactGeomDataSharedPtr        m_jac;
         Array<OneD, const NekDouble>    m_base0;
 
     private:
@@ -380,7 +382,7 @@ class IProductWRTBase_SumFac_Seg : public Operator
               m_base0   (m_stdExp->GetBasis(0)->GetBdata())
         {
             m_wspSize = m_numElmt*m_nquad0;
-            m_jac = pGeomData->GetJacWithStdWeights(pCollExp);
+            m_jac = pGeomData->GetCompactJacWithStdWeights(pCollExp);
         }
 };
 
@@ -410,7 +412,7 @@ class IProductWRTBase_SumFac_Quad : public Operator
                                 Array<OneD,       NekDouble> &output2,
                                 Array<OneD,       NekDouble> &wsp)
         {
-            ASSERTL1(wsp.num_elements() == m_wspSize,
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
                      "Incorrect workspace size");
 
             QuadIProduct(m_colldir0,m_colldir1,m_numElmt,
@@ -427,7 +429,7 @@ class IProductWRTBase_SumFac_Quad : public Operator
         const int                       m_nmodes1;
         const bool                      m_colldir0;
         const bool                      m_colldir1;
-        Array<OneD, const NekDouble>    m_jac;
+        CompactGeomDataSharedPtr        m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
 
@@ -445,7 +447,7 @@ class IProductWRTBase_SumFac_Quad : public Operator
               m_base0   (m_stdExp->GetBasis(0)->GetBdata()),
               m_base1   (m_stdExp->GetBasis(1)->GetBdata())
         {
-            m_jac     = pGeomData->GetJacWithStdWeights(pCollExp);
+            m_jac     = pGeomData->GetCompactJacWithStdWeights(pCollExp);
             m_wspSize = 2 * m_numElmt
                           * (max(m_nquad0*m_nquad1,m_nmodes0*m_nmodes1));
         }
@@ -477,7 +479,7 @@ class IProductWRTBase_SumFac_Tri : public Operator
                       Array<OneD,       NekDouble> &output2,
                       Array<OneD,       NekDouble> &wsp)
         {
-            ASSERTL1(wsp.num_elements() == m_wspSize,
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
                      "Incorrect workspace size");
 
             TriIProduct(m_sortTopVertex, m_numElmt, m_nquad0, m_nquad1,
@@ -490,7 +492,7 @@ class IProductWRTBase_SumFac_Tri : public Operator
         const int                       m_nquad1;
         const int                       m_nmodes0;
         const int                       m_nmodes1;
-        Array<OneD, const NekDouble>    m_jac;
+        CompactGeomDataSharedPtr        m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
         bool                            m_sortTopVertex;
@@ -507,7 +509,7 @@ class IProductWRTBase_SumFac_Tri : public Operator
               m_base0   (m_stdExp->GetBasis(0)->GetBdata()),
               m_base1   (m_stdExp->GetBasis(1)->GetBdata())
         {
-            m_jac     = pGeomData->GetJacWithStdWeights(pCollExp);
+            m_jac     = pGeomData->GetCompactJacWithStdWeights(pCollExp);
             m_wspSize = 2 * m_numElmt
                           * (max(m_nquad0*m_nquad1,m_nmodes0*m_nmodes1));
             if(m_stdExp->GetBasis(0)->GetBasisType()
@@ -549,7 +551,7 @@ class IProductWRTBase_SumFac_Hex : public Operator
                       Array<OneD, NekDouble> &wsp)
         {
 
-            ASSERTL1(wsp.num_elements() == m_wspSize,
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
                      "Incorrect workspace size");
 
             HexIProduct(m_colldir0,m_colldir1,m_colldir2, m_numElmt,
@@ -569,7 +571,7 @@ class IProductWRTBase_SumFac_Hex : public Operator
         const bool                      m_colldir0;
         const bool                      m_colldir1;
         const bool                      m_colldir2;
-        Array<OneD, const NekDouble>    m_jac;
+        CompactGeomDataSharedPtr        m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
         Array<OneD, const NekDouble>    m_base2;
@@ -593,7 +595,7 @@ class IProductWRTBase_SumFac_Hex : public Operator
               m_base2    (m_stdExp->GetBasis(2)->GetBdata())
 
         {
-            m_jac = pGeomData->GetJacWithStdWeights(pCollExp);
+            m_jac = pGeomData->GetCompactJacWithStdWeights(pCollExp);
             m_wspSize = 3 * m_numElmt * (max(m_nquad0*m_nquad1*m_nquad2,
                                              m_nmodes0*m_nmodes1*m_nmodes2));
         }
@@ -626,7 +628,7 @@ class IProductWRTBase_SumFac_Tet : public Operator
                       Array<OneD,       NekDouble> &output2,
                       Array<OneD,       NekDouble> &wsp)
         {
-            ASSERTL1(wsp.num_elements() == m_wspSize,
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
                     "Incorrect workspace size");
 
             TetIProduct(m_sortTopEdge, m_numElmt,
@@ -644,7 +646,7 @@ class IProductWRTBase_SumFac_Tet : public Operator
         const int                       m_nmodes0;
         const int                       m_nmodes1;
         const int                       m_nmodes2;
-        Array<OneD, const NekDouble>    m_jac;
+        CompactGeomDataSharedPtr        m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
         Array<OneD, const NekDouble>    m_base2;
@@ -665,7 +667,7 @@ class IProductWRTBase_SumFac_Tet : public Operator
               m_base1   (m_stdExp->GetBasis(1)->GetBdata()),
               m_base2   (m_stdExp->GetBasis(2)->GetBdata())
         {
-            m_jac     = pGeomData->GetJacWithStdWeights(pCollExp);
+            m_jac     = pGeomData->GetCompactJacWithStdWeights(pCollExp);
             m_wspSize = m_numElmt*(max(m_nquad0*m_nquad1*m_nquad2,
                         m_nquad2*m_nmodes0*(2*m_nmodes1-m_nmodes0+1)/2)+
                                    m_nquad2*m_nquad1*m_nmodes0);
@@ -710,7 +712,7 @@ class IProductWRTBase_SumFac_Prism : public Operator
                       Array<OneD, NekDouble> &wsp)
         {
 
-            ASSERTL1(wsp.num_elements() == m_wspSize,
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
                     "Incorrect workspace size");
 
             PrismIProduct(m_sortTopVertex, m_numElmt,
@@ -727,7 +729,7 @@ class IProductWRTBase_SumFac_Prism : public Operator
         const int                       m_nmodes0;
         const int                       m_nmodes1;
         const int                       m_nmodes2;
-        Array<OneD, const NekDouble>    m_jac;
+        CompactGeomDataSharedPtr        m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
         Array<OneD, const NekDouble>    m_base2;
@@ -749,7 +751,7 @@ class IProductWRTBase_SumFac_Prism : public Operator
               m_base2    (m_stdExp->GetBasis(2)->GetBdata())
 
         {
-            m_jac = pGeomData->GetJacWithStdWeights(pCollExp);
+            m_jac = pGeomData->GetCompactJacWithStdWeights(pCollExp);
 
             m_wspSize = m_numElmt * m_nquad2
                                   *(max(m_nquad0*m_nquad1,m_nmodes0*m_nmodes1))
@@ -773,5 +775,175 @@ OperatorKey IProductWRTBase_SumFac_Prism::m_type = GetOperatorFactory().
         OperatorKey(ePrism, eIProductWRTBase, eSumFac,false),
         IProductWRTBase_SumFac_Prism::create, "IProductWRTBase_SumFac_Prism");
 
+
+/**
+ * @brief Inner product operator using sum-factorisation (Pyr)
+ */
+class IProductWRTBase_SumFac_Pyr : public Operator
+{
+    public:
+        OPERATOR_CREATE(IProductWRTBase_SumFac_Pyr)
+
+        virtual ~IProductWRTBase_SumFac_Pyr()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD, NekDouble> &output,
+                      Array<OneD, NekDouble> &output1,
+                      Array<OneD, NekDouble> &output2,
+                      Array<OneD, NekDouble> &wsp)
+        {
+
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
+                    "Incorrect workspace size");
+
+            PyrIProduct(m_numElmt,
+                        m_nquad0,  m_nquad1,  m_nquad2,
+                        m_nmodes0, m_nmodes1, m_nmodes2,
+                        m_nModesPQ, m_coeffMap, m_zModeMap,
+                        m_base0,   m_base1,   m_base2,
+                        m_jac,input,output,wsp);
+        }
+
+    protected:
+        const int                       m_nquad0;
+        const int                       m_nquad1;
+        const int                       m_nquad2;
+        const int                       m_nmodes0;
+        const int                       m_nmodes1;
+        const int                       m_nmodes2;
+        CompactGeomDataSharedPtr        m_jac;
+        Array<OneD, const NekDouble>    m_base0;
+        Array<OneD, const NekDouble>    m_base1;
+        Array<OneD, const NekDouble>    m_base2;
+        Array<OneD, int>                m_nModesPQ;
+        Array<OneD, int>                m_coeffMap;
+        Array<OneD, int>                m_zModeMap;
+
+    private:
+        IProductWRTBase_SumFac_Pyr(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator  (pCollExp, pGeomData),
+              m_nquad0  (m_stdExp->GetNumPoints(0)),
+              m_nquad1  (m_stdExp->GetNumPoints(1)),
+              m_nquad2  (m_stdExp->GetNumPoints(2)),
+              m_nmodes0 (m_stdExp->GetBasisNumModes(0)),
+              m_nmodes1 (m_stdExp->GetBasisNumModes(1)),
+              m_nmodes2 (m_stdExp->GetBasisNumModes(2)),
+              m_base0    (m_stdExp->GetBasis(0)->GetBdata()),
+              m_base1    (m_stdExp->GetBasis(1)->GetBdata()),
+              m_base2    (m_stdExp->GetBasis(2)->GetBdata())
+
+        {
+            m_jac = pGeomData->GetCompactJacWithStdWeights(pCollExp);
+
+            StdRegions::StdPyrExpSharedPtr pyr =
+                boost::dynamic_pointer_cast<StdRegions::StdPyrExp>(m_stdExp);
+            ASSERTL0(pyr, "Expected a pyramid expansion");
+            pyr->GetSumFacModeMap(m_nModesPQ, m_coeffMap, m_zModeMap);
+
+            m_wspSize = m_numElmt * m_nquad2
+                                  *(max(m_nquad0*m_nquad1,m_nmodes0*m_nmodes1))
+                      + m_nquad1*m_nquad2*m_numElmt*m_nmodes0
+                      + m_nmodes2*(m_numElmt + m_nquad2);
+        }
+};
+
+/// Factory initialisation for the IProductWRTBase_SumFac_Pyr operator
+OperatorKey IProductWRTBase_SumFac_Pyr::m_type = GetOperatorFactory().
+    RegisterCreatorFunction(
+        OperatorKey(ePyramid, eIProductWRTBase, eSumFac,false),
+        IProductWRTBase_SumFac_Pyr::create, "IProductWRTBase_SumFac_Pyr");
+
+
+/**
+ * @brief Inner product operator using sum-factorisation on blocks of
+ * interleaved elements (Quad, Hex)
+ */
+class IProductWRTBase_SumFacSIMD : public Operator
+{
+    public:
+        OPERATOR_CREATE(IProductWRTBase_SumFacSIMD)
+
+        virtual ~IProductWRTBase_SumFacSIMD()
+        {
+        }
+
+        virtual void operator()(const Array<OneD, const NekDouble> &input,
+                                Array<OneD,       NekDouble> &output,
+                                Array<OneD,       NekDouble> &output1,
+                                Array<OneD,       NekDouble> &output2,
+                                Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
+                     "Incorrect workspace size");
+
+            const int nCoeffs = m_stdExp->GetNcoeffs();
+            const int nPhys   = m_stdExp->GetTotPoints();
+            const int nTot    = m_nBlocks*kSIMDWidth*nPhys;
+
+            NekDouble *in  = wsp.get();
+            NekDouble *out = in  + nTot;
+            NekDouble *tmp = out + m_nBlocks*kSIMDWidth*nCoeffs;
+
+            SIMDInterleave(m_numElmt, nPhys, input.get(), in);
+            Vmath::Vmul(nTot, m_jac.get(), 1, in, 1, in, 1);
+            SIMDTensorContract(m_nBlocks, m_dim, m_nquad, m_nmodes,
+                               m_base, true, in, out, tmp);
+            SIMDDeinterleave(m_numElmt, nCoeffs, out, output.get());
+        }
+
+    protected:
+        int                             m_dim;
+        int                             m_nBlocks;
+        int                             m_nquad[3];
+        int                             m_nmodes[3];
+        const NekDouble                *m_base[3];
+        Array<OneD, NekDouble>          m_jac;
+
+    private:
+        IProductWRTBase_SumFacSIMD(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator (pCollExp, pGeomData),
+              m_dim    (m_stdExp->GetShapeDimension()),
+              m_nBlocks(SIMDNumBlocks(m_numElmt))
+        {
+            const int nPhys = m_stdExp->GetTotPoints();
+
+            for (int i = 0; i < m_dim; ++i)
+            {
+                m_nquad[i]  = m_stdExp->GetNumPoints(i);
+                m_nmodes[i] = m_stdExp->GetBasisNumModes(i);
+                m_base[i]   = m_stdExp->GetBasis(i)->GetBdata().get();
+            }
+
+            // Store the Jacobian in the same interleaved layout as the data
+            Array<OneD, NekDouble> jac(m_numElmt*nPhys);
+            pGeomData->GetCompactJacWithStdWeights(pCollExp)->Expand(
+                0, jac.get());
+            m_jac = Array<OneD, NekDouble>(m_nBlocks*kSIMDWidth*nPhys);
+            SIMDInterleave(m_numElmt, nPhys, jac.get(), m_jac.get());
+
+            m_wspSize = m_nBlocks*kSIMDWidth*(nPhys + m_stdExp->GetNcoeffs())
+                      + SIMDTensorWspSize(m_nBlocks, m_dim, m_nquad, m_nmodes);
+        }
+};
+
+/// Factory initialisation for the IProductWRTBase_SumFacSIMD operators
+OperatorKey IProductWRTBase_SumFacSIMD::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eIProductWRTBase, eSumFacSIMD, false),
+        IProductWRTBase_SumFacSIMD::create,
+        "IProductWRTBase_SumFacSIMD_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eIProductWRTBase, eSumFacSIMD, false),
+        IProductWRTBase_SumFacSIMD::create,
+        "IProductWRTBase_SumFacSIMD_Hex")
+};
+
 }
 }
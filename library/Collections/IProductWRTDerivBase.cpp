@@ -37,6 +37,8 @@
 #include <Collections/Operator.h>
 #include <Collections/Collection.h>
 #include <Collections/IProduct.h>
+#include <Collections/SumFacSIMD.h>
+#include <StdRegions/StdPyrExp.h>
 
 namespace Nektar {
 namespace Collections {
@@ -89,19 +91,17 @@ class IProductWRTDerivBase_StdMat : public Operator
             // calculate dx/dxi in[0] + dy/dxi in[1] + dz/dxi in[2]
             for(int i = 0; i < m_dim; ++i)
             {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,
-                             tmp[i],1);
+                m_derivFac->Vmul(i, in[0].get(), tmp[i].get());
                 for(int j = 1; j < m_coordim; ++j)
                 {
-                    Vmath::Vvtvp (ntot,m_derivFac[i +j*m_dim],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
+                    m_derivFac->Vvtvp(i+j*m_dim, in[j].get(), tmp[i].get());
                 }
             }
 
             // calculate Iproduct WRT Std Deriv
 
             // First component
-            Vmath::Vmul(ntot,m_jac,1,tmp[0],1,tmp[0],1);
+            m_jac->Vmul(0, tmp[0].get(), tmp[0].get());
             Blas::Dgemm('N', 'N', m_iProdWRTStdDBase[0]->GetRows(),
                         m_numElmt,m_iProdWRTStdDBase[0]->GetColumns(),
                         1.0, m_iProdWRTStdDBase[0]->GetRawPtr(),
@@ -112,7 +112,7 @@ class IProductWRTDerivBase_StdMat : public Operator
             // Other components
             for(int i = 1; i < m_dim; ++i)
             {
-                Vmath::Vmul(ntot,m_jac,1,tmp[i],1,tmp[i],1);
+                m_jac->Vmul(0, tmp[i].get(), tmp[i].get());
                 Blas::Dgemm('N', 'N', m_iProdWRTStdDBase[i]->GetRows(),
                             m_numElmt,m_iProdWRTStdDBase[i]->GetColumns(),
                             1.0, m_iProdWRTStdDBase[i]->GetRawPtr(),
@@ -124,8 +124,8 @@ class IProductWRTDerivBase_StdMat : public Operator
 
     protected:
         Array<OneD, DNekMatSharedPtr>   m_iProdWRTStdDBase;
-        Array<TwoD, const NekDouble>    m_derivFac;
-        Array<OneD, const NekDouble>    m_jac;
+        CompactGeomDataSharedPtr        m_derivFac;
+        CompactGeomDataSharedPtr        m_jac;
         int                             m_dim;
         int                             m_coordim;
 
@@ -159,8 +159,8 @@ class IProductWRTDerivBase_StdMat : public Operator
                                      + j*nmodes, 1);
                 }
             }
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
-            m_jac      = pGeomData->GetJac(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
+            m_jac      = pGeomData->GetCompactJac(pCollExp);
             m_wspSize = m_dim*nqtot*m_numElmt;
         }
 };
@@ -250,18 +250,16 @@ class IProductWRTDerivBase_IterPerExp : public Operator
             // calculate dx/dxi in[0] + dy/dxi in[2] + dz/dxi in[3]
             for(int i = 0; i < m_dim; ++i)
             {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,
-                             tmp[i],1);
+                m_derivFac->Vmul(i, in[0].get(), tmp[i].get());
                 for(int j = 1; j < m_coordim; ++j)
                 {
-                    Vmath::Vvtvp (ntot,m_derivFac[i +j*m_dim],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
+                    m_derivFac->Vvtvp(i+j*m_dim, in[j].get(), tmp[i].get());
                 }
             }
 
             // calculate Iproduct WRT Std Deriv
             // first component
-            Vmath::Vmul(ntot,m_jac,1,tmp[0],1,tmp[0],1);
+            m_jac->Vmul(0, tmp[0].get(), tmp[0].get());
             for(int n = 0; n < m_numElmt; ++n)
             {
                 m_stdExp->IProductWRTDerivBase(0,tmp[0]+n*nPhys,
@@ -272,7 +270,7 @@ class IProductWRTDerivBase_IterPerExp : public Operator
             for(int i = 1; i < m_dim; ++i)
             {
                 // multiply by Jacobian
-                Vmath::Vmul(ntot,m_jac,1,tmp[i],1,tmp[i],1);
+                m_jac->Vmul(0, tmp[i].get(), tmp[i].get());
                 for(int n = 0; n < m_numElmt; ++n)
                 {
                     m_stdExp->IProductWRTDerivBase(i,tmp[i]+n*nPhys,tmp[0]);
@@ -283,8 +281,8 @@ class IProductWRTDerivBase_IterPerExp : public Operator
         }
 
     protected:
-        Array<TwoD, const NekDouble>    m_derivFac;
-        Array<OneD, const NekDouble>    m_jac;
+        CompactGeomDataSharedPtr        m_derivFac;
+        CompactGeomDataSharedPtr        m_jac;
         int                             m_dim;
         int                             m_coordim;
 
@@ -300,8 +298,8 @@ class IProductWRTDerivBase_IterPerExp : public Operator
 
             int nqtot  = m_stdExp->GetTotPoints();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
-            m_jac      = pGeomData->GetJac(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
+            m_jac      = pGeomData->GetCompactJac(pCollExp);
             m_wspSize  = m_dim*nqtot*m_numElmt;
         }
 };
@@ -484,10 +482,8 @@ class IProductWRTDerivBase_SumFac_Seg : public Operator
                       Array<OneD,       NekDouble> &wsp)
         {
 
-            Vmath::Vmul(m_numElmt*m_nquad0, m_jac, 1, input, 1, wsp, 1);
-            Vmath::Vmul(m_numElmt*m_nquad0, &m_derivFac[0][0], 1,
-                                            &wsp[0],           1,
-                                            &wsp[0],           1);
+            m_jac->Vmul(0, input.get(), wsp.get());
+            m_derivFac->Vmul(0, wsp.get(), wsp.get());
 
             // out = B0*in;
             Blas::Dgemm('T', 'N', m_nmodes0, m_numElmt, m_nquad0,
@@ -499,9 +495,9 @@ class IProductWRTDerivBase_SumFac_Seg : public Operator
     protected:
         const int                       m_nquad0;
         const int                       m_nmodes0;
-        Array<OneD, const NekDouble>    m_jac;
+        CompactGeomDataSharedPtr        m_jac;
         Array<OneD, const NekDouble>    m_derbase0;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CompactGeomDataSharedPtr        m_derivFac;
 
     private:
         IProductWRTDerivBase_SumFac_Seg(
@@ -513,8 +509,8 @@ class IProductWRTDerivBase_SumFac_Seg : public Operator
               m_derbase0(m_stdExp->GetBasis(0)->GetDbdata())
         {
             m_wspSize = m_numElmt*m_nquad0;
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
-            m_jac = pGeomData->GetJacWithStdWeights(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
+            m_jac = pGeomData->GetCompactJacWithStdWeights(pCollExp);
         }
 };
 
@@ -563,12 +559,10 @@ class IProductWRTDerivBase_SumFac_Quad : public Operator
             // calculate dx/dxi in[0] + dy/dxi in[1]
             for(int i = 0; i < 2; ++i)
             {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,
-                             tmp[i],1);
+                m_derivFac->Vmul(i, in[0].get(), tmp[i].get());
                 for(int j = 1; j < m_coordim; ++j)
                 {
-                    Vmath::Vvtvp (ntot,m_derivFac[i +j*2],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
+                    m_derivFac->Vvtvp(i+j*2, in[j].get(), tmp[i].get());
                 }
             }
 
@@ -597,8 +591,8 @@ class IProductWRTDerivBase_SumFac_Quad : public Operator
         const bool                      m_colldir0;
         const bool                      m_colldir1;
         int                             m_coordim;
-        Array<TwoD, const NekDouble>    m_derivFac;
-        Array<OneD, const NekDouble>    m_jac;
+        CompactGeomDataSharedPtr        m_derivFac;
+        CompactGeomDataSharedPtr        m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
         Array<OneD, const NekDouble>    m_derbase0;
@@ -623,8 +617,8 @@ class IProductWRTDerivBase_SumFac_Quad : public Operator
             LibUtilities::PointsKeyVector PtsKey = m_stdExp->GetPointsKeys();
             m_coordim = m_stdExp->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
-            m_jac      = pGeomData->GetJacWithStdWeights(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
+            m_jac      = pGeomData->GetCompactJacWithStdWeights(pCollExp);
             m_wspSize  = 4 * m_numElmt * (max(m_nquad0*m_nquad1,
                                               m_nmodes0*m_nmodes1));
         }
@@ -694,12 +688,11 @@ class IProductWRTDerivBase_SumFac_Tri : public Operator
 
             for(int i = 0; i < 2; ++i)
             {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1, tmp[i],1);
+                m_derivFac->Vmul(i, in[0].get(), tmp[i].get());
 
                 for(int j = 1; j < m_coordim; ++j)
                 {
-                    Vmath::Vvtvp (ntot,m_derivFac[i +j*2],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
+                    m_derivFac->Vvtvp(i+j*2, in[j].get(), tmp[i].get());
                 }
             }
 
@@ -736,8 +729,8 @@ class IProductWRTDerivBase_SumFac_Tri : public Operator
         const bool                      m_colldir0;
         const bool                      m_colldir1;
         int                             m_coordim;
-        Array<TwoD, const NekDouble>    m_derivFac;
-        Array<OneD, const NekDouble>    m_jac;
+        CompactGeomDataSharedPtr        m_derivFac;
+        CompactGeomDataSharedPtr        m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
         Array<OneD, const NekDouble>    m_derbase0;
@@ -765,8 +758,8 @@ class IProductWRTDerivBase_SumFac_Tri : public Operator
             LibUtilities::PointsKeyVector PtsKey = m_stdExp->GetPointsKeys();
             m_coordim = m_stdExp->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
-            m_jac      = pGeomData->GetJacWithStdWeights(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
+            m_jac      = pGeomData->GetCompactJacWithStdWeights(pCollExp);
             m_wspSize  = 4 * m_numElmt * (max(m_nquad0*m_nquad1,
                                               m_nmodes0*m_nmodes1));
 
@@ -855,12 +848,10 @@ class IProductWRTDerivBase_SumFac_Hex : public Operator
             // calculate dx/dxi in[0] + dy/dxi in[1] + dz/dxi in[2]
             for(int i = 0; i < 3; ++i)
             {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,
-                             tmp[i],1);
+                m_derivFac->Vmul(i, in[0].get(), tmp[i].get());
                 for(int j = 1; j < 3; ++j)
                 {
-                    Vmath::Vvtvp (ntot,m_derivFac[i+3*j],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
+                    m_derivFac->Vvtvp(i+3*j, in[j].get(), tmp[i].get());
                 }
             }
 
@@ -898,14 +889,14 @@ class IProductWRTDerivBase_SumFac_Hex : public Operator
         const bool                      m_colldir0;
         const bool                      m_colldir1;
         const bool                      m_colldir2;
-        Array<OneD, const NekDouble>    m_jac;
+        CompactGeomDataSharedPtr        m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
         Array<OneD, const NekDouble>    m_base2;
         Array<OneD, const NekDouble>    m_derbase0;
         Array<OneD, const NekDouble>    m_derbase1;
         Array<OneD, const NekDouble>    m_derbase2;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CompactGeomDataSharedPtr        m_derivFac;
 
     private:
         IProductWRTDerivBase_SumFac_Hex(
@@ -929,10 +920,10 @@ class IProductWRTDerivBase_SumFac_Hex : public Operator
               m_derbase2(m_stdExp->GetBasis(2)->GetDbdata())
 
         {
-            m_jac      = pGeomData->GetJacWithStdWeights(pCollExp);
+            m_jac      = pGeomData->GetCompactJacWithStdWeights(pCollExp);
             m_wspSize  = 6 * m_numElmt * (max(m_nquad0*m_nquad1*m_nquad2,
                                               m_nmodes0*m_nmodes1*m_nmodes2));
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
         }
 };
 
@@ -1017,11 +1008,10 @@ class IProductWRTDerivBase_SumFac_Tet : public Operator
 
             for(int i = 0; i < 3; ++i)
             {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,tmp[i],1);
+                m_derivFac->Vmul(i, in[0].get(), tmp[i].get());
                 for(int j = 1; j < 3; ++j)
                 {
-                    Vmath::Vvtvp (ntot,m_derivFac[i+3*j],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
+                    m_derivFac->Vvtvp(i+3*j, in[j].get(), tmp[i].get());
                 }
             }
 
@@ -1082,14 +1072,14 @@ class IProductWRTDerivBase_SumFac_Tet : public Operator
         const int                       m_nmodes0;
         const int                       m_nmodes1;
         const int                       m_nmodes2;
-        Array<OneD, const NekDouble>    m_jac;
+        CompactGeomDataSharedPtr        m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
         Array<OneD, const NekDouble>    m_base2;
         Array<OneD, const NekDouble>    m_derbase0;
         Array<OneD, const NekDouble>    m_derbase1;
         Array<OneD, const NekDouble>    m_derbase2;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CompactGeomDataSharedPtr        m_derivFac;
         Array<OneD, NekDouble>          m_fac0;
         Array<OneD, NekDouble>          m_fac1;
         Array<OneD, NekDouble>          m_fac2;
@@ -1115,10 +1105,10 @@ class IProductWRTDerivBase_SumFac_Tet : public Operator
               m_derbase2(m_stdExp->GetBasis(2)->GetDbdata())
 
         {
-            m_jac      = pGeomData->GetJacWithStdWeights(pCollExp);
+            m_jac      = pGeomData->GetCompactJacWithStdWeights(pCollExp);
             m_wspSize  = 6 * m_numElmt * (max(m_nquad0*m_nquad1*m_nquad2,
                                               m_nmodes0*m_nmodes1*m_nmodes2));
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
 
 
             const Array<OneD, const NekDouble>& z0
@@ -1238,12 +1228,10 @@ class IProductWRTDerivBase_SumFac_Prism : public Operator
 
             for(int i = 0; i < 3; ++i)
             {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,
-                             tmp[i],1);
+                m_derivFac->Vmul(i, in[0].get(), tmp[i].get());
                 for(int j = 1; j < 3; ++j)
                 {
-                    Vmath::Vvtvp (ntot,m_derivFac[i+3*j],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
+                    m_derivFac->Vvtvp(i+3*j, in[j].get(), tmp[i].get());
                 }
             }
             wsp1   = wsp + 3*nmax;
@@ -1290,14 +1278,14 @@ class IProductWRTDerivBase_SumFac_Prism : public Operator
         const int                       m_nmodes0;
         const int                       m_nmodes1;
         const int                       m_nmodes2;
-        Array<OneD, const NekDouble>    m_jac;
+        CompactGeomDataSharedPtr        m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
         Array<OneD, const NekDouble>    m_base2;
         Array<OneD, const NekDouble>    m_derbase0;
         Array<OneD, const NekDouble>    m_derbase1;
         Array<OneD, const NekDouble>    m_derbase2;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CompactGeomDataSharedPtr        m_derivFac;
         Array<OneD, NekDouble>          m_fac0;
         Array<OneD, NekDouble>          m_fac1;
         bool                            m_sortTopVertex;
@@ -1321,10 +1309,10 @@ class IProductWRTDerivBase_SumFac_Prism : public Operator
               m_derbase2(m_stdExp->GetBasis(2)->GetDbdata())
 
         {
-            m_jac      = pGeomData->GetJacWithStdWeights(pCollExp);
+            m_jac      = pGeomData->GetCompactJacWithStdWeights(pCollExp);
             m_wspSize  = 6 * m_numElmt * (max(m_nquad0*m_nquad1*m_nquad2,
                                               m_nmodes0*m_nmodes1*m_nmodes2));
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
 
             if(m_stdExp->GetBasis(0)->GetBasisType()
                     == LibUtilities::eModified_A)
@@ -1370,5 +1358,380 @@ OperatorKey IProductWRTDerivBase_SumFac_Prism::m_type = GetOperatorFactory().
         IProductWRTDerivBase_SumFac_Prism::create,
         "IProductWRTDerivBase_SumFac_Prism");
 
+
+/**
+ * @brief Inner product WRT deriv base operator using sum-factorisation (Pyr)
+ */
+class IProductWRTDerivBase_SumFac_Pyr : public Operator
+{
+    public:
+        OPERATOR_CREATE(IProductWRTDerivBase_SumFac_Pyr)
+
+        virtual ~IProductWRTDerivBase_SumFac_Pyr()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &entry0,
+                      Array<OneD, NekDouble>       &entry1,
+                      Array<OneD, NekDouble>       &entry2,
+                      Array<OneD, NekDouble>       &entry3,
+                      Array<OneD, NekDouble>       &wsp)
+        {
+            unsigned int nPhys  = m_stdExp->GetTotPoints();
+            unsigned int ntot   = m_numElmt*nPhys;
+            unsigned int nmodes = m_stdExp->GetNcoeffs();
+            unsigned int nmax  = max(ntot,m_numElmt*nmodes);
+            Array<OneD, Array<OneD, const NekDouble> > in(3);
+            Array<OneD, NekDouble> output, wsp1;
+            Array<OneD, Array<OneD, NekDouble> > tmp(3);
+
+            in[0] = entry0; in[1] = entry1;
+            in[2] = entry2;
+
+            output =  entry3;
+
+            for(int i = 0; i < 3; ++i)
+            {
+                tmp[i] = wsp + i*nmax;
+            }
+
+            // calculate (dphi/dx,in[0]) = ((dphi/dxi_0 dxi_0/dx +
+            //                               dphi/dxi_1 dxi_1/dx),in[0])
+            //     +     (dphi/dy,in[1]) = ((dphi/dxi_0 dxi_0/dy +
+            //                               dphi/dxi_1 dxi_1/dy),in[1])
+            //     +     (dphi/dz,in[2]) = ((dphi/dxi_0 dxi_0/dz +
+            //                               dphi/dxi_1 dxi_1/dz),in[2])
+            //
+            // Note dphi/dxi_0  =
+            //             dphi/deta_0 deta_0/dxi_0 = dphi/deta_0 2/(1-eta_2)
+            //
+            //      dphi/dxi_1  =
+            //             dphi/deta_1 deta_1/dxi_1 = dphi/deta_1 2/(1-eta_2)
+            //
+            //      dphi/dxi_2  =
+            //             dphi/deta_0 (1+eta_0)/(1-eta_2)
+            //           + dphi/deta_1 (1+eta_1)/(1-eta_2) + dphi/deta_2
+            //
+            // and so the full inner products are
+            //
+            // (dphi/dx,in[0]) + (dphi/dy,in[1]) + (dphi/dz,in[2])
+            //    = (dphi/deta_0, ((2/(1-eta_2) (dxi_0/dx in[0] + dxi_0/dy in[1]
+            //                                               + dxi_0/dz in[2])
+            //            + (1_eta_0)/(1-eta_2) (dxi_2/dx in[0] + dxi_2/dy in[1]
+            //                                               + dxi_2/dz in[2] ))
+            //    + (dphi/deta_1, ((2/(1-eta_2) (dxi_1/dx in[0] + dxi_1/dy in[1]
+            //                                               + dxi_1/dz in[2])
+            //            + (1_eta_1)/(1-eta_2) (dxi_2/dx in[0] + dxi_2/dy in[1]
+            //                                               + dxi_2/dz in[2] ))
+            //    + (dphi/deta_2, (dxi_2/dx in[0] + dxi_2/dy in[1]
+            //                                    + dxi_2/dz in[2]))
+
+            for(int i = 0; i < 3; ++i)
+            {
+                m_derivFac->Vmul(i, in[0].get(), tmp[i].get());
+                for(int j = 1; j < 3; ++j)
+                {
+                    m_derivFac->Vvtvp(i+3*j, in[j].get(), tmp[i].get());
+                }
+            }
+            wsp1   = wsp + 3*nmax;
+
+            // Sort into eta factors
+            for (int i = 0; i < m_numElmt; ++i)
+            {
+                // scale tmp[0] by fac0
+                Vmath::Vmul(nPhys,&m_fac0[0],1,tmp[0].get()+i*nPhys,1,
+                            tmp[0].get()+i*nPhys,1);
+
+                // scale tmp[2] by fac1 and add to tmp0
+                Vmath::Vvtvp(nPhys,&m_fac1[0],1,tmp[2].get()+i*nPhys,1,
+                             tmp[0].get()+i*nPhys,1,tmp[0].get()+i*nPhys,1);
+
+                // scale tmp[1] by fac0
+                Vmath::Vmul(nPhys,&m_fac0[0],1,tmp[1].get()+i*nPhys,1,
+                            tmp[1].get()+i*nPhys,1);
+
+                // scale tmp[2] by fac2 and add to tmp1
+                Vmath::Vvtvp(nPhys,&m_fac2[0],1,tmp[2].get()+i*nPhys,1,
+                             tmp[1].get()+i*nPhys,1,tmp[1].get()+i*nPhys,1);
+            }
+
+            // calculate Iproduct WRT Std Deriv
+            PyrIProduct(m_numElmt,
+                        m_nquad0,   m_nquad1,  m_nquad2,
+                        m_nmodes0,  m_nmodes1, m_nmodes2,
+                        m_nModesPQ, m_coeffMap, m_zModeMap,
+                        m_derbase0, m_base1,   m_base2,
+                        m_jac,tmp[0],output,wsp1);
+
+            PyrIProduct(m_numElmt,
+                        m_nquad0,  m_nquad1,   m_nquad2,
+                        m_nmodes0, m_nmodes1,  m_nmodes2,
+                        m_nModesPQ, m_coeffMap, m_zModeMap,
+                        m_base0,   m_derbase1, m_base2,
+                        m_jac,tmp[1],tmp[0],wsp1);
+            Vmath::Vadd(m_numElmt*nmodes,tmp[0],1,output,1,output,1);
+
+            PyrIProduct(m_numElmt,
+                        m_nquad0,  m_nquad1,  m_nquad2,
+                        m_nmodes0, m_nmodes1, m_nmodes2,
+                        m_nModesPQ, m_coeffMap, m_zModeMap,
+                        m_base0,   m_base1,   m_derbase2,
+                        m_jac,tmp[2],tmp[0],wsp1);
+            Vmath::Vadd(m_numElmt*nmodes,tmp[0],1,output,1,output,1);
+        }
+
+
+    protected:
+        const int                       m_nquad0;
+        const int                       m_nquad1;
+        const int                       m_nquad2;
+        const int                       m_nmodes0;
+        const int                       m_nmodes1;
+        const int                       m_nmodes2;
+        CompactGeomDataSharedPtr        m_jac;
+        Array<OneD, const NekDouble>    m_base0;
+        Array<OneD, const NekDouble>    m_base1;
+        Array<OneD, const NekDouble>    m_base2;
+        Array<OneD, const NekDouble>    m_derbase0;
+        Array<OneD, const NekDouble>    m_derbase1;
+        Array<OneD, const NekDouble>    m_derbase2;
+        CompactGeomDataSharedPtr        m_derivFac;
+        Array<OneD, NekDouble>          m_fac0;
+        Array<OneD, NekDouble>          m_fac1;
+        Array<OneD, NekDouble>          m_fac2;
+        Array<OneD, int>                m_nModesPQ;
+        Array<OneD, int>                m_coeffMap;
+        Array<OneD, int>                m_zModeMap;
+
+    private:
+        IProductWRTDerivBase_SumFac_Pyr(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator  (pCollExp, pGeomData),
+              m_nquad0  (m_stdExp->GetNumPoints(0)),
+              m_nquad1  (m_stdExp->GetNumPoints(1)),
+              m_nquad2  (m_stdExp->GetNumPoints(2)),
+              m_nmodes0 (m_stdExp->GetBasisNumModes(0)),
+              m_nmodes1 (m_stdExp->GetBasisNumModes(1)),
+              m_nmodes2 (m_stdExp->GetBasisNumModes(2)),
+              m_base0   (m_stdExp->GetBasis(0)->GetBdata()),
+              m_base1   (m_stdExp->GetBasis(1)->GetBdata()),
+              m_base2   (m_stdExp->GetBasis(2)->GetBdata()),
+              m_derbase0(m_stdExp->GetBasis(0)->GetDbdata()),
+              m_derbase1(m_stdExp->GetBasis(1)->GetDbdata()),
+              m_derbase2(m_stdExp->GetBasis(2)->GetDbdata())
+
+        {
+            m_jac      = pGeomData->GetCompactJacWithStdWeights(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
+
+            StdRegions::StdPyrExpSharedPtr pyr =
+                boost::dynamic_pointer_cast<StdRegions::StdPyrExp>(m_stdExp);
+            ASSERTL0(pyr, "Expected a pyramid expansion");
+            pyr->GetSumFacModeMap(m_nModesPQ, m_coeffMap, m_zModeMap);
+
+            int nmax   = m_numElmt * max(m_nquad0*m_nquad1*m_nquad2,
+                                         m_stdExp->GetNcoeffs());
+            m_wspSize  = 3 * nmax
+                       + m_numElmt * m_nquad2
+                                   *(max(m_nquad0*m_nquad1,m_nmodes0*m_nmodes1))
+                       + m_nquad1*m_nquad2*m_numElmt*m_nmodes0
+                       + m_nmodes2*(m_numElmt + m_nquad2);
+
+            const Array<OneD, const NekDouble>& z0
+                                            = m_stdExp->GetBasis(0)->GetZ();
+            const Array<OneD, const NekDouble>& z1
+                                            = m_stdExp->GetBasis(1)->GetZ();
+            const Array<OneD, const NekDouble>& z2
+                                            = m_stdExp->GetBasis(2)->GetZ();
+
+            m_fac0 = Array<OneD, NekDouble>(m_nquad0*m_nquad1*m_nquad2);
+            m_fac1 = Array<OneD, NekDouble>(m_nquad0*m_nquad1*m_nquad2);
+            m_fac2 = Array<OneD, NekDouble>(m_nquad0*m_nquad1*m_nquad2);
+
+            for (int i = 0; i < m_nquad0; ++i)
+            {
+                for(int j = 0; j < m_nquad1; ++j)
+                {
+                    for(int k = 0; k < m_nquad2; ++k)
+                    {
+                        // set up geometric factor: 2/(1-z2)
+                        m_fac0[i + j*m_nquad0 + k*m_nquad0*m_nquad1]
+                               = 2.0/(1-z2[k]);
+                        // set up geometric factor: (1+z0)/(1-z2)
+                        m_fac1[i + j*m_nquad0 + k*m_nquad0*m_nquad1]
+                               = (1+z0[i])/(1-z2[k]);
+                        // set up geometric factor: (1+z1)/(1-z2)
+                        m_fac2[i + j*m_nquad0 + k*m_nquad0*m_nquad1]
+                               = (1+z1[j])/(1-z2[k]);
+                    }
+                }
+            }
+        }
+};
+
+/// Factory initialisation for the IProductWRTDerivBase_SumFac_Pyr operator
+OperatorKey IProductWRTDerivBase_SumFac_Pyr::m_type = GetOperatorFactory().
+    RegisterCreatorFunction(
+        OperatorKey(ePyramid, eIProductWRTDerivBase, eSumFac, false),
+        IProductWRTDerivBase_SumFac_Pyr::create,
+        "IProductWRTDerivBase_SumFac_Pyr");
+
+
+/**
+ * @brief Inner product WRT deriv base operator using sum-factorisation on
+ * blocks of interleaved elements (Quad, Hex)
+ */
+class IProductWRTDerivBase_SumFacSIMD : public Operator
+{
+    public:
+        OPERATOR_CREATE(IProductWRTDerivBase_SumFacSIMD)
+
+        virtual ~IProductWRTDerivBase_SumFacSIMD()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &entry0,
+                      Array<OneD, NekDouble>       &entry1,
+                      Array<OneD, NekDouble>       &entry2,
+                      Array<OneD, NekDouble>       &entry3,
+                      Array<OneD, NekDouble>       &wsp)
+        {
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
+                     "Incorrect workspace size");
+
+            const int nPhys   = m_stdExp->GetTotPoints();
+            const int nCoeffs = m_stdExp->GetNcoeffs();
+            const int nTot    = m_nBlocks*kSIMDWidth*nPhys;
+            const int nCoTot  = m_nBlocks*kSIMDWidth*nCoeffs;
+
+            Array<OneD, const NekDouble> in[3] = { entry0, entry1, entry2 };
+            Array<OneD, NekDouble> output = (m_coordim == 2) ? entry2 : entry3;
+
+            NekDouble *buf = wsp.get();
+            NekDouble *tmp = buf + nTot;
+            NekDouble *res = tmp + m_dim*nTot;
+            NekDouble *acc = res + nCoTot;
+            NekDouble *wsp1 = acc + nCoTot;
+
+            // calculate dx/dxi in[0] + dy/dxi in[1] + dz/dxi in[2]
+            for (int j = 0; j < m_coordim; ++j)
+            {
+                SIMDInterleave(m_numElmt, nPhys, in[j].get(), buf);
+
+                for (int i = 0; i < m_dim; ++i)
+                {
+                    if (j == 0)
+                    {
+                        Vmath::Vmul(nTot, m_derivFac[i].get(), 1,
+                                          buf, 1, tmp + i*nTot, 1);
+                    }
+                    else
+                    {
+                        Vmath::Vvtvp(nTot, m_derivFac[i+m_dim*j].get(), 1,
+                                           buf, 1, tmp + i*nTot, 1,
+                                           tmp + i*nTot, 1);
+                    }
+                }
+            }
+
+            // Iproduct wrt derivative of base i in each direction
+            for (int i = 0; i < m_dim; ++i)
+            {
+                const NekDouble *mat[3];
+                for (int d = 0; d < m_dim; ++d)
+                {
+                    mat[d] = (d == i) ? m_derbase[d] : m_base[d];
+                }
+
+                Vmath::Vmul(nTot, m_jac.get(), 1, tmp + i*nTot, 1,
+                                  tmp + i*nTot, 1);
+                SIMDTensorContract(m_nBlocks, m_dim, m_nquad, m_nmodes,
+                                   mat, true, tmp + i*nTot,
+                                   i == 0 ? acc : res, wsp1);
+
+                if (i > 0)
+                {
+                    Vmath::Vadd(nCoTot, res, 1, acc, 1, acc, 1);
+                }
+            }
+
+            SIMDDeinterleave(m_numElmt, nCoeffs, acc, output.get());
+        }
+
+    protected:
+        int                                   m_dim;
+        int                                   m_coordim;
+        int                                   m_nBlocks;
+        int                                   m_nquad[3];
+        int                                   m_nmodes[3];
+        const NekDouble                      *m_base[3];
+        const NekDouble                      *m_derbase[3];
+        Array<OneD, NekDouble>                m_jac;
+        Array<OneD, Array<OneD, NekDouble> >  m_derivFac;
+
+    private:
+        IProductWRTDerivBase_SumFacSIMD(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator  (pCollExp, pGeomData),
+              m_dim     (m_stdExp->GetShapeDimension()),
+              m_coordim (m_stdExp->GetCoordim()),
+              m_nBlocks (SIMDNumBlocks(m_numElmt))
+        {
+            const int nPhys = m_stdExp->GetTotPoints();
+            const int nTot  = m_nBlocks*kSIMDWidth*nPhys;
+
+            for (int i = 0; i < m_dim; ++i)
+            {
+                m_nquad[i]   = m_stdExp->GetNumPoints(i);
+                m_nmodes[i]  = m_stdExp->GetBasisNumModes(i);
+                m_base[i]    = m_stdExp->GetBasis(i)->GetBdata().get();
+                m_derbase[i] = m_stdExp->GetBasis(i)->GetDbdata().get();
+            }
+
+            // Store the geometric factors in the same interleaved layout as
+            // the data so that they can be applied with unit stride. Each
+            // component is expanded one at a time from the compact factors.
+            CompactGeomDataSharedPtr derivFac =
+                pGeomData->GetCompactDerivFactors(pCollExp);
+            Array<OneD, NekDouble> fac(m_numElmt*nPhys);
+
+            m_derivFac = Array<OneD, Array<OneD, NekDouble> >(
+                                                        m_dim*m_coordim);
+            for (int i = 0; i < m_dim*m_coordim; ++i)
+            {
+                m_derivFac[i] = Array<OneD, NekDouble>(nTot);
+                derivFac->Expand(i, fac.get());
+                SIMDInterleave(m_numElmt, nPhys, fac.get(),
+                               m_derivFac[i].get());
+            }
+
+            pGeomData->GetCompactJacWithStdWeights(pCollExp)->Expand(
+                0, fac.get());
+            m_jac = Array<OneD, NekDouble>(nTot);
+            SIMDInterleave(m_numElmt, nPhys, fac.get(), m_jac.get());
+
+            m_wspSize = (1 + m_dim)*nTot
+                      + 2*m_nBlocks*kSIMDWidth*m_stdExp->GetNcoeffs()
+                      + SIMDTensorWspSize(m_nBlocks, m_dim, m_nquad, m_nmodes);
+        }
+};
+
+/// Factory initialisation for the IProductWRTDerivBase_SumFacSIMD operators
+OperatorKey IProductWRTDerivBase_SumFacSIMD::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eIProductWRTDerivBase, eSumFacSIMD, false),
+        IProductWRTDerivBase_SumFacSIMD::create,
+        "IProductWRTDerivBase_SumFacSIMD_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eIProductWRTDerivBase, eSumFacSIMD, false),
+        IProductWRTDerivBase_SumFacSIMD::create,
+        "IProductWRTDerivBase_SumFacSIMD_Hex")
+};
+
 }
 }
@@ -104,6 +104,14 @@ Operator::~Operator()
 }
 
 
+/**
+ * Operators which do not depend on any constant factors ignore this call.
+ */
+void Operator::UpdateFactors(StdRegions::ConstFactorMap factors)
+{
+}
+
+
 /**
  *
  */
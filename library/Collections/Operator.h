@@ -67,6 +67,7 @@ enum OperatorType
     eIProductWRTBase,
     eIProductWRTDerivBase,
     ePhysDeriv,
+    eHelmholtz,
     SIZE_OperatorType
 };
 
@@ -75,7 +76,8 @@ const char* const OperatorTypeMap[] =
     "BwdTrans",
     "IProductWRTBase",
     "IProductWRTDerivBase",
-    "PhysDeriv"
+    "PhysDeriv",
+    "Helmholtz"
 };
 
 enum ImplementationType
@@ -85,6 +87,7 @@ enum ImplementationType
     eIterPerExp,
     eStdMat,
     eSumFac,
+    eSumFacSIMD,
     SIZE_ImplementationType
 };
 
@@ -94,7 +97,8 @@ const char* const ImplementationTypeMap[] =
     "NoCollection",
     "IterPerExp",
     "StdMat",
-    "SumFac"
+    "SumFac",
+    "SumFacSIMD"
 };
 
 typedef bool ExpansionIsNodal;
@@ -129,6 +133,10 @@ class Operator
 
         COLLECTIONS_EXPORT virtual ~Operator();
 
+        /// Update the constant factors (e.g. Helmholtz lambda) of the operator
+        COLLECTIONS_EXPORT virtual void UpdateFactors(
+                StdRegions::ConstFactorMap factors);
+
         /// Get the size of the required workspace
         int GetWspSize()
         {
@@ -36,6 +36,7 @@
 #include <loki/Singleton.h>
 #include <Collections/Operator.h>
 #include <Collections/Collection.h>
+#include <Collections/SumFacSIMD.h>
 
 namespace Nektar {
 namespace Collections {
@@ -95,17 +96,14 @@ class PhysDeriv_StdMat : public Operator
                 Vmath::Zero(ntot,out[i],1);
                 for(int j = 0; j < m_dim; ++j)
                 {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*m_dim+j], 1,
-                                        Diff[j],               1,
-                                        out[i],                1,
-                                        out[i],                1);
+                    m_derivFac->Vvtvp(i*m_dim+j, Diff[j].get(), out[i].get());
                 }
             }
         }
 
     protected:
         Array<OneD, DNekMatSharedPtr>   m_derivMat;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CompactGeomDataSharedPtr        m_derivFac;
         int                             m_dim;
         int                             m_coordim;
 
@@ -140,7 +138,7 @@ class PhysDeriv_StdMat : public Operator
                                  &(m_derivMat[i]->GetPtr())[0] + j*nqtot, 1);
                 }
             }
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
             m_wspSize = 3*nqtot*m_numElmt;
         }
 };
@@ -227,19 +225,16 @@ class PhysDeriv_IterPerExp : public Operator
             // calculate full derivative
             for(int i = 0; i < m_coordim; ++i)
             {
-                Vmath::Vmul(ntot,m_derivFac[i*m_dim],1,Diff[0],1,out[i],1);
+                m_derivFac->Vmul(i*m_dim, Diff[0].get(), out[i].get());
                 for(int j = 1; j < m_dim; ++j)
                 {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*m_dim+j], 1,
-                                        Diff[j],               1,
-                                        out[i],                1,
-                                        out[i],                1);
+                    m_derivFac->Vvtvp(i*m_dim+j, Diff[j].get(), out[i].get());
                 }
             }
         }
 
     protected:
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CompactGeomDataSharedPtr        m_derivFac;
         int                             m_dim;
         int                             m_coordim;
 
@@ -258,7 +253,7 @@ class PhysDeriv_IterPerExp : public Operator
             {
                 nqtot *= PtsKey[i].GetNumPoints();
             }
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
             m_wspSize = 3*nqtot*m_numElmt;
         }
 };
@@ -429,7 +424,7 @@ class PhysDeriv_SumFac_Seg : public Operator
         {
             const int nqcol   = m_nquad0*m_numElmt;
 
-            ASSERTL1(wsp.num_elements() == m_wspSize,
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
                      "Incorrect workspace size");
             ASSERTL1(input.num_elements() >= nqcol,
                      "Incorrect input size");
@@ -441,23 +436,23 @@ class PhysDeriv_SumFac_Seg : public Operator
                         input.get(), m_nquad0, 0.0,
                         diff0.get(), m_nquad0);
 
-            Vmath::Vmul  (nqcol, m_derivFac[0], 1, diff0, 1, output0, 1);
+            m_derivFac->Vmul (0, diff0.get(), output0.get());
 
             if (m_coordim == 2)
             {
-                Vmath::Vmul  (nqcol, m_derivFac[1], 1, diff0, 1, output1, 1);
+                m_derivFac->Vmul (1, diff0.get(), output1.get());
             }
             else if (m_coordim == 3)
             {
-                Vmath::Vmul  (nqcol, m_derivFac[1], 1, diff0, 1, output1, 1);
-                Vmath::Vmul  (nqcol, m_derivFac[2], 1, diff0, 1, output2, 1);
+                m_derivFac->Vmul (1, diff0.get(), output1.get());
+                m_derivFac->Vmul (2, diff0.get(), output2.get());
             }
         }
 
     protected:
         int                             m_coordim;
         const int                       m_nquad0;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CompactGeomDataSharedPtr        m_derivFac;
         NekDouble                      *m_Deriv0;
 
     private:
@@ -470,7 +465,7 @@ class PhysDeriv_SumFac_Seg : public Operator
             LibUtilities::PointsKeyVector PtsKey = m_stdExp->GetPointsKeys();
             m_coordim = m_stdExp->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
 
             m_Deriv0 = &((m_stdExp->GetBasis(0)->GetD())->GetPtr())[0];
             m_wspSize = m_nquad0*m_numElmt;
@@ -508,7 +503,7 @@ class PhysDeriv_SumFac_Quad : public Operator
             const int nqtot   = m_nquad0 * m_nquad1;
             const int nqcol   = nqtot*m_numElmt;
 
-            ASSERTL1(wsp.num_elements() == m_wspSize,
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
                      "Incorrect workspace size");
             ASSERTL1(input.num_elements() >= nqcol,
                      "Incorrect input size");
@@ -530,18 +525,15 @@ class PhysDeriv_SumFac_Quad : public Operator
                             diff1.get() + cnt, m_nquad0);
             }
 
-            Vmath::Vmul  (nqcol, m_derivFac[0], 1, diff0, 1, output0, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[1], 1, diff1, 1, output0, 1,
-                                                             output0, 1);
-            Vmath::Vmul  (nqcol, m_derivFac[2], 1, diff0, 1, output1, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[3], 1, diff1, 1, output1, 1,
-                                                             output1, 1);
+            m_derivFac->Vmul (0, diff0.get(), output0.get());
+            m_derivFac->Vvtvp(1, diff1.get(), output0.get());
+            m_derivFac->Vmul (2, diff0.get(), output1.get());
+            m_derivFac->Vvtvp(3, diff1.get(), output1.get());
 
             if (m_coordim == 3)
             {
-                Vmath::Vmul  (nqcol, m_derivFac[4], 1, diff0, 1, output2, 1);
-                Vmath::Vvtvp (nqcol, m_derivFac[5], 1, diff1, 1, output2, 1,
-                                                                 output2, 1);
+                m_derivFac->Vmul (4, diff0.get(), output2.get());
+                m_derivFac->Vvtvp(5, diff1.get(), output2.get());
             }
         }
 
@@ -549,7 +541,7 @@ class PhysDeriv_SumFac_Quad : public Operator
         int                             m_coordim;
         const int                       m_nquad0;
         const int                       m_nquad1;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CompactGeomDataSharedPtr        m_derivFac;
         NekDouble                      *m_Deriv0;
         NekDouble                      *m_Deriv1;
 
@@ -564,7 +556,7 @@ class PhysDeriv_SumFac_Quad : public Operator
             LibUtilities::PointsKeyVector PtsKey = m_stdExp->GetPointsKeys();
             m_coordim = m_stdExp->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
 
             m_Deriv0 = &((m_stdExp->GetBasis(0)->GetD())->GetPtr())[0];
             m_Deriv1 = &((m_stdExp->GetBasis(1)->GetD())->GetPtr())[0];
@@ -601,7 +593,7 @@ class PhysDeriv_SumFac_Tri : public Operator
             const int nqtot   = m_nquad0 * m_nquad1;
             const int nqcol   = nqtot*m_numElmt;
 
-            ASSERTL1(wsp.num_elements() == m_wspSize,
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
                      "Incorrect workspace size");
             ASSERTL1(input.num_elements() >= nqcol,
                      "Incorrect input size");
@@ -633,19 +625,15 @@ class PhysDeriv_SumFac_Tri : public Operator
             }
 
 
-            Vmath::Vmul  (nqcol, m_derivFac[0], 1, diff0, 1, output0, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[1], 1, diff1, 1,
-                          output0, 1, output0, 1);
-            Vmath::Vmul  (nqcol, m_derivFac[2], 1, diff0, 1, output1, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[3], 1, diff1, 1,
-                          output1, 1, output1, 1);
+            m_derivFac->Vmul (0, diff0.get(), output0.get());
+            m_derivFac->Vvtvp(1, diff1.get(), output0.get());
+            m_derivFac->Vmul (2, diff0.get(), output1.get());
+            m_derivFac->Vvtvp(3, diff1.get(), output1.get());
 
             if (m_coordim == 3)
             {
-                Vmath::Vmul  (nqcol, m_derivFac[4], 1, diff0, 1,
-                              output2, 1);
-                Vmath::Vvtvp (nqcol, m_derivFac[5], 1, diff1, 1,
-                              output2, 1, output2, 1);
+                m_derivFac->Vmul (4, diff0.get(), output2.get());
+                m_derivFac->Vvtvp(5, diff1.get(), output2.get());
             }
         }
 
@@ -653,7 +641,7 @@ class PhysDeriv_SumFac_Tri : public Operator
         int                             m_coordim;
         const int                       m_nquad0;
         const int                       m_nquad1;
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CompactGeomDataSharedPtr        m_derivFac;
         NekDouble                      *m_Deriv0;
         NekDouble                      *m_Deriv1;
         Array<OneD, NekDouble>          m_fac0;
@@ -670,7 +658,7 @@ class PhysDeriv_SumFac_Tri : public Operator
             LibUtilities::PointsKeyVector PtsKey = m_stdExp->GetPointsKeys();
             m_coordim = m_stdExp->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
 
             const Array<OneD, const NekDouble>& z0
                                             = m_stdExp->GetBasis(0)->GetZ();
@@ -770,19 +758,16 @@ class PhysDeriv_SumFac_Hex : public Operator
             // calculate full derivative
             for(int i = 0; i < m_coordim; ++i)
             {
-                Vmath::Vmul(ntot,m_derivFac[i*m_dim],1,Diff[0],1,out[i],1);
+                m_derivFac->Vmul(i*m_dim, Diff[0].get(), out[i].get());
                 for(int j = 1; j < m_dim; ++j)
                 {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*m_dim+j], 1,
-                                        Diff[j],               1,
-                                        out[i],                1,
-                                        out[i],                1);
+                    m_derivFac->Vvtvp(i*m_dim+j, Diff[j].get(), out[i].get());
                 }
             }
         }
 
     protected:
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CompactGeomDataSharedPtr        m_derivFac;
         int                             m_dim;
         int                             m_coordim;
         const int                       m_nquad0;
@@ -806,7 +791,7 @@ class PhysDeriv_SumFac_Hex : public Operator
             m_dim = PtsKey.size();
             m_coordim = m_stdExp->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
 
             m_Deriv0 = &((m_stdExp->GetBasis(0)->GetD())->GetPtr())[0];
             m_Deriv1 = &((m_stdExp->GetBasis(1)->GetD())->GetPtr())[0];
@@ -916,17 +901,16 @@ class PhysDeriv_SumFac_Tet : public Operator
             // calculate full derivative
             for(int i = 0; i < m_coordim; ++i)
             {
-                Vmath::Vmul(ntot,m_derivFac[i*m_dim],1,Diff[0],1,out[i],1);
+                m_derivFac->Vmul(i*m_dim, Diff[0].get(), out[i].get());
                 for(int j = 1; j < m_dim; ++j)
                 {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*m_dim+j], 1,
-                                        Diff[j], 1, out[i], 1, out[i], 1);
+                    m_derivFac->Vvtvp(i*m_dim+j, Diff[j].get(), out[i].get());
                 }
             }
         }
 
     protected:
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CompactGeomDataSharedPtr        m_derivFac;
         int                             m_dim;
         int                             m_coordim;
         const int                       m_nquad0;
@@ -954,7 +938,7 @@ class PhysDeriv_SumFac_Tet : public Operator
             m_dim = PtsKey.size();
             m_coordim = m_stdExp->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
 
             m_Deriv0 = &((m_stdExp->GetBasis(0)->GetD())->GetPtr())[0];
             m_Deriv1 = &((m_stdExp->GetBasis(1)->GetD())->GetPtr())[0];
@@ -1074,17 +1058,16 @@ class PhysDeriv_SumFac_Prism : public Operator
             // calculate full derivative
             for(int i = 0; i < m_coordim; ++i)
             {
-                Vmath::Vmul(ntot,m_derivFac[i*m_dim],1,Diff[0],1,out[i],1);
+                m_derivFac->Vmul(i*m_dim, Diff[0].get(), out[i].get());
                 for(int j = 1; j < m_dim; ++j)
                 {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*m_dim+j], 1,
-                                        Diff[j], 1, out[i], 1, out[i], 1);
+                    m_derivFac->Vvtvp(i*m_dim+j, Diff[j].get(), out[i].get());
                 }
             }
         }
 
     protected:
-        Array<TwoD, const NekDouble>    m_derivFac;
+        CompactGeomDataSharedPtr        m_derivFac;
         int                             m_dim;
         int                             m_coordim;
         const int                       m_nquad0;
@@ -1110,7 +1093,7 @@ class PhysDeriv_SumFac_Prism : public Operator
             m_dim = PtsKey.size();
             m_coordim = m_stdExp->GetCoordim();
 
-            m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
 
             const Array<OneD, const NekDouble>& z0
                                             = m_stdExp->GetBasis(0)->GetZ();
@@ -1150,5 +1133,269 @@ OperatorKey PhysDeriv_SumFac_Prism::m_typeArr[] = {
 };
 
 
+/**
+ * @brief Phys deriv operator using sum-factorisation (Pyramid)
+ */
+class PhysDeriv_SumFac_Pyr : public Operator
+{
+    public:
+        OPERATOR_CREATE(PhysDeriv_SumFac_Pyr)
+
+        virtual ~PhysDeriv_SumFac_Pyr()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output0,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            int nPhys = m_stdExp->GetTotPoints();
+            int ntot = m_numElmt*nPhys;
+            Array<OneD, Array<OneD, NekDouble> > Diff(3);
+            Array<OneD, Array<OneD, NekDouble> > out(3);
+            out[0] = output0; out[1] = output1; out[2] = output2;
+
+            for(int i = 0; i < m_dim; ++i)
+            {
+                Diff[i] = wsp + i*ntot;
+            }
+
+            // dEta0
+            Blas::Dgemm('N','N', m_nquad0,m_nquad1*m_nquad2*m_numElmt,
+                        m_nquad0,1.0, m_Deriv0,m_nquad0,&input[0],
+                        m_nquad0,0.0,&Diff[0][0],m_nquad0);
+
+            int cnt = 0;
+            for(int  i = 0; i < m_numElmt; ++i)
+            {
+
+                // dEta 1
+                for (int j = 0; j < m_nquad2; ++j)
+                {
+                    Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nquad1,
+                                1.0, &input[i*nPhys+j*m_nquad0*m_nquad1],
+                                m_nquad0, m_Deriv1, m_nquad1, 0.0,
+                                &Diff[1][i*nPhys+j*m_nquad0*m_nquad1],
+                                m_nquad0);
+                }
+
+                // dEta 2
+                Blas::Dgemm('N','T',m_nquad0*m_nquad1,m_nquad2,m_nquad2,
+                            1.0, &input[i*nPhys],m_nquad0*m_nquad1,
+                            m_Deriv2,m_nquad2, 0.0,&Diff[2][i*nPhys],
+                            m_nquad0*m_nquad1);
+
+                // dxi0 = 2/(1-eta_2) d Eta_0
+                Vmath::Vmul(nPhys,&m_fac0[0],1,Diff[0].get()+cnt,1,
+                            Diff[0].get()+cnt,1);
+
+                // dxi1 = 2/(1-eta_2) d Eta_1
+                Vmath::Vmul(nPhys,&m_fac0[0],1,Diff[1].get()+cnt,1,
+                            Diff[1].get()+cnt,1);
+
+                // dxi2 = (1+eta0)/(1-eta_2) d Eta_0
+                //      + (1+eta1)/(1-eta_2) d Eta_1 + d/dEta2;
+                Vmath::Vvtvp(nPhys,&m_fac1[0],1,Diff[0].get()+cnt,1,
+                             Diff[2].get()+cnt,1,Diff[2].get()+cnt,1);
+                Vmath::Vvtvp(nPhys,&m_fac2[0],1,Diff[1].get()+cnt,1,
+                             Diff[2].get()+cnt,1,Diff[2].get()+cnt,1);
+                cnt += nPhys;
+            }
+
+            // calculate full derivative
+            for(int i = 0; i < m_coordim; ++i)
+            {
+                m_derivFac->Vmul(i*m_dim, Diff[0].get(), out[i].get());
+                for(int j = 1; j < m_dim; ++j)
+                {
+                    m_derivFac->Vvtvp(i*m_dim+j, Diff[j].get(), out[i].get());
+                }
+            }
+        }
+
+    protected:
+        CompactGeomDataSharedPtr        m_derivFac;
+        int                             m_dim;
+        int                             m_coordim;
+        const int                       m_nquad0;
+        const int                       m_nquad1;
+        const int                       m_nquad2;
+        NekDouble                      *m_Deriv0;
+        NekDouble                      *m_Deriv1;
+        NekDouble                      *m_Deriv2;
+        Array<OneD, NekDouble>          m_fac0;
+        Array<OneD, NekDouble>          m_fac1;
+        Array<OneD, NekDouble>          m_fac2;
+
+    private:
+        PhysDeriv_SumFac_Pyr(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator(pCollExp, pGeomData),
+              m_nquad0  (m_stdExp->GetNumPoints(0)),
+              m_nquad1  (m_stdExp->GetNumPoints(1)),
+              m_nquad2  (m_stdExp->GetNumPoints(2))
+        {
+            LibUtilities::PointsKeyVector PtsKey = m_stdExp->GetPointsKeys();
+
+            m_dim = PtsKey.size();
+            m_coordim = m_stdExp->GetCoordim();
+
+            m_derivFac = pGeomData->GetCompactDerivFactors(pCollExp);
+
+            const Array<OneD, const NekDouble>& z0
+                                            = m_stdExp->GetBasis(0)->GetZ();
+            const Array<OneD, const NekDouble>& z1
+                                            = m_stdExp->GetBasis(1)->GetZ();
+            const Array<OneD, const NekDouble>& z2
+                                            = m_stdExp->GetBasis(2)->GetZ();
+            m_fac0 = Array<OneD, NekDouble>(m_nquad0*m_nquad1*m_nquad2);
+            m_fac1 = Array<OneD, NekDouble>(m_nquad0*m_nquad1*m_nquad2);
+            m_fac2 = Array<OneD, NekDouble>(m_nquad0*m_nquad1*m_nquad2);
+            for (int i = 0; i < m_nquad0; ++i)
+            {
+                for(int j = 0; j < m_nquad1; ++j)
+                {
+                    for(int k = 0; k < m_nquad2; ++k)
+                    {
+                        m_fac0[i+j*m_nquad0 + k*m_nquad0*m_nquad1] =
+                            2.0/(1-z2[k]);
+                        m_fac1[i+j*m_nquad0 + k*m_nquad0*m_nquad1] =
+                            0.5*(1+z0[i]);
+                        m_fac2[i+j*m_nquad0 + k*m_nquad0*m_nquad1] =
+                            0.5*(1+z1[j]);
+                    }
+                }
+            }
+
+            m_Deriv0 = &((m_stdExp->GetBasis(0)->GetD())->GetPtr())[0];
+            m_Deriv1 = &((m_stdExp->GetBasis(1)->GetD())->GetPtr())[0];
+            m_Deriv2 = &((m_stdExp->GetBasis(2)->GetD())->GetPtr())[0];
+
+            m_wspSize = 3*m_nquad0*m_nquad1*m_nquad2*m_numElmt;
+        }
+};
+
+/// Factory initialisation for the PhysDeriv_SumFac_Pyr operators
+OperatorKey PhysDeriv_SumFac_Pyr::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid, ePhysDeriv, eSumFac, false),
+        PhysDeriv_SumFac_Pyr::create, "PhysDeriv_SumFac_Pyr")
+};
+
+
+/**
+ * @brief Phys deriv operator using sum-factorisation on blocks of
+ * interleaved elements (Quad, Hex)
+ */
+class PhysDeriv_SumFacSIMD : public Operator
+{
+    public:
+        OPERATOR_CREATE(PhysDeriv_SumFacSIMD)
+
+        virtual ~PhysDeriv_SumFacSIMD()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output0,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL1(wsp.num_elements() >= m_wspSize,
+                     "Incorrect workspace size");
+
+            const int nPhys = m_stdExp->GetTotPoints();
+            const int nTot  = m_nBlocks*kSIMDWidth*nPhys;
+
+            Array<OneD, NekDouble> out[3] = { output0, output1, output2 };
+            NekDouble *in   = wsp.get();
+            NekDouble *tmp  = in + nTot;
+            NekDouble *diff = in + 2*nTot;
+
+            SIMDInterleave(m_numElmt, nPhys, input.get(), in);
+
+            for (int j = 0; j < m_dim; ++j)
+            {
+                SIMDTensorDeriv(m_nBlocks, m_dim, m_nquad, j, m_Deriv[j],
+                                in, diff + j*nTot);
+            }
+
+            // calculate full derivative
+            for (int i = 0; i < m_coordim; ++i)
+            {
+                Vmath::Vmul(nTot, m_derivFac[i*m_dim].get(), 1,
+                                  diff, 1, tmp, 1);
+                for (int j = 1; j < m_dim; ++j)
+                {
+                    Vmath::Vvtvp(nTot, m_derivFac[i*m_dim+j].get(), 1,
+                                       diff + j*nTot, 1, tmp, 1, tmp, 1);
+                }
+                SIMDDeinterleave(m_numElmt, nPhys, tmp, out[i].get());
+            }
+        }
+
+    protected:
+        int                                   m_dim;
+        int                                   m_coordim;
+        int                                   m_nBlocks;
+        int                                   m_nquad[3];
+        const NekDouble                      *m_Deriv[3];
+        Array<OneD, Array<OneD, NekDouble> >  m_derivFac;
+
+    private:
+        PhysDeriv_SumFacSIMD(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator  (pCollExp, pGeomData),
+              m_dim     (m_stdExp->GetShapeDimension()),
+              m_coordim (m_stdExp->GetCoordim()),
+              m_nBlocks (SIMDNumBlocks(m_numElmt))
+        {
+            const int nPhys = m_stdExp->GetTotPoints();
+
+            for (int i = 0; i < m_dim; ++i)
+            {
+                m_nquad[i] = m_stdExp->GetNumPoints(i);
+                m_Deriv[i] = &((m_stdExp->GetBasis(i)->GetD())->GetPtr())[0];
+            }
+
+            // Store the metric terms in the same interleaved layout as the
+            // data so that they can be applied with unit stride. Each
+            // component is expanded one at a time from the compact factors.
+            CompactGeomDataSharedPtr derivFac =
+                pGeomData->GetCompactDerivFactors(pCollExp);
+            Array<OneD, NekDouble> fac(m_numElmt*nPhys);
+
+            m_derivFac = Array<OneD, Array<OneD, NekDouble> >(
+                                                        m_dim*m_coordim);
+            for (int i = 0; i < m_dim*m_coordim; ++i)
+            {
+                m_derivFac[i] =
+                    Array<OneD, NekDouble>(m_nBlocks*kSIMDWidth*nPhys);
+                derivFac->Expand(i, fac.get());
+                SIMDInterleave(m_numElmt, nPhys, fac.get(),
+                               m_derivFac[i].get());
+            }
+
+            m_wspSize = (2 + m_dim)*m_nBlocks*kSIMDWidth*nPhys;
+        }
+};
+
+/// Factory initialisation for the PhysDeriv_SumFacSIMD operators
+OperatorKey PhysDeriv_SumFacSIMD::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, ePhysDeriv, eSumFacSIMD, false),
+        PhysDeriv_SumFacSIMD::create, "PhysDeriv_SumFacSIMD_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    ePhysDeriv, eSumFacSIMD, false),
+        PhysDeriv_SumFacSIMD::create, "PhysDeriv_SumFacSIMD_Hex")
+};
+
 }
 }
@@ -0,0 +1,231 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SumFacSIMD.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Kernels for sum-factorisation on blocks of elements whose
+// data are interleaved so that contractions vectorise across elements
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <Collections/SumFacSIMD.h>
+
+namespace Nektar
+{
+namespace Collections
+{
+
+/**
+ * @brief Number of blocks of #kSIMDWidth elements needed to hold @a numElmt
+ * elements. The last block is padded with zeroed elements if necessary.
+ */
+int SIMDNumBlocks(int numElmt)
+{
+    return (numElmt + kSIMDWidth - 1) / kSIMDWidth;
+}
+
+/**
+ * @brief Reorder element-contiguous data into blocks of #kSIMDWidth
+ * interleaved elements.
+ *
+ * Entry @a i of element @a e is stored at (b * nPerElmt + i) * kSIMDWidth + l
+ * where e = b * kSIMDWidth + l. Lanes beyond @a numElmt in the final block
+ * are set to zero.
+ */
+void SIMDInterleave(int numElmt, int nPerElmt,
+                    const NekDouble *input,
+                          NekDouble *output)
+{
+    const int nBlocks = SIMDNumBlocks(numElmt);
+
+    for (int b = 0; b < nBlocks; ++b)
+    {
+        NekDouble *out = output + b * nPerElmt * kSIMDWidth;
+
+        for (int l = 0; l < kSIMDWidth; ++l)
+        {
+            const int e = b * kSIMDWidth + l;
+
+            if (e < numElmt)
+            {
+                Vmath::Vcopy(nPerElmt, input + e * nPerElmt, 1,
+                             out + l, kSIMDWidth);
+            }
+            else
+            {
+                Vmath::Zero(nPerElmt, out + l, kSIMDWidth);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Inverse of SIMDInterleave; padded lanes are discarded.
+ */
+void SIMDDeinterleave(int numElmt, int nPerElmt,
+                      const NekDouble *input,
+                            NekDouble *output)
+{
+    for (int e = 0; e < numElmt; ++e)
+    {
+        const int b = e / kSIMDWidth;
+        const int l = e % kSIMDWidth;
+
+        Vmath::Vcopy(nPerElmt, input + b * nPerElmt * kSIMDWidth + l,
+                     kSIMDWidth, output + e * nPerElmt, 1);
+    }
+}
+
+/**
+ * @brief Apply a one-dimensional operator along a single direction of
+ * interleaved data.
+ *
+ * The input is viewed as [nOuter][nIn][nInner][kSIMDWidth] and the output
+ * as [nOuter][nOut][nInner][kSIMDWidth], with
+ *
+ *   output[o][k][i][l] = sum_j mat[k*sk + j*sj] * input[o][j][i][l].
+ *
+ * The two innermost loops run over contiguous memory with a trip count that
+ * is a multiple of the vector width, so they are vectorised across elements.
+ */
+void SIMDContract(int nOuter, int nIn, int nOut, int nInner,
+                  const NekDouble *mat, int sk, int sj,
+                  const NekDouble *input,
+                        NekDouble *output)
+{
+    const int len = nInner * kSIMDWidth;
+
+    for (int o = 0; o < nOuter; ++o)
+    {
+        const NekDouble *in  = input  + o * nIn  * len;
+              NekDouble *out = output + o * nOut * len;
+
+        for (int k = 0; k < nOut; ++k, out += len)
+        {
+            std::fill(out, out + len, 0.0);
+
+            for (int j = 0; j < nIn; ++j)
+            {
+                const NekDouble  m   = mat[k * sk + j * sj];
+                const NekDouble *inj = in + j * len;
+
+                for (int i = 0; i < nInner; ++i)
+                {
+                    const NekDouble *x = inj + i * kSIMDWidth;
+                          NekDouble *y = out + i * kSIMDWidth;
+
+                    for (int l = 0; l < kSIMDWidth; ++l)
+                    {
+                        y[l] += m * x[l];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Workspace required by SIMDTensorContract.
+ */
+int SIMDTensorWspSize(int nBlocks, int dim,
+                      const int *nIn, const int *nOut)
+{
+    int size = nBlocks * kSIMDWidth;
+    for (int d = 0; d < dim; ++d)
+    {
+        size *= std::max(nIn[d], nOut[d]);
+    }
+    return std::min(dim - 1, 2) * size;
+}
+
+/**
+ * @brief Apply a tensor product of one-dimensional operators to blocks of
+ * interleaved elements, contracting the fastest running direction first.
+ *
+ * Each mat[d] is the column-major basis matrix of size nquad x nmodes. For a
+ * backward transform (@a transpose false) it maps nIn[d] = nmodes to
+ * nOut[d] = nquad; for an inner product (@a transpose true) its transpose
+ * maps nIn[d] = nquad to nOut[d] = nmodes.
+ */
+void SIMDTensorContract(int nBlocks, int dim,
+                        const int *nIn, const int *nOut,
+                        const NekDouble *const *mat, bool transpose,
+                        const NekDouble *input,
+                              NekDouble *output,
+                              NekDouble *wsp)
+{
+    const int half = SIMDTensorWspSize(nBlocks, dim, nIn, nOut)
+                        / std::max(std::min(dim - 1, 2), 1);
+
+    const NekDouble *in = input;
+
+    for (int d = 0; d < dim; ++d)
+    {
+        NekDouble *out = (d == dim - 1) ? output : wsp + (d % 2) * half;
+
+        int nOuter = nBlocks, nInner = 1;
+        for (int e = 0;     e < d;   ++e) nInner *= nOut[e];
+        for (int e = d + 1; e < dim; ++e) nOuter *= nIn[e];
+
+        if (transpose)
+        {
+            SIMDContract(nOuter, nIn[d], nOut[d], nInner,
+                         mat[d], nIn[d], 1, in, out);
+        }
+        else
+        {
+            SIMDContract(nOuter, nIn[d], nOut[d], nInner,
+                         mat[d], 1, nOut[d], in, out);
+        }
+
+        in = out;
+    }
+}
+
+/**
+ * @brief Differentiate blocks of interleaved elements in the standard
+ * direction @a dir using the column-major derivative matrix @a deriv.
+ */
+void SIMDTensorDeriv(int nBlocks, int dim, const int *nquad, int dir,
+                     const NekDouble *deriv,
+                     const NekDouble *input,
+                           NekDouble *output)
+{
+    int nOuter = nBlocks, nInner = 1;
+    for (int e = 0;       e < dir; ++e) nInner *= nquad[e];
+    for (int e = dir + 1; e < dim; ++e) nOuter *= nquad[e];
+
+    SIMDContract(nOuter, nquad[dir], nquad[dir], nInner,
+                 deriv, 1, nquad[dir], input, output);
+}
+
+}
+}
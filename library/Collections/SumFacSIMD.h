@@ -0,0 +1,92 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SumFacSIMD.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Kernels for sum-factorisation on blocks of elements whose
+// data are interleaved so that contractions vectorise across elements
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIBRARY_COLLECTIONS_SUMFACSIMD_H
+#define NEKTAR_LIBRARY_COLLECTIONS_SUMFACSIMD_H
+
+#include <Collections/Operator.h>
+
+/// Number of elements interleaved in each block. This matches the number of
+/// doubles held in a vector register so that the innermost loops of the
+/// kernels below map directly onto packed arithmetic.
+#ifndef NEKTAR_COLLECTIONS_SIMD_WIDTH
+#  if defined(__AVX512F__)
+#    define NEKTAR_COLLECTIONS_SIMD_WIDTH 8
+#  else
+#    define NEKTAR_COLLECTIONS_SIMD_WIDTH 4
+#  endif
+#endif
+
+namespace Nektar
+{
+namespace Collections
+{
+
+static const int kSIMDWidth = NEKTAR_COLLECTIONS_SIMD_WIDTH;
+
+int SIMDNumBlocks(int numElmt);
+
+void SIMDInterleave(int numElmt, int nPerElmt,
+                    const NekDouble *input,
+                          NekDouble *output);
+
+void SIMDDeinterleave(int numElmt, int nPerElmt,
+                      const NekDouble *input,
+                            NekDouble *output);
+
+void SIMDContract(int nOuter, int nIn, int nOut, int nInner,
+                  const NekDouble *mat, int sk, int sj,
+                  const NekDouble *input,
+                        NekDouble *output);
+
+int SIMDTensorWspSize(int nBlocks, int dim,
+                      const int *nIn, const int *nOut);
+
+void SIMDTensorContract(int nBlocks, int dim,
+                        const int *nIn, const int *nOut,
+                        const NekDouble *const *mat, bool transpose,
+                        const NekDouble *input,
+                              NekDouble *output,
+                              NekDouble *wsp);
+
+void SIMDTensorDeriv(int nBlocks, int dim, const int *nquad, int dir,
+                     const NekDouble *deriv,
+                     const NekDouble *input,
+                           NekDouble *output);
+
+}
+}
+#endif
@@ -29,13 +29,16 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
 // DEALINGS IN THE SOFTWARE.
 //
-// Description: Small demo to run timings of various operators.
+// Description: Small demo to run timings of various operators. The element
+// shapes of the input mesh are reported first so that shape-specific kernels
+// can be compared; Pyr.xml provides a pyramidal mesh for this purpose.
 //
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <cstdio>
 #include <cstdlib>
 #include <iomanip>
+#include <map>
 
 #include <boost/timer/timer.hpp>
 
@@ -125,8 +128,25 @@ int main(int argc, char *argv[])
     SpatialDomains::MeshGraphSharedPtr graph =
         SpatialDomains::MeshGraph::Read(session);
 
+    // Report the element shapes being timed
+    expList = SetupExpList(2, session, graph, Collections::eNoCollection);
+    map<LibUtilities::ShapeType, int> shapeCount;
+    for (int i = 0; i < expList->GetExpSize(); ++i)
+    {
+        shapeCount[expList->GetExp(i)->DetShapeType()]++;
+    }
+
+    cout << sl << "Mesh contains:";
+    map<LibUtilities::ShapeType, int>::iterator shIt;
+    for (shIt = shapeCount.begin(); shIt != shapeCount.end(); ++shIt)
+    {
+        cout << " " << shIt->second << " "
+             << LibUtilities::ShapeTypeMap[shIt->first];
+    }
+    cout << endl;
+
     // BwdTrans operator
-    for (int imp = 1; imp < 5; ++imp)
+    for (int imp = 1; imp < Collections::SIZE_ImplementationType; ++imp)
     {
         Collections::ImplementationType impType =
             (Collections::ImplementationType)imp;
@@ -208,5 +228,28 @@ int main(int argc, char *argv[])
 
             printOutput(N, Ntest, timer, fmt);
         }
+
+        cout << sl << "Helmholtz Op: Ntest = " << Ntest << endl;
+        for (int N = 2; N < maxOrder; ++N)
+        {
+            expList = SetupExpList(N, session, graph, impType);
+            Array<OneD, NekDouble> input (expList->GetNcoeffs());
+            Array<OneD, NekDouble> output(expList->GetNcoeffs());
+
+            StdRegions::ConstFactorMap factors;
+            factors[StdRegions::eFactorLambda] = 1.0;
+            MultiRegions::GlobalMatrixKey mkey(
+                StdRegions::eHelmholtz, MultiRegions::NullAssemblyMapSharedPtr,
+                factors);
+
+            timer.start();
+            for (int i = 0; i < Ntest; ++i)
+            {
+                expList->GeneralMatrixOp(mkey, input, output);
+            }
+            timer.stop();
+
+            printOutput(N, Ntest, timer, fmt);
+        }
     }
 }
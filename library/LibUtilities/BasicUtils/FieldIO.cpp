@@ -44,14 +44,26 @@
 
 #include "zlib.h"
 #include <set>
+#include <fstream>
+#include <algorithm>
+#include <limits>
+
+#include <boost/cstdint.hpp>
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+#include <boost/thread/thread.hpp>
 
 #ifdef NEKTAR_USE_MPI
 #include <mpi.h>
+#include <LibUtilities/Communication/CommMpi.h>
 #endif
 
 // Buffer size for zlib compression/decompression
 #define CHUNK 16384
 
+// Uncompressed size of each independently compressed chunk in blocked mode
+#define BLOCK_CHUNK 1048576
+
 #ifndef NEKTAR_VERSION
 #define NEKTAR_VERSION "Unknown"
 #endif
@@ -134,16 +146,53 @@ namespace Nektar
         }
 
 
+        /**
+         * Registers the IOFormat solver information property, which selects
+         * the container format used when writing field files.
+         */
+        std::string FieldIO::formatLookupIds[2] = {
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "IOFormat", "Xml",    eXmlFormat),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "IOFormat", "Binary", eBinaryFormat)
+        };
+        std::string FieldIO::formatDef =
+            LibUtilities::SessionReader::RegisterDefaultSolverInfo(
+                "IOFormat", "Xml");
+
+
         /**
          *
          */
         FieldIO::FieldIO(
-                LibUtilities::CommSharedPtr pComm)
-            : m_comm(pComm)
+                LibUtilities::CommSharedPtr pComm,
+                FieldIOFormat               pFormat)
+            : m_comm(pComm),
+              m_format(pFormat),
+              m_compressionThreads(0)
         {
         }
 
 
+        /**
+         * Field data is compressed by default as a single zlib stream per
+         * element block. Calling this enables blocked compression, in which
+         * the data is split into independently compressed chunks that are
+         * compressed and decompressed concurrently on @a nThreads threads,
+         * or on all available cores if @a nThreads is zero. Files in either
+         * format can always be read.
+         */
+        void FieldIO::SetCompressionThreads(int nThreads)
+        {
+            ASSERTL0(nThreads >= 0, "Number of threads must be non-negative.");
+            if (nThreads == 0)
+            {
+                nThreads = std::max(1u, boost::thread::hardware_concurrency());
+            }
+            m_compressionThreads = nThreads;
+        }
+
+
         /**
          *
          */
@@ -166,11 +215,34 @@ namespace Nektar
                          "Invalid size of fielddata vector.");
             }
 
+            if (m_format == eBinaryFormat)
+            {
+                WriteBinary(outFile, fielddefs, fielddata, fieldmetadatamap);
+                return;
+            }
+
             // Prepare to write out data. In parallel, we must create directory
             // and determine the full pathname to the file to write out.
             // Any existing file/directory which is in the way is removed.
             std::string filename = SetUpOutput(outFile, fielddefs, fieldmetadatamap);
 
+            WritePartition(filename, fielddefs, fielddata, fieldmetadatamap);
+        }
+
+
+        /**
+         * @brief Writes the XML file containing the field data of this
+         * process to @a filename, as returned by SetUpOutput().
+         *
+         * No communication takes place, so this may be called from a thread
+         * other than the one driving the communicator.
+         */
+        void FieldIO::WritePartition(
+                const std::string                            &filename,
+                const std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+                std::vector<std::vector<NekDouble> >         &fielddata,
+                const FieldMetaDataMap                       &fieldmetadatamap)
+        {
             // Create the file (partition)
             TiXmlDocument doc;
             TiXmlDeclaration * decl = new TiXmlDeclaration("1.0", "utf-8", "");
@@ -188,192 +260,715 @@ namespace Nektar
                 TiXmlElement * elemTag = new TiXmlElement("ELEMENTS");
                 root->LinkEndChild(elemTag);
 
-                // Write FIELDS
-                std::string fieldsString;
+                WriteFieldDefinition(elemTag, fielddefs[f]);
+
+                std::string compressedDataString;
+                if (m_compressionThreads > 0)
                 {
-                    std::stringstream fieldsStringStream;
-                    bool first = true;
-                    for (std::vector<int>::size_type i = 0; i
-                    < fielddefs[f]->m_fields.size(); i++)
-                    {
-                        if (!first)
-                            fieldsStringStream << ",";
-                        fieldsStringStream << fielddefs[f]->m_fields[i];
-                        first = false;
-                    }
-                    fieldsString = fieldsStringStream.str();
+                    elemTag->SetAttribute("COMPRESSED", "ZlibBlocks");
+                    ASSERTL0(Z_OK == DeflateBlocks(fielddata[f],
+                                                   compressedDataString),
+                             "Failed to compress field data.");
+                }
+                else
+                {
+                    ASSERTL0(Z_OK == Deflate(fielddata[f], compressedDataString),
+                             "Failed to compress field data.");
                 }
-                elemTag->SetAttribute("FIELDS", fieldsString);
 
-                // Write SHAPE
-                std::string shapeString;
+                // If the string length is not divisible by 3,
+                // pad it. There is a bug in transform_width
+                // that will make it reference past the end
+                // and crash.
+                switch (compressedDataString.length() % 3)
                 {
-                    std::stringstream shapeStringStream;
-                    shapeStringStream << ShapeTypeMap[fielddefs[f]->m_shapeType];
-                    if(fielddefs[f]->m_numHomogeneousDir == 1)
-                    {
-                        shapeStringStream << "-HomogenousExp1D";
-                    }
-                    else if (fielddefs[f]->m_numHomogeneousDir == 2)
-                    {
-                        shapeStringStream << "-HomogenousExp2D";
-                    }
+                case 1:
+                    compressedDataString += '\0';
+                case 2:
+                    compressedDataString += '\0';
+                    break;
+                }
 
-                    shapeString = shapeStringStream.str();
+                // Convert from binary to base64.
+                typedef boost::archive::iterators::base64_from_binary<
+                        boost::archive::iterators::transform_width<
+                        std::string::const_iterator, 6, 8> > base64_t;
+                std::string base64string(base64_t(compressedDataString.begin()),
+                        base64_t(compressedDataString.end()));
+                elemTag->LinkEndChild(new TiXmlText(base64string));
+
+            }
+            doc.SaveFile(filename);
+        }
+
+
+        /**
+         * @brief Sets the attributes of an ELEMENTS tag describing the field
+         * definition @a fielddef.
+         */
+        void FieldIO::WriteFieldDefinition(
+                TiXmlElement                    *elemTag,
+                const FieldDefinitionsSharedPtr &fielddef)
+        {
+            // Write FIELDS
+            std::string fieldsString;
+            {
+                std::stringstream fieldsStringStream;
+                bool first = true;
+                for (std::vector<int>::size_type i = 0; i
+                < fielddef->m_fields.size(); i++)
+                {
+                    if (!first)
+                        fieldsStringStream << ",";
+                    fieldsStringStream << fielddef->m_fields[i];
+                    first = false;
+                }
+                fieldsString = fieldsStringStream.str();
+            }
+            elemTag->SetAttribute("FIELDS", fieldsString);
+
+            // Write SHAPE
+            std::string shapeString;
+            {
+                std::stringstream shapeStringStream;
+                shapeStringStream << ShapeTypeMap[fielddef->m_shapeType];
+                if(fielddef->m_numHomogeneousDir == 1)
+                {
+                    shapeStringStream << "-HomogenousExp1D";
+                }
+                else if (fielddef->m_numHomogeneousDir == 2)
+                {
+                    shapeStringStream << "-HomogenousExp2D";
                 }
-                elemTag->SetAttribute("SHAPE", shapeString);
 
-                // Write BASIS
-                std::string basisString;
+                shapeString = shapeStringStream.str();
+            }
+            elemTag->SetAttribute("SHAPE", shapeString);
+
+            // Write BASIS
+            std::string basisString;
+            {
+                std::stringstream basisStringStream;
+                bool first = true;
+                for (std::vector<BasisType>::size_type i = 0; i < fielddef->m_basis.size(); i++)
                 {
-                    std::stringstream basisStringStream;
+                    if (!first)
+                        basisStringStream << ",";
+                    basisStringStream
+                    << BasisTypeMap[fielddef->m_basis[i]];
+                    first = false;
+                }
+                basisString = basisStringStream.str();
+            }
+            elemTag->SetAttribute("BASIS", basisString);
+
+            // Write homogeneuous length details
+            if(fielddef->m_numHomogeneousDir)
+            {
+                std::string homoLenString;
+                {
+                    std::stringstream homoLenStringStream;
                     bool first = true;
-                    for (std::vector<BasisType>::size_type i = 0; i < fielddefs[f]->m_basis.size(); i++)
+                    for (int i = 0; i < fielddef->m_numHomogeneousDir; ++i)
                     {
                         if (!first)
-                            basisStringStream << ",";
-                        basisStringStream
-                        << BasisTypeMap[fielddefs[f]->m_basis[i]];
+                            homoLenStringStream << ",";
+                        homoLenStringStream
+                        << fielddef->m_homogeneousLengths[i];
                         first = false;
                     }
-                    basisString = basisStringStream.str();
+                    homoLenString = homoLenStringStream.str();
                 }
-                elemTag->SetAttribute("BASIS", basisString);
-
-                // Write homogeneuous length details
-                if(fielddefs[f]->m_numHomogeneousDir)
+                elemTag->SetAttribute("HOMOGENEOUSLENGTHS", homoLenString);
+            }
+				
+            // Write homogeneuous planes/lines details
+            if(fielddef->m_numHomogeneousDir)
+            {
+                if(fielddef->m_homogeneousYIDs.size() > 0)
                 {
-                    std::string homoLenString;
+                    std::string homoYIDsString;
                     {
-                        std::stringstream homoLenStringStream;
+                        std::stringstream homoYIDsStringStream;
                         bool first = true;
-                        for (int i = 0; i < fielddefs[f]->m_numHomogeneousDir; ++i)
+                        for(int i = 0; i < fielddef->m_homogeneousYIDs.size(); i++)
                         {
                             if (!first)
-                                homoLenStringStream << ",";
-                            homoLenStringStream
-                            << fielddefs[f]->m_homogeneousLengths[i];
+                                homoYIDsStringStream << ",";
+                            homoYIDsStringStream << fielddef->m_homogeneousYIDs[i];
                             first = false;
                         }
-                        homoLenString = homoLenStringStream.str();
+                        homoYIDsString = homoYIDsStringStream.str();
                     }
-                    elemTag->SetAttribute("HOMOGENEOUSLENGTHS", homoLenString);
+                    elemTag->SetAttribute("HOMOGENEOUSYIDS", homoYIDsString);
                 }
-				
-                // Write homogeneuous planes/lines details
-                if(fielddefs[f]->m_numHomogeneousDir)
+                
+                if(fielddef->m_homogeneousZIDs.size() > 0)
                 {
-                    if(fielddefs[f]->m_homogeneousYIDs.size() > 0)
+                    std::string homoZIDsString;
                     {
-                        std::string homoYIDsString;
+                        std::stringstream homoZIDsStringStream;
+                        bool first = true;
+                        for(int i = 0; i < fielddef->m_homogeneousZIDs.size(); i++)
                         {
-                            std::stringstream homoYIDsStringStream;
-                            bool first = true;
-                            for(int i = 0; i < fielddefs[f]->m_homogeneousYIDs.size(); i++)
-                            {
-                                if (!first)
-                                    homoYIDsStringStream << ",";
-                                homoYIDsStringStream << fielddefs[f]->m_homogeneousYIDs[i];
-                                first = false;
-                            }
-                            homoYIDsString = homoYIDsStringStream.str();
+                            if (!first)
+                                homoZIDsStringStream << ",";
+                            homoZIDsStringStream << fielddef->m_homogeneousZIDs[i];
+                            first = false;
                         }
-                        elemTag->SetAttribute("HOMOGENEOUSYIDS", homoYIDsString);
+                        homoZIDsString = homoZIDsStringStream.str();
                     }
-                    
-                    if(fielddefs[f]->m_homogeneousZIDs.size() > 0)
+                    elemTag->SetAttribute("HOMOGENEOUSZIDS", homoZIDsString);
+                }
+            }
+            
+            // Write NUMMODESPERDIR
+            std::string numModesString;
+            {
+                std::stringstream numModesStringStream;
+
+                if (fielddef->m_uniOrder)
+                {
+                    numModesStringStream << "UNIORDER:";
+                    // Just dump single definition
+                    bool first = true;
+                    for (std::vector<int>::size_type i = 0; i
+                             < fielddef->m_basis.size(); i++)
                     {
-                        std::string homoZIDsString;
-                        {
-                            std::stringstream homoZIDsStringStream;
-                            bool first = true;
-                            for(int i = 0; i < fielddefs[f]->m_homogeneousZIDs.size(); i++)
-                            {
-                                if (!first)
-                                    homoZIDsStringStream << ",";
-                                homoZIDsStringStream << fielddefs[f]->m_homogeneousZIDs[i];
-                                first = false;
-                            }
-                            homoZIDsString = homoZIDsStringStream.str();
-                        }
-                        elemTag->SetAttribute("HOMOGENEOUSZIDS", homoZIDsString);
+                        if (!first)
+                            numModesStringStream << ",";
+                        numModesStringStream << fielddef->m_numModes[i];
+                        first = false;
+                    }
+                }
+                else
+                {
+                    numModesStringStream << "MIXORDER:";
+                    bool first = true;
+                    for (std::vector<int>::size_type i = 0; i
+                             < fielddef->m_numModes.size(); i++)
+                    {
+                        if (!first)
+                            numModesStringStream << ",";
+                        numModesStringStream << fielddef->m_numModes[i];
+                        first = false;
                     }
                 }
                 
-                // Write NUMMODESPERDIR
-                std::string numModesString;
+                numModesString = numModesStringStream.str();
+            }
+            elemTag->SetAttribute("NUMMODESPERDIR", numModesString);
+
+            // Write ID
+            // Should ideally look at ways of compressing this stream
+            // if just sequential;
+            std::string idString;
+            {
+                std::stringstream idStringStream;
+                GenerateSeqString(fielddef->m_elementIDs,idString);
+            }
+            elemTag->SetAttribute("ID", idString);
+        }
+
+        /**
+         * Identifier stored in the first eight bytes of a binary field file.
+         */
+        static const char BinaryFieldMagic[8] =
+            { 'N', 'E', 'K', 'B', 'F', 'L', 'D', '\0' };
+
+        /**
+         * Version of the binary field file layout written by WriteBinary().
+         */
+        static const boost::uint64_t BinaryFieldVersion = 2;
+
+        namespace
+        {
+            /**
+             * @brief Writes byte ranges at absolute offsets of a file shared
+             * by all processes of a communicator.
+             *
+             * In parallel the file is opened collectively with MPI-IO and
+             * each process writes its own ranges independently. In serial
+             * (or without MPI) a standard file stream is used.
+             */
+            class BinaryFileWriter
+            {
+            public:
+                BinaryFileWriter(const std::string &filename,
+                                 CommSharedPtr      comm)
                 {
-                    std::stringstream numModesStringStream;
+#ifdef NEKTAR_USE_MPI
+                    m_useMpi = false;
+                    CommMpiSharedPtr mpiComm =
+                        boost::dynamic_pointer_cast<CommMpi>(comm);
+                    if (mpiComm && comm->GetSize() > 1)
+                    {
+                        int err = MPI_File_open(
+                            mpiComm->GetComm(),
+                            const_cast<char *>(filename.c_str()),
+                            MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                            MPI_INFO_NULL, &m_file);
+                        ASSERTL0(err == MPI_SUCCESS,
+                                 "Unable to open file: " + filename);
+
+                        // Opening does not truncate an existing file.
+                        err = MPI_File_set_size(m_file, 0);
+                        ASSERTL0(err == MPI_SUCCESS,
+                                 "Unable to truncate file: " + filename);
+                        m_useMpi = true;
+                        return;
+                    }
+#endif
+                    ASSERTL0(comm->GetSize() == 1,
+                             "Binary field output in parallel requires MPI.");
+                    m_stream.open(filename.c_str(),
+                                  std::ios::out | std::ios::binary |
+                                  std::ios::trunc);
+                    ASSERTL0(m_stream.good(),
+                             "Unable to open file: " + filename);
+                }
 
-                    if (fielddefs[f]->m_uniOrder)
+                /// Write @a nbytes bytes from @a data at @a offset.
+                void WriteAt(boost::uint64_t  offset,
+                             const void      *data,
+                             boost::uint64_t  nbytes)
+                {
+                    if (nbytes == 0)
                     {
-                        numModesStringStream << "UNIORDER:";
-                        // Just dump single definition
-                        bool first = true;
-                        for (std::vector<int>::size_type i = 0; i
-                                 < fielddefs[f]->m_basis.size(); i++)
-                        {
-                            if (!first)
-                                numModesStringStream << ",";
-                            numModesStringStream << fielddefs[f]->m_numModes[i];
-                            first = false;
-                        }
+                        return;
                     }
-                    else
+#ifdef NEKTAR_USE_MPI
+                    if (m_useMpi)
                     {
-                        numModesStringStream << "MIXORDER:";
-                        bool first = true;
-                        for (std::vector<int>::size_type i = 0; i
-                                 < fielddefs[f]->m_numModes.size(); i++)
+                        // MPI counts are ints, so write in bounded chunks.
+                        const boost::uint64_t maxChunk = 1 << 30;
+                        const char *ptr = static_cast<const char *>(data);
+                        while (nbytes > 0)
                         {
-                            if (!first)
-                                numModesStringStream << ",";
-                            numModesStringStream << fielddefs[f]->m_numModes[i];
-                            first = false;
+                            int n = (int) std::min(nbytes, maxChunk);
+                            int err = MPI_File_write_at(
+                                m_file, (MPI_Offset) offset,
+                                const_cast<char *>(ptr), n, MPI_BYTE,
+                                MPI_STATUS_IGNORE);
+                            ASSERTL0(err == MPI_SUCCESS,
+                                     "Failed to write binary field data.");
+                            offset += n;
+                            ptr    += n;
+                            nbytes -= n;
                         }
+                        return;
                     }
-                    
-                    numModesString = numModesStringStream.str();
+#endif
+                    m_stream.seekp(offset);
+                    m_stream.write(static_cast<const char *>(data), nbytes);
+                    ASSERTL0(m_stream.good(),
+                             "Failed to write binary field data.");
                 }
-                elemTag->SetAttribute("NUMMODESPERDIR", numModesString);
 
-                // Write ID
-                // Should ideally look at ways of compressing this stream
-                // if just sequential;
-                std::string idString;
+                /// Close the file; collective in parallel.
+                void Close()
                 {
-                    std::stringstream idStringStream;
-                    GenerateSeqString(fielddefs[f]->m_elementIDs,idString);
+#ifdef NEKTAR_USE_MPI
+                    if (m_useMpi)
+                    {
+                        MPI_File_close(&m_file);
+                        return;
+                    }
+#endif
+                    m_stream.close();
                 }
-                elemTag->SetAttribute("ID", idString);
 
-                std::string compressedDataString;
-                ASSERTL0(Z_OK == Deflate(fielddata[f], compressedDataString),
-                        "Failed to compress field data.");
+            private:
+#ifdef NEKTAR_USE_MPI
+                bool          m_useMpi;
+                MPI_File      m_file;
+#endif
+                std::ofstream m_stream;
+            };
+
+            /// Read @a nbytes bytes at @a offset of @a file into @a data.
+            void ReadAt(std::ifstream   &file,
+                        boost::uint64_t  offset,
+                        void            *data,
+                        boost::uint64_t  nbytes)
+            {
+                if (nbytes == 0)
+                {
+                    return;
+                }
+                file.seekg(offset);
+                file.read(static_cast<char *>(data), nbytes);
+                ASSERTL0(file.good(), "Failed to read binary field file.");
+            }
 
-                // If the string length is not divisible by 3,
-                // pad it. There is a bug in transform_width
-                // that will make it reference past the end
-                // and crash.
-                switch (compressedDataString.length() % 3)
+            /// Returns true if @a elmtSet holds an ID in [@a lo, @a hi].
+            bool IntersectsRange(const std::set<int> &elmtSet,
+                                 boost::uint64_t      lo,
+                                 boost::uint64_t      hi)
+            {
+                if (lo > hi)
                 {
-                case 1:
-                    compressedDataString += '\0';
-                case 2:
-                    compressedDataString += '\0';
-                    break;
+                    return false;
                 }
+                std::set<int>::const_iterator it =
+                    elmtSet.lower_bound((int) lo);
+                return it != elmtSet.end() && (boost::uint64_t) *it <= hi;
+            }
 
-                // Convert from binary to base64.
-                typedef boost::archive::iterators::base64_from_binary<
-                        boost::archive::iterators::transform_width<
-                        std::string::const_iterator, 6, 8> > base64_t;
-                std::string base64string(base64_t(compressedDataString.begin()),
-                        base64_t(compressedDataString.end()));
-                elemTag->LinkEndChild(new TiXmlText(base64string));
+            /// Serialise an XML document to a string.
+            std::string PrintXml(TiXmlDocument &doc)
+            {
+                TiXmlPrinter printer;
+                printer.SetStreamPrinting();
+                doc.Accept(&printer);
+                return std::string(printer.CStr());
+            }
+        }
+
+
+        /**
+         * @brief Writes the field to a single binary file shared by all
+         * processes.
+         *
+         * The file is laid out as follows (all integers are native-endian
+         * 64-bit unsigned values):
+         *
+         * - header: 8 byte identifier, layout version, number of processes
+         *   @f$ P @f$ and length of the metadata XML;
+         * - a table of @f$ P @f$ entries (region offset, number of element
+         *   blocks, length of the definitions XML, smallest and largest
+         *   element ID), one per process;
+         * - the metadata XML, as written to the INFO block of XML files;
+         * - for each process, a region containing an index of (offset,
+         *   number of values, smallest and largest element ID) for each
+         *   element block, the XML description of the element blocks and
+         *   finally the uncompressed data of each block.
+         *
+         * The offset of each region is found with an exclusive prefix sum of
+         * the region sizes, so that each process can write its own region
+         * independently, avoiding the directory of per-process files used by
+         * the XML format. Since the table and index give the element ID range
+         * and location of each block, a reader need only parse the regions
+         * and read the blocks containing the elements it owns.
+         */
+        void FieldIO::WriteBinary(
+                const std::string                      &outFile,
+                std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+                std::vector<std::vector<NekDouble> >   &fielddata,
+                const FieldMetaDataMap                 &fieldmetadatamap)
+        {
+            ASSERTL0(!outFile.empty(), "Empty path given to WriteBinary()");
+
+            int nprocs = m_comm->GetSize();
+            int rank   = m_comm->GetRank();
+            fs::path specPath(outFile);
+
+            // Remove any existing file or directory which is in the way
+            if (rank == 0)
+            {
+                if (m_comm->RemoveExistingFiles())
+                {
+                    try
+                    {
+                        fs::remove_all(specPath);
+                    }
+                    catch (fs::filesystem_error& e)
+                    {
+                        ASSERTL0(e.code().value() ==
+                                     berrc::no_such_file_or_directory,
+                                 "Filesystem error: " + string(e.what()));
+                    }
+                }
+                cout << "Writing: " << specPath << endl;
+            }
+            m_comm->Block();
 
+            // Describe the element blocks of this process, without data.
+            std::string defString;
+            {
+                TiXmlDocument doc;
+                TiXmlElement *root = new TiXmlElement("NEKTAR");
+                doc.LinkEndChild(root);
+                for (int f = 0; f < fielddefs.size(); ++f)
+                {
+                    TiXmlElement *elemTag = new TiXmlElement("ELEMENTS");
+                    root->LinkEndChild(elemTag);
+                    WriteFieldDefinition(elemTag, fielddefs[f]);
+                }
+                defString = PrintXml(doc);
             }
-            doc.SaveFile(filename);
+
+            std::string metaString;
+            if (rank == 0)
+            {
+                TiXmlDocument doc;
+                TiXmlElement *root = new TiXmlElement("NEKTAR");
+                doc.LinkEndChild(root);
+                AddInfoTag(root, fieldmetadatamap);
+                metaString = PrintXml(doc);
+            }
+
+            const boost::uint64_t nBlocks    = fielddefs.size();
+            const boost::uint64_t headerSize = 8 + 3 * sizeof(boost::uint64_t);
+            const boost::uint64_t entrySize  = 5 * sizeof(boost::uint64_t);
+            const boost::uint64_t indexSize  =
+                4 * sizeof(boost::uint64_t) * nBlocks;
+            const boost::uint64_t metaSize   = metaString.size();
+
+            boost::uint64_t dataSize = 0;
+            for (int f = 0; f < fielddefs.size(); ++f)
+            {
+                dataSize += fielddata[f].size() * sizeof(NekDouble);
+            }
+
+            // Locate the region of this process from the sizes of the
+            // regions of lower rank. The metadata, written by rank 0, precedes
+            // all regions.
+            boost::uint64_t offset = indexSize + defString.size() + dataSize;
+            if (rank == 0)
+            {
+                offset += metaSize;
+            }
+            m_comm->Exscan(offset);
+            offset += headerSize + entrySize * nprocs;
+            if (rank == 0)
+            {
+                offset += metaSize;
+            }
+
+            // Build the block index of this process.
+            std::vector<boost::uint64_t> index(4 * nBlocks);
+            boost::uint64_t dataOffset = offset + indexSize + defString.size();
+            boost::uint64_t minId = std::numeric_limits<boost::uint64_t>::max();
+            boost::uint64_t maxId = 0;
+            for (int f = 0; f < fielddefs.size(); ++f)
+            {
+                const std::vector<unsigned int> &ids =
+                    fielddefs[f]->m_elementIDs;
+
+                index[4*f]   = dataOffset;
+                index[4*f+1] = fielddata[f].size();
+                index[4*f+2] = ids.size() > 0 ?
+                    *std::min_element(ids.begin(), ids.end()) :
+                    std::numeric_limits<boost::uint64_t>::max();
+                index[4*f+3] = ids.size() > 0 ?
+                    *std::max_element(ids.begin(), ids.end()) : 0;
+                dataOffset  += fielddata[f].size() * sizeof(NekDouble);
+
+                minId = std::min(minId, index[4*f+2]);
+                maxId = std::max(maxId, index[4*f+3]);
+            }
+
+            BinaryFileWriter file(LibUtilities::PortablePath(specPath),
+                                  m_comm);
+
+            if (rank == 0)
+            {
+                boost::uint64_t header[3] =
+                    { BinaryFieldVersion, (boost::uint64_t) nprocs, metaSize };
+                file.WriteAt(0, BinaryFieldMagic, 8);
+                file.WriteAt(8, header, sizeof(header));
+                file.WriteAt(headerSize + entrySize * nprocs,
+                             metaString.c_str(), metaSize);
+            }
+
+            boost::uint64_t entry[5] =
+                { offset, nBlocks, (boost::uint64_t) defString.size(),
+                  minId, maxId };
+            file.WriteAt(headerSize + entrySize * rank, entry, entrySize);
+
+            if (nBlocks > 0)
+            {
+                file.WriteAt(offset, &index[0], indexSize);
+            }
+            file.WriteAt(offset + indexSize, defString.c_str(),
+                         defString.size());
+
+            for (int f = 0; f < fielddefs.size(); ++f)
+            {
+                if (fielddata[f].size() > 0)
+                {
+                    file.WriteAt(index[4*f], &fielddata[f][0],
+                                 fielddata[f].size() * sizeof(NekDouble));
+                }
+            }
+
+            file.Close();
+        }
+
+
+        /**
+         * @brief Imports a field written by WriteBinary().
+         *
+         * If @a ElementIDs is given, only the regions and element blocks
+         * whose element ID range contains at least one of these elements are
+         * considered, so that the definitions of other processes are neither
+         * read nor parsed. Of these, the blocks containing at least one of
+         * the elements are retained and their data is read directly from its
+         * offset in the file.
+         */
+        void FieldIO::ImportBinary(
+                const std::string                      &infilename,
+                std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+                std::vector<std::vector<NekDouble> >   &fielddata,
+                FieldMetaDataMap                       &fieldmetadatamap,
+                const Array<OneD, int>                  ElementIDs)
+        {
+            std::ifstream file(infilename.c_str(),
+                               std::ios::in | std::ios::binary);
+            ASSERTL0(file.good(), "Unable to open file: " + infilename);
+
+            const boost::uint64_t nprocs =
+                ImportBinaryMetaData(file, infilename, fieldmetadatamap);
+            const boost::uint64_t headerSize = 8 + 3 * sizeof(boost::uint64_t);
+            const boost::uint64_t entrySize  = 5 * sizeof(boost::uint64_t);
+
+            std::vector<boost::uint64_t> table(5 * nprocs);
+            ReadAt(file, headerSize, &table[0], entrySize * nprocs);
+
+            const bool readData = fielddata != NullVectorNekDoubleVector;
+
+            const bool selectElmts = ElementIDs != NullInt1DArray;
+
+            std::set<int> elmtSet;
+            if (selectElmts)
+            {
+                elmtSet.insert(ElementIDs.begin(), ElementIDs.end());
+            }
+
+            for (boost::uint64_t p = 0; p < nprocs; ++p)
+            {
+                const boost::uint64_t offset  = table[5*p];
+                const boost::uint64_t nBlocks = table[5*p+1];
+                const boost::uint64_t defSize = table[5*p+2];
+
+                if (nBlocks == 0 ||
+                    (selectElmts &&
+                     !IntersectsRange(elmtSet, table[5*p+3], table[5*p+4])))
+                {
+                    continue;
+                }
+
+                const boost::uint64_t indexSize =
+                    4 * sizeof(boost::uint64_t) * nBlocks;
+                std::vector<boost::uint64_t> index(4 * nBlocks);
+                ReadAt(file, offset, &index[0], indexSize);
+
+                bool needed = !selectElmts;
+                for (boost::uint64_t b = 0; b < nBlocks && !needed; ++b)
+                {
+                    needed = IntersectsRange(elmtSet, index[4*b+2],
+                                             index[4*b+3]);
+                }
+                if (!needed)
+                {
+                    continue;
+                }
+
+                std::string defString(defSize, '\0');
+                ReadAt(file, offset + indexSize, &defString[0], defSize);
+
+                TiXmlDocument doc;
+                doc.Parse(defString.c_str());
+                ASSERTL0(!doc.Error(), "Unable to parse field definitions "
+                         "of " + infilename + ": " + doc.ErrorDesc());
+
+                std::vector<FieldDefinitionsSharedPtr> blockDefs;
+                ImportFieldDefs(doc, blockDefs, false);
+                ASSERTL0(blockDefs.size() == nBlocks,
+                         "Inconsistent block index in " + infilename);
+
+                for (boost::uint64_t b = 0; b < nBlocks; ++b)
+                {
+                    if (selectElmts)
+                    {
+                        const std::vector<unsigned int> &ids =
+                            blockDefs[b]->m_elementIDs;
+                        bool found = false;
+                        for (int i = 0; i < ids.size() && !found; ++i)
+                        {
+                            found = elmtSet.count(ids[i]) > 0;
+                        }
+                        if (!found)
+                        {
+                            continue;
+                        }
+                    }
+
+                    fielddefs.push_back(blockDefs[b]);
+
+                    if (readData)
+                    {
+                        std::vector<NekDouble> data(index[4*b+1]);
+                        ASSERTL0(data.size() ==
+                                     blockDefs[b]->m_fields.size() *
+                                     CheckFieldDefinition(blockDefs[b]),
+                                 "Invalid size of field data in " +
+                                 infilename);
+                        if (data.size() > 0)
+                        {
+                            ReadAt(file, index[4*b], &data[0],
+                                   data.size() * sizeof(NekDouble));
+                        }
+                        fielddata.push_back(data);
+                    }
+                }
+            }
+        }
+
+
+        /**
+         * @brief Checks the header of a binary field file and imports the
+         * metadata which follows the process table. Returns the number of
+         * processes which wrote the file.
+         */
+        boost::uint64_t FieldIO::ImportBinaryMetaData(
+                std::ifstream     &file,
+                const std::string &infilename,
+                FieldMetaDataMap  &fieldmetadatamap)
+        {
+            char magic[8];
+            boost::uint64_t header[3];
+            ReadAt(file, 0, magic, 8);
+            ReadAt(file, 8, header, sizeof(header));
+            ASSERTL0(std::equal(magic, magic + 8, BinaryFieldMagic),
+                     "File is not a binary field file: " + infilename);
+            ASSERTL0(header[0] == BinaryFieldVersion,
+                     "Unsupported binary field file version in " +
+                     infilename);
+
+            const boost::uint64_t nprocs     = header[1];
+            const boost::uint64_t metaSize   = header[2];
+            const boost::uint64_t headerSize = 8 + sizeof(header);
+            const boost::uint64_t entrySize  = 5 * sizeof(boost::uint64_t);
+
+            std::string metaString(metaSize, '\0');
+            ReadAt(file, headerSize + entrySize * nprocs,
+                   &metaString[0], metaSize);
+            TiXmlDocument doc;
+            doc.Parse(metaString.c_str());
+            ASSERTL0(!doc.Error(), "Unable to parse metadata of " +
+                     infilename + ": " + doc.ErrorDesc());
+            ImportFieldMetaData(doc, fieldmetadatamap);
+
+            return nprocs;
+        }
+
+
+        /**
+         * @brief Returns true if @a infilename is a regular file written in
+         * the binary field format.
+         */
+        bool FieldIO::IsBinaryFile(const std::string &infilename)
+        {
+            std::ifstream file(infilename.c_str(),
+                               std::ios::in | std::ios::binary);
+            char magic[8];
+            if (!file.read(magic, 8))
+            {
+                return false;
+            }
+            return std::equal(magic, magic + 8, BinaryFieldMagic);
         }
 
 
@@ -482,6 +1077,11 @@ namespace Nektar
                     }
                 }
             }
+            else if (IsBinaryFile(infile)) // single shared binary file
+            {
+                ImportBinary(infile, fielddefs, fielddata, fieldmetadatamap,
+                             ElementIDs);
+            }
             else // serial format case 
             {
                 
@@ -611,6 +1211,14 @@ namespace Nektar
         void FieldIO::ImportFieldMetaData(std::string filename,
                                  FieldMetaDataMap &fieldmetadatamap)
         {
+            if (IsBinaryFile(filename))
+            {
+                std::ifstream file(filename.c_str(),
+                                   std::ios::in | std::ios::binary);
+                ImportBinaryMetaData(file, filename, fieldmetadatamap);
+                return;
+            }
+
             TiXmlDocument doc(filename);
             bool loadOkay = doc.LoadFile();
             
@@ -784,6 +1392,10 @@ namespace Nektar
                             numPointsString.insert(0, attr->Value());
                             numPointDef = true;
                         }
+                        else if (attrName == "COMPRESSED")
+                        {
+                            // Compression scheme, read by ImportFieldData.
+                        }
                         else
                         {
                             std::string errstr("Unknown attribute: ");
@@ -984,9 +1596,24 @@ namespace Nektar
                     std::string vCompressed(binary_t(elementStr.begin()),
                                             binary_t(elementStr.end()));
 
+                    // Files written in blocked mode are flagged; all others
+                    // hold a single zlib stream.
+                    const char *compressed = element->Attribute("COMPRESSED");
+                    bool blocked = compressed &&
+                        std::string(compressed) == "ZlibBlocks";
+
                     std::vector<NekDouble> elementFieldData;
-                    ASSERTL0(Z_OK == Inflate(vCompressed, elementFieldData),
-                            "Failed to decompress field data.");
+                    if (blocked)
+                    {
+                        ASSERTL0(Z_OK == InflateBlocks(vCompressed,
+                                                       elementFieldData),
+                                 "Failed to decompress field data.");
+                    }
+                    else
+                    {
+                        ASSERTL0(Z_OK == Inflate(vCompressed, elementFieldData),
+                                 "Failed to decompress field data.");
+                    }
 
                     fielddata.push_back(elementFieldData);
 
@@ -1333,6 +1960,205 @@ namespace Nektar
             }
         }
 
+        namespace
+        {
+            /// Location of one independently compressed chunk.
+            struct CompressedChunk
+            {
+                const Bytef *m_src;
+                uLong        m_srcLen;
+                Bytef       *m_dest;
+                uLong        m_destLen;
+            };
+
+            void ChunkWorker(const boost::function<void (int)> &func,
+                             int start, int stride, int nChunks)
+            {
+                for (int i = start; i < nChunks; i += stride)
+                {
+                    func(i);
+                }
+            }
+
+            /// Call @a func for each chunk index, spread over @a nThreads
+            /// threads.
+            void ForEachChunk(int nThreads, int nChunks,
+                              const boost::function<void (int)> &func)
+            {
+                nThreads = std::min(nThreads, nChunks);
+                if (nThreads <= 1)
+                {
+                    ChunkWorker(func, 0, 1, nChunks);
+                    return;
+                }
+
+                boost::thread_group threads;
+                for (int t = 0; t < nThreads; ++t)
+                {
+                    threads.create_thread(
+                        boost::bind(&ChunkWorker, boost::cref(func),
+                                    t, nThreads, nChunks));
+                }
+                threads.join_all();
+            }
+
+            void DeflateChunk(const Bytef              *in,
+                              boost::uint64_t           nBytes,
+                              std::vector<std::string> &out,
+                              std::vector<int>         &status,
+                              int                       i)
+            {
+                uLong  srcLen  = std::min<boost::uint64_t>(
+                    BLOCK_CHUNK, nBytes - (boost::uint64_t) i * BLOCK_CHUNK);
+                uLongf destLen = compressBound(srcLen);
+
+                out[i].resize(destLen);
+                status[i] = compress2((Bytef *)(&out[i][0]), &destLen,
+                                      in + (boost::uint64_t) i * BLOCK_CHUNK,
+                                      srcLen, Z_DEFAULT_COMPRESSION);
+                out[i].resize(destLen);
+            }
+
+            void InflateChunk(const std::vector<CompressedChunk> &chunks,
+                              std::vector<int>                   &status,
+                              int                                 i)
+            {
+                uLongf destLen = chunks[i].m_destLen;
+                status[i] = uncompress(chunks[i].m_dest, &destLen,
+                                       chunks[i].m_src, chunks[i].m_srcLen);
+                if (status[i] == Z_OK && destLen != chunks[i].m_destLen)
+                {
+                    status[i] = Z_DATA_ERROR;
+                }
+            }
+        }
+
+        /**
+         * Compress a vector of NekDouble values into a sequence of
+         * independent zlib streams, each holding at most BLOCK_CHUNK bytes of
+         * input, so that they may be compressed and decompressed
+         * concurrently. The output starts with the number of chunks followed
+         * by the uncompressed and then the compressed size of each chunk, all
+         * as 64-bit unsigned integers.
+         */
+        int FieldIO::DeflateBlocks(std::vector<NekDouble>& in,
+                                   string& out)
+        {
+            const boost::uint64_t nBytes  = in.size() * sizeof(NekDouble);
+            const boost::uint64_t nChunks =
+                (nBytes + BLOCK_CHUNK - 1) / BLOCK_CHUNK;
+
+            std::vector<std::string> chunks(nChunks);
+            std::vector<int>         status(nChunks, Z_OK);
+
+            if (nChunks > 0)
+            {
+                ForEachChunk(std::max(m_compressionThreads, 1), nChunks,
+                             boost::bind(&DeflateChunk,
+                                         (const Bytef *)(&in[0]), nBytes,
+                                         boost::ref(chunks),
+                                         boost::ref(status), _1));
+            }
+
+            std::vector<boost::uint64_t> table(2 * nChunks + 1);
+            table[0] = nChunks;
+            boost::uint64_t outSize = table.size() * sizeof(boost::uint64_t);
+            for (int i = 0; i < nChunks; ++i)
+            {
+                if (status[i] != Z_OK)
+                {
+                    return status[i];
+                }
+                table[1 + i] = std::min<boost::uint64_t>(
+                    BLOCK_CHUNK, nBytes - (boost::uint64_t) i * BLOCK_CHUNK);
+                table[1 + nChunks + i] = chunks[i].size();
+                outSize += chunks[i].size();
+            }
+
+            out.reserve(out.size() + outSize);
+            out.append((const char *)(&table[0]),
+                       table.size() * sizeof(boost::uint64_t));
+            for (int i = 0; i < nChunks; ++i)
+            {
+                out += chunks[i];
+            }
+            return Z_OK;
+        }
+
+
+        /**
+         * Decompress data written by DeflateBlocks() into a vector of
+         * NekDouble values, decompressing chunks concurrently.
+         */
+        int FieldIO::InflateBlocks(std::string& in,
+                                   std::vector<NekDouble>& out)
+        {
+            const boost::uint64_t wordSize = sizeof(boost::uint64_t);
+            boost::uint64_t nChunks;
+
+            if (in.size() < wordSize)
+            {
+                return Z_DATA_ERROR;
+            }
+            memcpy(&nChunks, &in[0], wordSize);
+
+            const boost::uint64_t headerSize = (2 * nChunks + 1) * wordSize;
+            if (in.size() < headerSize)
+            {
+                return Z_DATA_ERROR;
+            }
+            std::vector<boost::uint64_t> table(2 * nChunks);
+            if (nChunks > 0)
+            {
+                memcpy(&table[0], &in[wordSize], 2 * nChunks * wordSize);
+            }
+
+            // Locate each chunk in the input and output buffers. The input
+            // may carry trailing padding added for base64 encoding.
+            boost::uint64_t inSize = headerSize, outSize = 0;
+            for (int i = 0; i < nChunks; ++i)
+            {
+                outSize += table[i];
+                inSize  += table[nChunks + i];
+            }
+            if (in.size() < inSize || outSize % sizeof(NekDouble) != 0)
+            {
+                return Z_DATA_ERROR;
+            }
+
+            out.resize(outSize / sizeof(NekDouble));
+
+            std::vector<CompressedChunk> chunks(nChunks);
+            boost::uint64_t inOffset = headerSize, outOffset = 0;
+            for (int i = 0; i < nChunks; ++i)
+            {
+                chunks[i].m_src     = (const Bytef *)(&in[0]) + inOffset;
+                chunks[i].m_srcLen  = table[nChunks + i];
+                chunks[i].m_dest    = (Bytef *)(&out[0]) + outOffset;
+                chunks[i].m_destLen = table[i];
+                inOffset  += table[nChunks + i];
+                outOffset += table[i];
+            }
+
+            std::vector<int> status(nChunks, Z_OK);
+            if (nChunks > 0)
+            {
+                ForEachChunk(std::max(m_compressionThreads, 1), nChunks,
+                             boost::bind(&InflateChunk, boost::cref(chunks),
+                                         boost::ref(status), _1));
+            }
+
+            for (int i = 0; i < nChunks; ++i)
+            {
+                if (status[i] != Z_OK)
+                {
+                    return Z_DATA_ERROR;
+                }
+            }
+            return Z_OK;
+        }
+
+
         /**
          *
          */
@@ -43,6 +43,7 @@
 #include <LibUtilities/Foundations/Basis.h>
 #include <LibUtilities/Foundations/Points.h>
 #include <tinyxml.h>
+#include <fstream>
 
 // These are required for the Write(...) and Import(...) functions.
 #include <boost/archive/iterators/base64_from_binary.hpp>
@@ -52,6 +53,7 @@
 #include <boost/iostreams/filter/zlib.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 #include <boost/assign/list_of.hpp>
+#include <boost/cstdint.hpp>
 
 namespace Nektar
 {
@@ -130,6 +132,19 @@ namespace Nektar
         
         typedef boost::shared_ptr<FieldDefinitions> FieldDefinitionsSharedPtr;
 
+        /// Container format used when writing field files.
+        enum FieldIOFormat
+        {
+            eXmlFormat,     ///< XML file (or directory of XML files)
+            eBinaryFormat   ///< Single shared binary file with index header
+        };
+
+        const char* const FieldIOFormatMap[] =
+        {
+            "Xml",
+            "Binary"
+        };
+
 
         /// Write a field file in serial only
         LIB_UTILITIES_EXPORT void Write(
@@ -153,7 +168,8 @@ namespace Nektar
             public:
                 /// Constructor
                 LIB_UTILITIES_EXPORT FieldIO(
-                        LibUtilities::CommSharedPtr pComm);
+                        LibUtilities::CommSharedPtr pComm,
+                        FieldIOFormat               pFormat = eXmlFormat);
 
                 /// Write data in FLD format
                 LIB_UTILITIES_EXPORT void Write(
@@ -198,24 +214,75 @@ namespace Nektar
                         std::vector<std::vector<unsigned int> > &elementList,
                         const FieldMetaDataMap &fieldinfomap  = NullFieldMetaDataMap);
 
+                /// Prepares the output path of Write(). Collective in
+                /// parallel; returns the file name for this process.
+                LIB_UTILITIES_EXPORT std::string SetUpOutput(
+                        const std::string outname,
+                        const std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+                        const FieldMetaDataMap &fieldmetadatamap);
+
+                /// Writes the XML data of this process to a file given by
+                /// SetUpOutput(). Does not communicate.
+                LIB_UTILITIES_EXPORT void WritePartition(
+                        const std::string &filename,
+                        const std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+                        std::vector<std::vector<NekDouble> > &fielddata,
+                        const FieldMetaDataMap &fieldmetadatamap);
+
+                /// Enables multi-threaded blocked compression of field data.
+                LIB_UTILITIES_EXPORT void SetCompressionThreads(int nThreads);
+
+                /// Returns the container format used by Write().
+                FieldIOFormat GetFormat() const
+                {
+                    return m_format;
+                }
+
+                static std::string formatLookupIds[];
+                static std::string formatDef;
 
             private:
                 /// Communicator to use when writing parallel format
                 LibUtilities::CommSharedPtr    m_comm;
+                /// Container format used by Write()
+                FieldIOFormat                  m_format;
+                /// Threads used for blocked compression; zero for a single
+                /// zlib stream per element block.
+                int                            m_compressionThreads;
 
                 LIB_UTILITIES_EXPORT void AddInfoTag(
                         TiXmlElement * root,
                         const FieldMetaDataMap &fieldmetadatamap);
 
+                LIB_UTILITIES_EXPORT void WriteFieldDefinition(
+                        TiXmlElement                    *elemTag,
+                        const FieldDefinitionsSharedPtr &fielddef);
+
+                LIB_UTILITIES_EXPORT void WriteBinary(
+                        const std::string &outFile,
+                        std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+                        std::vector<std::vector<NekDouble> >   &fielddata,
+                        const FieldMetaDataMap &fieldmetadatamap);
+
+                LIB_UTILITIES_EXPORT void ImportBinary(
+                        const std::string& infilename,
+                        std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+                        std::vector<std::vector<NekDouble> > &fielddata,
+                        FieldMetaDataMap &fieldmetadatamap,
+                        const Array<OneD, int> ElementIDs);
+
+                LIB_UTILITIES_EXPORT bool IsBinaryFile(
+                        const std::string& infilename);
+
+                LIB_UTILITIES_EXPORT boost::uint64_t ImportBinaryMetaData(
+                        std::ifstream &file,
+                        const std::string& infilename,
+                        FieldMetaDataMap &fieldmetadatamap);
+
                 LIB_UTILITIES_EXPORT void GenerateSeqString(
                         const std::vector<unsigned int> &elmtids,
                         std::string &idString);
 
-                LIB_UTILITIES_EXPORT std::string SetUpOutput(
-                        const std::string outname,
-                        const std::vector<FieldDefinitionsSharedPtr> &fielddefs,
-                        const FieldMetaDataMap &fieldmetadatamap);
-
                 LIB_UTILITIES_EXPORT void ImportMultiFldFileIDs(
                         const std::string &inFile,
                         std::vector<std::string> &fileNames,
@@ -231,6 +298,13 @@ namespace Nektar
 
                 LIB_UTILITIES_EXPORT int Inflate(string& in,
                         std::vector<NekDouble>& out);
+
+                LIB_UTILITIES_EXPORT int DeflateBlocks(
+                        std::vector<NekDouble>& in,
+                        string& out);
+
+                LIB_UTILITIES_EXPORT int InflateBlocks(string& in,
+                        std::vector<NekDouble>& out);
         };
 
         typedef boost::shared_ptr<FieldIO> FieldIOSharedPtr;
@@ -0,0 +1,293 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File KDTree.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: k-d tree for nearest neighbour searches over point sets
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+#include <LibUtilities/BasicUtils/KDTree.h>
+
+namespace Nektar
+{
+namespace LibUtilities
+{
+
+namespace
+{
+
+/// Maximum number of points in a leaf, below which nodes are searched
+/// linearly.
+const int kLeafSize = 8;
+
+/// Orders point indices by one coordinate.
+struct CoordLess
+{
+    CoordLess(const Array<OneD, NekDouble> &c) : m_c(c.data())
+    {
+    }
+
+    bool operator()(int a, int b) const
+    {
+        return m_c[a] < m_c[b];
+    }
+
+    const NekDouble *m_c;
+};
+
+}
+
+KDTree::KDTree(
+    const int                                   dim,
+    const Array<OneD, Array<OneD, NekDouble> > &pts)
+    : m_dim(dim)
+{
+    ASSERTL0(dim >= 1 && pts.num_elements() >= dim,
+             "Insufficient coordinate arrays for k-d tree.");
+
+    int npts = pts[0].num_elements();
+
+    m_index.resize(npts);
+    m_splitDir.resize(npts, 0);
+    for (int i = 0; i < npts; ++i)
+    {
+        m_index[i] = i;
+    }
+
+    Build(0, npts, pts);
+
+    m_coords.resize(npts * m_dim);
+    for (int i = 0; i < npts; ++i)
+    {
+        for (int j = 0; j < m_dim; ++j)
+        {
+            m_coords[i * m_dim + j] = pts[j][m_index[i]];
+        }
+    }
+}
+
+/**
+ * @brief Arranges m_index[begin, end) so that its median splits the points
+ * along the direction of largest spread, then recurses on both halves.
+ */
+void KDTree::Build(
+    const int                                   begin,
+    const int                                   end,
+    const Array<OneD, Array<OneD, NekDouble> > &pts)
+{
+    if (end - begin <= kLeafSize)
+    {
+        return;
+    }
+
+    int       dir       = 0;
+    NekDouble maxSpread = -1.0;
+    for (int j = 0; j < m_dim; ++j)
+    {
+        NekDouble lo = pts[j][m_index[begin]], hi = lo;
+        for (int i = begin + 1; i < end; ++i)
+        {
+            lo = std::min(lo, pts[j][m_index[i]]);
+            hi = std::max(hi, pts[j][m_index[i]]);
+        }
+        if (hi - lo > maxSpread)
+        {
+            maxSpread = hi - lo;
+            dir       = j;
+        }
+    }
+
+    int mid = begin + (end - begin) / 2;
+    std::nth_element(m_index.begin() + begin, m_index.begin() + mid,
+                     m_index.begin() + end, CoordLess(pts[dir]));
+    m_splitDir[mid] = dir;
+
+    Build(begin,   mid, pts);
+    Build(mid + 1, end, pts);
+}
+
+NekDouble KDTree::DistSq(const NekDouble *pt, const int pos) const
+{
+    const NekDouble *c = &m_coords[pos * m_dim];
+    NekDouble d = 0.0;
+    for (int j = 0; j < m_dim; ++j)
+    {
+        NekDouble tmp = pt[j] - c[j];
+        d += tmp * tmp;
+    }
+    return d;
+}
+
+void KDTree::FindNearest(
+    const Array<OneD, const NekDouble> &pt,
+    const int                           k,
+          std::vector<Neighbour>       &result) const
+{
+    ASSERTL1(pt.num_elements() >= m_dim, "Point has too few coordinates.");
+
+    result.clear();
+    if (k <= 0 || m_index.empty())
+    {
+        return;
+    }
+
+    result.reserve(k + 1);
+    SearchNearest(pt.data(), 0, m_index.size(), k, result);
+
+    // result is a max-heap on distance; sort and map to original indices.
+    std::sort_heap(result.begin(), result.end());
+    for (int i = 0; i < result.size(); ++i)
+    {
+        result[i].second = m_index[result[i].second];
+    }
+}
+
+void KDTree::FindInRadius(
+    const Array<OneD, const NekDouble> &pt,
+    const NekDouble                     radius,
+          std::vector<Neighbour>       &result) const
+{
+    ASSERTL1(pt.num_elements() >= m_dim, "Point has too few coordinates.");
+
+    result.clear();
+    if (m_index.empty())
+    {
+        return;
+    }
+
+    SearchRadius(pt.data(), 0, m_index.size(), radius * radius, result);
+
+    std::sort(result.begin(), result.end());
+    for (int i = 0; i < result.size(); ++i)
+    {
+        result[i].second = m_index[result[i].second];
+    }
+}
+
+/**
+ * @brief Adds the points of m_index[begin, end) which are closer than the
+ * current k-th nearest to @a heap, a max-heap of (distance, position) pairs
+ * holding at most @a k entries.
+ */
+void KDTree::SearchNearest(
+    const NekDouble        *pt,
+    const int               begin,
+    const int               end,
+    const int               k,
+          std::vector<Neighbour> &heap) const
+{
+    if (end - begin <= kLeafSize)
+    {
+        for (int i = begin; i < end; ++i)
+        {
+            Neighbour n(DistSq(pt, i), i);
+            if (heap.size() < k)
+            {
+                heap.push_back(n);
+                std::push_heap(heap.begin(), heap.end());
+            }
+            else if (n < heap.front())
+            {
+                std::pop_heap(heap.begin(), heap.end());
+                heap.back() = n;
+                std::push_heap(heap.begin(), heap.end());
+            }
+        }
+        return;
+    }
+
+    int       mid  = begin + (end - begin) / 2;
+    int       dir  = m_splitDir[mid];
+    NekDouble diff = pt[dir] - m_coords[mid * m_dim + dir];
+
+    // Visit the half containing the point first.
+    if (diff < 0.0)
+    {
+        SearchNearest(pt, begin, mid, k, heap);
+    }
+    else
+    {
+        SearchNearest(pt, mid + 1, end, k, heap);
+    }
+
+    if (heap.size() < k || diff * diff < heap.front().first)
+    {
+        SearchNearest(pt, mid, mid + 1, k, heap);
+        if (diff < 0.0)
+        {
+            SearchNearest(pt, mid + 1, end, k, heap);
+        }
+        else
+        {
+            SearchNearest(pt, begin, mid, k, heap);
+        }
+    }
+}
+
+void KDTree::SearchRadius(
+    const NekDouble        *pt,
+    const int               begin,
+    const int               end,
+    const NekDouble         radiusSq,
+          std::vector<Neighbour> &result) const
+{
+    if (end - begin <= kLeafSize)
+    {
+        for (int i = begin; i < end; ++i)
+        {
+            NekDouble d = DistSq(pt, i);
+            if (d <= radiusSq)
+            {
+                result.push_back(Neighbour(d, i));
+            }
+        }
+        return;
+    }
+
+    int       mid  = begin + (end - begin) / 2;
+    int       dir  = m_splitDir[mid];
+    NekDouble diff = pt[dir] - m_coords[mid * m_dim + dir];
+
+    if (diff <= 0.0 || diff * diff <= radiusSq)
+    {
+        SearchRadius(pt, begin, mid, radiusSq, result);
+    }
+    if (diff >= 0.0 || diff * diff <= radiusSq)
+    {
+        SearchRadius(pt, mid + 1, end, radiusSq, result);
+    }
+    SearchRadius(pt, mid, mid + 1, radiusSq, result);
+}
+
+}
+}
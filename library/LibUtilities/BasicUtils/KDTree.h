@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File KDTree.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: k-d tree for nearest neighbour searches over point sets
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_UTILITIES_BASIC_UTILS_KDTREE_H
+#define NEKTAR_LIB_UTILITIES_BASIC_UTILS_KDTREE_H
+
+#include <utility>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <LibUtilities/LibUtilitiesDeclspec.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+
+namespace Nektar
+{
+namespace LibUtilities
+{
+
+/**
+ * @brief Balanced k-d tree over a fixed set of points, supporting k-nearest
+ * neighbour and fixed-radius queries.
+ *
+ * The points are copied into the tree on construction, in tree order, so that
+ * queries touch contiguous memory and do not share any reference-counted
+ * arrays. Queries are const and may therefore be issued concurrently from
+ * several threads.
+ *
+ * Query results are (squared distance, point index) pairs sorted by
+ * increasing distance, where the index refers to the position of the point in
+ * the arrays passed to the constructor.
+ */
+class KDTree
+{
+    public:
+        typedef std::pair<NekDouble, int> Neighbour;
+
+        /**
+         * @param dim   Number of coordinates of each point.
+         * @param pts   Point coordinates, pts[coordIdx][ptIdx]. Only the first
+         *              @a dim arrays are used.
+         */
+        LIB_UTILITIES_EXPORT KDTree(
+            const int                                   dim,
+            const Array<OneD, Array<OneD, NekDouble> > &pts);
+
+        /// Finds the @a k points nearest to @a pt (fewer if the tree holds
+        /// fewer points).
+        LIB_UTILITIES_EXPORT void FindNearest(
+            const Array<OneD, const NekDouble> &pt,
+            const int                           k,
+                  std::vector<Neighbour>       &result) const;
+
+        /// Finds all points within distance @a radius of @a pt.
+        LIB_UTILITIES_EXPORT void FindInRadius(
+            const Array<OneD, const NekDouble> &pt,
+            const NekDouble                     radius,
+                  std::vector<Neighbour>       &result) const;
+
+        int GetNpoints() const
+        {
+            return m_index.size();
+        }
+
+    private:
+        int                    m_dim;
+        /// Coordinates in tree order, point-major.
+        std::vector<NekDouble> m_coords;
+        /// Original index of each point in tree order.
+        std::vector<int>       m_index;
+        /// Splitting direction of the node whose median is at each position.
+        std::vector<int>       m_splitDir;
+
+        void Build(
+            const int                                   begin,
+            const int                                   end,
+            const Array<OneD, Array<OneD, NekDouble> > &pts);
+
+        NekDouble DistSq(const NekDouble *pt, const int pos) const;
+
+        void SearchNearest(
+            const NekDouble        *pt,
+            const int               begin,
+            const int               end,
+            const int               k,
+                  std::vector<Neighbour> &heap) const;
+
+        void SearchRadius(
+            const NekDouble        *pt,
+            const int               begin,
+            const int               end,
+            const NekDouble         radiusSq,
+                  std::vector<Neighbour> &result) const;
+};
+
+typedef boost::shared_ptr<KDTree> KDTreeSharedPtr;
+
+}
+}
+#endif
@@ -44,6 +44,10 @@
 #include <iomanip>
 #include <vector>
 #include <map>
+#include <set>
+#include <limits>
+#include <algorithm>
+#include <numeric>
 
 #include <tinyxml.h>
 
@@ -75,11 +79,20 @@ namespace Nektar
                 m_numFields(0),
                 m_fieldNameToId(),
                 m_comm(pSession->GetComm()),
-                m_weightingRequired(false)
+                m_weightingRequired(false),
+                m_chunked(false)
         {
             ReadConditions(pSession);
             ReadGeometry(pSession);
             ReadExpansions(pSession);
+
+            // Weights measured at runtime take precedence over those
+            // estimated from the expansions.
+            m_measuredWeights = pSession->GetElementWeights();
+            if (!m_measuredWeights.empty())
+            {
+                m_weightingRequired = true;
+            }
         }
 
         MeshPartition::~MeshPartition()
@@ -98,7 +111,15 @@ namespace Nektar
                 WeightElements();
             }
             CreateGraph(m_mesh);
-            PartitionGraph(m_mesh, nParts, m_localPartition);
+
+            if (IsCurvePartitioner())
+            {
+                PartitionGraphCurve(m_mesh, nParts, m_localPartition);
+            }
+            else
+            {
+                PartitionGraph(m_mesh, nParts, m_localPartition);
+            }
         }
 
         void MeshPartition::WriteLocalPartition(LibUtilities::SessionReaderSharedPtr& pSession)
@@ -179,6 +200,745 @@ namespace Nektar
             bndRegs = m_bndRegOrder;
         }
 
+        /**
+         * Write the mesh as @a nChunks chunks for distributed reading. Each
+         * chunk holds a contiguous range of the elements, ordered by ID,
+         * together with the entities they reference. Unlike a partition, the
+         * domain and boundary regions of each chunk are kept complete.
+         */
+        void MeshPartition::WriteChunks(
+                LibUtilities::SessionReaderSharedPtr& pSession,
+                int                                   nChunks)
+        {
+            int i, nElmt = m_meshElements.size();
+            ASSERTL0(nElmt >= nChunks, "Too few elements for this many chunks.");
+
+            m_chunked = true;
+            CreateGraph(m_mesh);
+
+            m_localPartition.resize(nChunks);
+            for (i = 0; i < nChunks; ++i)
+            {
+                m_localPartition[i] = m_mesh.create_subgraph();
+            }
+
+            BoostVertexIterator vertit, vertit_end;
+            for (boost::tie(vertit, vertit_end) = boost::vertices(m_mesh), i = 0;
+                 vertit != vertit_end; ++vertit, ++i)
+            {
+                int chunk = (int)((long)i * nChunks / nElmt);
+                m_mesh[*vertit].partition = chunk;
+                boost::add_vertex(i, m_localPartition[chunk]);
+            }
+
+            std::string dirname = pSession->GetSessionName() + "_chunks";
+            fs::path    pdirname(dirname);
+            if (!fs::is_directory(dirname))
+            {
+                fs::create_directory(dirname);
+            }
+
+            for (i = 0; i < nChunks; ++i)
+            {
+                TiXmlDocument vNew;
+                TiXmlDeclaration * decl = new TiXmlDeclaration("1.0", "utf-8", "");
+                vNew.LinkEndChild(decl);
+
+                TiXmlElement* vElmtNektar = new TiXmlElement("NEKTAR");
+                OutputPartition(pSession, m_localPartition[i], vElmtNektar);
+                vNew.LinkEndChild(vElmtNektar);
+
+                boost::format pad("C%1$07d.xml");
+                pad % i;
+                fs::path fullpath = pdirname / fs::path(pad.str());
+                vNew.SaveFile(PortablePath(fullpath));
+            }
+
+            m_chunked = false;
+        }
+
+        /**
+         * Partition a mesh of which each process holds a slice, as read from
+         * a chunked mesh, without assembling it on any one process.
+         *
+         * The elements are ordered along a Hilbert curve through their
+         * centroids and the curve is cut into @a nParts pieces of equal
+         * weight. The elements, the entities they reference and their
+         * composite membership are then sent to their new owners, so that
+         * afterwards this object holds exactly the partition of this
+         * process.
+         */
+        void MeshPartition::PartitionDistributedMesh(int nParts)
+        {
+            CommSharedPtr vComm = m_comm->GetRowComm();
+            ASSERTL0(nParts == vComm->GetSize(),
+                     "Distributed partitioning requires one partition per "
+                     "process.");
+
+            int i, nElmt = m_meshElements.size();
+            vComm->AllReduce(nElmt, LibUtilities::ReduceSum);
+            ASSERTL0(nElmt >= nParts,
+                     "Too few elements for this many processes.");
+            m_shared = false;
+
+            if (m_weightingRequired)
+            {
+                WeightElements();
+            }
+
+            std::vector<int> part;
+            PartitionCurve(vComm, nParts, 0, m_meshElements.size(), part);
+            if (nParts > 1)
+            {
+                MigrateElements(part);
+            }
+
+            nElmt = m_meshElements.size();
+            vComm->AllReduce(nElmt, LibUtilities::ReduceMin);
+            ASSERTL0(nElmt > 0, "Partitioning left a process without elements.");
+
+            if (m_weightingRequired)
+            {
+                m_vertWeights.clear();
+                WeightElements();
+            }
+
+            // Set up the graph of the local partition.
+            int rank = vComm->GetRank();
+            CreateGraph(m_mesh);
+
+            m_localPartition.resize(nParts);
+            for (i = 0; i < nParts; ++i)
+            {
+                m_localPartition[i] = m_mesh.create_subgraph();
+            }
+
+            BoostVertexIterator vertit, vertit_end;
+            for (boost::tie(vertit, vertit_end) = boost::vertices(m_mesh), i = 0;
+                 vertit != vertit_end; ++vertit, ++i)
+            {
+                m_mesh[*vertit].partition = rank;
+                boost::add_vertex(i, m_localPartition[rank]);
+            }
+        }
+
+        /**
+         * Compute the centroid of the vertices of the elements in positions
+         * [@a pStart, @a pEnd) of #m_meshElements.
+         */
+        void MeshPartition::ComputeCentroids(
+            int                     pStart,
+            int                     pEnd,
+            std::vector<NekDouble> &pCentroids)
+        {
+            std::map<int, MeshEntity>::iterator eIt = m_meshElements.begin();
+            int cnt = 0;
+
+            pCentroids.resize(3 * (pEnd - pStart));
+            std::advance(eIt, pStart);
+
+            for (; cnt < pEnd - pStart; ++eIt, ++cnt)
+            {
+                std::set<int> vFaces, vEdges, vVerts;
+                std::set<int>::iterator sIt;
+                const std::vector<unsigned int> &list = eIt->second.list;
+
+                switch (m_dim)
+                {
+                    case 1:
+                        vVerts.insert(list.begin(), list.end());
+                        break;
+                    case 2:
+                        vEdges.insert(list.begin(), list.end());
+                        break;
+                    case 3:
+                        vFaces.insert(list.begin(), list.end());
+                        break;
+                }
+
+                for (sIt = vFaces.begin(); sIt != vFaces.end(); ++sIt)
+                {
+                    const std::vector<unsigned int> &edges =
+                        m_meshFaces[*sIt].list;
+                    vEdges.insert(edges.begin(), edges.end());
+                }
+                for (sIt = vEdges.begin(); sIt != vEdges.end(); ++sIt)
+                {
+                    const std::vector<unsigned int> &verts =
+                        m_meshEdges[*sIt].list;
+                    vVerts.insert(verts.begin(), verts.end());
+                }
+
+                NekDouble x = 0.0, y = 0.0, z = 0.0;
+                for (sIt = vVerts.begin(); sIt != vVerts.end(); ++sIt)
+                {
+                    const MeshVertex &v = m_meshVertices[*sIt];
+                    x += v.x;
+                    y += v.y;
+                    z += v.z;
+                }
+
+                pCentroids[3*cnt  ] = x / vVerts.size();
+                pCentroids[3*cnt+1] = y / vVerts.size();
+                pCentroids[3*cnt+2] = z / vVerts.size();
+            }
+        }
+
+        /**
+         * Compute the position of the point with @a nBits-bit integer
+         * coordinates @a x along the Hilbert curve in @a nDim dimensions,
+         * using the transpose algorithm of Skilling (AIP Conf. Proc. 707,
+         * 2004). The coordinates are overwritten.
+         */
+        boost::uint64_t MeshPartition::HilbertKey(
+            unsigned int *x, int nDim, int nBits)
+        {
+            unsigned int M = 1u << (nBits - 1), P, Q, t;
+            int i;
+
+            // Inverse undo excess work
+            for (Q = M; Q > 1; Q >>= 1)
+            {
+                P = Q - 1;
+                for (i = 0; i < nDim; ++i)
+                {
+                    if (x[i] & Q)
+                    {
+                        x[0] ^= P;
+                    }
+                    else
+                    {
+                        t = (x[0] ^ x[i]) & P;
+                        x[0] ^= t;
+                        x[i] ^= t;
+                    }
+                }
+            }
+
+            // Gray encode
+            for (i = 1; i < nDim; ++i)
+            {
+                x[i] ^= x[i-1];
+            }
+            t = 0;
+            for (Q = M; Q > 1; Q >>= 1)
+            {
+                if (x[nDim-1] & Q)
+                {
+                    t ^= Q - 1;
+                }
+            }
+            for (i = 0; i < nDim; ++i)
+            {
+                x[i] ^= t;
+            }
+
+            // Interleave the transposed coordinates into a single key.
+            boost::uint64_t key = 0;
+            for (int b = nBits - 1; b >= 0; --b)
+            {
+                for (i = 0; i < nDim; ++i)
+                {
+                    key = (key << 1) | ((x[i] >> b) & 1);
+                }
+            }
+            return key;
+        }
+
+        /**
+         * Assign the elements in positions [@a pStart, @a pEnd) of
+         * #m_meshElements to one of @a nParts partitions, by cutting a
+         * Hilbert curve through the centroids of the elements held by all
+         * processes of @a pComm into pieces of equal weight. The weight of an
+         * element is the sum of its weights for each field, as given by
+         * CalculateElementWeight, if weighting is enabled.
+         *
+         * Each cut is located by bisection of the key space, which needs one
+         * reduction of the weights below all cuts per bit of the key, so that
+         * no element data is exchanged and the cost is dominated by the local
+         * sort of the keys.
+         */
+        void MeshPartition::PartitionCurve(
+            CommSharedPtr     pComm,
+            int               nParts,
+            int               pStart,
+            int               pEnd,
+            std::vector<int> &pPart)
+        {
+            const int nBits = 21;
+            const NekDouble nCells = (NekDouble)((1 << nBits) - 1);
+
+            int i, j, nElmt = pEnd - pStart;
+            std::vector<NekDouble> centroids;
+            ComputeCentroids(pStart, pEnd, centroids);
+
+            // Bounding box of the whole mesh
+            Array<OneD, NekDouble> bmin(3,  std::numeric_limits<NekDouble>::max());
+            Array<OneD, NekDouble> bmax(3, -std::numeric_limits<NekDouble>::max());
+            for (i = 0; i < nElmt; ++i)
+            {
+                for (j = 0; j < 3; ++j)
+                {
+                    bmin[j] = std::min(bmin[j], centroids[3*i+j]);
+                    bmax[j] = std::max(bmax[j], centroids[3*i+j]);
+                }
+            }
+            pComm->AllReduce(bmin, LibUtilities::ReduceMin);
+            pComm->AllReduce(bmax, LibUtilities::ReduceMax);
+
+            // Only directions in which the mesh has an extent are used, so
+            // that the curve fills the mesh of a two-dimensional problem.
+            std::vector<int> dirs;
+            for (j = 0; j < 3; ++j)
+            {
+                if (bmax[j] > bmin[j])
+                {
+                    dirs.push_back(j);
+                }
+            }
+            int nDim = std::max((int)dirs.size(), 1);
+            if (dirs.empty())
+            {
+                dirs.push_back(0);
+            }
+
+            // Sorted keys and cumulative weights of the local elements
+            std::vector<std::pair<boost::uint64_t, int> > keys(nElmt);
+            for (i = 0; i < nElmt; ++i)
+            {
+                unsigned int q[3];
+                for (j = 0; j < nDim; ++j)
+                {
+                    int d = dirs[j];
+                    NekDouble range = bmax[d] - bmin[d];
+                    q[j] = range > 0.0 ? (unsigned int)(
+                        (centroids[3*i+d] - bmin[d]) / range * nCells) : 0;
+                }
+                keys[i] = std::make_pair(HilbertKey(q, nDim, nBits), i);
+            }
+            std::sort(keys.begin(), keys.end());
+
+            std::vector<int> vIds;
+            std::map<int, MeshEntity>::iterator eIt = m_meshElements.begin();
+            std::advance(eIt, pStart);
+            for (i = 0; i < nElmt; ++i, ++eIt)
+            {
+                vIds.push_back(eIt->first);
+            }
+
+            std::vector<NekDouble> cumWeight(nElmt + 1, 0.0);
+            for (i = 0; i < nElmt; ++i)
+            {
+                NekDouble w = 1.0;
+                if (m_weightingRequired)
+                {
+                    const MultiWeight &mw = m_vertWeights[vIds[keys[i].second]];
+                    w = std::accumulate(mw.begin(), mw.end(), 0.0);
+                }
+                cumWeight[i+1] = cumWeight[i] + w;
+            }
+
+            NekDouble total = cumWeight[nElmt];
+            pComm->AllReduce(total, LibUtilities::ReduceSum);
+
+            // Bisection for the smallest keys below which the total weight
+            // reaches each multiple of total/nParts.
+            int nCuts = nParts - 1;
+            std::vector<boost::uint64_t> lo(nCuts, 0);
+            std::vector<boost::uint64_t> hi(nCuts, (boost::uint64_t)1 << (nDim * nBits));
+            std::vector<boost::uint64_t> mid(nCuts);
+            Array<OneD, NekDouble> below(std::max(nCuts, 1), 0.0);
+
+            for (int b = 0; b < nDim * nBits && nCuts > 0; ++b)
+            {
+                for (j = 0; j < nCuts; ++j)
+                {
+                    mid[j] = lo[j] + (hi[j] - lo[j]) / 2;
+                    below[j] = cumWeight[std::lower_bound(
+                        keys.begin(), keys.end(),
+                        std::make_pair(mid[j], -1)) - keys.begin()];
+                }
+
+                pComm->AllReduce(below, LibUtilities::ReduceSum);
+
+                for (j = 0; j < nCuts; ++j)
+                {
+                    if (below[j] < total * (j + 1) / nParts)
+                    {
+                        lo[j] = mid[j];
+                    }
+                    else
+                    {
+                        hi[j] = mid[j];
+                    }
+                }
+            }
+
+            // The partition of an element is the number of cuts at or below
+            // its key.
+            pPart.resize(nElmt);
+            for (i = 0; i < nElmt; ++i)
+            {
+                pPart[keys[i].second] = std::upper_bound(
+                    hi.begin(), hi.end(), keys[i].first) - hi.begin();
+            }
+        }
+
+        void MeshPartition::PackString(
+            const std::string &pStr, std::vector<int> &pBuf)
+        {
+            pBuf.push_back(pStr.size());
+            pBuf.insert(pBuf.end(), pStr.begin(), pStr.end());
+        }
+
+        std::string MeshPartition::UnpackString(
+            const Array<OneD, const int> &pBuf, int &pOffset)
+        {
+            int len = pBuf[pOffset++];
+            std::string str(len, ' ');
+            for (int i = 0; i < len; ++i)
+            {
+                str[i] = (char)pBuf[pOffset++];
+            }
+            return str;
+        }
+
+        /**
+         * Append the entities @a pIds to @a pBuf as their count followed by
+         * the ID, type, list and composites (ID and type) of each.
+         */
+        void MeshPartition::PackEntities(
+            const std::vector<int>           &pIds,
+            std::map<int, MeshEntity>        &pEntities,
+            std::map<int, std::vector<int> > &pComps,
+            std::vector<int>                 &pBuf)
+        {
+            pBuf.push_back(pIds.size());
+            for (int i = 0; i < pIds.size(); ++i)
+            {
+                const MeshEntity &e = pEntities[pIds[i]];
+                pBuf.push_back(e.id);
+                pBuf.push_back(e.type);
+                pBuf.push_back(e.list.size());
+                pBuf.insert(pBuf.end(), e.list.begin(), e.list.end());
+
+                std::map<int, std::vector<int> >::iterator cIt =
+                    pComps.find(pIds[i]);
+                if (cIt == pComps.end())
+                {
+                    pBuf.push_back(0);
+                    continue;
+                }
+
+                pBuf.push_back(cIt->second.size());
+                for (int j = 0; j < cIt->second.size(); ++j)
+                {
+                    pBuf.push_back(cIt->second[j]);
+                    pBuf.push_back(m_meshComposites[cIt->second[j]].type);
+                }
+            }
+        }
+
+        int MeshPartition::UnpackComposites(
+            const Array<OneD, const int> &pBuf,
+            int                           pOffset,
+            int                           pId)
+        {
+            int nComp = pBuf[pOffset++];
+            for (int j = 0; j < nComp; ++j)
+            {
+                MeshEntity &c = m_meshComposites[pBuf[pOffset]];
+                c.id   = pBuf[pOffset++];
+                c.type = (char)pBuf[pOffset++];
+                c.list.push_back(pId);
+            }
+            return pOffset;
+        }
+
+        int MeshPartition::UnpackEntities(
+            const Array<OneD, const int> &pBuf,
+            int                           pOffset,
+            std::map<int, MeshEntity>    &pEntities)
+        {
+            int nEntities = pBuf[pOffset++];
+            for (int i = 0; i < nEntities; ++i)
+            {
+                MeshEntity e;
+                e.id   = pBuf[pOffset++];
+                e.type = (char)pBuf[pOffset++];
+                int n  = pBuf[pOffset++];
+                e.list.assign(pBuf.get() + pOffset, pBuf.get() + pOffset + n);
+                pOffset += n;
+
+                // Entities shared by several elements may arrive from
+                // several processes, but need only be recorded once.
+                if (pEntities.count(e.id))
+                {
+                    pOffset = 2 * pBuf[pOffset] + pOffset + 1;
+                    continue;
+                }
+
+                pEntities[e.id] = e;
+                pOffset = UnpackComposites(pBuf, pOffset, e.id);
+            }
+            return pOffset;
+        }
+
+        /**
+         * Send each local element, together with the faces, edges, vertices
+         * and curves it references and the composites these belong to, to
+         * the process given by @a pPart. On return the mesh entities of this
+         * object are those of the received elements only.
+         */
+        void MeshPartition::MigrateElements(const std::vector<int> &pPart)
+        {
+            CommSharedPtr vComm = m_comm->GetRowComm();
+            int i, j, p, nProc = vComm->GetSize();
+
+            std::map<int, MeshEntity>::iterator eIt;
+            std::set<int>::iterator             sIt;
+
+            // Composites to which each entity belongs
+            std::map<int, std::vector<int> > vertComps, edgeComps;
+            std::map<int, std::vector<int> > faceComps, elmtComps;
+            for (eIt  = m_meshComposites.begin();
+                 eIt != m_meshComposites.end(); ++eIt)
+            {
+                std::map<int, std::vector<int> > *comps;
+                switch (eIt->second.type)
+                {
+                    case 'V': comps = &vertComps; break;
+                    case 'E': comps = &edgeComps; break;
+                    case 'F': comps = &faceComps; break;
+                    default:  comps = &elmtComps; break;
+                }
+                for (j = 0; j < eIt->second.list.size(); ++j)
+                {
+                    (*comps)[eIt->second.list[j]].push_back(eIt->first);
+                }
+            }
+
+            // Curves of each edge and face
+            std::map<MeshCurvedKey, MeshCurvedKey> entityCurves;
+            std::map<MeshCurvedKey, MeshCurved>::iterator cIt;
+            for (cIt = m_meshCurved.begin(); cIt != m_meshCurved.end(); ++cIt)
+            {
+                entityCurves[std::make_pair(cIt->second.entitytype,
+                                            cIt->second.entityid)] =
+                    cIt->first;
+            }
+
+            // Elements to send to each process
+            std::vector<std::vector<int> > sendElmts(nProc);
+            for (eIt = m_meshElements.begin(), i = 0;
+                 eIt != m_meshElements.end(); ++eIt, ++i)
+            {
+                sendElmts[pPart[i]].push_back(eIt->first);
+            }
+
+            std::vector<std::vector<int> >       sendInt(nProc);
+            std::vector<std::vector<NekDouble> > sendDbl(nProc);
+
+            for (p = 0; p < nProc; ++p)
+            {
+                std::set<int> vFaces, vEdges, vVerts;
+                for (i = 0; i < sendElmts[p].size(); ++i)
+                {
+                    const std::vector<unsigned int> &list =
+                        m_meshElements[sendElmts[p][i]].list;
+                    switch (m_dim)
+                    {
+                        case 1: vVerts.insert(list.begin(), list.end()); break;
+                        case 2: vEdges.insert(list.begin(), list.end()); break;
+                        case 3: vFaces.insert(list.begin(), list.end()); break;
+                    }
+                }
+                for (sIt = vFaces.begin(); sIt != vFaces.end(); ++sIt)
+                {
+                    const std::vector<unsigned int> &list =
+                        m_meshFaces[*sIt].list;
+                    vEdges.insert(list.begin(), list.end());
+                }
+                for (sIt = vEdges.begin(); sIt != vEdges.end(); ++sIt)
+                {
+                    const std::vector<unsigned int> &list =
+                        m_meshEdges[*sIt].list;
+                    vVerts.insert(list.begin(), list.end());
+                }
+
+                std::vector<int> &buf = sendInt[p];
+                PackEntities(sendElmts[p], m_meshElements, elmtComps, buf);
+                PackEntities(std::vector<int>(vFaces.begin(), vFaces.end()),
+                             m_meshFaces, faceComps, buf);
+                PackEntities(std::vector<int>(vEdges.begin(), vEdges.end()),
+                             m_meshEdges, edgeComps, buf);
+
+                buf.push_back(vVerts.size());
+                for (sIt = vVerts.begin(); sIt != vVerts.end(); ++sIt)
+                {
+                    const MeshVertex &v = m_meshVertices[*sIt];
+                    buf.push_back(v.id);
+                    sendDbl[p].push_back(v.x);
+                    sendDbl[p].push_back(v.y);
+                    sendDbl[p].push_back(v.z);
+
+                    std::map<int, std::vector<int> >::iterator vcIt =
+                        vertComps.find(v.id);
+                    if (vcIt == vertComps.end())
+                    {
+                        buf.push_back(0);
+                        continue;
+                    }
+                    buf.push_back(vcIt->second.size());
+                    for (j = 0; j < vcIt->second.size(); ++j)
+                    {
+                        buf.push_back(vcIt->second[j]);
+                        buf.push_back(m_meshComposites[vcIt->second[j]].type);
+                    }
+                }
+
+                std::vector<MeshCurvedKey> vCurves;
+                std::map<MeshCurvedKey, MeshCurvedKey>::iterator ecIt;
+                for (sIt = vEdges.begin(); sIt != vEdges.end(); ++sIt)
+                {
+                    ecIt = entityCurves.find(std::make_pair("E", *sIt));
+                    if (ecIt != entityCurves.end())
+                    {
+                        vCurves.push_back(ecIt->second);
+                    }
+                }
+                for (sIt = vFaces.begin(); sIt != vFaces.end(); ++sIt)
+                {
+                    ecIt = entityCurves.find(std::make_pair("F", *sIt));
+                    if (ecIt != entityCurves.end())
+                    {
+                        vCurves.push_back(ecIt->second);
+                    }
+                }
+
+                buf.push_back(vCurves.size());
+                for (i = 0; i < vCurves.size(); ++i)
+                {
+                    const MeshCurved &c = m_meshCurved[vCurves[i]];
+                    buf.push_back(c.id);
+                    buf.push_back(c.entityid);
+                    buf.push_back(c.npoints);
+                    PackString(c.entitytype, buf);
+                    PackString(c.type,       buf);
+                    PackString(c.data,       buf);
+                }
+            }
+
+            // Exchange the sizes of the messages, then the messages.
+            Array<OneD, int> sendSizeInt(nProc), sendOffsetInt(nProc, 0);
+            Array<OneD, int> sendSizeDbl(nProc), sendOffsetDbl(nProc, 0);
+            Array<OneD, int> recvSizeInt(nProc), recvOffsetInt(nProc, 0);
+            Array<OneD, int> recvSizeDbl(nProc), recvOffsetDbl(nProc, 0);
+
+            for (p = 0; p < nProc; ++p)
+            {
+                sendSizeInt[p] = sendInt[p].size();
+                sendSizeDbl[p] = sendDbl[p].size();
+            }
+            vComm->AlltoAll(sendSizeInt, recvSizeInt);
+            vComm->AlltoAll(sendSizeDbl, recvSizeDbl);
+
+            for (p = 1; p < nProc; ++p)
+            {
+                sendOffsetInt[p] = sendOffsetInt[p-1] + sendSizeInt[p-1];
+                sendOffsetDbl[p] = sendOffsetDbl[p-1] + sendSizeDbl[p-1];
+                recvOffsetInt[p] = recvOffsetInt[p-1] + recvSizeInt[p-1];
+                recvOffsetDbl[p] = recvOffsetDbl[p-1] + recvSizeDbl[p-1];
+            }
+
+            int nSendInt = sendOffsetInt[nProc-1] + sendSizeInt[nProc-1];
+            int nSendDbl = sendOffsetDbl[nProc-1] + sendSizeDbl[nProc-1];
+            int nRecvInt = recvOffsetInt[nProc-1] + recvSizeInt[nProc-1];
+            int nRecvDbl = recvOffsetDbl[nProc-1] + recvSizeDbl[nProc-1];
+
+            Array<OneD, int>       sendBufInt(std::max(nSendInt, 1));
+            Array<OneD, NekDouble> sendBufDbl(std::max(nSendDbl, 1));
+            Array<OneD, int>       recvBufInt(std::max(nRecvInt, 1));
+            Array<OneD, NekDouble> recvBufDbl(std::max(nRecvDbl, 1));
+
+            for (p = 0; p < nProc; ++p)
+            {
+                std::copy(sendInt[p].begin(), sendInt[p].end(),
+                          sendBufInt.get() + sendOffsetInt[p]);
+                std::copy(sendDbl[p].begin(), sendDbl[p].end(),
+                          sendBufDbl.get() + sendOffsetDbl[p]);
+            }
+            sendInt.clear();
+            sendDbl.clear();
+
+            vComm->AlltoAllv(sendBufInt, sendSizeInt, sendOffsetInt,
+                             recvBufInt, recvSizeInt, recvOffsetInt);
+            vComm->AlltoAllv(sendBufDbl, sendSizeDbl, sendOffsetDbl,
+                             recvBufDbl, recvSizeDbl, recvOffsetDbl);
+
+            // Replace the local mesh by the received entities.
+            m_meshElements  .clear();
+            m_meshFaces     .clear();
+            m_meshEdges     .clear();
+            m_meshVertices  .clear();
+            m_meshCurved    .clear();
+            m_meshComposites.clear();
+
+            for (p = 0; p < nProc; ++p)
+            {
+                int offset = recvOffsetInt[p];
+                int dcnt   = recvOffsetDbl[p];
+
+                if (recvSizeInt[p] == 0)
+                {
+                    continue;
+                }
+
+                offset = UnpackEntities(recvBufInt, offset, m_meshElements);
+                offset = UnpackEntities(recvBufInt, offset, m_meshFaces);
+                offset = UnpackEntities(recvBufInt, offset, m_meshEdges);
+
+                int nVerts = recvBufInt[offset++];
+                for (i = 0; i < nVerts; ++i, dcnt += 3)
+                {
+                    MeshVertex v;
+                    v.id = recvBufInt[offset++];
+                    v.x  = recvBufDbl[dcnt  ];
+                    v.y  = recvBufDbl[dcnt+1];
+                    v.z  = recvBufDbl[dcnt+2];
+
+                    if (m_meshVertices.count(v.id))
+                    {
+                        offset = 2 * recvBufInt[offset] + offset + 1;
+                        continue;
+                    }
+                    m_meshVertices[v.id] = v;
+                    offset = UnpackComposites(recvBufInt, offset, v.id);
+                }
+
+                int nCurves = recvBufInt[offset++];
+                for (i = 0; i < nCurves; ++i)
+                {
+                    MeshCurved c;
+                    c.id         = recvBufInt[offset++];
+                    c.entityid   = recvBufInt[offset++];
+                    c.npoints    = recvBufInt[offset++];
+                    c.entitytype = UnpackString(recvBufInt, offset);
+                    c.type       = UnpackString(recvBufInt, offset);
+                    c.data       = UnpackString(recvBufInt, offset);
+                    m_meshCurved[std::make_pair(c.entitytype, c.id)] = c;
+                }
+            }
+
+            // Composite lists are kept sorted for compact output.
+            for (eIt  = m_meshComposites.begin();
+                 eIt != m_meshComposites.end(); ++eIt)
+            {
+                std::vector<unsigned int> &list = eIt->second.list;
+                std::sort(list.begin(), list.end());
+            }
+        }
+
 
         void MeshPartition::ReadExpansions(const LibUtilities::SessionReaderSharedPtr& pSession)
         {
@@ -608,7 +1368,7 @@ namespace Nektar
          */
         void MeshPartition::WeightElements()
         {
-            std::vector<unsigned int> weight(m_numFields, 1);
+            std::vector<unsigned int> weight(std::max(m_numFields, 1), 1);
             std::map<int, MeshEntity>::iterator eIt;
             for (eIt = m_meshElements.begin(); eIt != m_meshElements.end(); ++eIt)
             {
@@ -652,6 +1412,33 @@ namespace Nektar
                     }
                 }
             } // for i
+
+            // Measured weights are scaled so that the mean weight is 100,
+            // since the partitioners require integer weights.
+            if (!m_measuredWeights.empty())
+            {
+                std::map<int, NekDouble>::iterator wIt;
+                NekDouble mean = 0.0;
+                for (wIt  = m_measuredWeights.begin();
+                     wIt != m_measuredWeights.end(); ++wIt)
+                {
+                    mean += wIt->second;
+                }
+                mean /= m_measuredWeights.size();
+
+                for (eIt = m_meshElements.begin(); eIt != m_meshElements.end(); ++eIt)
+                {
+                    wIt = m_measuredWeights.find(eIt->first);
+                    if (wIt == m_measuredWeights.end() || mean <= 0.0)
+                    {
+                        continue;
+                    }
+                    unsigned int w = std::max(
+                        1, (int)(100.0 * wIt->second / mean + 0.5));
+                    std::fill(m_vertWeights[eIt->first].begin(),
+                              m_vertWeights[eIt->first].end(), w);
+                }
+            }
         }
 
         void MeshPartition::CreateGraph(BoostSubGraph& pGraph)
@@ -812,6 +1599,64 @@ namespace Nektar
         }
 
 
+        /**
+         * Partition the mesh along a Hilbert curve through the element
+         * centroids, rather than partitioning its graph. When every process
+         * holds the mesh, each process of the row communicator orders and
+         * cuts its own slice of the elements and the resulting partitioning
+         * is assembled on all processes. Otherwise the partitioning is
+         * computed in serial.
+         */
+        void MeshPartition::PartitionGraphCurve(
+            BoostSubGraph&              pGraph,
+            int                         nParts,
+            std::vector<BoostSubGraph>& pLocalPartition)
+        {
+            int i, nElmt = m_meshElements.size();
+            CommSharedPtr vComm = m_shared ?
+                GetCommFactory().CreateInstance("Serial", 0, 0) :
+                m_comm->GetRowComm();
+
+            int rank   = vComm->GetRank();
+            int nProc  = vComm->GetSize();
+            int nStart = (int)((long)rank       * nElmt / nProc);
+            int nEnd   = (int)((long)(rank + 1) * nElmt / nProc);
+
+            std::vector<int> localPart;
+            PartitionCurve(vComm, nParts, nStart, nEnd, localPart);
+
+            Array<OneD, int> part(nElmt, 0);
+            std::copy(localPart.begin(), localPart.end(),
+                      part.get() + nStart);
+            vComm->AllReduce(part, LibUtilities::ReduceSum);
+
+            CheckPartitions(nParts, part);
+
+            // Create boost subgraph for this process's partitions
+            pLocalPartition.resize(nParts);
+            for (i = 0; i < nParts; ++i)
+            {
+                pLocalPartition[i] = pGraph.create_subgraph();
+            }
+
+            BoostVertexIterator vertit, vertit_end;
+            for (boost::tie(vertit, vertit_end) = boost::vertices(pGraph), i = 0;
+                 vertit != vertit_end; ++vertit, ++i)
+            {
+                pGraph[*vertit].partition = part[i];
+                boost::add_vertex(i, pLocalPartition[part[i]]);
+            }
+        }
+
+        /**
+         * Whether this partitioner orders the elements along a space-filling
+         * curve instead of partitioning the graph of the mesh.
+         */
+        bool MeshPartition::IsCurvePartitioner() const
+        {
+            return false;
+        }
+
         void MeshPartition::CheckPartitions(int nParts, Array<OneD, int> &pPart)
         {
             unsigned int       i     = 0;
@@ -855,7 +1700,8 @@ namespace Nektar
             TiXmlElement* vElmtGeometry = new TiXmlElement("GEOMETRY");
             vElmtGeometry->SetAttribute("DIM", vDim);
             vElmtGeometry->SetAttribute("SPACE", vSpace);
-            vElmtGeometry->SetAttribute("PARTITION", vPart);
+            vElmtGeometry->SetAttribute(m_chunked ? "CHUNK" : "PARTITION",
+                                        vPart);
 
             TiXmlElement *vVertex  = new TiXmlElement("VERTEX");
             TiXmlElement *vEdge    = new TiXmlElement("EDGE");
@@ -1122,7 +1968,10 @@ namespace Nektar
             bool comma = false;
             for (unsigned int i = 0; i < m_domain.size(); ++i)
             {
-                if (vComposites.find(m_domain[i]) != vComposites.end())
+                // Chunks keep the whole domain, since the composites are
+                // completed when the chunks are read.
+                if (m_chunked ||
+                    vComposites.find(m_domain[i]) != vComposites.end())
                 {
                     vDomainListStr += comma ? "," : "";
                     comma = true;
@@ -1152,7 +2001,14 @@ namespace Nektar
 
             pNektar->LinkEndChild(vElmtGeometry);
 
-            if (pSession->DefinesElement("Nektar/Conditions"))
+            if (m_chunked && pSession->DefinesElement("Nektar/Conditions"))
+            {
+                // Boundary regions are filtered when the chunks are
+                // partitioned, so are kept in full here.
+                pNektar->LinkEndChild(new TiXmlElement(
+                    *pSession->GetElement("Nektar/Conditions")));
+            }
+            else if (pSession->DefinesElement("Nektar/Conditions"))
             {
                 std::set<int> vBndRegionIdList;
                 TiXmlElement* vConditions    = new TiXmlElement(*pSession->GetElement("Nektar/Conditions"));
@@ -38,6 +38,7 @@
 
 #include <boost/graph/subgraph.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <boost/cstdint.hpp>
 #include <LibUtilities/Communication/Comm.h>
 
 class TiXmlElement;
@@ -66,10 +67,13 @@ namespace Nektar
             LIB_UTILITIES_EXPORT virtual ~MeshPartition();
 
             LIB_UTILITIES_EXPORT void PartitionMesh(int nParts, bool shared = false);
+            LIB_UTILITIES_EXPORT void PartitionDistributedMesh(int nParts);
             LIB_UTILITIES_EXPORT void WriteLocalPartition(
                     SessionReaderSharedPtr& pSession);
             LIB_UTILITIES_EXPORT void WriteAllPartitions(
                     SessionReaderSharedPtr& pSession);
+            LIB_UTILITIES_EXPORT void WriteChunks(
+                    SessionReaderSharedPtr& pSession, int nChunks);
 
             LIB_UTILITIES_EXPORT void PrintPartInfo(std::ostream &out);
             LIB_UTILITIES_EXPORT void GetCompositeOrdering(
@@ -214,7 +218,10 @@ namespace Nektar
             CommSharedPtr                       m_comm;
 
             bool                                m_weightingRequired;
+            /// Element weights measured at runtime, if rebalancing.
+            std::map<int, NekDouble>            m_measuredWeights;
             bool                                m_shared;
+            bool                                m_chunked;
 
             void ReadExpansions(const SessionReaderSharedPtr& pSession);
             void ReadGeometry(const SessionReaderSharedPtr& pSession);
@@ -225,6 +232,8 @@ namespace Nektar
                                 int nParts,
                                 std::vector<BoostSubGraph>& pLocalPartition);
 
+            virtual bool IsCurvePartitioner() const;
+
             virtual void PartitionGraphImpl(
                     int&                              nVerts,
                     int&                              nVertConds,
@@ -236,6 +245,41 @@ namespace Nektar
                     int&                              volume,
                     Nektar::Array<Nektar::OneD, int>& part) = 0;
 
+            void ComputeCentroids(
+                int                     pStart,
+                int                     pEnd,
+                std::vector<NekDouble> &pCentroids);
+            void PartitionCurve(
+                CommSharedPtr     pComm,
+                int               nParts,
+                int               pStart,
+                int               pEnd,
+                std::vector<int> &pPart);
+            void PartitionGraphCurve(
+                BoostSubGraph&              pGraph,
+                int                         nParts,
+                std::vector<BoostSubGraph>& pLocalPartition);
+            void MigrateElements(const std::vector<int> &pPart);
+            void PackEntities(
+                const std::vector<int>                       &pIds,
+                std::map<int, MeshEntity>                    &pEntities,
+                std::map<int, std::vector<int> >             &pComps,
+                std::vector<int>                             &pBuf);
+            int  UnpackEntities(
+                const Array<OneD, const int>                 &pBuf,
+                int                                           pOffset,
+                std::map<int, MeshEntity>                    &pEntities);
+            int  UnpackComposites(
+                const Array<OneD, const int>                 &pBuf,
+                int                                           pOffset,
+                int                                           pId);
+            static void PackString(
+                const std::string &pStr, std::vector<int> &pBuf);
+            static std::string UnpackString(
+                const Array<OneD, const int> &pBuf, int &pOffset);
+            static boost::uint64_t HilbertKey(
+                unsigned int *x, int nDim, int nBits);
+
             void OutputPartition(SessionReaderSharedPtr& pSession, BoostSubGraph& pGraph, TiXmlElement* pGeometry);
             void CheckPartitions(int nParts, Array<OneD, int> &pPart);
             int CalculateElementWeight(char elmtType, bool bndWeight, int na, int nb, int nc);
@@ -0,0 +1,84 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File MeshPartitionSFC.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Space-filling curve partitioner interface
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "MeshPartitionSFC.h"
+
+#include "LibUtilities/BasicUtils/SessionReader.h"
+
+namespace Nektar
+{
+namespace LibUtilities
+{
+
+    std::string MeshPartitionSFC::className
+        = GetMeshPartitionFactory().RegisterCreatorFunction(
+            "SFC",
+            MeshPartitionSFC::create,
+            "Partitioning along a Hilbert space-filling curve.");
+
+    std::string MeshPartitionSFC::cmdSwitch
+        = SessionReader::RegisterCmdLineFlag("use-sfc","","Use a space-filling curve for mesh partitioning.");
+
+    MeshPartitionSFC::MeshPartitionSFC(const SessionReaderSharedPtr& pSession)
+        : MeshPartition(pSession)
+    {
+
+    }
+
+    MeshPartitionSFC::~MeshPartitionSFC()
+    {
+
+    }
+
+    bool MeshPartitionSFC::IsCurvePartitioner() const
+    {
+        return true;
+    }
+
+    void MeshPartitionSFC::PartitionGraphImpl(
+            int&                              nVerts,
+            int&                              nVertConds,
+            Nektar::Array<Nektar::OneD, int>& xadj,
+            Nektar::Array<Nektar::OneD, int>& adjcy,
+            Nektar::Array<Nektar::OneD, int>& vertWgt,
+            Nektar::Array<Nektar::OneD, int>& vertSize,
+            int&                              nparts,
+            int&                              volume,
+            Nektar::Array<Nektar::OneD, int>& part)
+    {
+        ASSERTL0(false, "The SFC partitioner does not partition the mesh graph.");
+    }
+}
+}
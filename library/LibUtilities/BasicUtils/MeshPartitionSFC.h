@@ -0,0 +1,88 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File MeshPartitionSFC.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Space-filling curve partitioner interface
+//
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NEKTAR_LIB_UTILITIES_MESHPARTITIONSFC_H
+#define NEKTAR_LIB_UTILITIES_MESHPARTITIONSFC_H
+
+#include "LibUtilities/Memory/NekMemoryManager.hpp"
+
+#include "MeshPartition.h"
+
+namespace Nektar
+{
+namespace LibUtilities
+{
+
+    /**
+     * Partitions the mesh by ordering the element centroids along a Hilbert
+     * curve and cutting the curve into pieces of equal weight. This does not
+     * require the graph of the mesh on a single process and is considerably
+     * faster than graph partitioning, at the cost of a larger partition
+     * boundary.
+     */
+    class MeshPartitionSFC : public MeshPartition
+    {
+        public:
+            /// Creates an instance of this class
+            static MeshPartitionSharedPtr create(const SessionReaderSharedPtr& pSession)
+            {
+                return MemoryManager<MeshPartitionSFC>::AllocateSharedPtr(pSession);
+            }
+
+            /// Name of class
+            static std::string className;
+            static std::string cmdSwitch;
+
+            MeshPartitionSFC(const SessionReaderSharedPtr& pSession);
+            virtual ~MeshPartitionSFC();
+
+        private:
+            virtual bool IsCurvePartitioner() const;
+
+            virtual void PartitionGraphImpl(
+                    int&                              nVerts,
+                    int&                              nVertConds,
+                    Nektar::Array<Nektar::OneD, int>& xadj,
+                    Nektar::Array<Nektar::OneD, int>& adjcy,
+                    Nektar::Array<Nektar::OneD, int>& vertWgt,
+                    Nektar::Array<Nektar::OneD, int>& vertSize,
+                    int&                              nparts,
+                    int&                              volume,
+                    Nektar::Array<Nektar::OneD, int>& part);
+    };
+
+}
+}
+
+#endif
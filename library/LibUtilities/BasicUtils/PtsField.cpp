@@ -34,7 +34,11 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
 #include <LibUtilities/BasicUtils/PtsField.h>
+#include <LibUtilities/Memory/NekMemoryManager.hpp>
 
 namespace Nektar
 {
@@ -49,6 +53,9 @@ namespace LibUtilities
  *
  * Set coord_id to -1 to use n-D interpolation for an n-dimensional field.
  * The most suitable algorithm is chosen automatically.
+ *
+ * The physical points are divided evenly between the threads set by
+ * SetNumThreads().
  */
 void PtsField::CalcWeights(
     const Array<OneD, Array<OneD, NekDouble> > &physCoords,
@@ -58,48 +65,113 @@ void PtsField::CalcWeights(
              "physCoords is smaller than number of dimesnions");
 
     int nPhysPts = physCoords[0].num_elements();
-    int lastProg = 0;
 
     m_weights = Array<OneD, Array<OneD, float> >(nPhysPts);
     m_neighInds = Array<OneD, Array<OneD, unsigned int> >(nPhysPts);
 
-    // interpolate points and transform
-    for (int i = 0; i < nPhysPts; ++i)
+    // The neighbour search tree is shared by all threads, so build it here.
+    if (m_dim > 1 && coordId < 0 && !m_kdTree)
     {
-        Array<OneD, NekDouble> physPt(m_dim);
-        for (int j = 0; j < m_dim; ++j)
+        m_kdTree = MemoryManager<KDTree>::AllocateSharedPtr(m_dim, m_pts);
+    }
+
+    int nThreads = max(1, min(m_numThreads, nPhysPts));
+    vector<std::string> errors(nThreads);
+
+    // The calling thread handles the first range and reports progress.
+    boost::thread_group threads;
+    for (int t = 1; t < nThreads; ++t)
+    {
+        threads.create_thread(
+            boost::bind(&PtsField::CalcWeightsRange, this,
+                        boost::cref(physCoords), coordId,
+                        t * nPhysPts / nThreads, (t + 1) * nPhysPts / nThreads,
+                        false, boost::ref(errors[t])));
+    }
+    CalcWeightsRange(physCoords, coordId, 0, nPhysPts / nThreads, true,
+                     errors[0]);
+    threads.join_all();
+
+    for (int t = 0; t < nThreads; ++t)
+    {
+        if (!errors[t].empty())
         {
-            physPt[j] = physCoords[j][i];
+            throw ErrorUtil::NekError(errors[t]);
         }
+    }
+}
+
+
+/**
+ * @brief Compute the weights of the physical points begin to end - 1.
+ *
+ * Errors are returned in @a error rather than thrown, since this may run on a
+ * worker thread.
+ */
+void PtsField::CalcWeightsRange(
+    const Array<OneD, Array<OneD, NekDouble> > &physCoords,
+    short coordId,
+    const int begin,
+    const int end,
+    const bool reportProgress,
+    std::string &error)
+{
+    int lastProg = 0;
+    int nPhysPts = physCoords[0].num_elements();
+
+    try
+    {
+        Array<OneD, NekDouble> physPt(m_dim);
 
-        if (m_dim == 1 || coordId >= 0)
+        // interpolate points and transform
+        for (int i = begin; i < end; ++i)
         {
-            if (m_dim == 1)
+            for (int j = 0; j < m_dim; ++j)
             {
-                coordId = 0;
+                physPt[j] = physCoords[j][i];
             }
 
-            if (m_pts[0].num_elements() <= 2)
+            if (m_dim == 1 || coordId >= 0)
             {
-                CalcW_Linear(i, physPt[coordId]);
+                if (m_dim == 1)
+                {
+                    coordId = 0;
+                }
+
+                if (m_pts[0].num_elements() <= 2)
+                {
+                    CalcW_Linear(i, physPt[coordId]);
+                }
+                else
+                {
+                    CalcW_Quadratic(i, physPt[coordId]);
+                }
             }
             else
             {
-                CalcW_Quadratic(i, physPt[coordId]);
+                CalcW_Shepard(i, physPt);
             }
-        }
-        else
-        {
-            CalcW_Shepard(i, physPt);
-        }
 
-        int progress = int(100 * i / nPhysPts);
-        if (m_progressCallback && progress > lastProg)
-        {
-            m_progressCallback(i, nPhysPts);
-            lastProg = progress;
+            if (!reportProgress)
+            {
+                continue;
+            }
+
+            // Scale to the whole set of points, assuming the other threads
+            // progress at the same rate.
+            int pos      = (long long)(i - begin) * nPhysPts / (end - begin);
+            int progress = int(100 * (long long)pos / nPhysPts);
+            if (m_progressCallback && progress > lastProg)
+            {
+                m_progressCallback(pos, nPhysPts);
+                lastProg = progress;
+            }
         }
     }
+    catch (const std::exception &e)
+    {
+        error = e.what();
+    }
 }
 
 
@@ -228,6 +300,22 @@ void PtsField::SetConnectivity(const vector< Array< OneD, int > > &conn)
 void PtsField::SetDim(const int ptsDim)
 {
     m_dim = ptsDim;
+    m_kdTree.reset();
+}
+
+
+/**
+ * @brief Set the number of threads used by CalcWeights, where 0 selects the
+ * number of hardware threads.
+ */
+void PtsField::SetNumThreads(const int nThreads)
+{
+    ASSERTL0(nThreads >= 0, "Number of threads must be non-negative");
+    m_numThreads = nThreads;
+    if (m_numThreads == 0)
+    {
+        m_numThreads = max(1u, boost::thread::hardware_concurrency());
+    }
 }
 
 
@@ -316,6 +404,7 @@ void PtsField::SetPts(Array< OneD, Array< OneD, NekDouble > > &pts)
              "Pts field count mismatch");
 
     m_pts = pts;
+    m_kdTree.reset();
 }
 
 
@@ -559,51 +648,44 @@ NekDouble PtsField::DistSq(const Array< OneD, NekDouble > &point1,
 
 
 /**
- * @brief Find nearest neighbours using a brute-force "algorithm".
+ * @brief Find nearest neighbours using a k-d tree over the field points.
  *
  * @param physPt              Coordinates of the physical point its neighbours
  * we are looking for
- * @param neighbourPts        The points we found
+ * @param neighbourPts        The points we found, nearest first
  * @param numPts              The number of points to find
  *
- * This iterates over all points, computes the (squared) euclidean distance
- * and chooses the numPts closest points. Thus, its very expensive and
- * inefficient.
+ * The tree is built on the first call, or by CalcWeights, and reused
+ * until the points change.
  */
 void PtsField::FindNeighbours(const Array< OneD, NekDouble > &physPt,
                               vector< PtsPoint > &neighbourPts,
                               const unsigned int numPts)
 {
-    int npts = m_pts[0].num_elements();
-
-    // generate an initial set of intPts
-    for (int i = 0; i < numPts; ++i)
+    if (!m_kdTree)
     {
-        PtsPoint intPt = PtsPoint(-1, Array<OneD, NekDouble>(m_dim), 1E30);
-        neighbourPts.push_back(intPt);
+        m_kdTree = MemoryManager<KDTree>::AllocateSharedPtr(m_dim, m_pts);
     }
 
-    // generate and iterate over all intPts
-    for (int i = 0; i < npts; ++i)
+    vector<KDTree::Neighbour> nbrs;
+    m_kdTree->FindNearest(physPt, numPts, nbrs);
+
+    for (int i = 0; i < nbrs.size(); ++i)
     {
         Array<OneD, NekDouble> coords(m_dim);
         for (int j = 0; j < m_dim; ++j)
         {
-            coords[j] = m_pts[j][i];
+            coords[j] = m_pts[j][nbrs[i].second];
         }
-        NekDouble d = DistSq(physPt, coords);
+        neighbourPts.push_back(PtsPoint(nbrs[i].second, coords,
+                                        nbrs[i].first));
+    }
 
-        if (d < neighbourPts.back().m_distSq)
-        {
-            // create new point struct
-            PtsPoint intPt = PtsPoint(i, coords, d);
-
-            // add it to list, sort the list and remove last point from the sorted
-            // list
-            neighbourPts.push_back(intPt);
-            sort(neighbourPts.begin(), neighbourPts.end());
-            neighbourPts.pop_back();
-        }
+    // pad with dummy points if there are fewer than numPts points
+    for (int i = nbrs.size(); i < numPts; ++i)
+    {
+        neighbourPts.push_back(
+            PtsPoint(-1, Array<OneD, NekDouble>(m_dim), 1E30));
     }
 }
 
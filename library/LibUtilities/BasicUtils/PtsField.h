@@ -44,6 +44,7 @@
 
 #include <LibUtilities/BasicUtils/ErrorUtil.hpp>
 #include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/KDTree.h>
 
 using namespace std;
 
@@ -95,7 +96,8 @@ class PtsField
             const Array<OneD, Array<OneD, NekDouble> > &pts) :
             m_dim(dim),
             m_pts(pts),
-            m_ptsType(ePtsFile)
+            m_ptsType(ePtsFile),
+            m_numThreads(1)
         {
         };
 
@@ -106,7 +108,8 @@ class PtsField
             m_dim(dim),
             m_fieldNames(fieldnames),
             m_pts(pts),
-            m_ptsType(ePtsFile)
+            m_ptsType(ePtsFile),
+            m_numThreads(1)
         {
         };
 
@@ -121,7 +124,8 @@ class PtsField
             m_pts(pts),
             m_ptsType(ePtsFile),
             m_weights(weights),
-            m_neighInds(neighInds)
+            m_neighInds(neighInds),
+            m_numThreads(1)
         {
         };
 
@@ -129,6 +133,8 @@ class PtsField
             const Array< OneD, Array< OneD, NekDouble > > &physCoords,
             short int coordId = -1);
 
+        LIB_UTILITIES_EXPORT void SetNumThreads(const int nThreads);
+
         LIB_UTILITIES_EXPORT void Interpolate(
             const Array< OneD, Array< OneD, NekDouble > > &physCoords,
             Array<OneD, Array<OneD, NekDouble> > &intFields,
@@ -220,9 +226,21 @@ class PtsField
         /// Indices of the relevant neighbours for each physical point.
         /// Structure: m_neighInds[ptIdx][neighbourIdx]
         Array<OneD, Array<OneD, unsigned int> > m_neighInds;
+        /// Search tree over the point coordinates, built on first use
+        KDTreeSharedPtr                         m_kdTree;
+        /// Number of threads used to compute the weights
+        int                                     m_numThreads;
 
         boost::function<void (const int position, const int goal)> m_progressCallback;
 
+        LIB_UTILITIES_EXPORT void CalcWeightsRange(
+            const Array< OneD, Array< OneD, NekDouble > > &physCoords,
+            short int coordId,
+            const int begin,
+            const int end,
+            const bool reportProgress,
+            std::string &error);
+
         LIB_UTILITIES_EXPORT void CalcW_Linear(const int physPtIdx,
                                                const NekDouble coord);
 
@@ -42,6 +42,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <set>
 #include <string>
 using namespace std;
 
@@ -56,6 +57,7 @@ using namespace std;
 #include <LibUtilities/BasicUtils/MeshPartition.h>
 #include <LibUtilities/BasicUtils/ParseUtils.hpp>
 #include <LibUtilities/BasicUtils/FileSystem.h>
+#include <LibUtilities/BasicUtils/Thread.h>
 
 #include <boost/program_options.hpp>
 #include <boost/format.hpp>
@@ -185,6 +187,7 @@ namespace Nektar
         SessionReader::SessionReader(int argc, char *argv[])
         {
             m_xmlDoc    = 0;
+            m_numChunks = 0;
             m_filenames = ParseCommandLineArguments(argc, argv);
 
             ASSERTL0(m_filenames.size() > 0, "No session file(s) given.");
@@ -217,6 +220,7 @@ namespace Nektar
 
             ParseCommandLineArguments(argc, argv);
             m_xmlDoc      = 0;
+            m_numChunks   = 0;
             m_filenames   = pFilenames;
 
             m_sessionName = ParseSessionName(m_filenames);
@@ -279,6 +283,9 @@ namespace Nektar
             // command line.
             CmdLineOverride();
 
+            // Start worker threads if requested
+            StartThreads();
+
             // In verbose mode, print out parameters and solver info sections
             if (m_verbose && m_comm)
             {
@@ -333,9 +340,14 @@ namespace Nektar
                                  "number of procs in Z-dir")
                 ("nsz",          po::value<int>(),
                                  "number of slices in Z-dir")
+                ("nthreads",     po::value<int>(),
+                                 "number of threads per process")
                 ("part-only",    po::value<int>(),
                                  "only partition mesh into N partitions.")
                 ("part-info",    "Output partition information")
+                ("write-chunks", po::value<int>(),
+                                 "only write mesh as N chunks for distributed "
+                                 "reading.")
             ;
             
             CmdLineArgMap::const_iterator cmdIt;
@@ -479,6 +491,12 @@ namespace Nektar
             {
                 retval = fname.substr(0, fname.find_last_of("_"));
             }
+            // Likewise remove the _chunks extension of a chunked mesh
+            else if (fname.size() > 7 &&
+                fname.substr(fname.size() - 7, 7) == "_chunks")
+            {
+                retval = fname.substr(0, fname.find_last_of("_"));
+            }
             // otherwise remove the .xml extension
             else if (fname.size() > 4 &&
                 fname.substr(fname.size() - 4, 4) == ".xml")
@@ -1372,6 +1390,29 @@ namespace Nektar
             return m_bndRegOrder;
         }
 
+        /**
+         * Partitions the mesh again, weighting each element by the cost
+         * given in @a pWeights, which is indexed by element ID and must be
+         * the same on all processes. The XML document is replaced by the new
+         * partition of this process, so that a new MeshGraph and expansions
+         * can be created from this session. The remaining session data,
+         * which does not depend on the partition, is left unchanged.
+         */
+        void SessionReader::Repartition(
+            const std::map<int, NekDouble> &pWeights)
+        {
+            m_elmtWeights = pWeights;
+            m_compOrder.clear();
+            m_bndRegOrder.clear();
+
+            PartitionMesh();
+        }
+
+        const std::map<int, NekDouble> &SessionReader::GetElementWeights() const
+        {
+            return m_elmtWeights;
+        }
+
         /**
          *
          */
@@ -1413,6 +1454,11 @@ namespace Nektar
                 ASSERTL0(file.good(), "Unable to open file: " + fullpath.string());
                 file >> (*pDoc);
             }
+            else if (pFilename.size() > 7 &&
+                    pFilename.substr(pFilename.size() - 7, 7) == "_chunks")
+            {
+                LoadChunks(pFilename, pDoc);
+            }
             else
             {
                 ifstream file(pFilename.c_str());
@@ -1421,6 +1467,146 @@ namespace Nektar
             }
         }
 
+
+        /**
+         * A chunked mesh directory, as written by the --write-chunks option,
+         * holds files C0000000.xml, C0000001.xml, ... each of which contains
+         * a contiguous range of the mesh elements together with the vertices,
+         * edges, faces and curves they reference, and the unmodified
+         * remaining sections of the session. Process @a r of @a P reads the
+         * chunks \f$[rK/P, (r+1)K/P)\f$ of the \f$K\f$ chunks and merges
+         * their geometry, removing entities shared between chunks.
+         * Processes without a chunk of their own read the remaining sections
+         * from the first chunk of their neighbour, but keep none of its
+         * geometry.
+         */
+        void SessionReader::LoadChunks(
+            const std::string &pDirname,
+            TiXmlDocument* pDoc) const
+        {
+            ASSERTL0(m_numChunks > 0, "Number of chunks is not known.");
+
+            CommSharedPtr vComm = m_comm->GetRowComm();
+            int nProc  = vComm->GetSize();
+            int rank   = vComm->GetRank();
+            int cStart = (int)((long)rank       * m_numChunks / nProc);
+            int cEnd   = (int)((long)(rank + 1) * m_numChunks / nProc);
+            bool vEmpty = cStart == cEnd;
+
+            const std::string vSections[] =
+                { "VERTEX", "EDGE", "FACE", "ELEMENT", "CURVED" };
+            const int nSections = 5;
+
+            std::set<std::string>                    vSeen;
+            std::map<int, std::pair<char, std::set<unsigned int> > > vComps;
+            TiXmlElement *vMainGeom = 0;
+
+            for (int c = cStart; c < std::max(cEnd, cStart + 1); ++c)
+            {
+                boost::format pad("C%1$07d.xml");
+                pad % c;
+                fs::path fullpath = fs::path(pDirname) / fs::path(pad.str());
+                std::string vFilename = PortablePath(fullpath);
+
+                TiXmlDocument  vTempDoc;
+                TiXmlDocument *vDoc = c == cStart ? pDoc : &vTempDoc;
+                ifstream file(vFilename.c_str());
+                ASSERTL0(file.good(), "Unable to open file: " + vFilename);
+                file >> (*vDoc);
+
+                TiXmlElement *vGeom = TiXmlHandle(vDoc).FirstChildElement(
+                    "NEKTAR").FirstChildElement("GEOMETRY").Element();
+                ASSERTL0(vGeom, "Unable to find GEOMETRY tag in " + vFilename);
+
+                if (c == cStart)
+                {
+                    vMainGeom = vGeom;
+                    vMainGeom->RemoveAttribute("CHUNK");
+                }
+
+                // Move the mesh entities not yet seen into the main document.
+                for (int i = 0; i < nSections; ++i)
+                {
+                    TiXmlElement *vSrc  = vGeom->FirstChildElement(
+                        vSections[i].c_str());
+                    TiXmlElement *vDest = vMainGeom->FirstChildElement(
+                        vSections[i].c_str());
+                    if (!vSrc)
+                    {
+                        continue;
+                    }
+
+                    TiXmlElement *x = vSrc->FirstChildElement();
+                    while (x)
+                    {
+                        TiXmlElement *vNext = x->NextSiblingElement();
+                        std::string vKey = vSections[i] + x->ValueStr() +
+                            x->Attribute("ID");
+                        bool vNew = !vEmpty && vSeen.insert(vKey).second;
+
+                        if (vSrc == vDest && !vNew)
+                        {
+                            vSrc->RemoveChild(x);
+                        }
+                        else if (vSrc != vDest && vNew)
+                        {
+                            vDest->LinkEndChild(new TiXmlElement(*x));
+                        }
+                        x = vNext;
+                    }
+                }
+
+                // Composites are split between chunks, so collect the union
+                // of their entities.
+                TiXmlElement *vComp = vGeom->FirstChildElement("COMPOSITE");
+                ASSERTL0(vComp, "Unable to find COMPOSITE tag in " + vFilename);
+                TiXmlElement *x = vComp->FirstChildElement();
+                while (x && !vEmpty)
+                {
+                    int id = atoi(x->Attribute("ID"));
+                    std::string vSeqStr = x->FirstChild()->ToText()->Value();
+                    std::string::size_type indxBeg =
+                        vSeqStr.find_first_of('[') + 1;
+                    std::string::size_type indxEnd =
+                        vSeqStr.find_last_of(']') - 1;
+                    std::vector<unsigned int> vSeq;
+                    ParseUtils::GenerateSeqVector(
+                        vSeqStr.substr(indxBeg, indxEnd - indxBeg + 1).c_str(),
+                        vSeq);
+
+                    vComps[id].first =
+                        vSeqStr[vSeqStr.find_first_not_of(" \t\r\n")];
+                    vComps[id].second.insert(vSeq.begin(), vSeq.end());
+                    x = x->NextSiblingElement();
+                }
+            }
+
+            // Rewrite the composites of the main document.
+            TiXmlElement *vComp = vMainGeom->FirstChildElement("COMPOSITE");
+            vComp->Clear();
+
+            std::map<int, std::pair<char, std::set<unsigned int> > >::iterator
+                cIt;
+            for (cIt = vComps.begin(); cIt != vComps.end(); ++cIt)
+            {
+                std::stringstream vSeqStr;
+                std::set<unsigned int>::iterator sIt;
+                vSeqStr << cIt->second.first << "[";
+                for (sIt  = cIt->second.second.begin();
+                     sIt != cIt->second.second.end(); ++sIt)
+                {
+                    vSeqStr << (sIt == cIt->second.second.begin() ? "" : ",")
+                            << *sIt;
+                }
+                vSeqStr << "]";
+
+                TiXmlElement *x = new TiXmlElement("C");
+                x->SetAttribute("ID", cIt->first);
+                x->LinkEndChild(new TiXmlText(vSeqStr.str()));
+                vComp->LinkEndChild(x);
+            }
+        }
+
         /**
          *
          */
@@ -1542,6 +1728,49 @@ namespace Nektar
             if (m_xmlDoc)
             {
                 delete m_xmlDoc;
+                m_xmlDoc = 0;
+            }
+
+            // A mesh stored as a directory of chunks (see --write-chunks) is
+            // never loaded as a whole. Instead each process reads a
+            // contiguous slice of the chunks.
+            const bool isChunked = m_filenames[0].size() > 7 &&
+                m_filenames[0].substr(m_filenames[0].size() - 7, 7) == "_chunks";
+            if (isChunked)
+            {
+                m_numChunks = 0;
+                if (isRoot)
+                {
+                    fs::directory_iterator dIt(m_filenames[0]), dEnd;
+                    for (; dIt != dEnd; ++dIt)
+                    {
+                        if (dIt->path().extension() == ".xml")
+                        {
+                            ++m_numChunks;
+                        }
+                    }
+                    ASSERTL0(m_numChunks > 0,
+                             "No chunks found in " + m_filenames[0]);
+                }
+                m_comm->AllReduce(m_numChunks, LibUtilities::ReduceMax);
+                m_xmlDoc = MergeDoc(m_filenames);
+
+                // Periodic boundary conditions match the entities of two
+                // composites by their order in the complete composite
+                // definitions, which no process holds when reading chunks.
+                if (DefinesElement("Nektar/Conditions/BoundaryConditions"))
+                {
+                    TiXmlElement *region = GetElement(
+                        "Nektar/Conditions/BoundaryConditions")
+                                            ->FirstChildElement("REGION");
+                    for (; region;
+                           region = region->NextSiblingElement("REGION"))
+                    {
+                        ASSERTL0(!region->FirstChildElement("P"),
+                                 "Periodic boundary conditions are not "
+                                 "supported with a chunked mesh.");
+                    }
+                }
             }
 
             // Load file for root process only (since this is always needed)
@@ -1553,7 +1782,7 @@ namespace Nektar
             // where X is the number of the partition (and should match the
             // process rank). The result is shared with all other processes.
             int isPartitioned = 0;
-            if (isRoot)
+            if (isRoot && !isChunked)
             {
                 m_xmlDoc = MergeDoc(m_filenames);
                 if (DefinesElement("Nektar/Geometry"))
@@ -1570,6 +1799,8 @@ namespace Nektar
             // If the mesh is already partitioned, we are done. Remaining
             // processes must load their partitions.
             if (isPartitioned) {
+                ASSERTL0(m_elmtWeights.empty(),
+                         "A pre-partitioned mesh cannot be repartitioned.");
                 if (!isRoot)
                 {
                     m_xmlDoc = MergeDoc(m_filenames);
@@ -1593,6 +1824,10 @@ namespace Nektar
             {
                 vPartitionerName = "Scotch";
             }
+            if (DefinesCmdLineArgument("use-sfc"))
+            {
+                vPartitionerName = "SFC";
+            }
 
             // Mesh has not been partitioned so do partitioning if required.
             // Note in the serial case nothing is done as we have already loaded
@@ -1623,14 +1858,60 @@ namespace Nektar
                 Finalise();
                 exit(0);
             }
+            else if (DefinesCmdLineArgument("write-chunks"))
+            {
+                // Write the mesh as chunks for distributed reading, again in
+                // serial.
+                ASSERTL0(GetComm()->GetSize() == 1,
+                        "The 'write-chunks' option should be used in serial.");
+
+                int nChunks = GetCmdLineArgument<int>("write-chunks");
+                SessionReaderSharedPtr vSession     = GetSharedThisPtr();
+                MeshPartitionSharedPtr vPartitioner =
+                        GetMeshPartitionFactory().CreateInstance(
+                                            vPartitionerName, vSession);
+                vPartitioner->WriteChunks(vSession, nChunks);
+
+                Finalise();
+                exit(0);
+            }
             else if (vCommMesh->GetSize() > 1)
             {
                 SessionReaderSharedPtr vSession     = GetSharedThisPtr();
                 int nParts = vCommMesh->GetSize();
-                if (DefinesCmdLineArgument("shared-filesystem"))
+                if (isChunked)
+                {
+                    // Each process holds a slice of the mesh. These are
+                    // partitioned by all processes together and each process
+                    // then writes its own partition, as below.
+                    MeshPartitionSharedPtr vPartitioner =
+                                GetMeshPartitionFactory().CreateInstance(
+                                                    vPartitionerName, vSession);
+                    vPartitioner->PartitionDistributedMesh(nParts);
+                    vPartitioner->WriteLocalPartition(vSession);
+                    vPartitioner->GetBndRegionOrdering(m_bndRegOrder);
+
+                    if (DefinesCmdLineArgument("part-info"))
+                    {
+                        vector<unsigned int> elmtIds;
+                        vPartitioner->GetElementIDs(vCommMesh->GetRank(),
+                                                    elmtIds);
+                        int nMin = elmtIds.size(), nMax = elmtIds.size();
+                        vCommMesh->AllReduce(nMin, LibUtilities::ReduceMin);
+                        vCommMesh->AllReduce(nMax, LibUtilities::ReduceMax);
+
+                        if (isRoot)
+                        {
+                            cout << "# Distributed partition: " << nParts
+                                 << " partitions of " << nMin << " to "
+                                 << nMax << " elements" << endl;
+                        }
+                    }
+                }
+                else if (DefinesCmdLineArgument("shared-filesystem"))
                 {
                     CommSharedPtr vComm = GetComm();
-                    vector<unsigned int> keys, vals;
+                    vector<unsigned int> keys;
                     int i;
 
                     if (vComm->GetRank() == 0)
@@ -1645,71 +1926,34 @@ namespace Nektar
                         vPartitioner->GetCompositeOrdering(m_compOrder);
                         vPartitioner->GetBndRegionOrdering(m_bndRegOrder);
 
-                        // Communicate orderings to the other processors.
-
-                        // First send sizes of the orderings and boundary
-                        // regions to allocate storage on the remote end.
-                        keys.resize(2);
-                        keys[0] = m_compOrder.size();
-                        keys[1] = m_bndRegOrder.size();
-
-                        for (i = 1; i < vComm->GetSize(); ++i)
-                        {
-                            vComm->Send(i, keys);
-                        }
-
-                        // Construct the keys and sizes of values for composite
-                        // ordering
+                        // Communicate orderings to the other processors in
+                        // a single broadcast. Each ordering is packed as its
+                        // key, its size and its values.
                         CompositeOrdering::iterator cIt;
-                        keys.resize(m_compOrder.size());
-                        vals.resize(m_compOrder.size());
-
-                        for (cIt  = m_compOrder.begin(), i = 0;
-                             cIt != m_compOrder.end(); ++cIt, ++i)
-                        {
-                            keys[i] = cIt->first;
-                            vals[i] = cIt->second.size();
-                        }
-
-                        // Send across data.
-                        for (i = 1; i < vComm->GetSize(); ++i)
-                        {
-                            vComm->Send(i, keys);
-                            vComm->Send(i, vals);
-
-                            for (cIt  = m_compOrder.begin();
-                                 cIt != m_compOrder.end(); ++cIt)
-                            {
-                                vComm->Send(i, cIt->second);
-                            }
-                        }
-
-                        // Construct the keys and sizes of values for composite
-                        // ordering
                         BndRegionOrdering::iterator bIt;
-                        keys.resize(m_bndRegOrder.size());
-                        vals.resize(m_bndRegOrder.size());
 
-                        for (bIt  = m_bndRegOrder.begin(), i = 0;
-                             bIt != m_bndRegOrder.end(); ++bIt, ++i)
+                        keys.push_back(m_compOrder.size());
+                        for (cIt  = m_compOrder.begin();
+                             cIt != m_compOrder.end(); ++cIt)
                         {
-                            keys[i] = bIt->first;
-                            vals[i] = bIt->second.size();
+                            keys.push_back(cIt->first);
+                            keys.push_back(cIt->second.size());
+                            keys.insert(keys.end(), cIt->second.begin(),
+                                                    cIt->second.end());
                         }
 
-                        // Send across data.
-                        for (i = 1; i < vComm->GetSize(); ++i)
+                        keys.push_back(m_bndRegOrder.size());
+                        for (bIt  = m_bndRegOrder.begin();
+                             bIt != m_bndRegOrder.end(); ++bIt)
                         {
-                            vComm->Send(i, keys);
-                            vComm->Send(i, vals);
-
-                            for (bIt  = m_bndRegOrder.begin();
-                                 bIt != m_bndRegOrder.end(); ++bIt)
-                            {
-                                vComm->Send(i, bIt->second);
-                            }
+                            keys.push_back(bIt->first);
+                            keys.push_back(bIt->second.size());
+                            keys.insert(keys.end(), bIt->second.begin(),
+                                                    bIt->second.end());
                         }
 
+                        vComm->Bcast(keys, 0);
+
                         if (DefinesCmdLineArgument("part-info"))
                         {
                             vPartitioner->PrintPartInfo(std::cout);
@@ -1717,34 +1961,30 @@ namespace Nektar
                     }
                     else
                     {
-                        keys.resize(2);
-                        vComm->Recv(0, keys);
+                        vComm->Bcast(keys, 0);
 
-                        int cmpSize = keys[0];
-                        int bndSize = keys[1];
+                        int cnt = 0, nOrder, key, size;
 
-                        keys.resize(cmpSize);
-                        vals.resize(cmpSize);
-                        vComm->Recv(0, keys);
-                        vComm->Recv(0, vals);
-
-                        for (int i = 0; i < keys.size(); ++i)
+                        nOrder = keys[cnt++];
+                        for (i = 0; i < nOrder; ++i)
                         {
-                            vector<unsigned int> tmp(vals[i]);
-                            vComm->Recv(0, tmp);
-                            m_compOrder[keys[i]] = tmp;
+                            key  = keys[cnt++];
+                            size = keys[cnt++];
+                            m_compOrder[key] = vector<unsigned int>(
+                                keys.begin() + cnt,
+                                keys.begin() + cnt + size);
+                            cnt += size;
                         }
 
-                        keys.resize(bndSize);
-                        vals.resize(bndSize);
-                        vComm->Recv(0, keys);
-                        vComm->Recv(0, vals);
-
-                        for (int i = 0; i < keys.size(); ++i)
+                        nOrder = keys[cnt++];
+                        for (i = 0; i < nOrder; ++i)
                         {
-                            vector<unsigned int> tmp(vals[i]);
-                            vComm->Recv(0, tmp);
-                            m_bndRegOrder[keys[i]] = tmp;
+                            key  = keys[cnt++];
+                            size = keys[cnt++];
+                            m_bndRegOrder[key] = vector<unsigned int>(
+                                keys.begin() + cnt,
+                                keys.begin() + cnt + size);
+                            cnt += size;
                         }
                     }
                 }
@@ -1796,8 +2036,9 @@ namespace Nektar
                          ". Check XML standards compliance. Error on line: " +
                          boost::lexical_cast<std::string>(m_xmlDoc->Row()));
             }
-            else
+            else if (!m_xmlDoc)
             {
+                // The root process has already loaded the mesh.
                 m_xmlDoc = MergeDoc(m_filenames);
             }
         }
@@ -2631,6 +2872,51 @@ namespace Nektar
             }
         }
 
+        /**
+         * Starts the session ThreadManager if more than one thread per process
+         * has been requested, either with the --nthreads command-line option
+         * or through the NThreads parameter. The command-line option takes
+         * precedence.
+         */
+        void SessionReader::StartThreads()
+        {
+            int nThreads = 1;
+            if (DefinesCmdLineArgument("nthreads"))
+            {
+                nThreads = GetCmdLineArgument<int>("nthreads");
+            }
+            else
+            {
+                LoadParameter("NThreads", nThreads, 1);
+            }
+
+            ASSERTL0(nThreads > 0, "Number of threads must be positive.");
+
+            if (nThreads == 1)
+            {
+                return;
+            }
+
+            Thread::ThreadMaster &master = Thread::GetThreadMaster();
+            Thread::ThreadManagerSharedPtr tm =
+                master.GetInstance(Thread::ThreadMaster::SessionJob);
+
+            // A previous session in this process may already have started
+            // the threads.
+            if (tm->IsInitialised())
+            {
+                return;
+            }
+
+            master.SetThreadingType("ThreadManagerBoost");
+            master.CreateInstance(Thread::ThreadMaster::SessionJob, nThreads);
+
+            if (m_verbose && m_comm->GetRank() == 0)
+            {
+                cout << "Using " << nThreads << " threads per process" << endl;
+            }
+        }
+
         void SessionReader::SetUpXmlDoc(void)
         {
             m_xmlDoc = MergeDoc(m_filenames);
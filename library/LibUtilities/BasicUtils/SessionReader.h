@@ -424,6 +424,13 @@ namespace Nektar
             LIB_UTILITIES_EXPORT CompositeOrdering GetCompositeOrdering() const;
             LIB_UTILITIES_EXPORT BndRegionOrdering GetBndRegionOrdering() const;
 
+            /// Repartitions the mesh using the given element weights.
+            LIB_UTILITIES_EXPORT void Repartition(
+                const std::map<int, NekDouble> &pWeights);
+            /// Returns the element weights used when repartitioning.
+            LIB_UTILITIES_EXPORT const std::map<int, NekDouble>
+                &GetElementWeights() const;
+
             LIB_UTILITIES_EXPORT void SetUpXmlDoc();
 
         private:
@@ -457,11 +464,15 @@ namespace Nektar
             FilterMap                                 m_filters;
             /// Be verbose
             bool                                      m_verbose;
+            /// Number of chunks of a mesh stored for distributed reading.
+            int                                       m_numChunks;
             /// Map of original composite ordering for parallel periodic bcs.
             CompositeOrdering                         m_compOrder;
             /// Map of original boundary region ordering for parallel periodic
             /// bcs.
             BndRegionOrdering                         m_bndRegOrder;
+            /// Element weights measured at runtime for repartitioning.
+            std::map<int, NekDouble>                  m_elmtWeights;
             /// String to enumeration map for Solver Info parameters. 
             LIB_UTILITIES_EXPORT static EnumMapList&  GetSolverInfoEnums();
             /// Default solver info options.
@@ -492,6 +503,10 @@ namespace Nektar
             LIB_UTILITIES_EXPORT void LoadDoc(
                 const std::string &pFilename,
                 TiXmlDocument* pDoc) const;
+            /// Loads this process's slice of a chunked mesh directory.
+            LIB_UTILITIES_EXPORT void LoadChunks(
+                const std::string &pDirname,
+                TiXmlDocument* pDoc) const;
             /// Creates an XML document from a list of input files.
             LIB_UTILITIES_EXPORT TiXmlDocument *MergeDoc(
                 const std::vector<std::string> &pFilenames) const;
@@ -525,6 +540,8 @@ namespace Nektar
             LIB_UTILITIES_EXPORT void ReadFilters(TiXmlElement *filters);
             /// Enforce parameters from command line arguments.
             LIB_UTILITIES_EXPORT void CmdLineOverride();
+            /// Start the session ThreadManager if threads are requested.
+            LIB_UTILITIES_EXPORT void StartThreads();
 
             /// Parse a string in the form lhs = rhs.
             LIB_UTILITIES_EXPORT void ParseEquals(
@@ -37,6 +37,7 @@
 
 #include <vector>
 
+#include <boost/cstdint.hpp>
 #include <boost/enable_shared_from_this.hpp>
 #include <LibUtilities/BasicUtils/NekFactory.hpp>
 #include <LibUtilities/LibUtilitiesDeclspec.h>
@@ -69,6 +70,22 @@ namespace Nektar
             ReduceMin
         };
 
+        /// Class for communicator request type.
+        class CommRequest
+        {
+        public:
+            /// Default constructor
+            CommRequest()
+            {
+            }
+            /// Default deconstructor
+            virtual ~CommRequest()
+            {
+            }
+        };
+
+        typedef boost::shared_ptr<CommRequest> CommRequestSharedPtr;
+
         /// Base communications class
         class Comm: public boost::enable_shared_from_this<Comm>
         {
@@ -113,6 +130,13 @@ namespace Nektar
                                          enum ReduceOperator pOp);
                 LIB_UTILITIES_EXPORT inline void AllReduce(std::vector<unsigned int>& pData,
                                                            enum ReduceOperator pOp);
+                LIB_UTILITIES_EXPORT inline void IAllReduce(Array<OneD, NekDouble>& pData,
+                                                            enum ReduceOperator pOp,
+                                                            CommRequestSharedPtr pRequest,
+                                                            int pLoc = 0);
+                LIB_UTILITIES_EXPORT inline void Bcast(std::vector<unsigned int>& pData,
+                                                       int pRoot);
+                LIB_UTILITIES_EXPORT inline void Exscan(boost::uint64_t& pData);
                 LIB_UTILITIES_EXPORT inline void AlltoAll(Array<OneD, NekDouble>& pSendData,
                                                           Array<OneD, NekDouble>& pRecvData);
                 LIB_UTILITIES_EXPORT inline void AlltoAll(Array<OneD, int>& pSendData,
@@ -130,6 +154,40 @@ namespace Nektar
                                                            Array<OneD, int>& pRecvDataSizeMap,
                                                            Array<OneD, int>& pRecvDataOffsetMap);
                 
+                LIB_UTILITIES_EXPORT inline void IAlltoAllv(Array<OneD, NekDouble>& pSendData,
+                                                            Array<OneD, int>& pSendDataSizeMap,
+                                                            Array<OneD, int>& pSendDataOffsetMap,
+                                                            Array<OneD, NekDouble>& pRecvData,
+                                                            Array<OneD, int>& pRecvDataSizeMap,
+                                                            Array<OneD, int>& pRecvDataOffsetMap,
+                                                            CommRequestSharedPtr pRequest,
+                                                            int pLoc = 0);
+
+                LIB_UTILITIES_EXPORT inline void Isend(int pProc,
+                                                       Array<OneD, NekDouble>& pData,
+                                                       int pCount,
+                                                       CommRequestSharedPtr pRequest,
+                                                       int pLoc);
+                LIB_UTILITIES_EXPORT inline void Irecv(int pProc,
+                                                       Array<OneD, NekDouble>& pData,
+                                                       int pCount,
+                                                       CommRequestSharedPtr pRequest,
+                                                       int pLoc);
+                LIB_UTILITIES_EXPORT inline void SendInit(int pProc,
+                                                          Array<OneD, NekDouble>& pData,
+                                                          int pCount,
+                                                          CommRequestSharedPtr pRequest,
+                                                          int pLoc);
+                LIB_UTILITIES_EXPORT inline void RecvInit(int pProc,
+                                                          Array<OneD, NekDouble>& pData,
+                                                          int pCount,
+                                                          CommRequestSharedPtr pRequest,
+                                                          int pLoc);
+                LIB_UTILITIES_EXPORT inline void StartAll(CommRequestSharedPtr pRequest);
+
+                LIB_UTILITIES_EXPORT inline CommRequestSharedPtr CreateRequest(int num);
+                LIB_UTILITIES_EXPORT inline void WaitAll(CommRequestSharedPtr pRequest);
+
                 LIB_UTILITIES_EXPORT inline void SplitComm(int pRows, int pColumns);
                 LIB_UTILITIES_EXPORT inline CommSharedPtr GetRowComm();
                 LIB_UTILITIES_EXPORT inline CommSharedPtr GetColumnComm();
@@ -179,6 +237,9 @@ namespace Nektar
                                          enum ReduceOperator pOp) = 0;
                 virtual void v_AllReduce(std::vector<unsigned int>& pData,
                                          enum ReduceOperator pOp) = 0;
+                virtual void v_Bcast(std::vector<unsigned int>& pData,
+                                     int pRoot) = 0;
+                virtual void v_Exscan(boost::uint64_t& pData) = 0;
 			    virtual void v_AlltoAll(Array<OneD, NekDouble>& pSendData,
 										Array<OneD, NekDouble>& pRecvData) = 0;
                 virtual void v_AlltoAll(Array<OneD, int>& pSendData,
@@ -195,6 +256,41 @@ namespace Nektar
 										Array<OneD, int>& pRecvData,
 										Array<OneD, int>& pRecvDataSizeMap,
 										Array<OneD, int>& pRecvDataOffsetMap) = 0;
+                virtual void v_IAllReduce(Array<OneD, NekDouble>& pData,
+                                          enum ReduceOperator pOp,
+                                          CommRequestSharedPtr pRequest,
+                                          int pLoc) = 0;
+                virtual void v_IAlltoAllv(Array<OneD, NekDouble>& pSendData,
+                                          Array<OneD, int>& pSendDataSizeMap,
+                                          Array<OneD, int>& pSendDataOffsetMap,
+                                          Array<OneD, NekDouble>& pRecvData,
+                                          Array<OneD, int>& pRecvDataSizeMap,
+                                          Array<OneD, int>& pRecvDataOffsetMap,
+                                          CommRequestSharedPtr pRequest,
+                                          int pLoc) = 0;
+                virtual void v_Isend(int pProc,
+                                     Array<OneD, NekDouble>& pData,
+                                     int pCount,
+                                     CommRequestSharedPtr pRequest,
+                                     int pLoc) = 0;
+                virtual void v_Irecv(int pProc,
+                                     Array<OneD, NekDouble>& pData,
+                                     int pCount,
+                                     CommRequestSharedPtr pRequest,
+                                     int pLoc) = 0;
+                virtual void v_SendInit(int pProc,
+                                        Array<OneD, NekDouble>& pData,
+                                        int pCount,
+                                        CommRequestSharedPtr pRequest,
+                                        int pLoc) = 0;
+                virtual void v_RecvInit(int pProc,
+                                        Array<OneD, NekDouble>& pData,
+                                        int pCount,
+                                        CommRequestSharedPtr pRequest,
+                                        int pLoc) = 0;
+                virtual void v_StartAll(CommRequestSharedPtr pRequest) = 0;
+                virtual CommRequestSharedPtr v_CreateRequest(int num) = 0;
+                virtual void v_WaitAll(CommRequestSharedPtr pRequest) = 0;
                 virtual void v_SplitComm(int pRows, int pColumns) = 0;
                 virtual bool v_TreatAsRankZero(void) = 0;
                 LIB_UTILITIES_EXPORT virtual bool v_RemoveExistingFiles(void);
@@ -380,6 +476,27 @@ namespace Nektar
         }
 
 
+        /**
+         * Broadcast @a pData from process @a pRoot to all other processes.
+         * The size of the data is communicated as well, so @a pData need not
+         * be sized on the receiving processes.
+         */
+        inline void Comm::Bcast(std::vector<unsigned int>& pData, int pRoot)
+        {
+            v_Bcast(pData, pRoot);
+        }
+
+
+        /**
+         * Replace @a pData with the sum of the values of @a pData on all
+         * processes of lower rank. The result on rank 0 is zero.
+         */
+        inline void Comm::Exscan(boost::uint64_t& pData)
+        {
+            v_Exscan(pData);
+        }
+
+
         /**
          *
          */
@@ -425,6 +542,133 @@ namespace Nektar
 		}
 
 
+        /**
+         * @brief Starts a non-blocking reduction of @a pData across all
+         * processes.
+         *
+         * The reduction is posted in slot @a pLoc of @a pRequest and is only
+         * guaranteed to be complete, with the result stored in @a pData, after
+         * a call to WaitAll. @a pData must not be accessed in the meantime.
+         */
+        inline void Comm::IAllReduce(Array<OneD, NekDouble>& pData,
+                                     enum ReduceOperator pOp,
+                                     CommRequestSharedPtr pRequest,
+                                     int pLoc)
+        {
+            v_IAllReduce(pData, pOp, pRequest, pLoc);
+        }
+
+
+        /**
+         * @brief Starts a non-blocking all-to-all exchange of variable sized
+         * blocks, tracked in slot @a pLoc of @a pRequest. Neither buffer may
+         * be accessed until WaitAll has been called.
+         */
+        inline void Comm::IAlltoAllv(Array<OneD, NekDouble>& pSendData,
+                                     Array<OneD, int>& pSendDataSizeMap,
+                                     Array<OneD, int>& pSendDataOffsetMap,
+                                     Array<OneD, NekDouble>& pRecvData,
+                                     Array<OneD, int>& pRecvDataSizeMap,
+                                     Array<OneD, int>& pRecvDataOffsetMap,
+                                     CommRequestSharedPtr pRequest,
+                                     int pLoc)
+        {
+            v_IAlltoAllv(pSendData, pSendDataSizeMap, pSendDataOffsetMap,
+                         pRecvData, pRecvDataSizeMap, pRecvDataOffsetMap,
+                         pRequest, pLoc);
+        }
+
+
+        /**
+         * @brief Starts a non-blocking send of the first @a pCount entries of
+         * @a pData to process @a pProc, tracked in slot @a pLoc of
+         * @a pRequest.
+         */
+        inline void Comm::Isend(int pProc,
+                                Array<OneD, NekDouble>& pData,
+                                int pCount,
+                                CommRequestSharedPtr pRequest,
+                                int pLoc)
+        {
+            v_Isend(pProc, pData, pCount, pRequest, pLoc);
+        }
+
+
+        /**
+         * @brief Starts a non-blocking receive of @a pCount entries from
+         * process @a pProc into @a pData, tracked in slot @a pLoc of
+         * @a pRequest.
+         */
+        inline void Comm::Irecv(int pProc,
+                                Array<OneD, NekDouble>& pData,
+                                int pCount,
+                                CommRequestSharedPtr pRequest,
+                                int pLoc)
+        {
+            v_Irecv(pProc, pData, pCount, pRequest, pLoc);
+        }
+
+
+        /**
+         * @brief Sets up a persistent send of the first @a pCount entries of
+         * @a pData to process @a pProc in slot @a pLoc of @a pRequest. The
+         * send is only performed when StartAll is called, and may be
+         * restarted once it has completed. @a pData must stay allocated for
+         * the lifetime of the request.
+         */
+        inline void Comm::SendInit(int pProc,
+                                   Array<OneD, NekDouble>& pData,
+                                   int pCount,
+                                   CommRequestSharedPtr pRequest,
+                                   int pLoc)
+        {
+            v_SendInit(pProc, pData, pCount, pRequest, pLoc);
+        }
+
+
+        /**
+         * @brief Sets up a persistent receive of @a pCount entries from
+         * process @a pProc into @a pData in slot @a pLoc of @a pRequest.
+         */
+        inline void Comm::RecvInit(int pProc,
+                                   Array<OneD, NekDouble>& pData,
+                                   int pCount,
+                                   CommRequestSharedPtr pRequest,
+                                   int pLoc)
+        {
+            v_RecvInit(pProc, pData, pCount, pRequest, pLoc);
+        }
+
+
+        /**
+         * @brief Starts all persistent operations held in @a pRequest.
+         */
+        inline void Comm::StartAll(CommRequestSharedPtr pRequest)
+        {
+            v_StartAll(pRequest);
+        }
+
+
+        /**
+         * @brief Creates a request object able to track @a num outstanding
+         * non-blocking operations.
+         */
+        inline CommRequestSharedPtr Comm::CreateRequest(int num)
+        {
+            return v_CreateRequest(num);
+        }
+
+
+        /**
+         * @brief Blocks until all operations posted in @a pRequest have
+         * completed.
+         */
+        inline void Comm::WaitAll(CommRequestSharedPtr pRequest)
+        {
+            v_WaitAll(pRequest);
+        }
+
+
         /**
          * @brief Splits this communicator into a grid of size pRows*pColumns
          * and creates row and column communicators. By default the communicator
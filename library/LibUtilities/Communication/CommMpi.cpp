@@ -540,6 +540,48 @@ namespace Nektar
         }
 
 
+        /**
+         *
+         */
+        void CommMpi::v_Bcast(std::vector<unsigned int>& pData, int pRoot)
+        {
+            if (GetSize() == 1)
+            {
+                return;
+            }
+
+            int size   = pData.size();
+            int retval = MPI_Bcast(&size, 1, MPI_INT, pRoot, m_comm);
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error performing broadcast.");
+
+            pData.resize(size);
+            if (size > 0)
+            {
+                retval = MPI_Bcast(&pData[0], size, MPI_UNSIGNED, pRoot,
+                                   m_comm);
+                ASSERTL0(retval == MPI_SUCCESS,
+                         "MPI error performing broadcast.");
+            }
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_Exscan(boost::uint64_t& pData)
+        {
+            unsigned long long send = pData, recv = 0;
+            int retval = MPI_Exscan(&send, &recv, 1, MPI_UNSIGNED_LONG_LONG,
+                                    MPI_SUM, m_comm);
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error performing exclusive scan.");
+
+            // The result is undefined on rank 0.
+            pData = GetRank() == 0 ? 0 : (boost::uint64_t) recv;
+        }
+
+
         /**
          *
          */
@@ -625,6 +667,232 @@ namespace Nektar
 		}
 
 
+        /**
+         * Posts a non-blocking reduction in slot @a pLoc of @a pRequest. With
+         * an MPI-2 library, which lacks MPI_Iallreduce, this falls back to a
+         * blocking reduction and WaitAll is then a no-op for this slot.
+         */
+        void CommMpi::v_IAllReduce(Array<OneD, NekDouble>& pData,
+                                   enum ReduceOperator pOp,
+                                   CommRequestSharedPtr pRequest,
+                                   int pLoc)
+        {
+            if (GetSize() == 1)
+            {
+                return;
+            }
+
+#if MPI_VERSION >= 3
+            CommRequestMpiSharedPtr req =
+                boost::dynamic_pointer_cast<CommRequestMpi>(pRequest);
+            ASSERTL1(req, "Request was not created by an MPI communicator.");
+            ASSERTL1(pLoc < req->GetNumRequest(), "Request slot out of range.");
+
+            MPI_Op vOp;
+            switch (pOp)
+            {
+            case ReduceMax: vOp = MPI_MAX; break;
+            case ReduceMin: vOp = MPI_MIN; break;
+            case ReduceSum:
+            default:        vOp = MPI_SUM; break;
+            }
+            int retval = MPI_Iallreduce(MPI_IN_PLACE,
+                                        pData.get(),
+                                        (int) pData.num_elements(),
+                                        MPI_DOUBLE,
+                                        vOp,
+                                        m_comm,
+                                        req->GetRequest(pLoc));
+
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error performing non-blocking All-reduce.");
+#else
+            v_AllReduce(pData, pOp);
+#endif
+        }
+
+
+        /**
+         * With an MPI-2 library, which lacks MPI_Ialltoallv, this falls back
+         * to a blocking exchange.
+         */
+        void CommMpi::v_IAlltoAllv(Array<OneD, NekDouble>& pSendData,
+                                   Array<OneD, int>& pSendDataSizeMap,
+                                   Array<OneD, int>& pSendDataOffsetMap,
+                                   Array<OneD, NekDouble>& pRecvData,
+                                   Array<OneD, int>& pRecvDataSizeMap,
+                                   Array<OneD, int>& pRecvDataOffsetMap,
+                                   CommRequestSharedPtr pRequest,
+                                   int pLoc)
+        {
+#if MPI_VERSION >= 3
+            CommRequestMpiSharedPtr req =
+                boost::dynamic_pointer_cast<CommRequestMpi>(pRequest);
+            ASSERTL1(req, "Request was not created by an MPI communicator.");
+            ASSERTL1(pLoc < req->GetNumRequest(), "Request slot out of range.");
+
+            int retval = MPI_Ialltoallv(pSendData.get(),
+                                        pSendDataSizeMap.get(),
+                                        pSendDataOffsetMap.get(),
+                                        MPI_DOUBLE,
+                                        pRecvData.get(),
+                                        pRecvDataSizeMap.get(),
+                                        pRecvDataOffsetMap.get(),
+                                        MPI_DOUBLE,
+                                        m_comm,
+                                        req->GetRequest(pLoc));
+
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error performing non-blocking All-to-All-v.");
+#else
+            v_AlltoAllv(pSendData, pSendDataSizeMap, pSendDataOffsetMap,
+                        pRecvData, pRecvDataSizeMap, pRecvDataOffsetMap);
+#endif
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_Isend(int pProc,
+                              Array<OneD, NekDouble>& pData,
+                              int pCount,
+                              CommRequestSharedPtr pRequest,
+                              int pLoc)
+        {
+            CommRequestMpiSharedPtr req =
+                boost::dynamic_pointer_cast<CommRequestMpi>(pRequest);
+            ASSERTL1(req, "Request was not created by an MPI communicator.");
+            ASSERTL1(pLoc < req->GetNumRequest(), "Request slot out of range.");
+
+            int retval = MPI_Isend(pData.get(), pCount, MPI_DOUBLE, pProc, 0,
+                                   m_comm, req->GetRequest(pLoc));
+
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error performing non-blocking send.");
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_Irecv(int pProc,
+                              Array<OneD, NekDouble>& pData,
+                              int pCount,
+                              CommRequestSharedPtr pRequest,
+                              int pLoc)
+        {
+            CommRequestMpiSharedPtr req =
+                boost::dynamic_pointer_cast<CommRequestMpi>(pRequest);
+            ASSERTL1(req, "Request was not created by an MPI communicator.");
+            ASSERTL1(pLoc < req->GetNumRequest(), "Request slot out of range.");
+
+            int retval = MPI_Irecv(pData.get(), pCount, MPI_DOUBLE, pProc, 0,
+                                   m_comm, req->GetRequest(pLoc));
+
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error performing non-blocking receive.");
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_SendInit(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc)
+        {
+            CommRequestMpiSharedPtr req =
+                boost::dynamic_pointer_cast<CommRequestMpi>(pRequest);
+            ASSERTL1(req, "Request was not created by an MPI communicator.");
+            ASSERTL1(pLoc < req->GetNumRequest(), "Request slot out of range.");
+
+            int retval = MPI_Send_init(pData.get(), pCount, MPI_DOUBLE, pProc,
+                                       0, m_comm, req->GetRequest(pLoc));
+
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error setting up persistent send.");
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_RecvInit(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc)
+        {
+            CommRequestMpiSharedPtr req =
+                boost::dynamic_pointer_cast<CommRequestMpi>(pRequest);
+            ASSERTL1(req, "Request was not created by an MPI communicator.");
+            ASSERTL1(pLoc < req->GetNumRequest(), "Request slot out of range.");
+
+            int retval = MPI_Recv_init(pData.get(), pCount, MPI_DOUBLE, pProc,
+                                       0, m_comm, req->GetRequest(pLoc));
+
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error setting up persistent receive.");
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_StartAll(CommRequestSharedPtr pRequest)
+        {
+            CommRequestMpiSharedPtr req =
+                boost::dynamic_pointer_cast<CommRequestMpi>(pRequest);
+            ASSERTL1(req, "Request was not created by an MPI communicator.");
+
+            if (req->GetNumRequest() == 0)
+            {
+                return;
+            }
+
+            int retval = MPI_Startall(req->GetNumRequest(),
+                                      req->GetRequest(0));
+
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error starting persistent requests.");
+        }
+
+
+        /**
+         *
+         */
+        CommRequestSharedPtr CommMpi::v_CreateRequest(int num)
+        {
+            return MemoryManager<CommRequestMpi>::AllocateSharedPtr(num);
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_WaitAll(CommRequestSharedPtr pRequest)
+        {
+            CommRequestMpiSharedPtr req =
+                boost::dynamic_pointer_cast<CommRequestMpi>(pRequest);
+            ASSERTL1(req, "Request was not created by an MPI communicator.");
+
+            if (req->GetNumRequest() == 0)
+            {
+                return;
+            }
+
+            int retval = MPI_Waitall(req->GetNumRequest(),
+                                     req->GetRequest(0),
+                                     MPI_STATUSES_IGNORE);
+
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error waiting for non-blocking operations.");
+        }
+
+
         /**
          * Processes are considered as a grid of size pRows*pColumns. Comm
          * objects are created corresponding to the rows and columns of this
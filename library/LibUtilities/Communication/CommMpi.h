@@ -36,6 +36,7 @@
 #define NEKTAR_LIB_UTILITIES_COMMMPI_H
 
 #include <string>
+#include <vector>
 #include <mpi.h>
 
 #include <LibUtilities/Communication/Comm.h>
@@ -57,6 +58,55 @@ namespace Nektar
         /// Pointer to a Communicator object.
         typedef boost::shared_ptr<CommMpi> CommMpiSharedPtr;
 
+        /// Class for communicator request type.
+        class CommRequestMpi : public CommRequest
+        {
+        public:
+            /// Creates a request able to hold @a num MPI requests.
+            CommRequestMpi(int num) :
+                m_num(num),
+                m_request(num, MPI_REQUEST_NULL)
+            {
+            }
+
+            /// Releases any persistent requests which are still held.
+            virtual ~CommRequestMpi()
+            {
+                int finalized;
+                MPI_Finalized(&finalized);
+                if (finalized)
+                {
+                    return;
+                }
+
+                for (int i = 0; i < m_num; ++i)
+                {
+                    if (m_request[i] != MPI_REQUEST_NULL)
+                    {
+                        MPI_Request_free(&m_request[i]);
+                    }
+                }
+            }
+
+            /// Returns a pointer to the @a i-th MPI request.
+            inline MPI_Request *GetRequest(int i)
+            {
+                return &m_request[i];
+            }
+
+            /// Returns the number of MPI requests held.
+            inline int GetNumRequest()
+            {
+                return m_num;
+            }
+
+        private:
+            int                      m_num;
+            std::vector<MPI_Request> m_request;
+        };
+
+        typedef boost::shared_ptr<CommRequestMpi> CommRequestMpiSharedPtr;
+
         /// A global linear system.
         class CommMpi : public Comm
         {
@@ -110,6 +160,9 @@ namespace Nektar
                                      enum ReduceOperator pOp);
             virtual void v_AllReduce(std::vector<unsigned int>& pData,
                                      enum ReduceOperator pOp);
+            virtual void v_Bcast(std::vector<unsigned int>& pData,
+                                 int pRoot);
+            virtual void v_Exscan(boost::uint64_t& pData);
 			virtual void v_AlltoAll(Array<OneD, NekDouble>& pSendData,
 									Array<OneD, NekDouble>& pRecvData);
             virtual void v_AlltoAll(Array<OneD, int>& pSendData,
@@ -126,6 +179,41 @@ namespace Nektar
 									Array<OneD, int>& pRecvData,
 									Array<OneD, int>& pRecvDataSizeMap,
 									Array<OneD, int>& pRecvDataOffsetMap);
+            virtual void v_IAllReduce(Array<OneD, NekDouble>& pData,
+                                      enum ReduceOperator pOp,
+                                      CommRequestSharedPtr pRequest,
+                                      int pLoc);
+            virtual void v_IAlltoAllv(Array<OneD, NekDouble>& pSendData,
+                                      Array<OneD, int>& pSendDataSizeMap,
+                                      Array<OneD, int>& pSendDataOffsetMap,
+                                      Array<OneD, NekDouble>& pRecvData,
+                                      Array<OneD, int>& pRecvDataSizeMap,
+                                      Array<OneD, int>& pRecvDataOffsetMap,
+                                      CommRequestSharedPtr pRequest,
+                                      int pLoc);
+            virtual void v_Isend(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc);
+            virtual void v_Irecv(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc);
+            virtual void v_SendInit(int pProc,
+                                    Array<OneD, NekDouble>& pData,
+                                    int pCount,
+                                    CommRequestSharedPtr pRequest,
+                                    int pLoc);
+            virtual void v_RecvInit(int pProc,
+                                    Array<OneD, NekDouble>& pData,
+                                    int pCount,
+                                    CommRequestSharedPtr pRequest,
+                                    int pLoc);
+            virtual void v_StartAll(CommRequestSharedPtr pRequest);
+            virtual CommRequestSharedPtr v_CreateRequest(int num);
+            virtual void v_WaitAll(CommRequestSharedPtr pRequest);
             virtual void v_SplitComm(int pRows, int pColumns);
 
         private:
@@ -226,6 +226,24 @@ namespace Nektar
         }
 
 
+        /**
+         *
+         */
+        void CommSerial::v_Bcast(std::vector<unsigned int>& pData, int pRoot)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_Exscan(boost::uint64_t& pData)
+        {
+            pData = 0;
+        }
+
+
 		/**
          *
          */
@@ -272,6 +290,113 @@ namespace Nektar
         }
 
 
+        /**
+         *
+         */
+        void CommSerial::v_IAllReduce(Array<OneD, NekDouble>& pData,
+                                      enum ReduceOperator pOp,
+                                      CommRequestSharedPtr pRequest,
+                                      int pLoc)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_IAlltoAllv(Array<OneD, NekDouble>& pSendData,
+                                      Array<OneD, int>& pSendDataSizeMap,
+                                      Array<OneD, int>& pSendDataOffsetMap,
+                                      Array<OneD, NekDouble>& pRecvData,
+                                      Array<OneD, int>& pRecvDataSizeMap,
+                                      Array<OneD, int>& pRecvDataOffsetMap,
+                                      CommRequestSharedPtr pRequest,
+                                      int pLoc)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_Isend(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_Irecv(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_SendInit(int pProc,
+                                    Array<OneD, NekDouble>& pData,
+                                    int pCount,
+                                    CommRequestSharedPtr pRequest,
+                                    int pLoc)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_RecvInit(int pProc,
+                                    Array<OneD, NekDouble>& pData,
+                                    int pCount,
+                                    CommRequestSharedPtr pRequest,
+                                    int pLoc)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_StartAll(CommRequestSharedPtr pRequest)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        CommRequestSharedPtr CommSerial::v_CreateRequest(int num)
+        {
+            return MemoryManager<CommRequest>::AllocateSharedPtr();
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_WaitAll(CommRequestSharedPtr pRequest)
+        {
+
+        }
+
+
         /**
          *
          */
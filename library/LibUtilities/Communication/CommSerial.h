@@ -103,6 +103,9 @@ namespace Nektar
                                                           enum ReduceOperator pOp);
             LIB_UTILITIES_EXPORT virtual void v_AllReduce(std::vector<unsigned int>& pData,
                                                           enum ReduceOperator pOp);
+            LIB_UTILITIES_EXPORT virtual void v_Bcast(std::vector<unsigned int>& pData,
+                                                      int pRoot);
+            LIB_UTILITIES_EXPORT virtual void v_Exscan(boost::uint64_t& pData);
             LIB_UTILITIES_EXPORT virtual void v_AlltoAll(Array<OneD, NekDouble>& pSendData,
                                                          Array<OneD, NekDouble>& pRecvData);
             LIB_UTILITIES_EXPORT virtual void v_AlltoAll(Array<OneD, int>& pSendData,
@@ -119,6 +122,41 @@ namespace Nektar
                                                           Array<OneD, int>& pRecvData,
                                                           Array<OneD, int>& pRecvDataSizeMap,
                                                           Array<OneD, int>& pRecvDataOffsetMap);
+            LIB_UTILITIES_EXPORT virtual void v_IAllReduce(Array<OneD, NekDouble>& pData,
+                                                           enum ReduceOperator pOp,
+                                                           CommRequestSharedPtr pRequest,
+                                                           int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_IAlltoAllv(Array<OneD, NekDouble>& pSendData,
+                                                           Array<OneD, int>& pSendDataSizeMap,
+                                                           Array<OneD, int>& pSendDataOffsetMap,
+                                                           Array<OneD, NekDouble>& pRecvData,
+                                                           Array<OneD, int>& pRecvDataSizeMap,
+                                                           Array<OneD, int>& pRecvDataOffsetMap,
+                                                           CommRequestSharedPtr pRequest,
+                                                           int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_Isend(int pProc,
+                                                      Array<OneD, NekDouble>& pData,
+                                                      int pCount,
+                                                      CommRequestSharedPtr pRequest,
+                                                      int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_Irecv(int pProc,
+                                                      Array<OneD, NekDouble>& pData,
+                                                      int pCount,
+                                                      CommRequestSharedPtr pRequest,
+                                                      int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_SendInit(int pProc,
+                                                         Array<OneD, NekDouble>& pData,
+                                                         int pCount,
+                                                         CommRequestSharedPtr pRequest,
+                                                         int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_RecvInit(int pProc,
+                                                         Array<OneD, NekDouble>& pData,
+                                                         int pCount,
+                                                         CommRequestSharedPtr pRequest,
+                                                         int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_StartAll(CommRequestSharedPtr pRequest);
+            LIB_UTILITIES_EXPORT virtual CommRequestSharedPtr v_CreateRequest(int num);
+            LIB_UTILITIES_EXPORT virtual void v_WaitAll(CommRequestSharedPtr pRequest);
             LIB_UTILITIES_EXPORT virtual void v_SplitComm(int pRows, int pColumns);
             
         };
@@ -33,6 +33,8 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include <LibUtilities/Communication/Transposition.h>
 
 #include <LibUtilities/BasicUtils/ErrorUtil.hpp>  // for ASSERTL0, etc
@@ -310,7 +312,21 @@ namespace Nektar
                     packed_len = m_num_homogeneous_points[0];
                 }
 
+                // Post all receives up front and send the block of each
+                // process as soon as it has been packed, so that packing
+                // overlaps with the exchange.
+                Array<OneD, NekDouble> tmp;
+                CommRequestSharedPtr request =
+                    m_hcomm->CreateRequest(2*m_num_processes[0]);
+
+                for(i = 0; i < m_num_processes[0]; i++)
+                {
+                    m_hcomm->Irecv(i, tmp = tmp_outarray + m_OffsetMap[i],
+                                   m_SizeMap[i], request, i);
+                }
+
                 // Start Transposition
+                int proc = 0;
                 while(index < num_points_per_plane)
                 {
                     copy_len =
@@ -327,11 +343,24 @@ namespace Nektar
                         cnt += num_pencil_per_proc;
                     }
 
+                    m_hcomm->Isend(proc, tmp = outarray + m_OffsetMap[proc],
+                                   m_SizeMap[proc], request,
+                                   m_num_processes[0] + proc);
+                    proc++;
+
                     index += copy_len;
                 }
 
-                m_hcomm->AlltoAllv(outarray,     m_SizeMap, m_OffsetMap,
-                                   tmp_outarray, m_SizeMap, m_OffsetMap);
+                // Processes which hold no pencils still take part in the
+                // exchange.
+                for(; proc < m_num_processes[0]; proc++)
+                {
+                    m_hcomm->Isend(proc, tmp = outarray + m_OffsetMap[proc],
+                                   m_SizeMap[proc], request,
+                                   m_num_processes[0] + proc);
+                }
+
+                m_hcomm->WaitAll(request);
 
                 for(i = 0; i < packed_len; ++i)
                 {
@@ -423,15 +452,39 @@ namespace Nektar
                     packed_len = m_num_homogeneous_points[0];
                 }
 
+                // Post all receives up front and send the block of each
+                // process as soon as its planes have been packed, so that
+                // packing overlaps with the exchange.
+                Array<OneD, NekDouble> tmp;
+                CommRequestSharedPtr request =
+                    m_hcomm->CreateRequest(2*m_num_processes[0]);
+
+                for(i = 0; i < m_num_processes[0]; i++)
+                {
+                    m_hcomm->Irecv(i, tmp = tmp_outarray + m_OffsetMap[i],
+                                   m_SizeMap[i], request, i);
+                }
+
                 // Start Transposition
-                for(i = 0; i < packed_len; ++i)
+                for(int proc = 0; proc < m_num_processes[0]; proc++)
                 {
-                    Vmath::Vcopy(num_pencil_per_proc,&(inarray[i]),packed_len,
-                                 &(tmp_inarray[i*num_pencil_per_proc]),1);
+                    int start = proc * m_num_points_per_proc[0];
+                    int end   = std::min(start + m_num_points_per_proc[0],
+                                         packed_len);
+
+                    for(i = start; i < end; ++i)
+                    {
+                        Vmath::Vcopy(num_pencil_per_proc,
+                                     &(inarray[i]), packed_len,
+                                     &(tmp_inarray[i*num_pencil_per_proc]), 1);
+                    }
+
+                    m_hcomm->Isend(proc, tmp = tmp_inarray + m_OffsetMap[proc],
+                                   m_SizeMap[proc], request,
+                                   m_num_processes[0] + proc);
                 }
 
-                m_hcomm->AlltoAllv(tmp_inarray,  m_SizeMap, m_OffsetMap,
-                                   tmp_outarray, m_SizeMap, m_OffsetMap);
+                m_hcomm->WaitAll(request);
 
                 while(index < num_points_per_plane)
                 {
@@ -37,6 +37,8 @@
 #include <LibUtilities/BasicUtils/VmathArray.hpp>
 #include <LibUtilities/BasicUtils/SharedArray.hpp>
 
+#include <cstdio>
+
 namespace Nektar
 {
     namespace LibUtilities
@@ -52,10 +54,14 @@ namespace Nektar
             phys = Array<OneD,NekDouble>(m_N);
             coef = Array<OneD,NekDouble>(m_N);
 
+            ImportWisdom();
+
             plan_forward  = fftw_plan_r2r_1d(m_N, &phys[0], &coef[0],
-                                             FFTW_R2HC, FFTW_ESTIMATE);
+                                             FFTW_R2HC, PlannerFlags());
             plan_backward = fftw_plan_r2r_1d(m_N, &coef[0], &phys[0],
-                                             FFTW_HC2R, FFTW_ESTIMATE);
+                                             FFTW_HC2R, PlannerFlags());
+
+            ExportWisdom();
 
             m_FFTW_w = Array<OneD,NekDouble>(m_N);
             m_FFTW_w_inv = Array<OneD,NekDouble>(m_N);
@@ -71,12 +77,155 @@ namespace Nektar
                 m_FFTW_w[i]     = m_FFTW_w[0]*2;
                 m_FFTW_w_inv[i] = m_FFTW_w_inv[0]/2;
             }
+
+            m_batch_w_inv = Array<OneD,NekDouble>(m_N);
+            Vmath::Smul(m_N, 1.0/m_N, m_FFTW_w_inv, 1, m_batch_w_inv, 1);
         }
 
         // Distructor
         NekFFTW::~NekFFTW()
         {
+            fftw_destroy_plan(plan_forward);
+            fftw_destroy_plan(plan_backward);
+
+            std::map<int, BatchPlan>::iterator it;
+            for (it = m_batchPlans.begin(); it != m_batchPlans.end(); ++it)
+            {
+                fftw_destroy_plan(it->second.plan_forward);
+                fftw_destroy_plan(it->second.plan_backward);
+            }
+        }
+
+        /**
+         * Returns the FFTW planner flags for the planner rigor set with
+         * NektarFFT::SetPlanner.
+         */
+        unsigned int NekFFTW::PlannerFlags()
+        {
+            switch (s_plannerRigor)
+            {
+                case eFFTMeasure:    return FFTW_MEASURE;
+                case eFFTPatient:    return FFTW_PATIENT;
+                case eFFTExhaustive: return FFTW_EXHAUSTIVE;
+                default:             return FFTW_ESTIMATE;
+            }
+        }
+
+        /**
+         * Reads previously saved plans from the wisdom file, once, so that
+         * measured plans are not recomputed in every run.
+         */
+        void NekFFTW::ImportWisdom()
+        {
+            static std::string imported;
+
+            if (s_wisdomFile.empty() || s_wisdomFile == imported)
+            {
+                return;
+            }
+            imported = s_wisdomFile;
+
+            FILE *f = fopen(s_wisdomFile.c_str(), "r");
+            if (f)
+            {
+                fftw_import_wisdom_from_file(f);
+                fclose(f);
+            }
+        }
+
+        /**
+         * Saves all plans created so far to the wisdom file. Plans created
+         * with FFTW_ESTIMATE are cheap to recreate, so are not saved.
+         */
+        void NekFFTW::ExportWisdom()
+        {
+            if (!s_writeWisdom || s_plannerRigor == eFFTEstimate)
+            {
+                return;
+            }
+
+            FILE *f = fopen(s_wisdomFile.c_str(), "w");
+            if (f)
+            {
+                fftw_export_wisdom_to_file(f);
+                fclose(f);
+            }
+        }
+
+        /**
+         * Returns the plans for transforming @a howmany vectors at once,
+         * creating them on first use. The real-to-complex transform stores
+         * the coefficients of each vector as consecutive real and imaginary
+         * parts, which except for the Nyquist mode is the Nektar++ ordering,
+         * so no reshuffling is required.
+         */
+        NekFFTW::BatchPlan &NekFFTW::GetBatchPlan(int howmany)
+        {
+            std::map<int, BatchPlan>::iterator it = m_batchPlans.find(howmany);
+            if (it != m_batchPlans.end())
+            {
+                return it->second;
+            }
+
+            BatchPlan &b = m_batchPlans[howmany];
+            b.phys = Array<OneD,NekDouble>(howmany*m_N);
+            b.coef = Array<OneD,NekDouble>(howmany*(m_N+2));
+
+            int n = m_N;
+            fftw_complex *c = reinterpret_cast<fftw_complex *>(&b.coef[0]);
+
+            b.plan_forward  = fftw_plan_many_dft_r2c(
+                1, &n, howmany, &b.phys[0], NULL, 1, m_N,
+                c, NULL, 1, m_N/2+1, PlannerFlags());
+            b.plan_backward = fftw_plan_many_dft_c2r(
+                1, &n, howmany, c, NULL, 1, m_N/2+1,
+                &b.phys[0], NULL, 1, m_N, PlannerFlags());
+
+            ExportWisdom();
+
+            return b;
+        }
+
+        // Batched forward transformation
+        void NekFFTW::v_FFTFwdTrans(
+                int                                 howmany,
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray)
+        {
+            BatchPlan &b = GetBatchPlan(howmany);
+
+            Vmath::Vcopy(howmany*m_N, inarray, 1, b.phys, 1);
+
+            fftw_execute(b.plan_forward);
+
+            // The weights remove the imaginary part of the mean mode, in
+            // place of which Nektar++ stores the (zero) Nyquist mode.
+            for (int i = 0; i < howmany; ++i)
+            {
+                Vmath::Vmul(m_N, &b.coef[i*(m_N+2)], 1, &m_FFTW_w[0], 1,
+                                 &outarray[i*m_N],   1);
+            }
+        }
+
+        // Batched backward transformation
+        void NekFFTW::v_FFTBwdTrans(
+                int                                 howmany,
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray)
+        {
+            BatchPlan &b = GetBatchPlan(howmany);
+
+            for (int i = 0; i < howmany; ++i)
+            {
+                NekDouble *c = &b.coef[i*(m_N+2)];
+                Vmath::Vmul(m_N, &inarray[i*m_N], 1, &m_batch_w_inv[0], 1,
+                                 c,               1);
+                c[m_N] = c[m_N+1] = 0.0;
+            }
+
+            fftw_execute(b.plan_backward);
 
+            Vmath::Vcopy(howmany*m_N, b.phys, 1, outarray, 1);
         }
 
         // Forward transformation
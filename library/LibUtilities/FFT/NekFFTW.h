@@ -46,6 +46,8 @@
 
 #include <fftw3.h>
 
+#include <map>
+
 namespace Nektar
 {
     template <typename Dim, typename DataType>
@@ -82,10 +84,29 @@ namespace Nektar
 			virtual void v_FFTFwdTrans(Array<OneD,NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
 			
 			virtual void v_FFTBwdTrans(Array<OneD,NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
-			
-			
-			
+
+			virtual void v_FFTFwdTrans(
+				int                                 howmany,
+				const Array<OneD, const NekDouble> &inarray,
+				Array<OneD, NekDouble>             &outarray);
+
+			virtual void v_FFTBwdTrans(
+				int                                 howmany,
+				const Array<OneD, const NekDouble> &inarray,
+				Array<OneD, NekDouble>             &outarray);
+
 		protected:
+			/// Plans and buffers for transforming a number of vectors at
+			/// once. The complex coefficients of each vector are stored in
+			/// m_N+2 values.
+			struct BatchPlan
+			{
+				Array<OneD,NekDouble> phys;
+				Array<OneD,NekDouble> coef;
+				fftw_plan             plan_forward;
+				fftw_plan             plan_backward;
+			};
+			
 			
 			Array<OneD,NekDouble> m_FFTW_w;  // weights to convert arrays form Nektar++ to FFTW format
 			Array<OneD,NekDouble> m_FFTW_w_inv; // weights to convert arrays from FFTW to Nektar++ format
@@ -97,6 +118,10 @@ namespace Nektar
 
 			fftw_plan plan_backward;         // plan to execute a backward FFT in FFTW
 			fftw_plan plan_forward;          // plan to execute a forward FFT in FFTW
+
+			std::map<int, BatchPlan> m_batchPlans; // batched plans by number of vectors
+			Array<OneD,NekDouble> m_batch_w_inv;   // weights to convert batched input to FFTW format
+
 			/**
 			 * Reshuffling routines to put the coefficients in Nektar++/FFTW format.
 			 * The routines take as an input the number of points N, the vector of coeffcients
@@ -106,6 +131,12 @@ namespace Nektar
 			void Reshuffle_FFTW2Nek(Array<OneD,NekDouble> &coef);
 			
 			void Reshuffle_Nek2FFTW(Array<OneD,NekDouble> &coef);
+
+			BatchPlan &GetBatchPlan(int howmany);
+
+			static unsigned int PlannerFlags();
+			static void ImportWisdom();
+			static void ExportWisdom();
 			
 			
 
@@ -34,6 +34,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <LibUtilities/FFT/NektarFFT.h>
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
 #include <loki/Singleton.h>             // for CreateUsingNew, NoDestroy, etc
 
 namespace Nektar
@@ -52,6 +55,21 @@ namespace Nektar
 		 *
 		 */
 		
+		FFTPlannerRigor NektarFFT::s_plannerRigor = eFFTEstimate;
+		std::string     NektarFFT::s_wisdomFile;
+		bool            NektarFFT::s_writeWisdom  = false;
+
+		std::string NektarFFT::plannerLookupIds[] = {
+			SessionReader::RegisterDefaultSolverInfo("FFTPlanner", "Estimate"),
+			SessionReader::RegisterEnumValue("FFTPlanner", "Estimate",   eFFTEstimate),
+			SessionReader::RegisterEnumValue("FFTPlanner", "Measure",    eFFTMeasure),
+			SessionReader::RegisterEnumValue("FFTPlanner", "Patient",    eFFTPatient),
+			SessionReader::RegisterEnumValue("FFTPlanner", "Exhaustive", eFFTExhaustive)
+		};
+
+		std::string NektarFFT::wisdomArg = SessionReader::RegisterCmdLineArgument(
+			"fftw-wisdom", "", "file in which to store FFT plans across runs.");
+
 		/**
 		 * This constructor is protected as the objects of this class are never
 		 * instantiated directly.
@@ -92,6 +110,39 @@ namespace Nektar
 			v_FFTBwdTrans(coef,phys);
 		}
 		
+		void NektarFFT::FFTFwdTrans(
+			int                                 howmany,
+			const Array<OneD, const NekDouble> &phys,
+			Array<OneD, NekDouble>             &coef)
+		{
+			v_FFTFwdTrans(howmany, phys, coef);
+		}
+
+		void NektarFFT::FFTBwdTrans(
+			int                                 howmany,
+			const Array<OneD, const NekDouble> &coef,
+			Array<OneD, NekDouble>             &phys)
+		{
+			v_FFTBwdTrans(howmany, coef, phys);
+		}
+
+		/**
+		 * The wisdom file is only written by the root process, so that
+		 * processes do not write to it concurrently.
+		 */
+		void NektarFFT::SetPlanner(const SessionReaderSharedPtr &pSession)
+		{
+			s_plannerRigor = pSession->GetSolverInfoAsEnum<FFTPlannerRigor>(
+				"FFTPlanner");
+
+			if (pSession->DefinesCmdLineArgument("fftw-wisdom"))
+			{
+				s_wisdomFile  = pSession->GetCmdLineArgument<std::string>(
+					"fftw-wisdom");
+				s_writeWisdom = pSession->GetComm()->GetRank() == 0;
+			}
+		}
+
 		void NektarFFT::v_FFTFwdTrans(Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef)
 		{
 			
@@ -101,6 +152,38 @@ namespace Nektar
 		{
 			
 		}
+
+		/**
+		 * Transforms the vectors one at a time, for implementations without
+		 * batched transforms.
+		 */
+		void NektarFFT::v_FFTFwdTrans(
+			int                                 howmany,
+			const Array<OneD, const NekDouble> &phys,
+			Array<OneD, NekDouble>             &coef)
+		{
+			Array<OneD, NekDouble> in(m_N), out(m_N);
+			for (int i = 0; i < howmany; ++i)
+			{
+				Vmath::Vcopy(m_N, &phys[i*m_N], 1, &in[0], 1);
+				v_FFTFwdTrans(in, out);
+				Vmath::Vcopy(m_N, &out[0], 1, &coef[i*m_N], 1);
+			}
+		}
+
+		void NektarFFT::v_FFTBwdTrans(
+			int                                 howmany,
+			const Array<OneD, const NekDouble> &coef,
+			Array<OneD, NekDouble>             &phys)
+		{
+			Array<OneD, NekDouble> in(m_N), out(m_N);
+			for (int i = 0; i < howmany; ++i)
+			{
+				Vmath::Vcopy(m_N, &coef[i*m_N], 1, &in[0], 1);
+				v_FFTBwdTrans(in, out);
+				Vmath::Vcopy(m_N, &out[0], 1, &phys[i*m_N], 1);
+			}
+		}
 		
 	}//end namespace LibUtilities
 }//end of namespace Nektar
@@ -40,6 +40,8 @@
 #include <LibUtilities/BasicUtils/NekFactory.hpp>
 #include <LibUtilities/LibUtilitiesDeclspec.h>
 
+#include <string>
+
 namespace Nektar
 {
     template <typename Dim, typename DataType>
@@ -54,6 +56,18 @@ namespace Nektar
 		 * library or to a specific FFT implementation.
 		 */
 		class NektarFFT;
+		class SessionReader;
+		typedef boost::shared_ptr<SessionReader> SessionReaderSharedPtr;
+
+		/// Effort spent by the FFT library in choosing how to perform a
+		/// transform, in increasing order.
+		enum FFTPlannerRigor
+		{
+			eFFTEstimate,
+			eFFTMeasure,
+			eFFTPatient,
+			eFFTExhaustive
+		};
 		
 		// A shared pointer to the NektarFFT object
 		typedef boost::shared_ptr<NektarFFT>  NektarFFTSharedPtr;
@@ -102,13 +116,57 @@ namespace Nektar
 			 * outarray   = vector in physical space (length N)
 			 */
 			LIB_UTILITIES_EXPORT void FFTBwdTrans(Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
-			
+
+			/**
+			 * Forward transformation of @a howmany vectors of length m_N,
+			 * stored contiguously in @a phys, into @a coef.
+			 */
+			LIB_UTILITIES_EXPORT void FFTFwdTrans(
+				int                                 howmany,
+				const Array<OneD, const NekDouble> &phys,
+				Array<OneD, NekDouble>             &coef);
+
+			/**
+			 * Backward transformation of @a howmany vectors of length m_N,
+			 * stored contiguously in @a coef, into @a phys.
+			 */
+			LIB_UTILITIES_EXPORT void FFTBwdTrans(
+				int                                 howmany,
+				const Array<OneD, const NekDouble> &coef,
+				Array<OneD, NekDouble>             &phys);
+
+			/**
+			 * Sets the planner rigor and wisdom file used by transforms
+			 * created subsequently, from the FFTPlanner solver info property
+			 * and the fftw-wisdom command-line argument of @a pSession.
+			 */
+			LIB_UTILITIES_EXPORT static void SetPlanner(
+				const SessionReaderSharedPtr &pSession);
+
 		protected:
-			
-			
+			/// Planner rigor of new transforms.
+			LIB_UTILITIES_EXPORT static FFTPlannerRigor s_plannerRigor;
+			/// File from which plans are read and to which they are saved.
+			LIB_UTILITIES_EXPORT static std::string     s_wisdomFile;
+			/// Whether this process saves new plans to #s_wisdomFile.
+			LIB_UTILITIES_EXPORT static bool            s_writeWisdom;
+
+			static std::string plannerLookupIds[];
+			static std::string wisdomArg;
+
 			virtual void v_FFTFwdTrans(Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef);
 						
 			virtual void v_FFTBwdTrans(Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
+
+			virtual void v_FFTFwdTrans(
+				int                                 howmany,
+				const Array<OneD, const NekDouble> &phys,
+				Array<OneD, NekDouble>             &coef);
+
+			virtual void v_FFTBwdTrans(
+				int                                 howmany,
+				const Array<OneD, const NekDouble> &coef,
+				Array<OneD, NekDouble>             &phys);
 			
 		private:
 			
@@ -149,6 +149,7 @@ namespace Nektar
 
         TimeIntegrationScheme::TimeIntegrationScheme(const TimeIntegrationSchemeKey &key):
             m_schemeKey(key),
+            m_lowStorage(0),
             m_initialised(false)
         {
             switch(key.GetIntegrationMethod())
@@ -1022,6 +1023,135 @@ namespace Nektar
                     m_timeLevelOffset[0] = 0;
                 }
                 break;
+            case eRungeKutta3_SSP:
+                {
+                    // Shu-Osher form with three registers:
+                    // Y_{i+1} = a_i y^n + (1-a_i) Y_i + b_i dt f(Y_i)
+                    m_numsteps  = 1;
+                    m_numstages = 3;
+                    m_lowStorage = 3;
+
+                    m_lowStorageA = Array<OneD, NekDouble>(m_numstages);
+                    m_lowStorageB = Array<OneD, NekDouble>(m_numstages);
+                    m_lowStorageC = Array<OneD, NekDouble>(m_numstages);
+
+                    m_lowStorageA[0] = 0.0;
+                    m_lowStorageA[1] = 3.0/4.0;
+                    m_lowStorageA[2] = 1.0/3.0;
+                    m_lowStorageB[0] = 1.0;
+                    m_lowStorageB[1] = 1.0/4.0;
+                    m_lowStorageB[2] = 2.0/3.0;
+                    m_lowStorageC[0] = 0.0;
+                    m_lowStorageC[1] = 1.0;
+                    m_lowStorageC[2] = 1.0/2.0;
+
+                    // Equivalent Butcher tableau
+                    m_A = Array<OneD, Array<TwoD,NekDouble> >(1);
+                    m_B = Array<OneD, Array<TwoD,NekDouble> >(1);
+
+                    m_A[0] = Array<TwoD,NekDouble>(m_numstages,m_numstages,0.0);
+                    m_B[0] = Array<TwoD,NekDouble>(m_numsteps, m_numstages,0.0);
+                    m_U    = Array<TwoD,NekDouble>(m_numstages,m_numsteps, 1.0);
+                    m_V    = Array<TwoD,NekDouble>(m_numsteps, m_numsteps, 1.0);
+
+                    m_A[0][1][0] = 1.0;
+                    m_A[0][2][0] = 1.0/4.0;
+                    m_A[0][2][1] = 1.0/4.0;
+
+                    m_B[0][0][0] = 1.0/6.0;
+                    m_B[0][0][1] = 1.0/6.0;
+                    m_B[0][0][2] = 2.0/3.0;
+
+                    m_schemeType = eExplicit;
+                    m_numMultiStepValues = 1;
+                    m_numMultiStepDerivs = 0;
+                    m_timeLevelOffset = Array<OneD,unsigned int>(m_numsteps);
+                    m_timeLevelOffset[0] = 0;
+                }
+                break;
+            case eRungeKutta4_LowStorage:
+                {
+                    // Five-stage fourth-order scheme of Carpenter and Kennedy
+                    // (NASA TM-109112, 1994) in Williamson's 2N form:
+                    // dY = a_i dY + dt f(Y),  Y = Y + b_i dY
+                    m_numsteps  = 1;
+                    m_numstages = 5;
+                    m_lowStorage = 2;
+
+                    m_lowStorageA = Array<OneD, NekDouble>(m_numstages);
+                    m_lowStorageB = Array<OneD, NekDouble>(m_numstages);
+                    m_lowStorageC = Array<OneD, NekDouble>(m_numstages);
+
+                    m_lowStorageA[0] =  0.0;
+                    m_lowStorageA[1] = -567301805773.0/1357537059087.0;
+                    m_lowStorageA[2] = -2404267990393.0/2016746695238.0;
+                    m_lowStorageA[3] = -3550918686646.0/2091501179385.0;
+                    m_lowStorageA[4] = -1275806237668.0/842570457699.0;
+                    m_lowStorageB[0] =  1432997174477.0/9575080441755.0;
+                    m_lowStorageB[1] =  5161836677717.0/13612068292357.0;
+                    m_lowStorageB[2] =  1720146321549.0/2090206949498.0;
+                    m_lowStorageB[3] =  3134564353537.0/4481467310338.0;
+                    m_lowStorageB[4] =  2277821191437.0/14882151754819.0;
+
+                    // Equivalent Butcher tableau. The increment of stage k
+                    // is dY_k = sum_j d_kj dt F_j with d_kk = 1 and
+                    // d_kj = a_k d_(k-1)j, and stage i+1 accumulates the
+                    // increments b_k dY_k of the stages k <= i.
+                    m_A = Array<OneD, Array<TwoD,NekDouble> >(1);
+                    m_B = Array<OneD, Array<TwoD,NekDouble> >(1);
+
+                    m_A[0] = Array<TwoD,NekDouble>(m_numstages,m_numstages,0.0);
+                    m_B[0] = Array<TwoD,NekDouble>(m_numsteps, m_numstages,0.0);
+                    m_U    = Array<TwoD,NekDouble>(m_numstages,m_numsteps, 1.0);
+                    m_V    = Array<TwoD,NekDouble>(m_numsteps, m_numsteps, 1.0);
+
+                    Array<TwoD, NekDouble> d(m_numstages, m_numstages, 0.0);
+                    for (int i = 0; i < m_numstages; ++i)
+                    {
+                        for (int j = 0; j < i; ++j)
+                        {
+                            d[i][j] = m_lowStorageA[i] * d[i-1][j];
+                        }
+                        d[i][i] = 1.0;
+                    }
+
+                    for (int i = 0; i < m_numstages; ++i)
+                    {
+                        for (int j = 0; j <= i; ++j)
+                        {
+                            NekDouble a = 0.0;
+                            for (int k = j; k <= i; ++k)
+                            {
+                                a += m_lowStorageB[k] * d[k][j];
+                            }
+
+                            if (i + 1 < m_numstages)
+                            {
+                                m_A[0][i+1][j] = a;
+                            }
+                            else
+                            {
+                                m_B[0][0][j] = a;
+                            }
+                        }
+                    }
+
+                    for (int i = 0; i < m_numstages; ++i)
+                    {
+                        m_lowStorageC[i] = 0.0;
+                        for (int j = 0; j < i; ++j)
+                        {
+                            m_lowStorageC[i] += m_A[0][i][j];
+                        }
+                    }
+
+                    m_schemeType = eExplicit;
+                    m_numMultiStepValues = 1;
+                    m_numMultiStepDerivs = 0;
+                    m_timeLevelOffset = Array<OneD,unsigned int>(m_numsteps);
+                    m_timeLevelOffset[0] = 0;
+                }
+                break;
             default:
                 {
                     NEKERROR(ErrorUtil::efatal,"Invalid Time Integration Scheme");
@@ -1100,8 +1230,28 @@ namespace Nektar
             // create a TimeIntegrationSolution object based upon the
             // initial value. Initialise all other multi-step values
             // and derivatives to zero
-            TimeIntegrationSolutionSharedPtr y_out = 
-                MemoryManager<TimeIntegrationSolution>::AllocateSharedPtr(m_schemeKey,y_0,time,timestep); 
+            TimeIntegrationSolutionSharedPtr y_out;
+
+            if (m_lowStorage)
+            {
+                // Low-storage schemes update the solution in place, so
+                // that it must not share storage with the initial value.
+                int nvar    = y_0.num_elements();
+                int npoints = y_0[0].num_elements();
+                DoubleArray y(nvar);
+                for (int i = 0; i < nvar; ++i)
+                {
+                    y[i] = Array<OneD, NekDouble>(npoints);
+                    Vmath::Vcopy(npoints, y_0[i], 1, y[i], 1);
+                }
+                y_out = MemoryManager<TimeIntegrationSolution>::
+                    AllocateSharedPtr(m_schemeKey, y, time, timestep);
+            }
+            else
+            {
+                y_out = MemoryManager<TimeIntegrationSolution>::
+                    AllocateSharedPtr(m_schemeKey, y_0, time, timestep);
+            }
 
             // calculate the initial derivative, if is part of the
             // solution vector of the current scheme
@@ -1143,7 +1293,14 @@ namespace Nektar
             int nvar    = solvector->GetFirstDim ();
             int npoints = solvector->GetSecondDim();
 
-            if( (solvector->GetIntegrationScheme()).get() != this )
+            if (m_lowStorage &&
+                (solvector->GetIntegrationScheme()).get() == this)
+            {
+                LowStorageTimeIntegrate(timestep,
+                                        solvector->UpdateSolution(),
+                                        solvector->UpdateTimeVector()[0], op);
+            }
+            else if( (solvector->GetIntegrationScheme()).get() != this )
             {
                 // This branch will be taken when the solution vector
                 // (solvector) is set up for a different scheme than
@@ -1676,6 +1833,106 @@ namespace Nektar
             }
         }
         
+        /**
+         * \brief Perform one step of a low-storage Runge-Kutta scheme,
+         * updating the solution @a y and time @a t in place.
+         *
+         * Rather than keeping every stage derivative as in the general
+         * path, 2N schemes use only the solution and one increment
+         * register, and 3N schemes the old solution and one stage
+         * register, besides the right-hand side evaluation. The register
+         * updates of each stage are fused into a single pass.
+         */
+        void TimeIntegrationScheme::LowStorageTimeIntegrate(
+            const NekDouble                       timestep,
+                  DoubleArray                    &y,
+                  NekDouble                      &t,
+            const TimeIntegrationSchemeOperators &op)
+        {
+            int nvar    = y.num_elements();
+            int npoints = y[0].num_elements();
+            int i, k, p;
+
+            if (m_dY.num_elements() != nvar ||
+                m_dY[0].num_elements() != npoints)
+            {
+                m_dY  = DoubleArray(nvar);
+                m_tmp = DoubleArray(nvar);
+                for (k = 0; k < nvar; ++k)
+                {
+                    m_dY [k] = Array<OneD, NekDouble>(npoints, 0.0);
+                    m_tmp[k] = Array<OneD, NekDouble>(npoints, 0.0);
+                }
+                m_initialised = false;
+            }
+
+            NekDouble t0 = t;
+
+            if (m_lowStorage == 2)
+            {
+                for (i = 0; i < m_numstages; ++i)
+                {
+                    m_T = t0 + m_lowStorageC[i] * timestep;
+
+                    op.DoProjection(y, y, m_T);
+                    op.DoOdeRhs(y, m_tmp, m_T);
+
+                    NekDouble a = m_lowStorageA[i];
+                    NekDouble b = m_lowStorageB[i];
+                    for (k = 0; k < nvar; ++k)
+                    {
+                        NekDouble       *yk  = y[k].get();
+                        NekDouble       *dyk = m_dY[k].get();
+                        const NekDouble *fk  = m_tmp[k].get();
+
+                        for (p = 0; p < npoints; ++p)
+                        {
+                            dyk[p] = a * dyk[p] + timestep * fk[p];
+                            yk[p] += b * dyk[p];
+                        }
+                    }
+                }
+            }
+            else
+            {
+                // The stage register starts from the old solution, and the
+                // last stage is written directly into the solution.
+                for (k = 0; k < nvar; ++k)
+                {
+                    Vmath::Vcopy(npoints, y[k], 1, m_dY[k], 1);
+                }
+
+                for (i = 0; i < m_numstages; ++i)
+                {
+                    m_T = t0 + m_lowStorageC[i] * timestep;
+
+                    op.DoProjection(m_dY, m_dY, m_T);
+                    op.DoOdeRhs(m_dY, m_tmp, m_T);
+
+                    NekDouble a = m_lowStorageA[i];
+                    NekDouble b = m_lowStorageB[i] * timestep;
+                    for (k = 0; k < nvar; ++k)
+                    {
+                        NekDouble       *yk  = y[k].get();
+                        NekDouble       *Yk  = m_dY[k].get();
+                        NekDouble       *out = i == m_numstages - 1 ? yk : Yk;
+                        const NekDouble *fk  = m_tmp[k].get();
+
+                        for (p = 0; p < npoints; ++p)
+                        {
+                            out[p] = a * yk[p] + (1.0 - a) * Yk[p]
+                                   + b * fk[p];
+                        }
+                    }
+                }
+            }
+
+            t = t0 + timestep;
+
+            // Ensure that the new solution is projected if necessary
+            op.DoProjection(y, y, t);
+        }
+
         bool TimeIntegrationScheme::CheckIfFirstStageEqualsOldSolution(const Array<OneD, const Array<TwoD, NekDouble> >& A,
                                                                        const Array<OneD, const Array<TwoD, NekDouble> >& B,
                                                                        const Array<TwoD, const NekDouble>& U,
@@ -93,6 +93,8 @@ namespace Nektar
             eIMEXdirk_2_3_3,		      	  //!< L-stable, two stage, third order IMEX DIRK(2,3,3)
             eIMEXdirk_3_4_3,                  //!< L-stable, three stage, third order IMEX DIRK(3,4,3)
             eIMEXdirk_4_4_3,		      	  //!< L-stable, four stage, third order IMEX DIRK(4,4,3)
+            eRungeKutta3_SSP,                 //!< Strong-stability-preserving Runge-Kutta 3rd order explicit (low-storage)
+            eRungeKutta4_LowStorage,          //!< Carpenter-Kennedy 2N-storage Runge-Kutta 4th order explicit
             SIZE_TimeIntegrationMethod        //!< Length of enum list
         };
 
@@ -128,6 +130,8 @@ namespace Nektar
             "IMEXdirk_2_3_3",
             "IMEXdirk_3_4_3",
             "IMEXdirk_4_4_3",
+            "RungeKutta3_SSP",
+            "RungeKutta4_LowStorage",
         };
 
         enum TimeIntegrationSchemeType
@@ -531,6 +535,17 @@ namespace Nektar
             Array<TwoD,NekDouble>               m_U;
             Array<TwoD,NekDouble>               m_V;
 
+            /// Number of solution-sized registers of a low-storage
+            /// Runge-Kutta scheme (2 or 3), or zero for the general path.
+            unsigned int                        m_lowStorage;
+            /// Low-storage coefficients: for 2N schemes the Williamson
+            /// coefficients (A, B), for 3N schemes the Shu-Osher weights of
+            /// the old solution and of the stage derivative (A, B). C holds
+            /// the stage times.
+            Array<OneD, NekDouble>              m_lowStorageA;
+            Array<OneD, NekDouble>              m_lowStorageB;
+            Array<OneD, NekDouble>              m_lowStorageC;
+
         private: 
             bool m_initialised;   /// bool to identify if array has been initialised 
             int  m_nvar;          /// The number of variables in integration scheme. 
@@ -538,6 +553,8 @@ namespace Nektar
             DoubleArray m_Y;      /// Array containing the stage values 
             DoubleArray m_tmp;    /// explicit right hand side of each stage equation
 
+            DoubleArray m_dY;     /// Second register of low-storage schemes
+
             TripleArray m_F;      /// Array corresponding to the stage Derivatives 
             TripleArray m_F_IMEX; /// Used to store the Explicit stage derivative of IMEX schemes
 
@@ -575,6 +592,12 @@ namespace Nektar
                                const TimeIntegrationSchemeOperators &op     );
 
 
+            LIB_UTILITIES_EXPORT void LowStorageTimeIntegrate(
+                const NekDouble                       timestep,
+                      DoubleArray                    &y,
+                      NekDouble                      &t,
+                const TimeIntegrationSchemeOperators &op);
+
             inline int GetFirstDim(ConstTripleArray &y) const
             {
                 return y[0].num_elements();
@@ -353,6 +353,38 @@ namespace LibUtilities {
         m_intScheme[0] = TimeIntegrationSchemeManager()[IntKey0];
     }
 
+    // --------------
+    // RungeKutta3_SSP
+    // --------------
+    string TimeIntegrationRungeKutta3_SSP::className =
+        GetTimeIntegrationWrapperFactory().RegisterCreatorFunction(
+            "RungeKutta3_SSP",
+            TimeIntegrationRungeKutta3_SSP::create);
+    void TimeIntegrationRungeKutta3_SSP::v_InitObject()
+    {
+        TimeIntegrationSchemeKey IntKey0(eRungeKutta3_SSP);
+        m_method       = eRungeKutta3_SSP;
+        m_intSteps     = 1;
+        m_intScheme    = vector<TimeIntegrationSchemeSharedPtr>(m_intSteps);
+        m_intScheme[0] = TimeIntegrationSchemeManager()[IntKey0];
+    }
+
+    // --------------
+    // RungeKutta4_LowStorage
+    // --------------
+    string TimeIntegrationRungeKutta4_LowStorage::className =
+        GetTimeIntegrationWrapperFactory().RegisterCreatorFunction(
+            "RungeKutta4_LowStorage",
+            TimeIntegrationRungeKutta4_LowStorage::create);
+    void TimeIntegrationRungeKutta4_LowStorage::v_InitObject()
+    {
+        TimeIntegrationSchemeKey IntKey0(eRungeKutta4_LowStorage);
+        m_method       = eRungeKutta4_LowStorage;
+        m_intSteps     = 1;
+        m_intScheme    = vector<TimeIntegrationSchemeSharedPtr>(m_intSteps);
+        m_intScheme[0] = TimeIntegrationSchemeManager()[IntKey0];
+    }
+
     // --------------
     // Midpoint
     // --------------
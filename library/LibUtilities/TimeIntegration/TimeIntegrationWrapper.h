@@ -539,6 +539,52 @@ namespace LibUtilities {
         virtual void v_InitObject();
     };
 
+    class TimeIntegrationRungeKutta3_SSP : public TimeIntegrationWrapper
+    {
+    public:
+        friend class MemoryManager<TimeIntegrationRungeKutta3_SSP>;
+
+        /// Creates an instance of this class
+        static TimeIntegrationWrapperSharedPtr create()
+        {
+            TimeIntegrationWrapperSharedPtr p =
+                MemoryManager<TimeIntegrationRungeKutta3_SSP>
+                    ::AllocateSharedPtr();
+            p->InitObject();
+            return p;
+        }
+        /// Name of class
+        static std::string className;
+
+        virtual ~TimeIntegrationRungeKutta3_SSP() {}
+
+    protected:
+        virtual void v_InitObject();
+    };
+
+    class TimeIntegrationRungeKutta4_LowStorage : public TimeIntegrationWrapper
+    {
+    public:
+        friend class MemoryManager<TimeIntegrationRungeKutta4_LowStorage>;
+
+        /// Creates an instance of this class
+        static TimeIntegrationWrapperSharedPtr create()
+        {
+            TimeIntegrationWrapperSharedPtr p =
+                MemoryManager<TimeIntegrationRungeKutta4_LowStorage>
+                    ::AllocateSharedPtr();
+            p->InitObject();
+            return p;
+        }
+        /// Name of class
+        static std::string className;
+
+        virtual ~TimeIntegrationRungeKutta4_LowStorage() {}
+
+    protected:
+        virtual void v_InitObject();
+    };
+
     class TimeIntegrationDIRKOrder2 : public TimeIntegrationWrapper
     {
     public:
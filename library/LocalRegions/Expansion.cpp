@@ -36,6 +36,7 @@
 #include <LibUtilities/Foundations/Interp.h>
 #include <LocalRegions/Expansion.h>
 #include <LocalRegions/MatrixKey.h>
+#include <LocalRegions/MetricRegistry.h>
 
 #include <SpatialDomains/MeshComponents.h>
 
@@ -71,7 +72,8 @@ namespace Nektar
         
         Expansion::Expansion(const Expansion &pSrc) :
                 m_geom(pSrc.m_geom),
-                m_metricinfo(pSrc.m_metricinfo)
+                m_metricinfo(pSrc.m_metricinfo),
+                m_sharedMetricInfo(pSrc.m_sharedMetricInfo)
         {
 
         }
@@ -157,6 +159,7 @@ namespace Nektar
 
             // Regenerate geometry factors
             m_metricinfo = m_geom->GetGeomFactors();
+            m_sharedMetricInfo.reset();
         }
 
         const SpatialDomains::GeomFactorsSharedPtr& Expansion::v_GetMetricInfo() const
@@ -164,6 +167,22 @@ namespace Nektar
             return m_metricinfo;
         }
 
+        /**
+         * Returns the metric registered with MetricRegistry which is
+         * equivalent to the metric of this element at its quadrature points.
+         * The lookup is performed on first use only.
+         */
+        const SpatialDomains::GeomFactorsSharedPtr& Expansion::GetSharedMetricInfo() const
+        {
+            if (!m_sharedMetricInfo)
+            {
+                m_sharedMetricInfo = m_base.num_elements() == 0 ? m_metricinfo
+                    : MetricRegistry::GetCanonical(
+                        m_metricinfo, GetPointsKeys());
+            }
+            return m_sharedMetricInfo;
+        }
+
 
         DNekScalMatSharedPtr Expansion::v_GetLocMatrix(const LocalRegions::MatrixKey &mkey)
         {
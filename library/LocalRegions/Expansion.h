@@ -91,6 +91,9 @@ namespace Nektar
                 LOCAL_REGIONS_EXPORT virtual const
                     SpatialDomains::GeomFactorsSharedPtr& v_GetMetricInfo() const;
 
+                LOCAL_REGIONS_EXPORT const
+                    SpatialDomains::GeomFactorsSharedPtr& GetSharedMetricInfo() const;
+
                 LOCAL_REGIONS_EXPORT DNekMatSharedPtr BuildTransformationMatrix(
                     const DNekScalMatSharedPtr &r_bnd, 
                     const StdRegions::MatrixType matrixType);
@@ -124,6 +127,8 @@ namespace Nektar
             protected:
                 SpatialDomains::GeometrySharedPtr  m_geom;
                 SpatialDomains::GeomFactorsSharedPtr m_metricinfo;
+                /// Canonical metric shared with congruent elements.
+                mutable SpatialDomains::GeomFactorsSharedPtr m_sharedMetricInfo;
                 MetricMap m_metrics;
 
                 void ComputeLaplacianMetric();
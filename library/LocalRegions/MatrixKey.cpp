@@ -35,6 +35,8 @@
 
 
 #include <LocalRegions/MatrixKey.h>
+#include <LocalRegions/Expansion.h>
+#include <LocalRegions/MetricRegistry.h>
 
 namespace Nektar
 {
@@ -49,12 +51,17 @@ namespace Nektar
             StdMatrixKey(matrixType, shapeType, stdExpansion, factorMap, varCoeffMap, nodalType),
             m_metricinfo(stdExpansion.GetMetricInfo())
         {
+            const Expansion *exp =
+                dynamic_cast<const Expansion *>(&stdExpansion);
+            m_sharedMetricinfo = exp ? exp->GetSharedMetricInfo()
+                                     : m_metricinfo;
         }
 
         MatrixKey::MatrixKey(const MatrixKey& mkey,
                       const StdRegions::MatrixType matrixType) :
             StdRegions::StdMatrixKey(mkey, matrixType),
-            m_metricinfo(mkey.m_metricinfo)
+            m_metricinfo(mkey.m_metricinfo),
+            m_sharedMetricinfo(mkey.m_sharedMetricinfo)
         {
         }
 
@@ -70,15 +77,38 @@ namespace Nektar
             }
         }
 
+        /**
+         * Matrices which depend on the element only through its metric terms
+         * are ordered by the canonical metric of the element, so that
+         * congruent elements share a single matrix in the matrix managers.
+         * All other matrices are ordered by the metric of the element itself.
+         */
+        static const SpatialDomains::GeomFactors *KeyMetric(
+            const MatrixKey &key,
+            const SpatialDomains::GeomFactorsSharedPtr &own,
+            const SpatialDomains::GeomFactorsSharedPtr &shared)
+        {
+            if (shared && key.GetNVarCoeff() == 0 &&
+                MetricRegistry::IsMetricOnly(key.GetMatrixType()))
+            {
+                return shared.get();
+            }
+            return own.get();
+        }
+
         bool operator<(const MatrixKey &lhs, const MatrixKey &rhs)
         {
-            if(lhs.m_metricinfo.get() < rhs.m_metricinfo.get())
+            const SpatialDomains::GeomFactors *lhsMetric = KeyMetric(
+                lhs, lhs.m_metricinfo, lhs.m_sharedMetricinfo);
+            const SpatialDomains::GeomFactors *rhsMetric = KeyMetric(
+                rhs, rhs.m_metricinfo, rhs.m_sharedMetricinfo);
+
+            if(lhsMetric < rhsMetric)
             {
                 return true;
             }
 
-
-            if(lhs.m_metricinfo.get() > rhs.m_metricinfo.get())
+            if(lhsMetric > rhsMetric)
             {
                 return false;
             }    
@@ -84,6 +84,8 @@ namespace Nektar
             MatrixKey();
 
             SpatialDomains::GeomFactorsSharedPtr  m_metricinfo; 
+            /// Canonical metric used to order metric-only matrix types.
+            SpatialDomains::GeomFactorsSharedPtr  m_sharedMetricinfo;
 
         private:
         };
@@ -0,0 +1,249 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File MetricRegistry.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Registry of canonical element metrics
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+
+#include <boost/functional/hash.hpp>
+
+#include <LocalRegions/MetricRegistry.h>
+
+namespace Nektar
+{
+    namespace LocalRegions
+    {
+        namespace
+        {
+            /// Relative tolerance below which metric terms are equal.
+            const NekDouble kMetricTol = 1e-12;
+
+            typedef std::vector<SpatialDomains::GeomFactorsSharedPtr>
+                MetricVector;
+            typedef boost::unordered_map<size_t, MetricVector>
+                MetricBucketMap;
+
+            MetricBucketMap registeredMetrics;
+            int             metricHits   = 0;
+            int             metricMisses = 0;
+
+            /**
+             * Combine a value quantised to 24 bits of mantissa into a hash,
+             * so that values differing only by round-off almost always hash
+             * equally. Values straddling a quantisation boundary merely fail
+             * to share.
+             */
+            void HashQuantised(size_t &hash, NekDouble val)
+            {
+                int exponent;
+                NekDouble mantissa = frexp(val, &exponent);
+                boost::hash_combine(hash, exponent);
+                boost::hash_combine(
+                    hash, (int)floor(mantissa * 16777216.0 + 0.5));
+            }
+
+            bool Close(NekDouble a, NekDouble b, NekDouble scale)
+            {
+                return fabs(a - b) <= kMetricTol * scale;
+            }
+        }
+
+        /**
+         * The lookup is performed by bucketing metrics on a coarse signature
+         * and comparing the Jacobian and derivative factors of all metrics
+         * in the bucket. Metrics which are not equivalent to any registered
+         * metric are registered and returned unchanged.
+         *
+         * @param   metric      Metric of an element.
+         * @param   ptsKeys     Points at which the element is evaluated.
+         * @returns             Canonical metric equivalent to @a metric.
+         */
+        SpatialDomains::GeomFactorsSharedPtr MetricRegistry::GetCanonical(
+            const SpatialDomains::GeomFactorsSharedPtr &metric,
+            const LibUtilities::PointsKeyVector        &ptsKeys)
+        {
+            if (!metric)
+            {
+                return metric;
+            }
+
+            MetricVector &bucket =
+                registeredMetrics[Signature(metric, ptsKeys)];
+
+            for (int i = 0; i < bucket.size(); ++i)
+            {
+                if (bucket[i] == metric ||
+                    Equivalent(bucket[i], metric, ptsKeys))
+                {
+                    ++metricHits;
+                    return bucket[i];
+                }
+            }
+
+            ++metricMisses;
+            bucket.push_back(metric);
+            return metric;
+        }
+
+        /**
+         * These matrices are evaluated from the standard matrices and the
+         * Jacobian and derivative factors of the element only. Matrices
+         * involving traces, normals or transformations, which depend on the
+         * orientation of the element within the mesh, are excluded.
+         */
+        bool MetricRegistry::IsMetricOnly(const StdRegions::MatrixType type)
+        {
+            switch (type)
+            {
+                case StdRegions::eMass:
+                case StdRegions::eInvMass:
+                case StdRegions::eLaplacian:
+                case StdRegions::eLaplacian00:
+                case StdRegions::eLaplacian01:
+                case StdRegions::eLaplacian02:
+                case StdRegions::eLaplacian10:
+                case StdRegions::eLaplacian11:
+                case StdRegions::eLaplacian12:
+                case StdRegions::eLaplacian20:
+                case StdRegions::eLaplacian21:
+                case StdRegions::eLaplacian22:
+                case StdRegions::eInvLaplacianWithUnityMean:
+                case StdRegions::eWeakDeriv0:
+                case StdRegions::eWeakDeriv1:
+                case StdRegions::eWeakDeriv2:
+                case StdRegions::eBwdTrans:
+                case StdRegions::eIProductWRTBase:
+                case StdRegions::eIProductWRTDerivBase0:
+                case StdRegions::eIProductWRTDerivBase1:
+                case StdRegions::eIProductWRTDerivBase2:
+                case StdRegions::eHelmholtz:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        void MetricRegistry::GetStatistics(int &hits, int &misses)
+        {
+            hits   = metricHits;
+            misses = metricMisses;
+        }
+
+        void MetricRegistry::Clear()
+        {
+            registeredMetrics.clear();
+            metricHits   = 0;
+            metricMisses = 0;
+        }
+
+        size_t MetricRegistry::Signature(
+            const SpatialDomains::GeomFactorsSharedPtr &metric,
+            const LibUtilities::PointsKeyVector        &ptsKeys)
+        {
+            const Array<OneD, const NekDouble> jac = metric->GetJac(ptsKeys);
+            const Array<TwoD, const NekDouble> df  =
+                metric->GetDerivFactors(ptsKeys);
+
+            size_t hash = 0;
+            boost::hash_combine(hash, (int)metric->GetGtype());
+            boost::hash_combine(hash, metric->GetCoordim());
+            boost::hash_combine(hash, jac.num_elements());
+            boost::hash_combine(hash, df.GetRows());
+            boost::hash_combine(hash, df.GetColumns());
+            HashQuantised(hash, jac[0]);
+            return hash;
+        }
+
+        bool MetricRegistry::Equivalent(
+            const SpatialDomains::GeomFactorsSharedPtr &lhs,
+            const SpatialDomains::GeomFactorsSharedPtr &rhs,
+            const LibUtilities::PointsKeyVector        &ptsKeys)
+        {
+            if (lhs->GetGtype()   != rhs->GetGtype() ||
+                lhs->GetCoordim() != rhs->GetCoordim())
+            {
+                return false;
+            }
+
+            const Array<OneD, const NekDouble> ljac = lhs->GetJac(ptsKeys);
+            const Array<OneD, const NekDouble> rjac = rhs->GetJac(ptsKeys);
+            const Array<TwoD, const NekDouble> ldf  =
+                lhs->GetDerivFactors(ptsKeys);
+            const Array<TwoD, const NekDouble> rdf  =
+                rhs->GetDerivFactors(ptsKeys);
+
+            if (ljac.num_elements() != rjac.num_elements() ||
+                ldf.GetRows()       != rdf.GetRows()       ||
+                ldf.GetColumns()    != rdf.GetColumns())
+            {
+                return false;
+            }
+
+            int i, j;
+            NekDouble scale = 0.0;
+
+            for (i = 0; i < ljac.num_elements(); ++i)
+            {
+                scale = std::max(scale, fabs(ljac[i]));
+            }
+            for (i = 0; i < ljac.num_elements(); ++i)
+            {
+                if (!Close(ljac[i], rjac[i], scale))
+                {
+                    return false;
+                }
+            }
+
+            scale = 0.0;
+            for (i = 0; i < ldf.GetRows(); ++i)
+            {
+                for (j = 0; j < ldf.GetColumns(); ++j)
+                {
+                    scale = std::max(scale, fabs(ldf[i][j]));
+                }
+            }
+            for (i = 0; i < ldf.GetRows(); ++i)
+            {
+                for (j = 0; j < ldf.GetColumns(); ++j)
+                {
+                    if (!Close(ldf[i][j], rdf[i][j], scale))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+    }
+}
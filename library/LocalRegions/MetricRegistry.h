@@ -0,0 +1,101 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File MetricRegistry.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Registry of canonical element metrics
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_LOCALREGIONS_METRICREGISTRY_H
+#define NEKTAR_LIB_LOCALREGIONS_METRICREGISTRY_H
+
+#include <vector>
+
+#include <boost/unordered_map.hpp>
+
+#include <StdRegions/StdRegions.hpp>
+#include <SpatialDomains/GeomFactors.h>
+#include <LocalRegions/LocalRegionsDeclspec.h>
+
+namespace Nektar
+{
+    namespace LocalRegions
+    {
+        /**
+         * @brief Registry mapping element metrics onto a canonical
+         * representative.
+         *
+         * Elements which are congruent up to a translation, such as those of
+         * structured or extruded meshes, have identical Jacobians and
+         * derivative factors. Matrices which depend on the element only
+         * through these metric terms are therefore identical too. The
+         * registry returns, for a given GeomFactors, the first registered
+         * GeomFactors whose metric terms agree to within a relative
+         * tolerance. MatrixKey orders such matrix types by the canonical
+         * metric, so that the matrix managers store a single matrix for all
+         * congruent elements.
+         */
+        class MetricRegistry
+        {
+        public:
+            /// Return the canonical metric equivalent to @a metric when
+            /// evaluated at @a ptsKeys.
+            LOCAL_REGIONS_EXPORT static SpatialDomains::GeomFactorsSharedPtr
+                GetCanonical(
+                    const SpatialDomains::GeomFactorsSharedPtr &metric,
+                    const LibUtilities::PointsKeyVector        &ptsKeys);
+
+            /// Determine whether a matrix type depends on the element only
+            /// through its metric terms.
+            LOCAL_REGIONS_EXPORT static bool IsMetricOnly(
+                const StdRegions::MatrixType type);
+
+            /// Number of lookups which matched an existing metric (hits) and
+            /// which registered a new one (misses).
+            LOCAL_REGIONS_EXPORT static void GetStatistics(
+                int &hits, int &misses);
+
+            /// Remove all registered metrics and reset the statistics.
+            LOCAL_REGIONS_EXPORT static void Clear();
+
+        private:
+            static size_t Signature(
+                const SpatialDomains::GeomFactorsSharedPtr &metric,
+                const LibUtilities::PointsKeyVector        &ptsKeys);
+
+            static bool Equivalent(
+                const SpatialDomains::GeomFactorsSharedPtr &lhs,
+                const SpatialDomains::GeomFactorsSharedPtr &rhs,
+                const LibUtilities::PointsKeyVector        &ptsKeys);
+        };
+    }
+}
+
+#endif
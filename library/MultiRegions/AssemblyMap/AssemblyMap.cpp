@@ -84,6 +84,7 @@ namespace Nektar
             m_numGlobalDirBndCoeffs(0),
             m_solnType(eNoSolnType),
             m_bndSystemBandWidth(0),
+            m_iterSolverType(eConjugateGradient),
             m_successiveRHS(0),
             m_gsh(0),
             m_bndGsh(0)
@@ -110,6 +111,8 @@ namespace Nektar
                                                             "GlobalSysSoln");
             m_preconType = pSession->GetSolverInfoAsEnum<PreconditionerType>(
                                                             "Preconditioner");
+            m_iterSolverType = pSession->GetSolverInfoAsEnum<
+                IterativeSolverType>("IterativeSolverType");
 
             // Override values with data from GlobalSysSolnInfo section 
             if(pSession->DefinesGlobalSysSolnInfo(variable, "GlobalSysSoln"))
@@ -128,6 +131,15 @@ namespace Nektar
                                                     "Preconditioner", precon);
             }
 
+            if(pSession->DefinesGlobalSysSolnInfo(variable,
+                                                  "IterativeSolverType"))
+            {
+                std::string iterSolver = pSession->GetGlobalSysSolnInfo(
+                                            variable, "IterativeSolverType");
+                m_iterSolverType = pSession->GetValueAsEnum<
+                    IterativeSolverType>("IterativeSolverType", iterSolver);
+            }
+
             if(pSession->DefinesGlobalSysSolnInfo(variable,
                                                   "IterativeSolverTolerance"))
             {
@@ -169,6 +181,7 @@ namespace Nektar
             m_hash(0),
             m_solnType(oldLevelMap->m_solnType),
             m_preconType(oldLevelMap->m_preconType),
+            m_iterSolverType(oldLevelMap->m_iterSolverType),
             m_iterativeTolerance(oldLevelMap->m_iterativeTolerance),
             m_successiveRHS(oldLevelMap->m_successiveRHS),
             m_gsh(oldLevelMap->m_gsh),
@@ -1188,6 +1201,11 @@ namespace Nektar
             return m_preconType;
         }
 
+        IterativeSolverType AssemblyMap::GetIterativeSolverType() const
+        {
+            return m_iterSolverType;
+        }
+
         NekDouble AssemblyMap::GetIterativeTolerance() const
         {
             return m_iterativeTolerance;
@@ -289,6 +289,8 @@ namespace Nektar
             /// Returns the method of solving global systems.
             MULTI_REGIONS_EXPORT GlobalSysSolnType GetGlobalSysSolnType() const;
             MULTI_REGIONS_EXPORT PreconditionerType GetPreconType() const;
+            MULTI_REGIONS_EXPORT IterativeSolverType
+                                            GetIterativeSolverType() const;
             MULTI_REGIONS_EXPORT NekDouble GetIterativeTolerance() const;
             MULTI_REGIONS_EXPORT int GetSuccessiveRHS() const;
 
@@ -366,6 +368,9 @@ namespace Nektar
             /// Type type of preconditioner to use in iterative solver.
             PreconditionerType m_preconType;
 
+            /// Krylov method to use in iterative solver.
+            IterativeSolverType m_iterSolverType;
+
             /// Tolerance for iterative solver
             NekDouble  m_iterativeTolerance;
 
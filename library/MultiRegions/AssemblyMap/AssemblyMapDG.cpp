@@ -45,6 +45,7 @@
 #include <LocalRegions/PointExp.h>
 #include <LocalRegions/Expansion2D.h>
 #include <LocalRegions/Expansion3D.h>
+#include <LibUtilities/BasicUtils/Timer.h>
 
 #include <boost/config.hpp>
 #include <boost/graph/adjacency_list.hpp>
@@ -834,6 +835,101 @@ namespace Nektar
             {
                 m_traceToUniversalMapUnique[i] = tmp2[i];
             }
+
+            SetUpTraceExchange();
+        }
+
+        /**
+         * @brief Sets up persistent point-to-point communication for the
+         * forwards/backwards trace exchange.
+         *
+         * A trace point is shared by at most two processes, so the
+         * neighbouring process of each shared point is identified by
+         * gathering the process ranks with gs_max and gs_min. Points are then
+         * sorted by universal ID per neighbour, giving the same message
+         * layout on both sides, and a persistent send and receive is set up
+         * for each neighbour carrying both forwards and backwards values.
+         */
+        void AssemblyMapDG::SetUpTraceExchange()
+        {
+            if (!m_traceGsh)
+            {
+                return;
+            }
+
+            int i, j;
+            int nTracePhys = m_traceToUniversalMap.num_elements();
+            int rank       = m_comm->GetRank();
+
+            Array<OneD, NekDouble> count  (nTracePhys, 1.0);
+            Array<OneD, NekDouble> rankMax(nTracePhys, (NekDouble) rank);
+            Array<OneD, NekDouble> rankMin(nTracePhys, (NekDouble) rank);
+
+            Gs::Gather(count,   Gs::gs_add, m_traceGsh);
+            Gs::Gather(rankMax, Gs::gs_max, m_traceGsh);
+            Gs::Gather(rankMin, Gs::gs_min, m_traceGsh);
+
+            map<int, vector<pair<int, int> > > procPoints;
+            map<int, vector<pair<int, int> > >::iterator pIt;
+
+            for (i = 0; i < nTracePhys; ++i)
+            {
+                if (count[i] < 1.5)
+                {
+                    continue;
+                }
+
+                ASSERTL0(count[i] < 2.5,
+                         "Trace point shared by more than two processes.");
+
+                int proc = (int)(rankMax[i] + 0.5);
+                if (proc == rank)
+                {
+                    proc = (int)(rankMin[i] + 0.5);
+                }
+
+                procPoints[proc].push_back(
+                    make_pair(m_traceToUniversalMap[i], i));
+            }
+
+            int nProcs = procPoints.size();
+            m_traceExchangeProcs   = Array<OneD, int>(nProcs);
+            m_traceExchangeOffsets = Array<OneD, int>(nProcs + 1, 0);
+
+            for (i = 0, pIt = procPoints.begin(); pIt != procPoints.end();
+                 ++pIt, ++i)
+            {
+                sort(pIt->second.begin(), pIt->second.end());
+                m_traceExchangeProcs[i]       = pIt->first;
+                m_traceExchangeOffsets[i + 1] =
+                    m_traceExchangeOffsets[i] + pIt->second.size();
+            }
+
+            int nShared = m_traceExchangeOffsets[nProcs];
+            m_traceExchangeIndex = Array<OneD, int>(nShared);
+            m_traceSendBuf       = Array<OneD, NekDouble>(2*nShared, 0.0);
+            m_traceRecvBuf       = Array<OneD, NekDouble>(2*nShared, 0.0);
+            m_traceRequest       = m_comm->CreateRequest(2*nProcs);
+
+            Array<OneD, NekDouble> tmp;
+            for (i = 0, pIt = procPoints.begin(); pIt != procPoints.end();
+                 ++pIt, ++i)
+            {
+                int offset = m_traceExchangeOffsets[i];
+                int nPts   = pIt->second.size();
+
+                for (j = 0; j < nPts; ++j)
+                {
+                    m_traceExchangeIndex[offset + j] = pIt->second[j].second;
+                }
+
+                m_comm->RecvInit(pIt->first,
+                                 tmp = m_traceRecvBuf + 2*offset,
+                                 2*nPts, m_traceRequest, i);
+                m_comm->SendInit(pIt->first,
+                                 tmp = m_traceSendBuf + 2*offset,
+                                 2*nPts, m_traceRequest, nProcs + i);
+            }
         }
 
         void AssemblyMapDG::RealignTraceElement(
@@ -916,10 +1012,96 @@ namespace Nektar
             }
         }
 
+        /// Time spent by this process completing trace exchanges.
+        static NekDouble s_traceExchangeTime = 0.0;
+
+        /**
+         * @brief Returns the total time this process has spent in trace
+         * exchanges, which is mostly time spent waiting for neighbouring
+         * processes. This is used to separate the computational load of a
+         * process from its communication.
+         */
+        NekDouble AssemblyMapDG::GetTraceExchangeTime()
+        {
+            return s_traceExchangeTime;
+        }
+
         void AssemblyMapDG::UniversalTraceAssemble(
             Array<OneD, NekDouble> &pGlobal) const
         {
+            Timer t;
+            t.Start();
             Gs::Gather(pGlobal, Gs::gs_add, m_traceGsh);
+            t.Stop();
+            s_traceExchangeTime += t.TimePerTest(1);
+        }
+
+        /**
+         * @brief Starts the parallel exchange of the forwards and backwards
+         * trace spaces.
+         *
+         * The shared values of @a pFwd and @a pBwd are packed into a single
+         * message per neighbouring process and sent without blocking. Local
+         * work not involving process-shared trace points may be performed
+         * before completing the exchange with UniversalTraceAssembleEnd,
+         * which together give the same result as calling
+         * UniversalTraceAssemble on both spaces.
+         */
+        void AssemblyMapDG::UniversalTraceAssembleBegin(
+            const Array<OneD, const NekDouble> &pFwd,
+            const Array<OneD, const NekDouble> &pBwd)
+        {
+            if (!m_traceRequest)
+            {
+                return;
+            }
+
+            for (int i = 0; i < m_traceExchangeProcs.num_elements(); ++i)
+            {
+                int offset = m_traceExchangeOffsets[i];
+                int nPts   = m_traceExchangeOffsets[i+1] - offset;
+
+                Vmath::Gathr(nPts, pFwd.get(),
+                             &m_traceExchangeIndex[offset],
+                             &m_traceSendBuf[2*offset]);
+                Vmath::Gathr(nPts, pBwd.get(),
+                             &m_traceExchangeIndex[offset],
+                             &m_traceSendBuf[2*offset + nPts]);
+            }
+
+            m_comm->StartAll(m_traceRequest);
+        }
+
+        /**
+         * @brief Completes the exchange started by
+         * UniversalTraceAssembleBegin, adding the values of neighbouring
+         * processes into @a pFwd and @a pBwd.
+         */
+        void AssemblyMapDG::UniversalTraceAssembleEnd(
+            Array<OneD, NekDouble> &pFwd,
+            Array<OneD, NekDouble> &pBwd)
+        {
+            if (!m_traceRequest)
+            {
+                return;
+            }
+
+            Timer t;
+            t.Start();
+            m_comm->WaitAll(m_traceRequest);
+            t.Stop();
+            s_traceExchangeTime += t.TimePerTest(1);
+
+            for (int i = 0; i < m_traceExchangeProcs.num_elements(); ++i)
+            {
+                int offset = m_traceExchangeOffsets[i];
+                int nPts   = m_traceExchangeOffsets[i+1] - offset;
+
+                Vmath::Assmb(nPts, &m_traceRecvBuf[2*offset],
+                             &m_traceExchangeIndex[offset], pFwd.get());
+                Vmath::Assmb(nPts, &m_traceRecvBuf[2*offset + nPts],
+                             &m_traceExchangeIndex[offset], pBwd.get());
+            }
         }
 
         int AssemblyMapDG::v_GetLocalToGlobalMap(const int i) const
@@ -90,8 +90,32 @@ namespace Nektar
             MULTI_REGIONS_EXPORT void UniversalTraceAssemble(
                 Array<OneD, NekDouble> &pGlobal) const;
 
+            MULTI_REGIONS_EXPORT void UniversalTraceAssembleBegin(
+                const Array<OneD, const NekDouble> &pFwd,
+                const Array<OneD, const NekDouble> &pBwd);
+
+            MULTI_REGIONS_EXPORT void UniversalTraceAssembleEnd(
+                Array<OneD, NekDouble> &pFwd,
+                Array<OneD, NekDouble> &pBwd);
+
+            MULTI_REGIONS_EXPORT static NekDouble GetTraceExchangeTime();
+
         protected:
             Gs::gs_data * m_traceGsh;
+
+            /// Processes sharing trace points with this process.
+            Array<OneD, int> m_traceExchangeProcs;
+            /// Offset of each process' points in #m_traceExchangeIndex.
+            Array<OneD, int> m_traceExchangeOffsets;
+            /// Shared trace points, grouped by process and sorted by
+            /// universal ID so that both sides agree on the ordering.
+            Array<OneD, int> m_traceExchangeIndex;
+            /// Send buffer holding forwards and backwards shared values.
+            Array<OneD, NekDouble> m_traceSendBuf;
+            /// Receive buffer holding forwards and backwards shared values.
+            Array<OneD, NekDouble> m_traceRecvBuf;
+            /// Persistent requests for the trace exchange.
+            LibUtilities::CommRequestSharedPtr m_traceRequest;
             
             /// Number of physical dirichlet boundary values in trace
             int m_numDirichletBndPhys;
@@ -112,6 +136,8 @@ namespace Nektar
                 const ExpListSharedPtr trace,
                 const PeriodicMap     &perMap = NullPeriodicMap);
 
+            void SetUpTraceExchange();
+
             virtual int v_GetLocalToGlobalMap(const int i) const;
 
             virtual int v_GetGlobalToUniversalMap(const int i) const;
@@ -0,0 +1,242 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File BoundingBoxTree.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Bounding box hierarchy for locating points in elements
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <MultiRegions/BoundingBoxTree.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        namespace
+        {
+            /// Maximum number of boxes held in a leaf.
+            const int kLeafSize = 8;
+
+            /// Orders box ids by centroid along one axis.
+            struct CentroidLess
+            {
+                CentroidLess(const std::vector<NekDouble> &c, int dim, int dir)
+                    : m_c(c), m_dim(dim), m_dir(dir)
+                {
+                }
+
+                bool operator()(int a, int b) const
+                {
+                    return m_c[a*m_dim + m_dir] < m_c[b*m_dim + m_dir];
+                }
+
+                const std::vector<NekDouble> &m_c;
+                int                           m_dim;
+                int                           m_dir;
+            };
+        }
+
+        BoundingBoxTree::BoundingBoxTree(
+            const int                     dim,
+            const std::vector<NekDouble> &boxes)
+            : m_dim  (dim),
+              m_boxes(boxes)
+        {
+            ASSERTL0(dim >= 1 && dim <= 3, "Unsupported dimension.");
+            ASSERTL0(boxes.size() % (2*dim) == 0,
+                     "Box array length is not a multiple of 2*dim.");
+
+            int nBoxes = boxes.size() / (2*dim);
+
+            std::vector<NekDouble> centroids(nBoxes*dim);
+            m_boxExtent.resize(nBoxes);
+            m_index    .resize(nBoxes);
+
+            for (int i = 0; i < nBoxes; ++i)
+            {
+                const NekDouble *min = &m_boxes[2*dim*i];
+                const NekDouble *max = min + dim;
+
+                m_boxExtent[i] = 0.0;
+                for (int d = 0; d < dim; ++d)
+                {
+                    centroids[i*dim + d] = 0.5 * (min[d] + max[d]);
+                    m_boxExtent[i] = std::max(m_boxExtent[i], max[d] - min[d]);
+                }
+                m_index[i] = i;
+            }
+
+            if (nBoxes > 0)
+            {
+                m_nodes.reserve(2 * (nBoxes / kLeafSize + 1));
+                Build(0, nBoxes, centroids);
+            }
+        }
+
+        /**
+         * @brief Creates the node covering #m_index[begin, end) and,
+         * recursively, its children. Returns the node id.
+         */
+        int BoundingBoxTree::Build(
+            const int                     begin,
+            const int                     end,
+            const std::vector<NekDouble> &centroids)
+        {
+            Node node;
+            node.m_left   = -1;
+            node.m_right  = -1;
+            node.m_begin  = begin;
+            node.m_end    = end;
+            node.m_extent = 0.0;
+
+            NekDouble cmin[3], cmax[3];
+            for (int d = 0; d < m_dim; ++d)
+            {
+                node.m_min[d] = cmin[d] =  1e300;
+                node.m_max[d] = cmax[d] = -1e300;
+            }
+
+            for (int i = begin; i < end; ++i)
+            {
+                int              id  = m_index[i];
+                const NekDouble *min = &m_boxes[2*m_dim*id];
+                const NekDouble *max = min + m_dim;
+
+                for (int d = 0; d < m_dim; ++d)
+                {
+                    node.m_min[d] = std::min(node.m_min[d], min[d]);
+                    node.m_max[d] = std::max(node.m_max[d], max[d]);
+                    cmin[d] = std::min(cmin[d], centroids[id*m_dim + d]);
+                    cmax[d] = std::max(cmax[d], centroids[id*m_dim + d]);
+                }
+                node.m_extent = std::max(node.m_extent, m_boxExtent[id]);
+            }
+
+            int nodeId = m_nodes.size();
+            m_nodes.push_back(node);
+
+            if (end - begin <= kLeafSize)
+            {
+                return nodeId;
+            }
+
+            // Split at the median along the direction of largest spread.
+            int dir = 0;
+            for (int d = 1; d < m_dim; ++d)
+            {
+                if (cmax[d] - cmin[d] > cmax[dir] - cmin[dir])
+                {
+                    dir = d;
+                }
+            }
+
+            int mid = begin + (end - begin) / 2;
+            std::nth_element(m_index.begin() + begin,
+                             m_index.begin() + mid,
+                             m_index.begin() + end,
+                             CentroidLess(centroids, m_dim, dir));
+
+            int left  = Build(begin, mid, centroids);
+            int right = Build(mid,   end, centroids);
+            m_nodes[nodeId].m_left  = left;
+            m_nodes[nodeId].m_right = right;
+
+            return nodeId;
+        }
+
+        bool BoundingBoxTree::Contains(
+            const NekDouble *min,
+            const NekDouble *max,
+            const NekDouble  pad,
+            const Array<OneD, const NekDouble> &pt) const
+        {
+            for (int d = 0; d < m_dim; ++d)
+            {
+                if (pt[d] < min[d] - pad || pt[d] > max[d] + pad)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void BoundingBoxTree::Query(
+            const Array<OneD, const NekDouble> &pt,
+            const NekDouble                     relPad,
+                  std::vector<int>             &result) const
+        {
+            ASSERTL1(pt.num_elements() >= m_dim,
+                     "Point has fewer coordinates than the tree dimension.");
+
+            if (m_nodes.empty())
+            {
+                return;
+            }
+
+            int first = result.size();
+
+            std::vector<int> stack(1, 0);
+            while (!stack.empty())
+            {
+                const Node &node = m_nodes[stack.back()];
+                stack.pop_back();
+
+                if (!Contains(node.m_min, node.m_max,
+                              relPad * node.m_extent, pt))
+                {
+                    continue;
+                }
+
+                if (node.m_left >= 0)
+                {
+                    stack.push_back(node.m_right);
+                    stack.push_back(node.m_left);
+                    continue;
+                }
+
+                for (int i = node.m_begin; i < node.m_end; ++i)
+                {
+                    int              id  = m_index[i];
+                    const NekDouble *min = &m_boxes[2*m_dim*id];
+
+                    if (Contains(min, min + m_dim,
+                                 relPad * m_boxExtent[id], pt))
+                    {
+                        result.push_back(id);
+                    }
+                }
+            }
+
+            std::sort(result.begin() + first, result.end());
+        }
+    }
+}
@@ -0,0 +1,129 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File BoundingBoxTree.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Bounding box hierarchy for locating points in elements
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_MULTIREGIONS_BOUNDINGBOXTREE_H
+#define NEKTAR_LIB_MULTIREGIONS_BOUNDINGBOXTREE_H
+
+#include <vector>
+
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <MultiRegions/MultiRegionsDeclspec.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * @brief Static hierarchy of axis-aligned bounding boxes, used to
+         * restrict point location to the few elements whose boxes contain
+         * the point.
+         *
+         * The tree is built by recursively bisecting the set of boxes at the
+         * median centroid along the direction of largest spread, giving a
+         * balanced binary tree with a small number of boxes in each leaf.
+         * Queries may enlarge every box by a fraction of its own size, so
+         * that points lying just outside an element (to some tolerance) are
+         * still reported.
+         */
+        class BoundingBoxTree
+        {
+        public:
+            /**
+             * @param dim    Spatial dimension of the boxes (1 to 3).
+             * @param boxes  For box \f$i\f$, entries \f$2 d i\f$ to
+             *               \f$2 d i + d - 1\f$ hold its minimum corner and
+             *               the following \f$d\f$ entries its maximum corner.
+             */
+            MULTI_REGIONS_EXPORT BoundingBoxTree(
+                const int                     dim,
+                const std::vector<NekDouble> &boxes);
+
+            /// Appends to @a result, in ascending order, the ids of all boxes
+            /// containing @a pt once enlarged by @a relPad times their
+            /// largest side.
+            MULTI_REGIONS_EXPORT void Query(
+                const Array<OneD, const NekDouble> &pt,
+                const NekDouble                     relPad,
+                      std::vector<int>             &result) const;
+
+            int GetDim() const
+            {
+                return m_dim;
+            }
+
+            int GetNumBoxes() const
+            {
+                return m_index.size();
+            }
+
+        private:
+            struct Node
+            {
+                /// Bounds of all boxes below this node.
+                NekDouble m_min[3];
+                NekDouble m_max[3];
+                /// Largest side of any box below this node.
+                NekDouble m_extent;
+                /// Children, or -1 for a leaf.
+                int       m_left;
+                int       m_right;
+                /// Range of #m_index covered by this node.
+                int       m_begin;
+                int       m_end;
+            };
+
+            int                    m_dim;
+            std::vector<NekDouble> m_boxes;
+            std::vector<NekDouble> m_boxExtent;
+            std::vector<int>       m_index;
+            std::vector<Node>      m_nodes;
+
+            int Build(
+                const int                     begin,
+                const int                     end,
+                const std::vector<NekDouble> &centroids);
+
+            bool Contains(
+                const NekDouble *min,
+                const NekDouble *max,
+                const NekDouble  pad,
+                const Array<OneD, const NekDouble> &pt) const;
+        };
+
+        typedef boost::shared_ptr<BoundingBoxTree> BoundingBoxTreeSharedPtr;
+    }
+}
+
+#endif
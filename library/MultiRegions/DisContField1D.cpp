@@ -190,6 +190,13 @@ namespace Nektar
                 }
             }
 
+            // Precompute gather map between elemental vertices and the trace
+            // space.
+            m_locTraceToTraceMap = MemoryManager<LocTraceToTraceMap>::
+                AllocateSharedPtr(*this, m_trace,
+                                  m_traceMap->GetElmtToTrace(),
+                                  m_leftAdjacentVerts);
+
 
             boost::unordered_map<int,pair<int,int> > perVertToExpMap;
             boost::unordered_map<int,pair<int,int> >::iterator it2;
@@ -447,6 +454,7 @@ namespace Nektar
             m_globalBndMat(In.m_globalBndMat),
             m_trace(In.m_trace),
             m_traceMap(In.m_traceMap),
+            m_locTraceToTraceMap(In.m_locTraceToTraceMap),
             m_boundaryVerts(In.m_boundaryVerts),
             m_periodicVerts(In.m_periodicVerts),
             m_periodicFwdCopy(In.m_periodicFwdCopy),
@@ -870,59 +878,16 @@ namespace Nektar
             Array<OneD,       NekDouble> &Fwd,
             Array<OneD,       NekDouble> &Bwd)
         {
-            // Expansion casts
-            LocalRegions::Expansion1DSharedPtr exp1D;
-            LocalRegions::Expansion1DSharedPtr exp1DFirst;
-            LocalRegions::Expansion1DSharedPtr exp1DLast;
-
             // Counter variables
-            int  n, v;
-            
-            // Number of elements
-            int nElements = GetExpSize(); 
-            
-            // Initial index of each element
-            int phys_offset;
-            
-            Array<OneD, Array<OneD, LocalRegions::ExpansionSharedPtr> >
-                &elmtToTrace = m_traceMap->GetElmtToTrace();
-            
-            // Basis shared pointer
-            LibUtilities::BasisSharedPtr Basis;
-            
-            // Set forward and backard state to zero
-            Vmath::Zero(Fwd.num_elements(), Fwd, 1);
-            Vmath::Zero(Bwd.num_elements(), Bwd, 1);
-			
-            int cnt;
+            int n, cnt;
 
-            // Loop on the elements
-            for (cnt = n = 0; n < nElements; ++n)
-            {
-                exp1D = (*m_exp)[n]->as<LocalRegions::Expansion1D>();
+            // Gather forwards and backwards element vertex values.
+            m_locTraceToTraceMap->FwdBwdTracePhys(field, Fwd, Bwd);
 
-                // Set the offset of each element
-                phys_offset = GetPhys_Offset(n);
-                
-                Basis = (*m_exp)[n]->GetBasis(0);
+            // Start parallel exchange for forwards/backwards spaces; the
+            // boundary conditions below do not touch process-shared points.
+            m_traceMap->UniversalTraceAssembleBegin(Fwd, Bwd);
 
-                for(v = 0; v < 2; ++v, ++cnt)
-                {
-                    int offset = m_trace->GetPhys_Offset(elmtToTrace[n][v]->GetElmtId());
-                    
-                    if (m_leftAdjacentVerts[cnt])
-                    {
-                        (*m_exp)[n]->GetVertexPhysVals(v, field + phys_offset,
-                                                       Fwd[offset]);
-                    }
-                    else
-                    {
-                        (*m_exp)[n]->GetVertexPhysVals(v, field + phys_offset,
-                                                       Bwd[offset]);
-                    }
-                }
-            }
-            
             // Fill boundary conditions into missing elements.
             int id = 0;
             
@@ -967,9 +932,8 @@ namespace Nektar
                 Bwd[m_periodicBwdCopy[n]] = Fwd[m_periodicFwdCopy[n]];
             }
 
-            // Do parallel exchange for forwards/backwards spaces.
-            m_traceMap->UniversalTraceAssemble(Fwd);
-            m_traceMap->UniversalTraceAssemble(Bwd);
+            // Complete parallel exchange for forwards/backwards spaces.
+            m_traceMap->UniversalTraceAssembleEnd(Fwd, Bwd);
 
         }
         
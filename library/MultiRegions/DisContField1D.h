@@ -43,6 +43,7 @@
 #include <SpatialDomains/Conditions.h>
 #include <MultiRegions/GlobalLinSys.h>
 #include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
+#include <MultiRegions/LocTraceToTraceMap.h>
 
 
 namespace Nektar
@@ -122,6 +123,9 @@ namespace Nektar
             /// Local to global DG mapping for trace space.
             AssemblyMapDGSharedPtr                        m_traceMap;
 
+            /// Gather map from elemental vertices to the trace space.
+            LocTraceToTraceMapSharedPtr                   m_locTraceToTraceMap;
+
             /**
              * @brief A set storing the global IDs of any boundary edges.
              */
@@ -65,6 +65,7 @@ namespace Nektar
               m_bndConditions      (In.m_bndConditions),
               m_globalBndMat       (In.m_globalBndMat),
               m_traceMap           (In.m_traceMap),
+              m_locTraceToTraceMap (In.m_locTraceToTraceMap),
               m_boundaryEdges      (In.m_boundaryEdges),
               m_periodicVerts      (In.m_periodicVerts),
               m_periodicEdges      (In.m_periodicEdges),
@@ -261,6 +262,7 @@ namespace Nektar
                         m_globalBndMat      = In.m_globalBndMat;
                         m_trace             = In.m_trace;
                         m_traceMap          = In.m_traceMap;
+                        m_locTraceToTraceMap = In.m_locTraceToTraceMap;
                         m_periodicEdges     = In.m_periodicEdges;
                         m_periodicVerts     = In.m_periodicVerts;
                         m_periodicFwdCopy   = In.m_periodicFwdCopy;
@@ -273,6 +275,7 @@ namespace Nektar
                         m_globalBndMat      = In.m_globalBndMat;
                         m_trace             = In.m_trace;
                         m_traceMap          = In.m_traceMap;
+                        m_locTraceToTraceMap = In.m_locTraceToTraceMap;
                         m_periodicEdges     = In.m_periodicEdges;
                         m_periodicVerts     = In.m_periodicVerts;
                         m_periodicFwdCopy   = In.m_periodicFwdCopy;
@@ -477,6 +480,12 @@ namespace Nektar
                 }
             }
 
+            // Precompute gather/scatter maps between elemental edges and the
+            // trace space.
+            m_locTraceToTraceMap = MemoryManager<LocTraceToTraceMap>::
+                AllocateSharedPtr(*this, m_trace, elmtToTrace,
+                                  m_leftAdjacentEdges);
+
             // Set up mapping to copy Fwd of periodic bcs to Bwd of other edge.
             cnt = 0;
             for (int n = 0; n < m_exp->size(); ++n)
@@ -1328,46 +1337,15 @@ namespace Nektar
                   Array<OneD,       NekDouble> &Fwd,
                   Array<OneD,       NekDouble> &Bwd)
         {
-            // Loop over elements and collect forward expansion
-            int nexp = GetExpSize();
-            int cnt, n, e, npts, phys_offset;
-            Array<OneD,NekDouble> e_tmp;
-            PeriodicMap::iterator it2;
-            boost::unordered_map<int,pair<int,int> >::iterator it3;
-            LocalRegions::Expansion2DSharedPtr exp2d;
-
-            Array<OneD, Array<OneD, LocalRegions::ExpansionSharedPtr> >
-                &elmtToTrace = m_traceMap->GetElmtToTrace();
-            
-            // Zero forward/backward vectors.
-            Vmath::Zero(Fwd.num_elements(), Fwd, 1);
-            Vmath::Zero(Bwd.num_elements(), Bwd, 1);
+            int cnt, n, e, npts;
 
-            for(cnt = n = 0; n < nexp; ++n)
-            {
-                exp2d = (*m_exp)[n]->as<LocalRegions::Expansion2D>();
-                phys_offset = GetPhys_Offset(n);
+            // Gather forwards and backwards element edge values.
+            m_locTraceToTraceMap->FwdBwdTracePhys(field, Fwd, Bwd);
 
-                for(e = 0; e < exp2d->GetNedges(); ++e, ++cnt)
-                {
-                    int offset = m_trace->GetPhys_Offset(
-                        elmtToTrace[n][e]->GetElmtId());
+            // Start parallel exchange for forwards/backwards spaces; the
+            // boundary conditions below do not touch process-shared points.
+            m_traceMap->UniversalTraceAssembleBegin(Fwd, Bwd);
 
-                    if (m_leftAdjacentEdges[cnt])
-                    {
-                        exp2d->GetEdgePhysVals(e, elmtToTrace[n][e],
-                                                     field + phys_offset,
-                                                     e_tmp = Fwd + offset);
-                    }
-                    else
-                    {
-                        exp2d->GetEdgePhysVals(e, elmtToTrace[n][e],
-                                                     field + phys_offset,
-                                                     e_tmp = Bwd + offset);
-                    }
-                }
-            }
-            
             // Fill boundary conditions into missing elements.
             int id1, id2 = 0;
             
@@ -1422,9 +1400,8 @@ namespace Nektar
                 Bwd[m_periodicBwdCopy[n]] = Fwd[m_periodicFwdCopy[n]];
             }
 
-            // Do parallel exchange for forwards/backwards spaces.
-            m_traceMap->UniversalTraceAssemble(Fwd);
-            m_traceMap->UniversalTraceAssemble(Bwd);
+            // Complete parallel exchange for forwards/backwards spaces.
+            m_traceMap->UniversalTraceAssembleEnd(Fwd, Bwd);
         }
         
         void DisContField2D::v_FillBndCondFromField(void)
@@ -1530,23 +1507,7 @@ namespace Nektar
             const Array<OneD, const NekDouble> &Fn, 
                   Array<OneD,       NekDouble> &outarray)
         {
-            int e, n, offset, t_offset;
-            Array<OneD, NekDouble> e_outarray;
-            Array<OneD, Array<OneD, LocalRegions::ExpansionSharedPtr> >
-                &elmtToTrace = m_traceMap->GetElmtToTrace();
-
-            for(n = 0; n < GetExpSize(); ++n)
-            {
-                offset = GetCoeff_Offset(n);
-                for(e = 0; e < (*m_exp)[n]->GetNedges(); ++e)
-                {
-                    t_offset = GetTrace()->GetPhys_Offset(
-                        elmtToTrace[n][e]->GetElmtId());
-                    (*m_exp)[n]->AddEdgeNormBoundaryInt(
-                        e, elmtToTrace[n][e], Fn+t_offset,
-                        e_outarray = outarray+offset);
-                }
-            }
+            m_locTraceToTraceMap->AddTraceIntegral(Fn, outarray);
         }
         
 
@@ -1577,35 +1538,7 @@ namespace Nektar
             const Array<OneD, const NekDouble> &Bwd, 
                   Array<OneD,       NekDouble> &outarray)
         {
-            int e,n,offset, t_offset;
-            Array<OneD, NekDouble> e_outarray;
-            Array<OneD, Array<OneD, LocalRegions::ExpansionSharedPtr> >
-                &elmtToTrace = m_traceMap->GetElmtToTrace();
-
-            for (n = 0; n < GetExpSize(); ++n)
-            {
-                offset = GetCoeff_Offset(n);
-                for (e = 0; e < (*m_exp)[n]->GetNedges(); ++e)
-                {
-                    t_offset = GetTrace()->GetPhys_Offset(
-                                            elmtToTrace[n][e]->GetElmtId());
-                    
-                    // Evaluate upwind flux less local edge 
-                    if (IsLeftAdjacentEdge(n, e))
-                    {
-                        (*m_exp)[n]->AddEdgeNormBoundaryInt(
-                        e, elmtToTrace[n][e], Fwd+t_offset,
-                        e_outarray = outarray+offset);
-                    }
-                    else
-                    {
-                        (*m_exp)[n]->AddEdgeNormBoundaryInt(
-                        e, elmtToTrace[n][e], Bwd+t_offset,
-                        e_outarray = outarray+offset);
-                    }
-
-                }
-            }
+            m_locTraceToTraceMap->AddFwdBwdTraceIntegral(Fwd, Bwd, outarray);
         }
 
         /**
@@ -42,6 +42,7 @@
 #include <MultiRegions/ExpList2D.h>
 #include <MultiRegions/GlobalLinSys.h>
 #include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
+#include <MultiRegions/LocTraceToTraceMap.h>
 #include <SpatialDomains/Conditions.h>
 
 namespace Nektar
@@ -116,6 +117,7 @@ namespace Nektar
             GlobalLinSysMapShPtr        m_globalBndMat;
             ExpListSharedPtr            m_trace;
             AssemblyMapDGSharedPtr      m_traceMap;
+            LocTraceToTraceMapSharedPtr m_locTraceToTraceMap;
             
             Array<OneD, Array<OneD, unsigned int> >     m_mapEdgeToElmn;
             Array<OneD, Array<OneD, unsigned int> >     m_signEdgeToElmn;
@@ -191,18 +191,22 @@
                      m_globalBndMat  = In.m_globalBndMat;
                      m_trace         = In.m_trace;
                      m_traceMap      = In.m_traceMap;
+                     m_locTraceToTraceMap = In.m_locTraceToTraceMap;
                      m_periodicVerts = In.m_periodicVerts;
                      m_periodicEdges = In.m_periodicEdges;
                      m_periodicFaces = In.m_periodicFaces;
+                     m_leftAdjacentFaces = In.m_leftAdjacentFaces;
                  }
                  else 
                  {
                      m_globalBndMat  = In.m_globalBndMat;
                      m_trace         = In.m_trace;
                      m_traceMap      = In.m_traceMap;
+                     m_locTraceToTraceMap = In.m_locTraceToTraceMap;
                      m_periodicVerts = In.m_periodicVerts;
                      m_periodicEdges = In.m_periodicEdges;
                      m_periodicFaces = In.m_periodicFaces;
+                     m_leftAdjacentFaces = In.m_leftAdjacentFaces;
 
                      int i,cnt,f;
                      Array<OneD, int> ElmtID,FaceID;
@@ -261,9 +265,11 @@
              m_globalBndMat        (In.m_globalBndMat),
              m_trace               (In.m_trace),
              m_traceMap            (In.m_traceMap),
+             m_locTraceToTraceMap  (In.m_locTraceToTraceMap),
              m_periodicFaces       (In.m_periodicFaces),
              m_periodicEdges       (In.m_periodicEdges),
-             m_periodicVerts       (In.m_periodicVerts)
+             m_periodicVerts       (In.m_periodicVerts),
+             m_leftAdjacentFaces   (In.m_leftAdjacentFaces)
          {
          }
 
@@ -429,6 +435,12 @@
                  }
              }
 
+             // Precompute gather/scatter maps between elemental faces and the
+             // trace space.
+             m_locTraceToTraceMap = MemoryManager<LocTraceToTraceMap>::
+                 AllocateSharedPtr(*this, m_trace, elmtToTrace,
+                                   m_leftAdjacentFaces);
+
              // Set up mapping to copy Fwd of periodic bcs to Bwd of other edge.
              cnt = 0;
              for (int n = 0; n < m_exp->size(); ++n)
@@ -1708,50 +1720,15 @@
                   Array<OneD,       NekDouble> &Fwd,
                   Array<OneD,       NekDouble> &Bwd)
         {
-            // Loop over elements and collect forward and backward expansions.
-            int nexp = GetExpSize();
-            int cnt, n, e, npts, offset, phys_offset;
-            Array<OneD,NekDouble> e_tmp;
-            
-            Array<OneD, Array<OneD, LocalRegions::ExpansionSharedPtr> >
-                &elmtToTrace = m_traceMap->GetElmtToTrace();
+            int cnt, n, e, npts;
 
-            set<int>::iterator    it;
-            PeriodicMap::iterator it2;
-            boost::unordered_map<int,pair<int,int> >::iterator it3;
+            // Gather forwards and backwards element face values.
+            m_locTraceToTraceMap->FwdBwdTracePhys(field, Fwd, Bwd);
 
-            // Zero vectors.
-            Vmath::Zero(Fwd.num_elements(), Fwd, 1);
-            Vmath::Zero(Bwd.num_elements(), Bwd, 1);
-             
-            LocalRegions::Expansion3DSharedPtr exp3d;
-            bool fwd;
-
-            for(cnt = n = 0; n < nexp; ++n)
-            {
-                exp3d = (*m_exp)[n]->as<LocalRegions::Expansion3D>();
-                phys_offset = GetPhys_Offset(n);
-                for(e = 0; e < exp3d->GetNfaces(); ++e, ++cnt)
-                {
-                    offset = m_trace->GetPhys_Offset(
-                        elmtToTrace[n][e]->GetElmtId());
+            // Start parallel exchange for forwards/backwards spaces; the
+            // boundary conditions below do not touch process-shared points.
+            m_traceMap->UniversalTraceAssembleBegin(Fwd, Bwd);
 
-                    fwd = m_leftAdjacentFaces[cnt];
-                    if (fwd)
-                    {
-                        exp3d->GetFacePhysVals(e, elmtToTrace[n][e],
-                                                     field + phys_offset,
-                                                     e_tmp = Fwd + offset);
-                    }
-                    else
-                    {
-                        exp3d->GetFacePhysVals(e, elmtToTrace[n][e],
-                                                     field + phys_offset,
-                                                     e_tmp = Bwd + offset);
-                    }
-                }
-            }
-            
             // fill boundary conditions into missing elements
             int id1,id2 = 0;
             cnt = 0;
@@ -1808,9 +1785,8 @@
                 Bwd[m_periodicBwdCopy[n]] = Fwd[m_periodicFwdCopy[n]];
             }
             
-            // Do parallel exchange for forwards/backwards spaces.
-            m_traceMap->UniversalTraceAssemble(Fwd);
-            m_traceMap->UniversalTraceAssemble(Bwd);
+            // Complete parallel exchange for forwards/backwards spaces.
+            m_traceMap->UniversalTraceAssembleEnd(Fwd, Bwd);
         }
 
         void DisContField3D::v_ExtractTracePhys(
@@ -1873,25 +1849,7 @@
             const Array<OneD, const NekDouble> &Fn,
                   Array<OneD,       NekDouble> &outarray)
         {
-            int e,n,offset, t_offset;
-            Array<OneD, NekDouble> e_outarray;
-            Array<OneD, Array<OneD, LocalRegions::ExpansionSharedPtr> >
-                &elmtToTrace = m_traceMap->GetElmtToTrace();
-
-            for(n = 0; n < GetExpSize(); ++n)
-            {
-                offset = GetCoeff_Offset(n);
-                e_outarray = outarray+offset;
-                for(e = 0; e < (*m_exp)[n]->GetNfaces(); ++e)
-                {
-                    t_offset = m_trace->GetPhys_Offset(
-                        elmtToTrace[n][e]->GetElmtId());
-                    (*m_exp)[n]->AddFaceNormBoundaryInt(e,
-                                                        elmtToTrace[n][e],
-                                                        Fn + t_offset,
-                                                        e_outarray);
-                }
-            }
+            m_locTraceToTraceMap->AddTraceIntegral(Fn, outarray);
         }
         /**
          * @brief Add trace contributions into elemental coefficient spaces.
@@ -1921,33 +1879,7 @@
             const Array<OneD, const NekDouble> &Bwd, 
                   Array<OneD,       NekDouble> &outarray)
         {
-            int e,n,offset, t_offset;
-            Array<OneD, NekDouble> e_outarray;
-            Array<OneD, Array<OneD, LocalRegions::ExpansionSharedPtr> >
-                &elmtToTrace = m_traceMap->GetElmtToTrace();
-
-            for(n = 0; n < GetExpSize(); ++n)
-            {
-                offset = GetCoeff_Offset(n);
-                for(e = 0; e < (*m_exp)[n]->GetNfaces(); ++e)
-                {
-                    t_offset = m_trace->GetPhys_Offset(elmtToTrace[n][e]->GetElmtId());
-
-                    // Evaluate upwind flux less local edge 
-                    if(IsLeftAdjacentFace(n,e))
-                    {
-                        (*m_exp)[n]->AddFaceNormBoundaryInt(
-                         e, elmtToTrace[n][e],  Fwd + t_offset,
-                         e_outarray = outarray+offset);
-                    }
-                    else
-                    {
-                        (*m_exp)[n]->AddFaceNormBoundaryInt(
-                         e, elmtToTrace[n][e],  Bwd + t_offset,
-                         e_outarray = outarray+offset);
-                    }
-                }
-            }
+            m_locTraceToTraceMap->AddFwdBwdTraceIntegral(Fwd, Bwd, outarray);
         }
 
         /**
@@ -42,6 +42,7 @@
 #include <MultiRegions/ExpList3D.h>
 #include <MultiRegions/GlobalLinSys.h>
 #include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
+#include <MultiRegions/LocTraceToTraceMap.h>
 #include <SpatialDomains/Conditions.h>
 
 namespace Nektar
@@ -100,6 +101,7 @@ namespace Nektar
             GlobalLinSysMapShPtr        m_globalBndMat;
             ExpListSharedPtr            m_trace;
             AssemblyMapDGSharedPtr      m_traceMap;
+            LocTraceToTraceMapSharedPtr m_locTraceToTraceMap;
 
             /**
              * @brief A set storing the global IDs of any boundary faces.
@@ -48,6 +48,7 @@
 
 #include <LocalRegions/MatrixKey.h>     // for MatrixKey
 #include <LocalRegions/Expansion.h>     // for Expansion
+#include <LocalRegions/MetricRegistry.h>  // for MetricRegistry
 
 #include <MultiRegions/AssemblyMap/AssemblyMapCG.h>  // for AssemblyMapCG, etc
 #include <MultiRegions/AssemblyMap/AssemblyMapDG.h>  // for AssemblyMapCG, etc
@@ -59,6 +60,8 @@
 #include <LibUtilities/LinearAlgebra/NekTypeDefs.hpp>
 #include <LibUtilities/LinearAlgebra/NekMatrix.hpp>
 
+#include <LibUtilities/BasicUtils/Thread.h>
+
 #include <Collections/CollectionOptimisation.h>
 #include <Collections/Operator.h>
 
@@ -66,6 +69,77 @@ namespace Nektar
 {
     namespace MultiRegions
     {
+        /**
+         * @brief Applies a collection operator to one collection on a worker
+         * thread.
+         *
+         * The input and outputs are copied to and from arrays owned by the
+         * job, since the reference counts of Array views are not thread-safe
+         * and the operators create views of their arguments internally.
+         */
+        class CollectionOperatorJob : public Thread::ThreadJob
+        {
+            public:
+                CollectionOperatorJob(
+                    Collections::Collection         &coll,
+                    const Collections::OperatorType  op,
+                    const NekDouble                 *in,
+                    const int                        nIn,
+                    NekDouble                      **out,
+                    const int                        nOut)
+                    : m_coll(coll),
+                      m_op  (op),
+                      m_inPtr(in),
+                      m_in  (nIn)
+                {
+                    for (int i = 0; i < 3; ++i)
+                    {
+                        m_outPtr[i] = out[i];
+                        if (out[i])
+                        {
+                            m_out[i] = Array<OneD, NekDouble>(nOut);
+                        }
+                    }
+                }
+
+                virtual ~CollectionOperatorJob()
+                {
+                }
+
+                virtual void Run()
+                {
+                    Vmath::Vcopy(m_in.num_elements(), m_inPtr, 1,
+                                 m_in.get(), 1);
+
+                    if (m_op == Collections::ePhysDeriv)
+                    {
+                        m_coll.ApplyOperator(m_op, m_in, m_out[0],
+                                             m_out[1], m_out[2]);
+                    }
+                    else
+                    {
+                        m_coll.ApplyOperator(m_op, m_in, m_out[0]);
+                    }
+
+                    for (int i = 0; i < 3; ++i)
+                    {
+                        if (m_outPtr[i])
+                        {
+                            Vmath::Vcopy(m_out[i].num_elements(),
+                                         m_out[i].get(), 1, m_outPtr[i], 1);
+                        }
+                    }
+                }
+
+            private:
+                Collections::Collection        &m_coll;
+                Collections::OperatorType       m_op;
+                const NekDouble                *m_inPtr;
+                NekDouble                      *m_outPtr[3];
+                Array<OneD, NekDouble>          m_in;
+                Array<OneD, NekDouble>          m_out[3];
+        };
+
         /**
          * @class ExpList
          * All multi-elemental expansions \f$u^{\delta}(\boldsymbol{x})\f$ can
@@ -181,11 +255,14 @@ namespace Nektar
             m_collections(in.m_collections),
             m_coll_coeff_offset(in.m_coll_coeff_offset),
             m_coll_phys_offset(in.m_coll_phys_offset),
+            m_coll_ncoeffs(in.m_coll_ncoeffs),
+            m_coll_nphys(in.m_coll_nphys),
             m_coeff_offset(in.m_coeff_offset),
             m_phys_offset(in.m_phys_offset),
             m_offset_elmt_id(in.m_offset_elmt_id),
             m_globalOptParam(in.m_globalOptParam),
             m_blockMat(in.m_blockMat),
+            m_boxTree(in.m_boxTree),
             m_WaveSpace(false)
         {
             SetExpType(eNoType);
@@ -315,14 +392,8 @@ namespace Nektar
                                 const Array<OneD, const NekDouble> &inarray,
                                       Array<OneD,       NekDouble> &outarray)
         {
-            Array<OneD,NekDouble>  tmp;
-            for (int i = 0; i < m_collections.size(); ++i)
-            {
-
-                m_collections[i].ApplyOperator(Collections::eIProductWRTBase,
-                                               inarray + m_coll_phys_offset[i],
-                                               tmp = outarray + m_coll_coeff_offset[i]);
-            }
+            ApplyCollectionOperator(Collections::eIProductWRTBase,
+                                    inarray, outarray);
         }
 
         /**
@@ -450,21 +521,8 @@ namespace Nektar
                                   Array<OneD, NekDouble> &out_d1,
                                   Array<OneD, NekDouble> &out_d2)
         {
-            Array<OneD, NekDouble> e_out_d0;
-            Array<OneD, NekDouble> e_out_d1;
-            Array<OneD, NekDouble> e_out_d2;
-            for (int i = 0; i < m_collections.size(); ++i)
-            {
-                int offset = m_coll_phys_offset[i];
-                e_out_d0 = out_d0  + offset;
-                e_out_d1 = out_d1  + offset;
-                e_out_d2 = out_d2  + offset;
-
-                m_collections[i].ApplyOperator(Collections::ePhysDeriv,
-                                               inarray + offset,
-                                               e_out_d0,e_out_d1, e_out_d2);
-
-            }
+            ApplyCollectionOperator(Collections::ePhysDeriv,
+                                    inarray, out_d0, out_d1, out_d2);
         }
 
         void ExpList::v_PhysDeriv(const int dir,
@@ -797,6 +855,45 @@ namespace Nektar
             Array<OneD,NekDouble> tmp_outarray;
             int cnt = 0;
             int eid;
+
+            // Constant coefficient Helmholtz operators are applied
+            // matrix-free through the collections unless a block matrix
+            // operation has been requested.
+            if (gkey.GetMatrixType() == StdRegions::eHelmholtz &&
+                gkey.GetNVarCoeffs() == 0 && m_collections.size() > 0)
+            {
+                const StdRegions::ConstFactorMap &factors =
+                                                    gkey.GetConstFactors();
+                bool useColl = factors.size() == 0 ||
+                    (factors.size() == 1 &&
+                     factors.count(StdRegions::eFactorLambda) == 1);
+
+                for (int n = 0; n < doBlockMatOp.num_elements(); ++n)
+                {
+                    useColl = useColl && !doBlockMatOp[n];
+                }
+
+                for (int i = 0; i < m_collections.size(); ++i)
+                {
+                    useColl = useColl && m_collections[i].HasOperator(
+                                                Collections::eHelmholtz);
+                }
+
+                if (useColl)
+                {
+                    for (int i = 0; i < m_collections.size(); ++i)
+                    {
+                        m_collections[i].UpdateFactors(
+                            Collections::eHelmholtz, factors);
+                        m_collections[i].ApplyOperator(
+                            Collections::eHelmholtz,
+                            inarray + m_coll_coeff_offset[i],
+                            tmp_outarray = outarray + m_coll_coeff_offset[i]);
+                    }
+                    return;
+                }
+            }
+
             for(int n = 0; n < num_elmts.num_elements(); ++n)
             {
                 if(doBlockMatOp[n])
@@ -1189,13 +1286,8 @@ namespace Nektar
         void ExpList::v_BwdTrans_IterPerExp(const Array<OneD, const NekDouble> &inarray,
                                             Array<OneD, NekDouble> &outarray)
         {
-            Array<OneD, NekDouble> tmp;
-            for (int i = 0; i < m_collections.size(); ++i)
-            {
-                m_collections[i].ApplyOperator(Collections::eBwdTrans,
-                                               inarray + m_coll_coeff_offset[i],
-                                               tmp = outarray + m_coll_phys_offset[i]);
-            }
+            ApplyCollectionOperator(Collections::eBwdTrans,
+                                    inarray, outarray);
         }
 
         LocalRegions::ExpansionSharedPtr& ExpList::GetExp(
@@ -1215,9 +1307,8 @@ namespace Nektar
 
 
         /**
-         * @todo need a smarter search here that first just looks at bounding
-         * vertices - suggest first seeing if point is within 10% of
-         * region defined by vertices. The do point search.
+         * Returns the index of the element containing @a gloCoord, or -1 if
+         * no such element is found.
          */
         int ExpList::GetExpIndex(
                                  const Array<OneD, const NekDouble> &gloCoord,
@@ -1230,17 +1321,185 @@ namespace Nektar
         }
 
 
+        /**
+         * The search is restricted to those elements whose bounding boxes,
+         * held in a tree built on the first call, contain the point. The
+         * boxes are enlarged by a fraction of their size which is at least
+         * the tolerance @a tol, so that points on or just outside an element
+         * are still found. If @a returnNearestElmt is set and no element
+         * contains the point, all elements are searched for the nearest one.
+         */
         int ExpList::GetExpIndex(const Array<OneD, const NekDouble> &gloCoords,
                                  Array<OneD, NekDouble> &locCoords,
                                  NekDouble tol,
                                  bool returnNearestElmt)
         {
-            NekDouble nearpt = 1e6;
-
             if (GetNumElmts() == 0)
             {
                 return -1;
             }
+
+            if (!m_boxTree)
+            {
+                SetUpBoxTree();
+            }
+
+            std::vector<int> elmts;
+            m_boxTree->Query(gloCoords, std::max(0.1, tol), elmts);
+
+            int elmtId = -1;
+            if (!elmts.empty())
+            {
+                elmtId = FindExpIndex(elmts, gloCoords, locCoords, tol, false);
+            }
+
+            if (elmtId < 0 && returnNearestElmt)
+            {
+                elmts.resize((*m_exp).size());
+                for (int i = 0; i < elmts.size(); ++i)
+                {
+                    elmts[i] = i;
+                }
+                elmtId = FindExpIndex(elmts, gloCoords, locCoords, tol, true);
+            }
+
+            return elmtId;
+        }
+
+
+        /**
+         * Locates each of the points @a gloCoords[d][i] as GetExpIndex()
+         * does, writing its element index to @a elmtIds[i] and its local
+         * coordinates to @a locCoords[d][i]. Consecutive points are first
+         * tested against the element of the previous point, which is
+         * usually a hit for structured probe sets such as lines and planes.
+         */
+        void ExpList::GetExpIndices(
+            const Array<OneD, const Array<OneD, NekDouble> > &gloCoords,
+                  Array<OneD, int>                           &elmtIds,
+                  Array<OneD, Array<OneD, NekDouble> >       &locCoords,
+                  NekDouble                                   tol,
+                  bool                                        returnNearestElmt)
+        {
+            int dim  = gloCoords.num_elements();
+            int npts = dim > 0 ? gloCoords[0].num_elements() : 0;
+
+            elmtIds   = Array<OneD, int>(npts, -1);
+            locCoords = Array<OneD, Array<OneD, NekDouble> >(dim);
+            for (int d = 0; d < dim; ++d)
+            {
+                locCoords[d] = Array<OneD, NekDouble>(npts, 0.0);
+            }
+
+            if (npts == 0 || GetNumElmts() == 0)
+            {
+                return;
+            }
+
+            // The previous element is only a safe guess where a point can lie
+            // in a single element.
+            bool reusePrev =
+                GetExp(0)->GetCoordim() == GetExp(0)->GetShapeDimension();
+
+            Array<OneD, NekDouble> pt(dim), loc(dim);
+            NekDouble resid;
+            int prev = -1;
+
+            for (int i = 0; i < npts; ++i)
+            {
+                for (int d = 0; d < dim; ++d)
+                {
+                    pt[d] = gloCoords[d][i];
+                }
+
+                int elmtId = -1;
+                if (reusePrev && prev >= 0 &&
+                    (*m_exp)[prev]->GetGeom()->ContainsPoint(pt, loc,
+                                                             tol, resid))
+                {
+                    elmtId = prev;
+                }
+                else
+                {
+                    elmtId = GetExpIndex(pt, loc, tol, returnNearestElmt);
+                }
+
+                elmtIds[i] = elmtId;
+                for (int d = 0; d < dim; ++d)
+                {
+                    locCoords[d][i] = loc[d];
+                }
+
+                prev = elmtId;
+            }
+        }
+
+
+        /**
+         * Builds the bounding box tree used by GetExpIndex(). Each box covers
+         * the vertices and quadrature points of an element, which for curved
+         * elements is enlarged further by the padding applied on query.
+         */
+        void ExpList::SetUpBoxTree()
+        {
+            int nElmts = (*m_exp).size();
+            int dim    = GetExp(0)->GetCoordim();
+
+            std::vector<NekDouble> boxes(2*dim*nElmts);
+
+            for (int i = 0; i < nElmts; ++i)
+            {
+                LocalRegions::ExpansionSharedPtr  exp  = (*m_exp)[i];
+                SpatialDomains::GeometrySharedPtr geom = exp->GetGeom();
+                NekDouble *min = &boxes[2*dim*i];
+                NekDouble *max = min + dim;
+
+                int nq = exp->GetTotPoints();
+                Array<OneD, Array<OneD, NekDouble> > coords(3);
+                for (int d = 0; d < 3; ++d)
+                {
+                    coords[d] = Array<OneD, NekDouble>(nq, 0.0);
+                }
+                exp->GetCoords(coords[0], coords[1], coords[2]);
+
+                for (int d = 0; d < dim; ++d)
+                {
+                    min[d] = Vmath::Vmin(nq, coords[d], 1);
+                    max[d] = Vmath::Vmax(nq, coords[d], 1);
+                }
+
+                for (int j = 0; j < geom->GetNumVerts(); ++j)
+                {
+                    NekDouble x[3];
+                    geom->GetVertex(j)->GetCoords(x[0], x[1], x[2]);
+                    for (int d = 0; d < dim; ++d)
+                    {
+                        min[d] = std::min(min[d], x[d]);
+                        max[d] = std::max(max[d], x[d]);
+                    }
+                }
+            }
+
+            m_boxTree = MemoryManager<BoundingBoxTree>::AllocateSharedPtr(
+                dim, boxes);
+        }
+
+
+        /**
+         * Searches the elements listed in @a elmts for the point @a
+         * gloCoords. If none contains it and @a returnNearestElmt is set,
+         * the element whose local coordinates are nearest to the standard
+         * region is returned.
+         */
+        int ExpList::FindExpIndex(
+                const std::vector<int>             &elmts,
+                const Array<OneD, const NekDouble> &gloCoords,
+                      Array<OneD, NekDouble>       &locCoords,
+                      NekDouble                     tol,
+                      bool                          returnNearestElmt)
+        {
+            NekDouble nearpt = 1e6;
+
             std::vector<std::pair<int,NekDouble> > elmtIdDist;
 
             // Manifold case (point may match multiple elements)
@@ -1251,8 +1510,9 @@ namespace Nektar
                 NekDouble dist = 0.0;
 
                 // Scan all elements and store those which may contain the point
-                for (int i = 0; i < (*m_exp).size(); ++i)
+                for (int k = 0; k < elmts.size(); ++k)
                 {
+                    int i = elmts[k];
                     if ((*m_exp)[i]->GetGeom()->ContainsPoint(gloCoords,
                                                               locCoords,
                                                               tol, nearpt))
@@ -1302,19 +1562,17 @@ namespace Nektar
             // non-embedded mesh (point can only match one element)
             else
             {
-                static int start = 0;
                 int min_id  = 0;
                 NekDouble nearpt_min = 1e6;
                 Array<OneD, NekDouble> savLocCoords(locCoords.num_elements());
 
-                // restart search from last found value
-                for (int i = start; i < (*m_exp).size(); ++i)
+                for (int k = 0; k < elmts.size(); ++k)
                 {
+                    int i = elmts[k];
                     if ((*m_exp)[i]->GetGeom()->ContainsPoint(gloCoords, 
                                                               locCoords,
                                                               tol, nearpt))
                     {
-                        start = i;
                         return i;
                     }
                     else
@@ -1328,39 +1586,18 @@ namespace Nektar
                     }
                 }
 
-                for (int i = 0; i < start; ++i)
-                {
-                    if ((*m_exp)[i]->GetGeom()->ContainsPoint(gloCoords, 
-                                                              locCoords,
-                                                              tol, nearpt))
-                    {
-                        start = i;
-                        return i;
-                    }
-                    else
-                    {
-                        if(nearpt < nearpt_min)
-                        {
-                            min_id    = i;
-                            nearpt_min = nearpt;
-                            Vmath::Vcopy(locCoords.num_elements(),
-                                         locCoords,1,savLocCoords,1);
-                        }
-                    }
-                }
-
-                std::string msg = "Failed to find point within element to tolerance of "
-                    + boost::lexical_cast<std::string>(tol)
-                    + " using local point ("
-                    + boost::lexical_cast<std::string>(locCoords[0]) +","
-                    + boost::lexical_cast<std::string>(locCoords[1]) +","
-                    + boost::lexical_cast<std::string>(locCoords[1]) 
-                    + ") in element: "
-                    + boost::lexical_cast<std::string>(min_id);
-                WARNINGL1(false,msg.c_str());
-
                 if(returnNearestElmt)
                 {
+                    std::string msg = "Failed to find point within element to tolerance of "
+                        + boost::lexical_cast<std::string>(tol)
+                        + " using local point ("
+                        + boost::lexical_cast<std::string>(locCoords[0]) +","
+                        + boost::lexical_cast<std::string>(locCoords[1]) +","
+                        + boost::lexical_cast<std::string>(locCoords[1]) 
+                        + ") in element: "
+                        + boost::lexical_cast<std::string>(min_id);
+                    WARNINGL1(false,msg.c_str());
+
                     Vmath::Vcopy(locCoords.num_elements(),savLocCoords,1,locCoords,1);
                     return min_id;
                 }
@@ -1368,7 +1605,6 @@ namespace Nektar
                 {
                     return -1;
                 }
-
             }
         }
 
@@ -1399,6 +1635,12 @@ namespace Nektar
             LibUtilities::NekManager<LocalRegions::MatrixKey,
                 DNekScalBlkMat, LocalRegions::MatrixKey::opLess>::ClearManager();
 
+            // Shared element metrics are re-registered on next use.
+            LocalRegions::MetricRegistry::Clear();
+
+            // Element bounding boxes are rebuilt on the next point search.
+            m_boxTree.reset();
+
             // Loop over all elements and reset geometry information.
             for (int i = 0; i < m_exp->size(); ++i)
             {
@@ -2467,14 +2709,8 @@ namespace Nektar
                                 Array<OneD,       NekDouble> &outarray,
                                 CoeffState coeffstate)
         {
-            Array<OneD,NekDouble>  tmp;
-            for (int i = 0; i < m_collections.size(); ++i)
-            {
-
-                m_collections[i].ApplyOperator(Collections::eIProductWRTBase,
-                                               inarray + m_coll_phys_offset[i],
-                                               tmp = outarray + m_coll_coeff_offset[i]);
-            }
+            ApplyCollectionOperator(Collections::eIProductWRTBase,
+                                    inarray, outarray);
         }
 
         void ExpList::v_GeneralMatrixOp(
@@ -2743,6 +2979,16 @@ namespace Nektar
             m_collections.clear();
             m_coll_coeff_offset.clear();
             m_coll_phys_offset.clear();
+            m_coll_ncoeffs.clear();
+            m_coll_nphys.clear();
+            m_coll_threadReady.clear();
+
+            // When running with threads, split each element type into at
+            // least one collection per thread so that the collections can be
+            // distributed across the workers
+            Thread::ThreadManagerSharedPtr tm = Thread::GetThreadMaster()
+                .GetInstance(Thread::ThreadMaster::SessionJob);
+            int nThreads = tm->IsInitialised() ? tm->GetMaxNumWorkers() : 1;
 
             // Loop over expansions, and create collections for each element type
             for (int i = 0; i < m_exp->size(); ++i)
@@ -2756,6 +3002,12 @@ namespace Nektar
                 LocalRegions::ExpansionSharedPtr exp = it->second[0].first;
 
                 Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(exp);
+                int collsize = collmax;
+                if (nThreads > 1)
+                {
+                    collsize = min(collsize, (int)(it->second.size()
+                                                   + nThreads - 1) / nThreads);
+                }
                 vector<StdRegions::StdExpansionSharedPtr> collExp;
 
                 int prevCoeffOffset     = m_coeff_offset[it->second[0].second];
@@ -2779,6 +3031,10 @@ namespace Nektar
 
                     Collections::Collection tmp(collExp, impTypes);
                     m_collections.push_back(tmp);
+                    m_coll_ncoeffs.push_back(
+                        collExp.size()*collExp[0]->GetNcoeffs());
+                    m_coll_nphys  .push_back(
+                        collExp.size()*collExp[0]->GetTotPoints());
                 }
                 else
                 {
@@ -2801,7 +3057,7 @@ namespace Nektar
                         if(prevCoeffOffset + nCoeffs != coeffOffset ||
                            prevnCoeff != nCoeffs ||
                            prevPhysOffset + nPhys != physOffset ||
-                           prevnPhys != nPhys || collcnt >= collmax)
+                           prevnPhys != nPhys || collcnt >= collsize)
                         {
 
                             // if no Imp Type provided and No
@@ -2816,6 +3072,10 @@ namespace Nektar
 
                             Collections::Collection tmp(collExp, impTypes);
                             m_collections.push_back(tmp);
+                            m_coll_ncoeffs.push_back(
+                                collExp.size()*collExp[0]->GetNcoeffs());
+                            m_coll_nphys  .push_back(
+                                collExp.size()*collExp[0]->GetTotPoints());
 
 
                             // start new geom list
@@ -2845,6 +3105,10 @@ namespace Nektar
 
                             Collections::Collection tmp(collExp, impTypes);
                             m_collections.push_back(tmp);
+                            m_coll_ncoeffs.push_back(
+                                collExp.size()*collExp[0]->GetNcoeffs());
+                            m_coll_nphys  .push_back(
+                                collExp.size()*collExp[0]->GetTotPoints());
                             collExp.clear();
                             collcnt = 0;
 
@@ -2858,6 +3122,99 @@ namespace Nektar
                 }
             }
         }
+
+        /**
+         * @brief Apply a collection operator to every collection in the
+         * expansion list.
+         *
+         * If a session ThreadManager has been started the collections are
+         * dispatched as ThreadJob instances across its workers. Each operator
+         * is first applied serially once, so that any element data which is
+         * constructed on demand (for example by the NoCollection operators)
+         * is available before the workers share it.
+         *
+         * @param op        Operator to apply; one of eBwdTrans,
+         *                  eIProductWRTBase or ePhysDeriv.
+         * @param inarray   Input array over the whole expansion list.
+         * @param out0      Output array; for ePhysDeriv the derivative in
+         *                  the first direction.
+         * @param out1      Derivative in the second direction (ePhysDeriv).
+         * @param out2      Derivative in the third direction (ePhysDeriv).
+         */
+        void ExpList::ApplyCollectionOperator(
+            const Collections::OperatorType     op,
+            const Array<OneD, const NekDouble> &inarray,
+                  Array<OneD,       NekDouble> &out0,
+                  Array<OneD,       NekDouble> &out1,
+                  Array<OneD,       NekDouble> &out2)
+        {
+            const bool physIn  = op != Collections::eBwdTrans;
+            const bool physOut = op != Collections::eIProductWRTBase;
+            const vector<int> &inOffset  =
+                physIn  ? m_coll_phys_offset : m_coll_coeff_offset;
+            const vector<int> &outOffset =
+                physOut ? m_coll_phys_offset : m_coll_coeff_offset;
+
+            Thread::ThreadManagerSharedPtr tm = Thread::GetThreadMaster()
+                .GetInstance(Thread::ThreadMaster::SessionJob);
+
+            bool threaded = tm->IsInitialised()            &&
+                            tm->GetMaxNumWorkers() > 1     &&
+                            !tm->InThread()                &&
+                            m_collections.size() > 1       &&
+                            m_coll_threadReady.count(op) > 0;
+
+            if (!threaded)
+            {
+                Array<OneD, NekDouble> tmp0, tmp1, tmp2;
+                for (int i = 0; i < m_collections.size(); ++i)
+                {
+                    if (op == Collections::ePhysDeriv)
+                    {
+                        tmp0 = out0 + outOffset[i];
+                        tmp1 = out1 + outOffset[i];
+                        tmp2 = out2 + outOffset[i];
+                        m_collections[i].ApplyOperator(
+                            op, inarray + inOffset[i], tmp0, tmp1, tmp2);
+                    }
+                    else
+                    {
+                        m_collections[i].ApplyOperator(
+                            op, inarray + inOffset[i],
+                            tmp0 = out0 + outOffset[i]);
+                    }
+                }
+
+                m_coll_threadReady.insert(op);
+                return;
+            }
+
+            const vector<int> &inSize  = physIn  ? m_coll_nphys
+                                                 : m_coll_ncoeffs;
+            const vector<int> &outSize = physOut ? m_coll_nphys
+                                                 : m_coll_ncoeffs;
+            Array<OneD, NekDouble> *out[3] = { &out0, &out1, &out2 };
+
+            vector<Thread::ThreadJob*> jobs(m_collections.size());
+            for (int i = 0; i < m_collections.size(); ++i)
+            {
+                NekDouble *outPtr[3];
+                for (int j = 0; j < 3; ++j)
+                {
+                    outPtr[j] = out[j]->num_elements() > 0
+                                    ? out[j]->get() + outOffset[i] : NULL;
+                }
+
+                jobs[i] = new CollectionOperatorJob(
+                    m_collections[i], op, inarray.get() + inOffset[i],
+                    inSize[i], outPtr, outSize[i]);
+            }
+
+            // Hold the workers until the whole list has been queued
+            tm->SetNumWorkers(0);
+            tm->QueueJobs(jobs);
+            tm->SetNumWorkers();
+            tm->Wait();
+        }
     } //end of namespace
 } //end of namespace
-
@@ -48,7 +48,9 @@
 #include <MultiRegions/GlobalMatrixKey.h>
 #include <MultiRegions/GlobalOptimizationParameters.h>
 #include <MultiRegions/AssemblyMap/AssemblyMap.h>
+#include <MultiRegions/BoundingBoxTree.h>
 #include <boost/enable_shared_from_this.hpp>
+#include <set>
 #include <tinyxml.h>
 
 namespace Nektar
@@ -596,6 +598,18 @@ namespace Nektar
                 NekDouble tol = 0.0,
                 bool returnNearestElmt = false);
 
+            /** This function locates each of the points given by \a
+             * gloCoords[d][i], returning the index of the containing
+             * element in \a elmtIds[i] (or -1) and the local Cartesian
+             * coordinates in \a locCoords[d][i].
+             **/
+            MULTI_REGIONS_EXPORT void GetExpIndices(
+                const Array<OneD, const Array<OneD, NekDouble> > &gloCoords,
+                      Array<OneD, int>                           &elmtIds,
+                      Array<OneD, Array<OneD, NekDouble> >       &locCoords,
+                NekDouble tol = 0.0,
+                bool returnNearestElmt = false);
+
             /// Get the start offset position for a global list of #m_coeffs
             /// correspoinding to element n.
             inline int GetCoeff_Offset(int n) const;
@@ -869,6 +883,15 @@ namespace Nektar
                                                     = Collections::eNoImpType);
 
         protected:
+            void ApplyCollectionOperator(
+                const Collections::OperatorType     op,
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &out0,
+                      Array<OneD,       NekDouble> &out1
+                                                = NullNekDouble1DArray,
+                      Array<OneD,       NekDouble> &out2
+                                                = NullNekDouble1DArray);
+
             boost::shared_ptr<DNekMat> GenGlobalMatrixFull(
                 const GlobalLinSysKey &mkey,
                 const boost::shared_ptr<AssemblyMapCG> &locToGloMap);
@@ -954,6 +977,16 @@ namespace Nektar
             /// Offset of elemental data into the array #m_phys
             std::vector<int>  m_coll_phys_offset;
 
+            /// Number of coefficients held by each collection
+            std::vector<int>  m_coll_ncoeffs;
+
+            /// Number of quadrature points held by each collection
+            std::vector<int>  m_coll_nphys;
+
+            /// Collection operators which have been applied serially once and
+            /// may therefore be distributed across threads
+            std::set<Collections::OperatorType> m_coll_threadReady;
+
             /// Offset of elemental data into the array #m_coeffs
             Array<OneD, int>  m_coeff_offset;
 
@@ -971,12 +1004,27 @@ namespace Nektar
             NekOptimize::GlobalOptParamSharedPtr m_globalOptParam;
 
             BlockMatrixMapShPtr  m_blockMat;
+
+            /// Bounding boxes of the elements, built on the first call to
+            /// GetExpIndex().
+            BoundingBoxTreeSharedPtr m_boxTree;
             
             //@todo should this be in ExpList or ExpListHomogeneous1D.cpp
             // it's a bool which determine if the expansion is in the wave space (coefficient space)
             // or not
             bool m_WaveSpace;
 
+            /// Builds #m_boxTree from the element geometries.
+            void SetUpBoxTree();
+
+            /// Searches the given subset of elements for a point.
+            int FindExpIndex(
+                const std::vector<int>             &elmts,
+                const Array<OneD, const NekDouble> &gloCoords,
+                      Array<OneD, NekDouble>       &locCoords,
+                      NekDouble                     tol,
+                      bool                          returnNearestElmt);
+
             /// This function assembles the block diagonal matrix of local
             /// matrices of the type \a mtype.
             const DNekScalBlkMatSharedPtr GenBlockMatrix(
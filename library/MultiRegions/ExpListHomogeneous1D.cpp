@@ -78,6 +78,7 @@ namespace Nektar
 
             if(m_useFFT)
             {
+                LibUtilities::NektarFFT::SetPlanner(m_session);
                 m_FFT = LibUtilities::GetNektarFFTFactory().CreateInstance(
                                 "NekFFTW", m_homogeneousBasis->GetNumPoints());
             }
@@ -186,43 +187,52 @@ namespace Nektar
             Array<OneD, NekDouble> ShufV2(num_dfts_per_proc*N,0.0);
             Array<OneD, NekDouble> ShufV1V2(num_dfts_per_proc*N,0.0);
 
-            Array<OneD, NekDouble> ShufV1_PAD_coef(m_padsize,0.0);
-            Array<OneD, NekDouble> ShufV2_PAD_coef(m_padsize,0.0);
-            Array<OneD, NekDouble> ShufV1_PAD_phys(m_padsize,0.0);
-            Array<OneD, NekDouble> ShufV2_PAD_phys(m_padsize,0.0);
+            int num_pad = num_dfts_per_proc*m_padsize;
 
-            Array<OneD, NekDouble> ShufV1V2_PAD_coef(m_padsize,0.0);
-            Array<OneD, NekDouble> ShufV1V2_PAD_phys(m_padsize,0.0);
+            Array<OneD, NekDouble> ShufV1_PAD_coef(num_pad,0.0);
+            Array<OneD, NekDouble> ShufV2_PAD_coef(num_pad,0.0);
+            Array<OneD, NekDouble> ShufV1_PAD_phys(num_pad,0.0);
+            Array<OneD, NekDouble> ShufV2_PAD_phys(num_pad,0.0);
+
+            Array<OneD, NekDouble> ShufV1V2_PAD_coef(num_pad,0.0);
+            Array<OneD, NekDouble> ShufV1V2_PAD_phys(num_pad,0.0);
 
             m_transposition->Transpose(V1, ShufV1, false, LibUtilities::eXYtoZ);
             m_transposition->Transpose(V2, ShufV2, false, LibUtilities::eXYtoZ);
 
-            // Looping on the pencils
+            // Copying each pencil of length N into a longer pencil of
+            // length m_padsize. We are in Fourier space
+            for(int i = 0 ; i < num_dfts_per_proc ; i++)
+            {
+                Vmath::Vcopy(N, &(ShufV1[i*N]), 1,
+                                &(ShufV1_PAD_coef[i*m_padsize]), 1);
+                Vmath::Vcopy(N, &(ShufV2[i*N]), 1,
+                                &(ShufV2_PAD_coef[i*m_padsize]), 1);
+            }
+
+            // Moving all pencils to physical space using the padded system
+            m_FFT_deal->FFTBwdTrans(num_dfts_per_proc,
+                                    ShufV1_PAD_coef, ShufV1_PAD_phys);
+            m_FFT_deal->FFTBwdTrans(num_dfts_per_proc,
+                                    ShufV2_PAD_coef, ShufV2_PAD_phys);
+
+            // Perfroming the vectors multiplication in physical space on
+            // the padded system
+            Vmath::Vmul(num_pad, ShufV1_PAD_phys,   1,
+                                 ShufV2_PAD_phys,   1,
+                                 ShufV1V2_PAD_phys, 1);
+
+            // Moving back the result (V1*V2)_phys in Fourier space, padded
+            // system
+            m_FFT_deal->FFTFwdTrans(num_dfts_per_proc,
+                                    ShufV1V2_PAD_phys, ShufV1V2_PAD_coef);
+
+            // Copying the first N modes of each padded pencil in the full
+            // vector (Fourier space)
             for(int i = 0 ; i < num_dfts_per_proc ; i++)
             {
-                // Copying the i-th pencil pf lenght N into a bigger
-                // pencil of lenght 2N We are in Fourier space
-                Vmath::Vcopy(N, &(ShufV1[i*N]), 1, &(ShufV1_PAD_coef[0]), 1);
-                Vmath::Vcopy(N, &(ShufV2[i*N]), 1, &(ShufV2_PAD_coef[0]), 1);
-
-                // Moving to physical space using the padded system
-                m_FFT_deal->FFTBwdTrans(ShufV1_PAD_coef, ShufV1_PAD_phys);
-                m_FFT_deal->FFTBwdTrans(ShufV2_PAD_coef, ShufV2_PAD_phys);
-
-                // Perfroming the vectors multiplication in physical space on
-                // the padded system
-                Vmath::Vmul(m_padsize, ShufV1_PAD_phys,   1,
-                                       ShufV2_PAD_phys,   1,
-                                       ShufV1V2_PAD_phys, 1);
-
-                // Moving back the result (V1*V2)_phys in Fourier space, padded
-                // system
-                m_FFT_deal->FFTFwdTrans(ShufV1V2_PAD_phys, ShufV1V2_PAD_coef);
-
-                // Copying the first half of the padded pencil in the full
-                // vector (Fourier space)
-                Vmath::Vcopy(N, &(ShufV1V2_PAD_coef[0]), 1,
-                                &(ShufV1V2[i*N]),        1);
+                Vmath::Vcopy(N, &(ShufV1V2_PAD_coef[i*m_padsize]), 1,
+                                &(ShufV1V2[i*N]),                  1);
             }
 
             m_transposition->Transpose(ShufV1V2, V1V2, false,
@@ -403,17 +413,11 @@ namespace Nektar
                 
                 if(IsForwards)
                 {
-                    for(int i = 0 ; i < num_dfts_per_proc ; i++)
-                    {
-                        m_FFT->FFTFwdTrans(m_tmpIN = fft_in + i*m_homogeneousBasis->GetNumPoints(), m_tmpOUT = fft_out + i*m_homogeneousBasis->GetNumPoints());
-                    }
+                    m_FFT->FFTFwdTrans(num_dfts_per_proc, fft_in, fft_out);
                 }
                 else 
                 {
-                    for(int i = 0 ; i < num_dfts_per_proc ; i++)
-                    {
-                        m_FFT->FFTBwdTrans(m_tmpIN = fft_in + i*m_homogeneousBasis->GetNumPoints(), m_tmpOUT = fft_out + i*m_homogeneousBasis->GetNumPoints());
-                    }
+                    m_FFT->FFTBwdTrans(num_dfts_per_proc, fft_in, fft_out);
                 }
         
                 if(UnShuff)
@@ -39,6 +39,18 @@ namespace Nektar
 {
     namespace MultiRegions
     {
+        std::string GlobalLinSysIterative::iterSolverDef =
+            LibUtilities::SessionReader::RegisterDefaultSolverInfo(
+                "IterativeSolverType", "ConjugateGradient");
+        std::string GlobalLinSysIterative::iterSolverLookupIds[2] = {
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "IterativeSolverType", "ConjugateGradient",
+                eConjugateGradient),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "IterativeSolverType", "PipelinedConjugateGradient",
+                ePipelinedConjugateGradient),
+        };
+
         /**
          * @class GlobalLinSysIterative
          *
@@ -102,7 +114,53 @@ namespace Nektar
             else
             {
                 // applying plain Conjugate Gradient
-                DoConjugateGradient(nGlobal, pInput, pOutput, plocToGloMap, nDir);
+                DoKrylovSolve(nGlobal, pInput, pOutput, plocToGloMap, nDir);
+            }
+        }
+
+
+        /**
+         * Dispatches to the Krylov method selected through the
+         * IterativeSolverType solver info of the assembly map.
+         */
+        void GlobalLinSysIterative::DoKrylovSolve(
+                    const int nGlobal,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const AssemblyMapSharedPtr &plocToGloMap,
+                    const int nDir)
+        {
+            switch (plocToGloMap->GetIterativeSolverType())
+            {
+                case ePipelinedConjugateGradient:
+                    DoPipelinedConjugateGradient(
+                        nGlobal, pInput, pOutput, plocToGloMap, nDir);
+                    break;
+                case eConjugateGradient:
+                default:
+                    DoConjugateGradient(
+                        nGlobal, pInput, pOutput, plocToGloMap, nDir);
+                    break;
+            }
+        }
+
+
+        /**
+         * Builds the preconditioner on first use.
+         */
+        void GlobalLinSysIterative::SetupPreconditioner(
+                    const AssemblyMapSharedPtr &plocToGloMap)
+        {
+            if (!m_precon)
+            {
+                MultiRegions::PreconditionerType pType
+                    = plocToGloMap->GetPreconType();
+                std::string PreconType
+                    = MultiRegions::PreconditionerTypeMap[pType];
+                v_UniqueMap();
+                m_precon = GetPreconFactory().CreateInstance(
+                    PreconType,GetSharedThisPtr(),plocToGloMap);
+                m_precon->BuildPreconditioner();
             }
         }
 
@@ -132,7 +190,7 @@ namespace Nektar
             {
                 // no previous solutions found, call CG
 
-                DoConjugateGradient(nGlobal, pInput, pOutput, plocToGloMap, nDir);
+                DoKrylovSolve(nGlobal, pInput, pOutput, plocToGloMap, nDir);
 
                 UpdateKnownSolutions(nGlobal, pOutput, nDir);
             }
@@ -206,7 +264,7 @@ namespace Nektar
 
 
                 // solve the system with projected rhs
-                DoConjugateGradient(nGlobal, pb_s, tmpx_s, plocToGloMap, nDir);
+                DoKrylovSolve(nGlobal, pb_s, tmpx_s, plocToGloMap, nDir);
 
 
                 // remainder solution + projection of previous solutions
@@ -359,17 +417,7 @@ namespace Nektar
             const AssemblyMapSharedPtr        &plocToGloMap,
             const int                          nDir)
         {
-            if (!m_precon)
-            {
-                MultiRegions::PreconditionerType pType
-                    = plocToGloMap->GetPreconType();
-                std::string PreconType
-                    = MultiRegions::PreconditionerTypeMap[pType];
-                v_UniqueMap();
-                m_precon = GetPreconFactory().CreateInstance(
-                    PreconType,GetSharedThisPtr(),plocToGloMap);
-                m_precon->BuildPreconditioner();
-            }
+            SetupPreconditioner(plocToGloMap);
 
             // Get the communicator for performing data exchanges
             LibUtilities::CommSharedPtr vComm
@@ -531,6 +579,185 @@ namespace Nektar
             }
         }
 
+
+        /**
+         * Solve a global linear system using the pipelined preconditioned
+         * conjugate gradient method of Ghysels and Vanroose (Parallel
+         * Computing 40, 2014). All inner products of an iteration are
+         * combined into a single global reduction, which is started
+         * non-blockingly and overlapped with the application of the
+         * preconditioner and the operator. This trades a few extra vector
+         * updates and slightly weaker round-off behaviour for hiding the
+         * reduction latency, which dominates at high core counts.
+         *
+         * @param       pInput      Input residual  of all DOFs.
+         * @param       pOutput     Solution vector of all DOFs.
+         */
+        void GlobalLinSysIterative::DoPipelinedConjugateGradient(
+            const int                          nGlobal,
+            const Array<OneD,const NekDouble> &pInput,
+                  Array<OneD,      NekDouble> &pOutput,
+            const AssemblyMapSharedPtr        &plocToGloMap,
+            const int                          nDir)
+        {
+            SetupPreconditioner(plocToGloMap);
+
+            // Get the communicator for performing data exchanges
+            LibUtilities::CommSharedPtr vComm
+                = m_expList.lock()->GetComm()->GetRowComm();
+
+            // Get vector sizes
+            int nNonDir = nGlobal - nDir;
+
+            // Allocate array storage. Vectors which are passed to the
+            // operator are stored for all DOFs with zero Dirichlet part.
+            Array<OneD, NekDouble> u_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> w_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> m_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> n_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> r_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> p_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> s_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> q_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> z_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> tmp;
+
+            int k;
+            NekDouble alpha, beta, gamma, gamma_old, delta, eps;
+            Array<OneD, NekDouble> vExchange(3,0.0);
+            LibUtilities::CommRequestSharedPtr request
+                = vComm->CreateRequest(1);
+
+            // Copy initial residual from input
+            Vmath::Vcopy(nNonDir, &pInput[nDir], 1, &r_A[0], 1);
+            // zero homogeneous out array ready for solution updates
+            // Should not be earlier in case input vector is same as
+            // output and above copy has been peformed
+            Vmath::Zero(nNonDir,tmp = pOutput + nDir,1);
+
+            // evaluate initial residual error for exit check
+            vExchange[2] = Vmath::Dot2(nNonDir,
+                                       r_A,
+                                       r_A,
+                                       m_map + nDir);
+
+            vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+            eps = vExchange[2];
+
+            if(m_rhs_magnitude == NekConstants::kNekUnsetDouble)
+            {
+                m_rhs_magnitude = 1.0/vExchange[2];
+            }
+
+            // If input residual is less than tolerance skip solve.
+            if (eps < m_tolerance * m_tolerance * m_rhs_magnitude)
+            {
+                if (m_verbose && m_root)
+                {
+                    cout << "CG iterations made = " << m_totalIterations
+                         << " using tolerance of "  << m_tolerance
+                         << " (error = " << sqrt(eps/m_rhs_magnitude) << ")" << endl;
+                }
+                m_rhs_magnitude = NekConstants::kNekUnsetDouble;
+                return;
+            }
+
+            // u_0 = M^{-1} r_0, w_0 = A u_0
+            m_precon->DoPreconditioner(r_A, tmp = u_A + nDir);
+            v_DoMatrixMultiply(u_A, w_A);
+
+            m_totalIterations = 1;
+            k         = 0;
+            alpha     = 0.0;
+            gamma_old = 0.0;
+
+            // Continue until convergence
+            while (true)
+            {
+                ASSERTL0(k < 5000,
+                         "Exceeded maximum number of iterations (5000)");
+
+                // <r_k, u_k>
+                vExchange[0] = Vmath::Dot2(nNonDir,
+                                           r_A,
+                                           u_A + nDir,
+                                           m_map + nDir);
+                // <w_k, u_k>
+                vExchange[1] = Vmath::Dot2(nNonDir,
+                                           w_A + nDir,
+                                           u_A + nDir,
+                                           m_map + nDir);
+                // <r_k, r_k>
+                vExchange[2] = Vmath::Dot2(nNonDir,
+                                           r_A,
+                                           r_A,
+                                           m_map + nDir);
+
+                // Start inner-product exchanges
+                vComm->IAllReduce(vExchange, Nektar::LibUtilities::ReduceSum,
+                                  request);
+
+                // Overlap the reduction with m_k = M^{-1} w_k, n_k = A m_k
+                m_precon->DoPreconditioner(w_A + nDir, tmp = m_A + nDir);
+                v_DoMatrixMultiply(m_A, n_A);
+
+                // Complete inner-product exchanges
+                vComm->WaitAll(request);
+
+                gamma = vExchange[0];
+                delta = vExchange[1];
+                eps   = vExchange[2];
+
+                // test if norm is within tolerance
+                if (eps < m_tolerance * m_tolerance * m_rhs_magnitude)
+                {
+                    if (m_verbose && m_root)
+                    {
+                        cout << "CG iterations made = " << m_totalIterations
+                             << " using tolerance of "  << m_tolerance
+                             << " (error = " << sqrt(eps/m_rhs_magnitude) << ")"
+                             << endl;
+                    }
+                    m_rhs_magnitude = NekConstants::kNekUnsetDouble;
+                    break;
+                }
+
+                // Compute search direction and solution coefficients
+                if (k > 0)
+                {
+                    beta  = gamma/gamma_old;
+                    alpha = gamma/(delta - beta*gamma/alpha);
+                }
+                else
+                {
+                    beta  = 0.0;
+                    alpha = gamma/delta;
+                }
+                gamma_old = gamma;
+
+                // z_k = n_k + beta z_{k-1}, q_k = m_k + beta q_{k-1}
+                Vmath::Svtvp(nNonDir, beta, &z_A[0], 1, &n_A[nDir], 1, &z_A[0], 1);
+                Vmath::Svtvp(nNonDir, beta, &q_A[0], 1, &m_A[nDir], 1, &q_A[0], 1);
+
+                // s_k = w_k + beta s_{k-1}, p_k = u_k + beta p_{k-1}
+                Vmath::Svtvp(nNonDir, beta, &s_A[0], 1, &w_A[nDir], 1, &s_A[0], 1);
+                Vmath::Svtvp(nNonDir, beta, &p_A[0], 1, &u_A[nDir], 1, &p_A[0], 1);
+
+                // Update solution x_{k+1}
+                Vmath::Svtvp(nNonDir, alpha, &p_A[0], 1, &pOutput[nDir], 1, &pOutput[nDir], 1);
+
+                // Update residual r_{k+1} and the recurrences for
+                // u_{k+1} = M^{-1} r_{k+1} and w_{k+1} = A u_{k+1}
+                Vmath::Svtvp(nNonDir, -alpha, &s_A[0], 1, &r_A[0],     1, &r_A[0],     1);
+                Vmath::Svtvp(nNonDir, -alpha, &q_A[0], 1, &u_A[nDir], 1, &u_A[nDir], 1);
+                Vmath::Svtvp(nNonDir, -alpha, &z_A[0], 1, &w_A[nDir], 1, &w_A[nDir], 1);
+
+                m_totalIterations++;
+                k++;
+            }
+        }
+
         void GlobalLinSysIterative::Set_Rhs_Magnitude(const NekVector<NekDouble> &pIn)
         {
 
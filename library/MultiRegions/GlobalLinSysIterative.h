@@ -60,6 +60,9 @@ namespace Nektar
 
             MULTI_REGIONS_EXPORT virtual ~GlobalLinSysIterative();
 
+            static std::string                          iterSolverDef;
+            static std::string                          iterSolverLookupIds[];
+
         protected:
             /// Global to universal unique map
             Array<OneD, int>                            m_map;
@@ -105,12 +108,31 @@ namespace Nektar
                     const AssemblyMapSharedPtr &locToGloMap,
                     const int pNumDir);
 
+            /// Iterative solve with a single overlapped reduction per step
+            void DoPipelinedConjugateGradient(
+                    const int pNumRows,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const int pNumDir);
+
 
             void Set_Rhs_Magnitude(const NekVector<NekDouble> &pIn);
 
             virtual void v_UniqueMap() = 0;
             
         private:
+            /// Calls the Krylov method selected by IterativeSolverType
+            void DoKrylovSolve(
+                    const int pNumRows,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const int pNumDir);
+
+            void SetupPreconditioner(
+                    const AssemblyMapSharedPtr &locToGloMap);
+
             void UpdateKnownSolutions(
                     const int pGlobalBndDofs,
                     const Array<OneD,const NekDouble> &pSolution,
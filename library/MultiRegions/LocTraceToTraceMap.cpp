@@ -0,0 +1,488 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File LocTraceToTraceMap.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Precomputed map between elemental traces and the trace space
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <utility>
+
+#include <MultiRegions/LocTraceToTraceMap.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        namespace
+        {
+            /// outarray[coeff[i]] += sign[i] * inarray[trace[i]]
+            void ScatterAdd(
+                const Array<OneD, const int>       &trace,
+                const Array<OneD, const int>       &coeff,
+                const Array<OneD, const NekDouble> &sign,
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray)
+            {
+                const int        n   = trace.num_elements();
+                const int       *t   = trace.get();
+                const int       *c   = coeff.get();
+                const NekDouble *s   = sign.get();
+                const NekDouble *in  = inarray.get();
+                NekDouble       *out = outarray.get();
+
+                for (int i = 0; i < n; ++i)
+                {
+                    out[c[i]] += s[i] * in[t[i]];
+                }
+            }
+
+            /// outarray[trace[i]] = inarray[phys[i]]
+            void Gather(
+                const Array<OneD, const int>       &trace,
+                const Array<OneD, const int>       &phys,
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray)
+            {
+                const int        n   = trace.num_elements();
+                const int       *t   = trace.get();
+                const int       *p   = phys.get();
+                const NekDouble *in  = inarray.get();
+                NekDouble       *out = outarray.get();
+
+                for (int i = 0; i < n; ++i)
+                {
+                    out[t[i]] = in[p[i]];
+                }
+            }
+        }
+
+        /**
+         * @brief Sets up the gather and scatter maps.
+         *
+         * @param locExp         Expansion whose element traces are mapped.
+         * @param trace          Trace space of @a locExp.
+         * @param elmtToTrace    Trace element of each element trace.
+         * @param leftAdjacents  For each element trace, in element order,
+         *                       whether it belongs to the forwards space.
+         */
+        LocTraceToTraceMap::LocTraceToTraceMap(
+            const ExpList                            &locExp,
+            const ExpListSharedPtr                   &trace,
+            const Array<OneD, Array<OneD,
+                LocalRegions::ExpansionSharedPtr> >  &elmtToTrace,
+            const std::vector<bool>                  &leftAdjacents)
+            : m_trace (trace),
+              m_expDim(0)
+        {
+            int nexp = elmtToTrace.num_elements();
+            std::vector<TraceEntity> entities;
+
+            for (int cnt = 0, n = 0; n < nexp; ++n)
+            {
+                // elmtToTrace[n] is an offset into a single array, so its
+                // length is not the number of traces of the element.
+                int nTraces = locExp.GetExp(n)->GetNtrace();
+                for (int e = 0; e < nTraces; ++e, ++cnt)
+                {
+                    TraceEntity ent;
+                    ent.m_elmt            = locExp.GetExp(n);
+                    ent.m_trace           = elmtToTrace[n][e];
+                    ent.m_id              = e;
+                    ent.m_physOffset      = locExp.GetPhys_Offset(n);
+                    ent.m_coeffOffset     = locExp.GetCoeff_Offset(n);
+                    ent.m_tracePhysOffset = trace->GetPhys_Offset(
+                        elmtToTrace[n][e]->GetElmtId());
+                    ent.m_fwd             = leftAdjacents[cnt];
+                    entities.push_back(ent);
+                }
+            }
+
+            if (nexp > 0)
+            {
+                m_expDim = locExp.GetExp(0)->GetShapeDimension();
+            }
+
+            // Probe fields used to identify the points copied to each trace
+            // point. The second guards against interpolation which happens
+            // to return an integer.
+            int nPhys = locExp.GetNpoints();
+            Array<OneD, NekDouble> probe1(nPhys), probe2(nPhys);
+            for (int i = 0; i < nPhys; ++i)
+            {
+                probe1[i] = i;
+                probe2[i] = sqrt(i + 2.0);
+            }
+
+            SetUpGather(entities, probe1, probe2);
+
+            if (m_expDim > 1)
+            {
+                SetUpScatter(entities);
+            }
+
+            m_traceCoeffs = Array<OneD, NekDouble>(trace->GetNcoeffs());
+        }
+
+        LocTraceToTraceMap::~LocTraceToTraceMap()
+        {
+        }
+
+        /**
+         * @brief Determines, for each element trace, the physical point
+         * copied to each of its trace points.
+         */
+        void LocTraceToTraceMap::SetUpGather(
+            const std::vector<TraceEntity>     &entities,
+            const Array<OneD, const NekDouble> &probe1,
+            const Array<OneD, const NekDouble> &probe2)
+        {
+            std::vector<std::pair<int, int> > fwd, bwd;
+
+            for (int k = 0; k < entities.size(); ++k)
+            {
+                const TraceEntity &ent = entities[k];
+                int nTracePts = ent.m_trace->GetTotPoints();
+                int nElmtPts  = ent.m_elmt ->GetTotPoints();
+
+                TraceEntity local = ent;
+                local.m_tracePhysOffset = 0;
+
+                Array<OneD, NekDouble> out1(nTracePts, 0.0);
+                Array<OneD, NekDouble> out2(nTracePts, 0.0);
+                ExtractTrace(local, probe1, out1);
+                ExtractTrace(local, probe2, out2);
+
+                std::vector<int> idx(nTracePts);
+                bool isGather = true;
+                for (int j = 0; j < nTracePts && isGather; ++j)
+                {
+                    int i = (int) out1[j];
+                    isGather = out1[j] == (NekDouble) i     &&
+                               i >= ent.m_physOffset         &&
+                               i <  ent.m_physOffset + nElmtPts &&
+                               out2[j] == probe2[i];
+                    idx[j] = i;
+                }
+
+                if (!isGather)
+                {
+                    m_gatherFallback.push_back(ent);
+                    continue;
+                }
+
+                std::vector<std::pair<int, int> > &list = ent.m_fwd ? fwd : bwd;
+                for (int j = 0; j < nTracePts; ++j)
+                {
+                    list.push_back(std::make_pair(ent.m_tracePhysOffset + j,
+                                                  idx[j]));
+                }
+            }
+
+            // Order by trace point for contiguous writes.
+            std::sort(fwd.begin(), fwd.end());
+            std::sort(bwd.begin(), bwd.end());
+
+            m_fwdGatherTrace = Array<OneD, int>(fwd.size());
+            m_fwdGatherPhys  = Array<OneD, int>(fwd.size());
+            for (int i = 0; i < fwd.size(); ++i)
+            {
+                m_fwdGatherTrace[i] = fwd[i].first;
+                m_fwdGatherPhys [i] = fwd[i].second;
+            }
+
+            m_bwdGatherTrace = Array<OneD, int>(bwd.size());
+            m_bwdGatherPhys  = Array<OneD, int>(bwd.size());
+            for (int i = 0; i < bwd.size(); ++i)
+            {
+                m_bwdGatherTrace[i] = bwd[i].first;
+                m_bwdGatherPhys [i] = bwd[i].second;
+            }
+        }
+
+        /**
+         * @brief Determines, for each element trace, the element coefficient
+         * and sign into which each trace coefficient of the trace integral is
+         * added.
+         *
+         * Where the trace and element have the same number of trace modes,
+         * the elemental trace integral is the inner product over the trace
+         * element followed by the trace-to-element index map, possibly
+         * negated to obtain an outwards normal. The sign is identified by
+         * comparing against the elemental routine.
+         */
+        void LocTraceToTraceMap::SetUpScatter(
+            const std::vector<TraceEntity> &entities)
+        {
+            std::vector<int>       fwdTrace, fwdCoeff, bwdTrace, bwdCoeff;
+            std::vector<NekDouble> fwdSign, bwdSign;
+            const NekDouble        tol = 1e-10;
+
+            for (int k = 0; k < entities.size(); ++k)
+            {
+                const TraceEntity &ent = entities[k];
+                const LocalRegions::ExpansionSharedPtr &elmt = ent.m_elmt;
+
+                StdRegions::IndexMapKey ikey = m_expDim == 3 ?
+                    StdRegions::IndexMapKey(
+                        StdRegions::eFaceToElement, elmt->DetShapeType(),
+                        elmt->GetBasisNumModes(0), elmt->GetBasisNumModes(1),
+                        elmt->GetBasisNumModes(2), ent.m_id,
+                        elmt->GetForient(ent.m_id)) :
+                    StdRegions::IndexMapKey(
+                        StdRegions::eEdgeToElement, elmt->DetShapeType(),
+                        elmt->GetBasisNumModes(0), elmt->GetBasisNumModes(1),
+                        0, ent.m_id, elmt->GetEorient(ent.m_id));
+                StdRegions::IndexMapValuesSharedPtr map =
+                    elmt->GetIndexMap(ikey);
+
+                int nTraceCoeffs = ent.m_trace->GetNcoeffs();
+                int nTracePts    = ent.m_trace->GetTotPoints();
+                int nElmtCoeffs  = elmt->GetNcoeffs();
+
+                if (map->num_elements() != nTraceCoeffs)
+                {
+                    m_scatterFallback.push_back(ent);
+                    continue;
+                }
+
+                Array<OneD, NekDouble> Fn(nTracePts);
+                for (int j = 0; j < nTracePts; ++j)
+                {
+                    Fn[j] = sqrt(j + 2.0);
+                }
+
+                TraceEntity local = ent;
+                local.m_tracePhysOffset = 0;
+                local.m_coeffOffset     = 0;
+
+                Array<OneD, NekDouble> actual(nElmtCoeffs, 0.0);
+                AddTraceInt(local, Fn, actual);
+
+                Array<OneD, NekDouble> traceCoeffs(nTraceCoeffs);
+                Array<OneD, NekDouble> predicted  (nElmtCoeffs, 0.0);
+                ent.m_trace->IProductWRTBase(Fn, traceCoeffs);
+                for (int i = 0; i < nTraceCoeffs; ++i)
+                {
+                    predicted[(*map)[i].index] +=
+                        (*map)[i].sign * traceCoeffs[i];
+                }
+
+                NekDouble scale  = std::max(1.0,
+                    Vmath::Vamax(nElmtCoeffs, predicted, 1));
+                NekDouble errPos = 0.0, errNeg = 0.0;
+                for (int i = 0; i < nElmtCoeffs; ++i)
+                {
+                    errPos = std::max(errPos, fabs(actual[i] - predicted[i]));
+                    errNeg = std::max(errNeg, fabs(actual[i] + predicted[i]));
+                }
+
+                NekDouble sign;
+                if (errPos <= tol * scale)
+                {
+                    sign = 1.0;
+                }
+                else if (errNeg <= tol * scale)
+                {
+                    sign = -1.0;
+                }
+                else
+                {
+                    m_scatterFallback.push_back(ent);
+                    continue;
+                }
+
+                int traceOffset = m_trace->GetCoeff_Offset(
+                    ent.m_trace->GetElmtId());
+
+                std::vector<int>       &t = ent.m_fwd ? fwdTrace : bwdTrace;
+                std::vector<int>       &c = ent.m_fwd ? fwdCoeff : bwdCoeff;
+                std::vector<NekDouble> &s = ent.m_fwd ? fwdSign  : bwdSign;
+                for (int i = 0; i < nTraceCoeffs; ++i)
+                {
+                    t.push_back(traceOffset + i);
+                    c.push_back(ent.m_coeffOffset + (*map)[i].index);
+                    s.push_back(sign * (*map)[i].sign);
+                }
+            }
+
+            m_fwdScatterTrace = Array<OneD, int>      (fwdTrace.size());
+            m_fwdScatterCoeff = Array<OneD, int>      (fwdTrace.size());
+            m_fwdScatterSign  = Array<OneD, NekDouble>(fwdTrace.size());
+            for (int i = 0; i < fwdTrace.size(); ++i)
+            {
+                m_fwdScatterTrace[i] = fwdTrace[i];
+                m_fwdScatterCoeff[i] = fwdCoeff[i];
+                m_fwdScatterSign [i] = fwdSign [i];
+            }
+
+            m_bwdScatterTrace = Array<OneD, int>      (bwdTrace.size());
+            m_bwdScatterCoeff = Array<OneD, int>      (bwdTrace.size());
+            m_bwdScatterSign  = Array<OneD, NekDouble>(bwdTrace.size());
+            for (int i = 0; i < bwdTrace.size(); ++i)
+            {
+                m_bwdScatterTrace[i] = bwdTrace[i];
+                m_bwdScatterCoeff[i] = bwdCoeff[i];
+                m_bwdScatterSign [i] = bwdSign [i];
+            }
+        }
+
+        /**
+         * @brief Extracts the forwards and backwards trace values of @a field.
+         *
+         * Both @a Fwd and @a Bwd are zeroed first, so that trace points
+         * without a local forwards or backwards element are zero.
+         */
+        void LocTraceToTraceMap::FwdBwdTracePhys(
+            const Array<OneD, const NekDouble> &field,
+                  Array<OneD,       NekDouble> &Fwd,
+                  Array<OneD,       NekDouble> &Bwd)
+        {
+            Vmath::Zero(Fwd.num_elements(), Fwd, 1);
+            Vmath::Zero(Bwd.num_elements(), Bwd, 1);
+
+            Gather(m_fwdGatherTrace, m_fwdGatherPhys, field, Fwd);
+            Gather(m_bwdGatherTrace, m_bwdGatherPhys, field, Bwd);
+
+            for (int k = 0; k < m_gatherFallback.size(); ++k)
+            {
+                const TraceEntity &ent = m_gatherFallback[k];
+                ExtractTrace(ent, field, ent.m_fwd ? Fwd : Bwd);
+            }
+        }
+
+        /**
+         * @brief Adds the integral of the trace quantity @a Fn over the
+         * trace of each element to its coefficients in @a outarray.
+         */
+        void LocTraceToTraceMap::AddTraceIntegral(
+            const Array<OneD, const NekDouble> &Fn,
+                  Array<OneD,       NekDouble> &outarray)
+        {
+            ASSERTL1(m_expDim > 1, "Trace integral map requires 2D or 3D "
+                     "elements.");
+
+            m_trace->IProductWRTBase(Fn, m_traceCoeffs);
+            ScatterAdd(m_fwdScatterTrace, m_fwdScatterCoeff, m_fwdScatterSign,
+                       m_traceCoeffs, outarray);
+            ScatterAdd(m_bwdScatterTrace, m_bwdScatterCoeff, m_bwdScatterSign,
+                       m_traceCoeffs, outarray);
+
+            for (int k = 0; k < m_scatterFallback.size(); ++k)
+            {
+                AddTraceInt(m_scatterFallback[k], Fn, outarray);
+            }
+        }
+
+        /**
+         * @brief As AddTraceIntegral(), but using @a Fwd for forwards element
+         * traces and @a Bwd for backwards element traces.
+         */
+        void LocTraceToTraceMap::AddFwdBwdTraceIntegral(
+            const Array<OneD, const NekDouble> &Fwd,
+            const Array<OneD, const NekDouble> &Bwd,
+                  Array<OneD,       NekDouble> &outarray)
+        {
+            ASSERTL1(m_expDim > 1, "Trace integral map requires 2D or 3D "
+                     "elements.");
+
+            m_trace->IProductWRTBase(Fwd, m_traceCoeffs);
+            ScatterAdd(m_fwdScatterTrace, m_fwdScatterCoeff, m_fwdScatterSign,
+                       m_traceCoeffs, outarray);
+
+            if (m_bwdScatterTrace.num_elements() > 0)
+            {
+                m_trace->IProductWRTBase(Bwd, m_traceCoeffs);
+                ScatterAdd(m_bwdScatterTrace, m_bwdScatterCoeff,
+                           m_bwdScatterSign, m_traceCoeffs, outarray);
+            }
+
+            for (int k = 0; k < m_scatterFallback.size(); ++k)
+            {
+                const TraceEntity &ent = m_scatterFallback[k];
+                AddTraceInt(ent, ent.m_fwd ? Fwd : Bwd, outarray);
+            }
+        }
+
+        void LocTraceToTraceMap::ExtractTrace(
+            const TraceEntity                  &ent,
+            const Array<OneD, const NekDouble> &field,
+                  Array<OneD,       NekDouble> &out)
+        {
+            Array<OneD, NekDouble> tmp;
+
+            switch (m_expDim)
+            {
+                case 1:
+                    ent.m_elmt->GetVertexPhysVals(
+                        ent.m_id, field + ent.m_physOffset,
+                        out[ent.m_tracePhysOffset]);
+                    break;
+                case 2:
+                    ent.m_elmt->GetEdgePhysVals(
+                        ent.m_id, ent.m_trace, field + ent.m_physOffset,
+                        tmp = out + ent.m_tracePhysOffset);
+                    break;
+                case 3:
+                    ent.m_elmt->GetFacePhysVals(
+                        ent.m_id, ent.m_trace, field + ent.m_physOffset,
+                        tmp = out + ent.m_tracePhysOffset);
+                    break;
+                default:
+                    ASSERTL0(false, "Unsupported expansion dimension.");
+            }
+        }
+
+        void LocTraceToTraceMap::AddTraceInt(
+            const TraceEntity                  &ent,
+            const Array<OneD, const NekDouble> &Fn,
+                  Array<OneD,       NekDouble> &outarray)
+        {
+            Array<OneD, NekDouble> tmp;
+
+            switch (m_expDim)
+            {
+                case 2:
+                    ent.m_elmt->AddEdgeNormBoundaryInt(
+                        ent.m_id, ent.m_trace, Fn + ent.m_tracePhysOffset,
+                        tmp = outarray + ent.m_coeffOffset);
+                    break;
+                case 3:
+                    ent.m_elmt->AddFaceNormBoundaryInt(
+                        ent.m_id, ent.m_trace, Fn + ent.m_tracePhysOffset,
+                        tmp = outarray + ent.m_coeffOffset);
+                    break;
+                default:
+                    ASSERTL0(false, "Unsupported expansion dimension.");
+            }
+        }
+    }
+}
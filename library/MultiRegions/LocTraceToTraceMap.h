@@ -0,0 +1,158 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File LocTraceToTraceMap.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Precomputed map between elemental traces and the trace space
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_MULTIREGIONS_LOCTRACETOTRACEMAP_H
+#define NEKTAR_LIB_MULTIREGIONS_LOCTRACETOTRACEMAP_H
+
+#include <vector>
+
+#include <MultiRegions/MultiRegionsDeclspec.h>
+#include <MultiRegions/ExpList.h>
+#include <LocalRegions/Expansion.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * @brief Precomputed map between the elemental traces of an ExpList
+         * and its trace space, used by the discontinuous fields.
+         *
+         * The forward and backward trace values are gathered from the
+         * physical values of the expansion through a flat list of (trace
+         * point, physical point) index pairs. Similarly, the trace integral is
+         * evaluated as a single inner product over the trace expansion,
+         * followed by a signed scatter of the trace coefficients into the
+         * elemental coefficients.
+         *
+         * Both maps are determined at construction from the existing
+         * elemental routines, so orientation is handled in exactly the same
+         * way. Element traces for which the operation is not a plain copy,
+         * such as when the trace points or polynomial order differ from the
+         * element, are recorded separately and evaluated with the elemental
+         * routines.
+         */
+        class LocTraceToTraceMap
+        {
+        public:
+            MULTI_REGIONS_EXPORT LocTraceToTraceMap(
+                const ExpList                            &locExp,
+                const ExpListSharedPtr                   &trace,
+                const Array<OneD, Array<OneD,
+                    LocalRegions::ExpansionSharedPtr> >  &elmtToTrace,
+                const std::vector<bool>                  &leftAdjacents);
+
+            MULTI_REGIONS_EXPORT virtual ~LocTraceToTraceMap();
+
+            MULTI_REGIONS_EXPORT void FwdBwdTracePhys(
+                const Array<OneD, const NekDouble> &field,
+                      Array<OneD,       NekDouble> &Fwd,
+                      Array<OneD,       NekDouble> &Bwd);
+
+            MULTI_REGIONS_EXPORT void AddTraceIntegral(
+                const Array<OneD, const NekDouble> &Fn,
+                      Array<OneD,       NekDouble> &outarray);
+
+            MULTI_REGIONS_EXPORT void AddFwdBwdTraceIntegral(
+                const Array<OneD, const NekDouble> &Fwd,
+                const Array<OneD, const NekDouble> &Bwd,
+                      Array<OneD,       NekDouble> &outarray);
+
+        private:
+            /// An element trace (vertex, edge or face) of the expansion.
+            struct TraceEntity
+            {
+                LocalRegions::ExpansionSharedPtr m_elmt;
+                LocalRegions::ExpansionSharedPtr m_trace;
+                int  m_id;
+                int  m_physOffset;
+                int  m_coeffOffset;
+                int  m_tracePhysOffset;
+                bool m_fwd;
+            };
+
+            /// Trace space.
+            ExpListSharedPtr          m_trace;
+            /// Dimension of the elements.
+            int                       m_expDim;
+
+            /// Trace point and physical point index of forwards gather.
+            Array<OneD, int>          m_fwdGatherTrace;
+            Array<OneD, int>          m_fwdGatherPhys;
+            /// Trace point and physical point index of backwards gather.
+            Array<OneD, int>          m_bwdGatherTrace;
+            Array<OneD, int>          m_bwdGatherPhys;
+            /// Element traces not expressible as a gather.
+            std::vector<TraceEntity>  m_gatherFallback;
+
+            /// Trace coefficient, element coefficient and sign of the
+            /// scatter of forwards and backwards element traces.
+            Array<OneD, int>          m_fwdScatterTrace;
+            Array<OneD, int>          m_fwdScatterCoeff;
+            Array<OneD, NekDouble>    m_fwdScatterSign;
+            Array<OneD, int>          m_bwdScatterTrace;
+            Array<OneD, int>          m_bwdScatterCoeff;
+            Array<OneD, NekDouble>    m_bwdScatterSign;
+            /// Element traces not expressible as a scatter.
+            std::vector<TraceEntity>  m_scatterFallback;
+
+            /// Workspace holding trace coefficients.
+            Array<OneD, NekDouble>    m_traceCoeffs;
+
+            void SetUpGather(
+                const std::vector<TraceEntity>     &entities,
+                const Array<OneD, const NekDouble> &probe1,
+                const Array<OneD, const NekDouble> &probe2);
+
+            void SetUpScatter(
+                const std::vector<TraceEntity>     &entities);
+
+            void ExtractTrace(
+                const TraceEntity                  &ent,
+                const Array<OneD, const NekDouble> &field,
+                      Array<OneD,       NekDouble> &out);
+
+            void AddTraceInt(
+                const TraceEntity                  &ent,
+                const Array<OneD, const NekDouble> &Fn,
+                      Array<OneD,       NekDouble> &outarray);
+        };
+
+        typedef boost::shared_ptr<LocTraceToTraceMap>
+            LocTraceToTraceMapSharedPtr;
+    }
+}
+
+#endif
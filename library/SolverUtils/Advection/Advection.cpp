@@ -98,7 +98,8 @@ void Advection::v_InitObject(
     const LibUtilities::SessionReaderSharedPtr        pSession,
     Array<OneD, MultiRegions::ExpListSharedPtr>       pFields)
 {
-    m_spaceDim = pFields[0]->GetCoordim(0);
+    m_spaceDim      = pFields[0]->GetCoordim(0);
+    m_restrictElmts = false;
 
     if (pSession->DefinesSolverInfo("HOMOGENEOUS"))
     {
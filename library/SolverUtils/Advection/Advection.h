@@ -43,6 +43,7 @@
 #include <LibUtilities/BasicUtils/SharedArray.hpp>
 #include <MultiRegions/ExpList.h>
 #include <SolverUtils/SolverUtilsDeclspec.h>
+#include <SolverUtils/Core/WorkspaceArena.h>
 #include <SolverUtils/RiemannSolvers/RiemannSolver.h>
 
 namespace Nektar
@@ -126,6 +127,35 @@ public:
         v_SetBaseFlow(inarray);
     }
 
+    /**
+     * @brief Restrict the element-wise terms of subsequent calls to Advect
+     * to the listed elements.
+     *
+     * This is used by multirate time integration, which only requires the
+     * advection term on the elements of the rate groups being advanced. The
+     * advection term on the remaining elements is left undefined. Schemes
+     * which do not support the restriction evaluate all elements.
+     *
+     * @param elmts  Indices of the elements to evaluate.
+     */
+    inline void SetActiveElmts(const Array<OneD, const int> &elmts)
+    {
+        m_activeElmts   = elmts;
+        m_restrictElmts = true;
+    }
+
+    /// Evaluate subsequent calls to Advect on all elements.
+    inline void ClearActiveElmts()
+    {
+        m_restrictElmts = false;
+    }
+
+    /// Returns the workspace used for temporaries of Advection::Advect.
+    inline const WorkspaceArena &GetWorkspace() const
+    {
+        return m_workspace;
+    }
+
 protected:
     /// Callback function to the flux vector (set when advection is in
     /// conservative form).
@@ -134,6 +164,12 @@ protected:
     RiemannSolverSharedPtr m_riemann;
     /// Storage for space dimension. Used for homogeneous extension.
     int                    m_spaceDim;
+    /// Workspace for temporaries of v_Advect.
+    WorkspaceArena         m_workspace;
+    /// Elements to evaluate if #m_restrictElmts is set.
+    Array<OneD, const int> m_activeElmts;
+    /// Indicates if only the elements #m_activeElmts are evaluated.
+    bool                   m_restrictElmts;
 
     /// Initialises the advection object.
     SOLVER_UTILS_EXPORT virtual void v_InitObject(
@@ -93,6 +93,16 @@ namespace Nektar
             Advection::v_InitObject(pSession, pFields);
             v_SetupMetrics         (pSession, pFields);
             v_SetupCFunctions      (pSession, pFields);
+
+            // Flux vector, coefficient and trace storage of v_Advect, plus
+            // the six solution-sized temporaries of the 2D divergence.
+            int nVariables   = pFields.num_elements();
+            int nSolutionPts = pFields[0]->GetTotPoints();
+            m_workspace.Reserve(
+                nVariables * (m_spaceDim * nSolutionPts +
+                              pFields[0]->GetNcoeffs() +
+                              3 * pFields[0]->GetTrace()->GetTotPoints()) +
+                6 * nSolutionPts);
         }
         
         /**
@@ -818,35 +828,31 @@ namespace Nektar
             int nTracePts    = fields[0]->GetTrace()->GetTotPoints();
             int nCoeffs      = fields[0]->GetNcoeffs();
             
+            WorkspaceArena::Scope scope(m_workspace);
+
             // Storage for flux vector.
             Array<OneD, Array<OneD, Array<OneD, NekDouble> > > fluxvector
                                                         (nConvectiveFields);
             // Outarray for Galerkin projection in case of primitive dealising
-            Array<OneD, Array<OneD, NekDouble> > outarrayCoeff
-                                                        (nConvectiveFields);
+            Array<OneD, Array<OneD, NekDouble> > outarrayCoeff =
+                m_workspace.AllocateVector(nConvectiveFields, nCoeffs);
             // Store forwards/backwards space along trace space
-            Array<OneD, Array<OneD, NekDouble> > Fwd    (nConvectiveFields);
-            Array<OneD, Array<OneD, NekDouble> > Bwd    (nConvectiveFields);
-            Array<OneD, Array<OneD, NekDouble> > numflux(nConvectiveFields);
+            Array<OneD, Array<OneD, NekDouble> > Fwd     =
+                m_workspace.AllocateVector(nConvectiveFields, nTracePts);
+            Array<OneD, Array<OneD, NekDouble> > Bwd     =
+                m_workspace.AllocateVector(nConvectiveFields, nTracePts);
+            Array<OneD, Array<OneD, NekDouble> > numflux =
+                m_workspace.AllocateVector(nConvectiveFields, nTracePts);
 
             // Set up storage for flux vector.
             for (i = 0; i < nConvectiveFields; ++i)
             {
-                fluxvector[i] =
-                    Array<OneD, Array<OneD, NekDouble> >(m_spaceDim);
-
-                for (j = 0; j < m_spaceDim; ++j)
-                {
-                    fluxvector[i][j] = Array<OneD, NekDouble>(nSolutionPts);
-                }
+                fluxvector[i] = m_workspace.AllocateVector(
+                    m_spaceDim, nSolutionPts, 0.0);
             }
 
             for (i = 0; i < nConvectiveFields; ++i)
             {
-                outarrayCoeff[i] = Array<OneD, NekDouble>(nCoeffs);
-                Fwd[i]           = Array<OneD, NekDouble>(nTracePts);
-                Bwd[i]           = Array<OneD, NekDouble>(nTracePts);
-                numflux[i]       = Array<OneD, NekDouble>(nTracePts);
                 fields[i]->GetFwdBwdTracePhys(inarray[i], Fwd[i], Bwd[i]);
             }
 
@@ -859,8 +865,10 @@ namespace Nektar
                 // 1D problems 
                 case 1:
                 {  
-                    Array<OneD, NekDouble> DfluxvectorX1(nSolutionPts);
-                    Array<OneD, NekDouble> divFC        (nSolutionPts);
+                    Array<OneD, NekDouble> DfluxvectorX1 =
+                        m_workspace.Allocate(nSolutionPts);
+                    Array<OneD, NekDouble> divFC         =
+                        m_workspace.Allocate(nSolutionPts);
            
                     // Get the advection flux vector (solver specific)
                     m_fluxVector(inarray, fluxvector);
@@ -901,20 +909,26 @@ namespace Nektar
                 // 2D problems 
                 case 2:
                 {
-                    Array<OneD, NekDouble> DfluxvectorX1(nSolutionPts);
-                    Array<OneD, NekDouble> DfluxvectorX2(nSolutionPts);
-                    Array<OneD, NekDouble> divFD(nSolutionPts);
-                    Array<OneD, NekDouble> divFC(nSolutionPts);
+                    Array<OneD, NekDouble> DfluxvectorX1 =
+                        m_workspace.Allocate(nSolutionPts);
+                    Array<OneD, NekDouble> DfluxvectorX2 =
+                        m_workspace.Allocate(nSolutionPts);
+                    Array<OneD, NekDouble> divFD =
+                        m_workspace.Allocate(nSolutionPts);
+                    Array<OneD, NekDouble> divFC =
+                        m_workspace.Allocate(nSolutionPts);
+
+                    // Temporary vectors, overwritten for each field
+                    Array<OneD, NekDouble> f_hat =
+                        m_workspace.Allocate(nSolutionPts);
+                    Array<OneD, NekDouble> g_hat =
+                        m_workspace.Allocate(nSolutionPts);
 
                     // Get the advection flux vector (solver specific)
                     m_fluxVector(inarray, fluxvector);
 
                     for (i = 0; i < nConvectiveFields; ++i)
                     {
-                        // Temporary vectors
-                        Array<OneD, NekDouble> f_hat(nSolutionPts);
-                        Array<OneD, NekDouble> g_hat(nSolutionPts);
-                        
                         Vmath::Vvtvvtp(nSolutionPts, 
                                        &m_gmat[0][0], 1, 
                                        &fluxvector[i][0][0], 1,
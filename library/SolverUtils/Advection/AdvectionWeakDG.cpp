@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <SolverUtils/Advection/AdvectionWeakDG.h>
+#include <LocalRegions/MatrixKey.h>
 #include <iostream>
 #include <iomanip>
 
@@ -60,6 +61,13 @@ namespace Nektar
             Array<OneD, MultiRegions::ExpListSharedPtr> pFields)
         {
             Advection::v_InitObject(pSession, pFields);
+
+            // Flux vector, coefficients and trace storage of v_Advect.
+            int nVariables = pFields.num_elements();
+            m_workspace.Reserve(nVariables * (
+                m_spaceDim * pFields[0]->GetTotPoints() +
+                pFields[0]->GetNcoeffs() +
+                3 * pFields[0]->GetTrace()->GetTotPoints()));
         }
 
         /**
@@ -84,9 +92,12 @@ namespace Nektar
             int nPointsTot      = fields[0]->GetTotPoints();
             int nCoeffs         = fields[0]->GetNcoeffs();
             int nTracePointsTot = fields[0]->GetTrace()->GetTotPoints();
-            int i, j;
-            
-            Array<OneD, Array<OneD, NekDouble> > tmp(nConvectiveFields);
+            int i;
+
+            WorkspaceArena::Scope scope(m_workspace);
+
+            Array<OneD, Array<OneD, NekDouble> > tmp =
+                m_workspace.AllocateVector(nConvectiveFields, nCoeffs, 0.0);
             Array<OneD, Array<OneD, Array<OneD, NekDouble> > > fluxvector(
                 nConvectiveFields);
 
@@ -94,11 +105,7 @@ namespace Nektar
             for (i = 0; i < nConvectiveFields; ++i)
             {
                 fluxvector[i] =
-                    Array<OneD, Array<OneD, NekDouble> >(m_spaceDim);
-                for (j = 0; j < m_spaceDim; ++j)
-                {
-                    fluxvector[i][j] = Array<OneD, NekDouble>(nPointsTot);
-                }
+                    m_workspace.AllocateVector(m_spaceDim, nPointsTot, 0.0);
             }
 
             ASSERTL1(m_riemann,
@@ -109,21 +116,29 @@ namespace Nektar
             // Get the advection part (without numerical flux)
             for(i = 0; i < nConvectiveFields; ++i)
             {
-                tmp[i] = Array<OneD, NekDouble>(nCoeffs, 0.0);
-
-                fields[i]->IProductWRTDerivBase(fluxvector[i],tmp[i]);
+                if (m_restrictElmts)
+                {
+                    IProductWRTDerivBaseElmts(fields[i], fluxvector[i], tmp[i]);
+                }
+                else
+                {
+                    fields[i]->IProductWRTDerivBase(fluxvector[i],tmp[i]);
+                }
             }
 
             // Store forwards/backwards space along trace space
-            Array<OneD, Array<OneD, NekDouble> > Fwd    (nConvectiveFields);
-            Array<OneD, Array<OneD, NekDouble> > Bwd    (nConvectiveFields);
-            Array<OneD, Array<OneD, NekDouble> > numflux(nConvectiveFields);
+            Array<OneD, Array<OneD, NekDouble> > Fwd     =
+                m_workspace.AllocateVector(
+                    nConvectiveFields, nTracePointsTot, 0.0);
+            Array<OneD, Array<OneD, NekDouble> > Bwd     =
+                m_workspace.AllocateVector(
+                    nConvectiveFields, nTracePointsTot, 0.0);
+            Array<OneD, Array<OneD, NekDouble> > numflux =
+                m_workspace.AllocateVector(
+                    nConvectiveFields, nTracePointsTot, 0.0);
 
             for(i = 0; i < nConvectiveFields; ++i)
             {
-                Fwd[i]     = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
-                Bwd[i]     = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
-                numflux[i] = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
                 fields[i]->GetFwdBwdTracePhys(inarray[i], Fwd[i], Bwd[i]);
             }
 
@@ -134,8 +149,86 @@ namespace Nektar
             {
                 Vmath::Neg                      (nCoeffs, tmp[i], 1);
                 fields[i]->AddTraceIntegral     (numflux[i], tmp[i]);
-                fields[i]->MultiplyByElmtInvMass(tmp[i], tmp[i]);
-                fields[i]->BwdTrans             (tmp[i], outarray[i]);
+
+                if (m_restrictElmts)
+                {
+                    InvMassBwdTransElmts(fields[i], tmp[i], outarray[i]);
+                }
+                else
+                {
+                    fields[i]->MultiplyByElmtInvMass(tmp[i], tmp[i]);
+                    fields[i]->BwdTrans             (tmp[i], outarray[i]);
+                }
+            }
+        }
+
+        /**
+         * @brief Inner product of the flux vector with respect to the
+         * derivative of the basis on the active elements only.
+         *
+         * The coefficients of the remaining elements are left unchanged.
+         */
+        void AdvectionWeakDG::IProductWRTDerivBaseElmts(
+            const MultiRegions::ExpListSharedPtr       &field,
+            const Array<OneD, Array<OneD, NekDouble> > &fluxvector,
+                  Array<OneD, NekDouble>               &outarray)
+        {
+            int nDim = field->GetCoordim(0);
+            Array<OneD, NekDouble> tmp;
+
+            for (int n = 0; n < m_activeElmts.num_elements(); ++n)
+            {
+                int e        = m_activeElmts[n];
+                int physOff  = field->GetPhys_Offset(e);
+                int coeffOff = field->GetCoeff_Offset(e);
+                LocalRegions::ExpansionSharedPtr exp = field->GetExp(e);
+                int nElmtCoeffs = exp->GetNcoeffs();
+
+                WorkspaceArena::Scope scope(m_workspace);
+                Array<OneD, NekDouble> wsp = m_workspace.Allocate(nElmtCoeffs);
+
+                exp->IProductWRTDerivBase(0, fluxvector[0] + physOff,
+                                          tmp = outarray + coeffOff);
+
+                for (int j = 1; j < nDim; ++j)
+                {
+                    exp->IProductWRTDerivBase(j, fluxvector[j] + physOff, wsp);
+                    Vmath::Vadd(nElmtCoeffs, wsp, 1, tmp, 1, tmp, 1);
+                }
+            }
+        }
+
+        /**
+         * @brief Multiply by the inverse elemental mass matrix and transform
+         * to physical space on the active elements only.
+         *
+         * The coefficients of the active elements are overwritten, and the
+         * physical values of the remaining elements are left unchanged.
+         */
+        void AdvectionWeakDG::InvMassBwdTransElmts(
+            const MultiRegions::ExpListSharedPtr       &field,
+                  Array<OneD, NekDouble>               &coeffs,
+                  Array<OneD, NekDouble>               &outarray)
+        {
+            Array<OneD, NekDouble> tmp, tmp2;
+
+            for (int n = 0; n < m_activeElmts.num_elements(); ++n)
+            {
+                int e        = m_activeElmts[n];
+                int coeffOff = field->GetCoeff_Offset(e);
+                LocalRegions::ExpansionSharedPtr exp = field->GetExp(e);
+                int nElmtCoeffs = exp->GetNcoeffs();
+
+                LocalRegions::MatrixKey mkey(
+                    StdRegions::eInvMass, exp->DetShapeType(), *exp);
+                DNekScalMatSharedPtr invMass = exp->GetLocMatrix(mkey);
+
+                NekVector<NekDouble> in (nElmtCoeffs, coeffs + coeffOff);
+                NekVector<NekDouble> out(nElmtCoeffs,
+                                         tmp = coeffs + coeffOff, eWrapper);
+                out = (*invMass) * in;
+
+                exp->BwdTrans(tmp, tmp2 = outarray + field->GetPhys_Offset(e));
             }
         }
     }//end of namespace SolverUtils
@@ -66,6 +66,17 @@ namespace Nektar
                 const Array<OneD, Array<OneD, NekDouble> >        &inarray,
                       Array<OneD, Array<OneD, NekDouble> >        &outarray,
                 const NekDouble                                   &time);
+
+        private:
+            void IProductWRTDerivBaseElmts(
+                const MultiRegions::ExpListSharedPtr       &field,
+                const Array<OneD, Array<OneD, NekDouble> > &fluxvector,
+                      Array<OneD, NekDouble>               &outarray);
+
+            void InvMassBwdTransElmts(
+                const MultiRegions::ExpListSharedPtr       &field,
+                      Array<OneD, NekDouble>               &coeffs,
+                      Array<OneD, NekDouble>               &outarray);
         };
     }
 }
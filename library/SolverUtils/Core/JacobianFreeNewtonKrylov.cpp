@@ -0,0 +1,774 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: JacobianFreeNewtonKrylov.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Jacobian-free Newton-Krylov solver for implicit stages
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <map>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/cstdint.hpp>
+
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+#include <LibUtilities/LinearAlgebra/Lapack.hpp>
+#include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
+#include <SolverUtils/Core/JacobianFreeNewtonKrylov.h>
+
+using namespace std;
+
+namespace Nektar {
+namespace SolverUtils {
+
+    /**
+     * @param session  Session defining the solver parameters.
+     * @param field    Field defining the elements and quadrature points.
+     * @param ode      Operators of the system, of which the projection and
+     *                 the right-hand side are used.
+     */
+    JacobianFreeNewtonKrylov::JacobianFreeNewtonKrylov(
+        const LibUtilities::SessionReaderSharedPtr         &session,
+        const MultiRegions::ExpListSharedPtr               &field,
+        const LibUtilities::TimeIntegrationSchemeOperators &ode)
+        : m_field             (field),
+          m_ode               (ode),
+          m_comm              (session->GetComm()),
+          m_nVar              (0),
+          m_nPts              (field->GetTotPoints()),
+          m_nDofs             (0),
+          m_nColours          (0),
+          m_precLambda        (0.0),
+          m_solvesSinceRebuild(0),
+          m_nNewtonIts        (0),
+          m_nKrylovIts        (0),
+          m_nRhsEvals         (0)
+    {
+        m_verbose = session->DefinesCmdLineArgument("verbose") &&
+                    m_comm->GetRank() == 0;
+
+        session->LoadParameter("JFNKNewtonTolerance",      m_newtonTol, 1e-6);
+        session->LoadParameter("JFNKNewtonMaxIterations",  m_maxNewtonIts, 10);
+        session->LoadParameter("JFNKKrylovTolerance",      m_krylovTol, 1e-2);
+        session->LoadParameter("JFNKKrylovDimension",      m_krylovDim, 30);
+        session->LoadParameter("JFNKKrylovMaxIterations",  m_maxKrylovIts, 200);
+        session->LoadParameter("JFNKPreconditionerUpdate", m_precondUpdate, 10);
+
+        string precon;
+        session->LoadSolverInfo("JFNKPreconditioner", precon, "BlockJacobi");
+        if (boost::iequals(precon, "BlockJacobi"))
+        {
+            m_blockJacobi = true;
+        }
+        else
+        {
+            ASSERTL0(boost::iequals(precon, "None"),
+                     "Unknown JFNKPreconditioner '" + precon + "'.");
+            m_blockJacobi = false;
+        }
+
+        ASSERTL0(m_krylovDim > 0, "JFNKKrylovDimension must be positive.");
+    }
+
+    /**
+     * @param rhs     Right-hand side \f$\boldsymbol{b}\f$, also used as
+     *                the initial guess.
+     * @param y       Solution.
+     * @param time    Time at which the right-hand side is evaluated.
+     * @param lambda  Coefficient \f$\lambda\f$ of the right-hand side.
+     */
+    void JacobianFreeNewtonKrylov::Solve(
+        const Array<OneD, const Array<OneD, NekDouble> > &rhs,
+              Array<OneD,       Array<OneD, NekDouble> > &y,
+        const NekDouble                                   time,
+        const NekDouble                                   lambda)
+    {
+        int i, it;
+
+        if (rhs.num_elements() != m_nVar)
+        {
+            Initialise(rhs.num_elements());
+        }
+
+        for (i = 0; i < m_nVar; ++i)
+        {
+            Vmath::Vcopy(m_nPts, &rhs[i][0], 1, &m_rhs[i * m_nPts], 1);
+            Vmath::Vcopy(m_nPts, &rhs[i][0], 1, &m_y  [i * m_nPts], 1);
+        }
+        NekDouble rhsNorm = sqrt(Dot(m_rhs, m_rhs));
+
+        bool rebuild = m_blockJacobi && (m_jacBlocks.empty() ||
+                                         m_solvesSinceRebuild >= m_precondUpdate);
+
+        NekDouble resNorm0 = 0.0, resNorm = 0.0;
+        int nKrylov = 0;
+        bool converged = false;
+
+        for (it = 0; it < m_maxNewtonIts; ++it)
+        {
+            // Negative residual b - (y - lambda f(y))
+            EvaluateRhs(m_y, m_fy, time);
+            Vmath::Svtvp(m_nDofs, lambda, m_fy, 1, m_rhs, 1, m_res, 1);
+            Vmath::Vsub (m_nDofs, m_res, 1, m_y, 1, m_res, 1);
+
+            resNorm = sqrt(Dot(m_res, m_res));
+            if (it == 0)
+            {
+                resNorm0 = resNorm;
+            }
+
+            if (resNorm <= m_newtonTol * resNorm0 ||
+                resNorm <= NekConstants::kNekZeroTol * rhsNorm)
+            {
+                converged = true;
+                break;
+            }
+
+            if (rebuild)
+            {
+                BuildPreconditioner(time);
+                rebuild = false;
+            }
+            if (m_blockJacobi && lambda != m_precLambda)
+            {
+                FactorPreconditioner(lambda);
+            }
+
+            nKrylov += Gmres(m_res, m_delta, time, lambda, m_krylovTol);
+            Vmath::Vadd(m_nDofs, m_y, 1, m_delta, 1, m_y, 1);
+        }
+
+        for (i = 0; i < m_nVar; ++i)
+        {
+            Vmath::Vcopy(m_nPts, &m_y[i * m_nPts], 1, &y[i][0], 1);
+        }
+
+        m_nNewtonIts += it;
+        m_nKrylovIts += nKrylov;
+        ++m_solvesSinceRebuild;
+
+        if (!converged)
+        {
+            // Rebuild the preconditioner for the next solve.
+            m_solvesSinceRebuild = m_precondUpdate;
+        }
+
+        if (m_verbose)
+        {
+            cout << "JFNK: Newton iterations = " << it
+                 << ", GMRES iterations = " << nKrylov
+                 << " (residual = " << resNorm / max(resNorm0, 1e-300)
+                 << (converged ? "" : ", not converged") << ")" << endl;
+        }
+    }
+
+    void JacobianFreeNewtonKrylov::Initialise(int nVar)
+    {
+        int i;
+
+        m_nVar  = nVar;
+        m_nDofs = m_nVar * m_nPts;
+
+        m_rhs   = Array<OneD, NekDouble>(m_nDofs, 0.0);
+        m_y     = Array<OneD, NekDouble>(m_nDofs, 0.0);
+        m_fy    = Array<OneD, NekDouble>(m_nDofs, 0.0);
+        m_res   = Array<OneD, NekDouble>(m_nDofs, 0.0);
+        m_delta = Array<OneD, NekDouble>(m_nDofs, 0.0);
+        m_pert  = Array<OneD, NekDouble>(m_nDofs, 0.0);
+        m_fpert = Array<OneD, NekDouble>(m_nDofs, 0.0);
+        m_tmp   = Array<OneD, NekDouble>(m_nDofs, 0.0);
+
+        m_in   = Array<OneD, Array<OneD, NekDouble> >(m_nVar);
+        m_proj = Array<OneD, Array<OneD, NekDouble> >(m_nVar);
+        m_out  = Array<OneD, Array<OneD, NekDouble> >(m_nVar);
+        for (i = 0; i < m_nVar; ++i)
+        {
+            m_in  [i] = Array<OneD, NekDouble>(m_nPts, 0.0);
+            m_proj[i] = Array<OneD, NekDouble>(m_nPts, 0.0);
+            m_out [i] = Array<OneD, NekDouble>(m_nPts, 0.0);
+        }
+
+        m_basis.resize(m_krylovDim + 1);
+        for (i = 0; i <= m_krylovDim; ++i)
+        {
+            m_basis[i] = Array<OneD, NekDouble>(m_nDofs, 0.0);
+        }
+
+        m_jacBlocks .clear();
+        m_precBlocks.clear();
+        m_precPivots.clear();
+
+        if (m_blockJacobi)
+        {
+            ColourElements();
+        }
+    }
+
+    void JacobianFreeNewtonKrylov::EvaluateRhs(
+        const Array<OneD, const NekDouble> &y,
+              Array<OneD,       NekDouble> &f,
+        const NekDouble                     time)
+    {
+        for (int i = 0; i < m_nVar; ++i)
+        {
+            Vmath::Vcopy(m_nPts, &y[i * m_nPts], 1, &m_in[i][0], 1);
+        }
+
+        m_ode.DoProjection(m_in, m_proj, time);
+        m_ode.DoOdeRhs    (m_proj, m_out, time);
+
+        for (int i = 0; i < m_nVar; ++i)
+        {
+            Vmath::Vcopy(m_nPts, &m_out[i][0], 1, &f[i * m_nPts], 1);
+        }
+
+        ++m_nRhsEvals;
+    }
+
+    /**
+     * Approximate \f$ (I - \lambda J) \boldsymbol{v} \f$ by a first-order
+     * finite difference of the right-hand side about #m_y, the right-hand
+     * side of which is #m_fy.
+     */
+    void JacobianFreeNewtonKrylov::ApplyJacobian(
+        const Array<OneD, const NekDouble> &v,
+              Array<OneD,       NekDouble> &out,
+        const NekDouble                     time,
+        const NekDouble                     lambda)
+    {
+        NekDouble vNorm = sqrt(Dot(v, v));
+        if (vNorm == 0.0)
+        {
+            Vmath::Zero(m_nDofs, out, 1);
+            return;
+        }
+
+        NekDouble yNorm = sqrt(Dot(m_y, m_y));
+        NekDouble eps   = sqrt(numeric_limits<NekDouble>::epsilon() *
+                               (1.0 + yNorm)) / vNorm;
+
+        Vmath::Svtvp(m_nDofs, eps, v, 1, m_y, 1, m_pert, 1);
+        EvaluateRhs(m_pert, m_fpert, time);
+
+        // out = v - lambda (f(y + eps v) - f(y)) / eps
+        Vmath::Vsub   (m_nDofs, m_fpert, 1, m_fy, 1, out, 1);
+        Vmath::Svtsvtp(m_nDofs, 1.0, v, 1, -lambda / eps, out, 1, out, 1);
+    }
+
+    void JacobianFreeNewtonKrylov::ApplyPreconditioner(
+        const Array<OneD, const NekDouble> &in,
+              Array<OneD,       NekDouble> &out)
+    {
+        if (!m_blockJacobi)
+        {
+            Vmath::Vcopy(m_nDofs, in, 1, out, 1);
+            return;
+        }
+
+        int nElmts = m_field->GetExpSize();
+        for (int e = 0; e < nElmts; ++e)
+        {
+            int offset = m_field->GetPhys_Offset(e);
+            int nq     = m_field->GetExp(e)->GetTotPoints();
+            int nb     = m_nVar * nq;
+            int info;
+
+            for (int i = 0; i < m_nVar; ++i)
+            {
+                Vmath::Vcopy(nq, &in[i * m_nPts + offset], 1,
+                                 &m_blockWork[i * nq], 1);
+            }
+
+            Lapack::Dgetrs('N', nb, 1, m_precBlocks[e].get(), nb,
+                           m_precPivots[e].get(), m_blockWork.get(), nb,
+                           info);
+            ASSERTL1(info == 0, "Preconditioner block solve failed.");
+
+            for (int i = 0; i < m_nVar; ++i)
+            {
+                Vmath::Vcopy(nq, &m_blockWork[i * nq], 1,
+                                 &out[i * m_nPts + offset], 1);
+            }
+        }
+    }
+
+    /**
+     * Restarted GMRES with right preconditioning for the Newton correction
+     * \f$ (I - \lambda J) \boldsymbol{x} = \boldsymbol{b} \f$, starting from
+     * zero. Returns the number of iterations.
+     */
+    int JacobianFreeNewtonKrylov::Gmres(
+        const Array<OneD, const NekDouble> &b,
+              Array<OneD,       NekDouble> &x,
+        const NekDouble                     time,
+        const NekDouble                     lambda,
+        const NekDouble                     tol)
+    {
+        int i, j, k = 0, nIts = 0;
+        int m = m_krylovDim;
+
+        Array<TwoD, NekDouble> H (m + 1, m, 0.0);
+        Array<OneD, NekDouble> cs(m, 0.0), sn(m, 0.0), g(m + 1, 0.0);
+
+        Vmath::Zero(m_nDofs, x, 1);
+
+        NekDouble bNorm = sqrt(Dot(b, b));
+        if (bNorm == 0.0)
+        {
+            return 0;
+        }
+
+        NekDouble target = tol * bNorm;
+        NekDouble resid  = bNorm;
+        bool      first  = true;
+
+        while (nIts < m_maxKrylovIts)
+        {
+            // Residual of the current iterate
+            if (first)
+            {
+                Vmath::Vcopy(m_nDofs, b, 1, m_basis[0], 1);
+                first = false;
+            }
+            else
+            {
+                ApplyJacobian(x, m_basis[0], time, lambda);
+                Vmath::Vsub(m_nDofs, b, 1, m_basis[0], 1, m_basis[0], 1);
+            }
+
+            NekDouble beta = sqrt(Dot(m_basis[0], m_basis[0]));
+            if (beta <= target)
+            {
+                break;
+            }
+
+            Vmath::Smul(m_nDofs, 1.0 / beta, m_basis[0], 1, m_basis[0], 1);
+            Vmath::Zero(m + 1, g, 1);
+            g[0] = beta;
+
+            for (k = 0; k < m && nIts < m_maxKrylovIts; )
+            {
+                j = k;
+                ApplyPreconditioner(m_basis[j], m_tmp);
+                ApplyJacobian(m_tmp, m_basis[j + 1], time, lambda);
+
+                // Modified Gram-Schmidt orthogonalisation
+                for (i = 0; i <= j; ++i)
+                {
+                    H[i][j] = Dot(m_basis[j + 1], m_basis[i]);
+                    Vmath::Svtvp(m_nDofs, -H[i][j], m_basis[i], 1,
+                                 m_basis[j + 1], 1, m_basis[j + 1], 1);
+                }
+                H[j + 1][j] = sqrt(Dot(m_basis[j + 1], m_basis[j + 1]));
+                if (H[j + 1][j] > 0.0)
+                {
+                    Vmath::Smul(m_nDofs, 1.0 / H[j + 1][j], m_basis[j + 1], 1,
+                                m_basis[j + 1], 1);
+                }
+
+                // Apply the previous Givens rotations to the new column and
+                // eliminate its subdiagonal entry.
+                for (i = 0; i < j; ++i)
+                {
+                    NekDouble tmp = cs[i] * H[i][j] + sn[i] * H[i + 1][j];
+                    H[i + 1][j]   = cs[i] * H[i + 1][j] - sn[i] * H[i][j];
+                    H[i][j]       = tmp;
+                }
+
+                NekDouble r = sqrt(H[j][j] * H[j][j] +
+                                   H[j + 1][j] * H[j + 1][j]);
+                cs[j] = r > 0.0 ? H[j][j] / r : 1.0;
+                sn[j] = r > 0.0 ? H[j + 1][j] / r : 0.0;
+                H[j][j]     = r;
+                H[j + 1][j] = 0.0;
+                g[j + 1]    = -sn[j] * g[j];
+                g[j]        =  cs[j] * g[j];
+
+                resid = fabs(g[j + 1]);
+                ++k;
+                ++nIts;
+
+                if (resid <= target || r == 0.0)
+                {
+                    break;
+                }
+            }
+
+            // Solve the triangular least-squares system and update the
+            // iterate x += M^{-1} V y.
+            for (i = k - 1; i >= 0; --i)
+            {
+                for (j = i + 1; j < k; ++j)
+                {
+                    g[i] -= H[i][j] * g[j];
+                }
+                g[i] /= H[i][i];
+            }
+
+            Vmath::Zero(m_nDofs, m_tmp, 1);
+            for (i = 0; i < k; ++i)
+            {
+                Vmath::Svtvp(m_nDofs, g[i], m_basis[i], 1, m_tmp, 1, m_tmp, 1);
+            }
+            ApplyPreconditioner(m_tmp, m_fpert);
+            Vmath::Vadd(m_nDofs, x, 1, m_fpert, 1, x, 1);
+
+            if (resid <= target)
+            {
+                break;
+            }
+        }
+
+        return nIts;
+    }
+
+    /**
+     * Colouring of the elements such that no two elements within two traces
+     * of each other have the same colour, including elements on other
+     * processes. Perturbing all elements of one colour then leaves the
+     * right-hand side of each of them unaffected by the others, also when
+     * the right-hand side couples elements through two traces, as the
+     * gradients of the viscous terms do.
+     *
+     * The colouring is found in rounds, following Jones and Plassmann. In
+     * each round, every uncoloured element whose priority is the largest
+     * among the uncoloured elements of its distance-2 neighbourhood takes
+     * the smallest colour not used in that neighbourhood. The priorities
+     * are a hash of the global element IDs, so the result does not depend
+     * on the partitioning.
+     */
+    void JacobianFreeNewtonKrylov::ColourElements()
+    {
+        int e, i;
+        int nElmts = m_field->GetExpSize();
+
+        const MultiRegions::AssemblyMapDGSharedPtr &traceMap =
+            m_field->GetTraceMap();
+        const MultiRegions::ExpListSharedPtr &trace = m_field->GetTrace();
+        const Array<OneD, const Array<OneD, LocalRegions::ExpansionSharedPtr> >
+            &elmtToTrace = traceMap->GetElmtToTrace();
+
+        map<int, vector<int> > traceElmts;
+        for (e = 0; e < nElmts; ++e)
+        {
+            for (i = 0; i < m_field->GetExp(e)->GetNtrace(); ++i)
+            {
+                traceElmts[elmtToTrace[e][i]->GetElmtId()].push_back(e);
+            }
+        }
+
+        // Traces with a single local element are shared with another
+        // process if the assembly finds a second contribution.
+        Array<OneD, NekDouble> buf(trace->GetNpoints(), 0.0);
+        map<int, vector<int> >::iterator it;
+        for (it = traceElmts.begin(); it != traceElmts.end(); ++it)
+        {
+            if (it->second.size() == 1)
+            {
+                Vmath::Fill(trace->GetExp(it->first)->GetTotPoints(), 1.0,
+                            &buf[trace->GetPhys_Offset(it->first)], 1);
+            }
+        }
+        traceMap->UniversalTraceAssemble(buf);
+
+        // Neighbour of each element across each of its traces.
+        vector<vector<int> > nbrs(nElmts);
+        for (e = 0; e < nElmts; ++e)
+        {
+            nbrs[e].resize(m_field->GetExp(e)->GetNtrace(), eNoNeighbour);
+            for (i = 0; i < nbrs[e].size(); ++i)
+            {
+                int t = elmtToTrace[e][i]->GetElmtId();
+                const vector<int> &elmts = traceElmts[t];
+
+                if (elmts.size() > 1)
+                {
+                    int n = elmts[0] == e ? elmts[1] : elmts[0];
+                    nbrs[e][i] = n == e ? eNoNeighbour : n;
+                }
+                else if (buf[trace->GetPhys_Offset(t)] > 1.5)
+                {
+                    nbrs[e][i] = eRemoteNeighbour;
+                }
+            }
+        }
+
+        m_elmtColour = Array<OneD, int>(nElmts, -1);
+        m_nColours   = 0;
+
+        Array<OneD, NekDouble> priority(nElmts), maxPriority(nElmts);
+        Array<OneD, NekDouble> usedColours(nElmts);
+        for (e = 0; e < nElmts; ++e)
+        {
+            // Multiplication by an odd constant is a bijection on 32-bit
+            // integers, so that the priorities are distinct and non-zero.
+            boost::uint32_t id = m_field->GetExp(e)->GetGeom()->GetGlobalID();
+            priority[e] = NekDouble(id * 2654435761u) + 1.0;
+        }
+
+        int nUncoloured = nElmts;
+        m_comm->AllReduce(nUncoloured, LibUtilities::ReduceSum);
+
+        while (nUncoloured > 0)
+        {
+            for (e = 0; e < nElmts; ++e)
+            {
+                bool coloured  = m_elmtColour[e] >= 0;
+                maxPriority[e] = coloured ? 0.0 : priority[e];
+                usedColours[e] = coloured ?
+                    NekDouble(boost::uint64_t(1) << m_elmtColour[e]) : 0.0;
+            }
+
+            for (i = 0; i < 2; ++i)
+            {
+                ReduceOverNeighbours(nbrs, maxPriority, false);
+                ReduceOverNeighbours(nbrs, usedColours, true);
+            }
+
+            nUncoloured = 0;
+            for (e = 0; e < nElmts; ++e)
+            {
+                if (m_elmtColour[e] >= 0)
+                {
+                    continue;
+                }
+
+                if (maxPriority[e] == priority[e])
+                {
+                    boost::uint64_t used = boost::uint64_t(usedColours[e]);
+                    int c = 0;
+                    while (used & (boost::uint64_t(1) << c))
+                    {
+                        ++c;
+                    }
+                    ASSERTL0(c < kMaxColours,
+                             "Too many colours in element colouring.");
+
+                    m_elmtColour[e] = c;
+                    m_nColours      = max(m_nColours, c + 1);
+                }
+                else
+                {
+                    ++nUncoloured;
+                }
+            }
+
+            m_comm->AllReduce(nUncoloured, LibUtilities::ReduceSum);
+        }
+
+        m_comm->AllReduce(m_nColours, LibUtilities::ReduceMax);
+    }
+
+    /**
+     * Replace the value of each element by the reduction of the values of
+     * the element and of its neighbours across each trace, which is the
+     * maximum or, for values holding bit sets, their union. The values of
+     * neighbours on other processes are found through the trace exchange,
+     * in which a shared trace receives the sum of the values of the
+     * elements on both sides. Values must therefore be integers below
+     * 2^52 so that the sum is exact.
+     */
+    void JacobianFreeNewtonKrylov::ReduceOverNeighbours(
+        const vector<vector<int> > &nbrs,
+              Array<OneD, NekDouble> &val,
+        const bool                    bitwiseOr)
+    {
+        int e, i;
+        int nElmts = m_field->GetExpSize();
+
+        const MultiRegions::ExpListSharedPtr &trace = m_field->GetTrace();
+        const Array<OneD, const Array<OneD, LocalRegions::ExpansionSharedPtr> >
+            &elmtToTrace = m_field->GetTraceMap()->GetElmtToTrace();
+
+        Array<OneD, NekDouble> buf(trace->GetNpoints(), 0.0);
+        for (e = 0; e < nElmts; ++e)
+        {
+            for (i = 0; i < nbrs[e].size(); ++i)
+            {
+                if (nbrs[e][i] == eRemoteNeighbour)
+                {
+                    int t = elmtToTrace[e][i]->GetElmtId();
+                    Vmath::Fill(trace->GetExp(t)->GetTotPoints(), val[e],
+                                &buf[trace->GetPhys_Offset(t)], 1);
+                }
+            }
+        }
+        m_field->GetTraceMap()->UniversalTraceAssemble(buf);
+
+        Array<OneD, NekDouble> out(nElmts);
+        Vmath::Vcopy(nElmts, val, 1, out, 1);
+        for (e = 0; e < nElmts; ++e)
+        {
+            for (i = 0; i < nbrs[e].size(); ++i)
+            {
+                NekDouble nbrVal;
+                if (nbrs[e][i] >= 0)
+                {
+                    nbrVal = val[nbrs[e][i]];
+                }
+                else if (nbrs[e][i] == eRemoteNeighbour)
+                {
+                    int t  = elmtToTrace[e][i]->GetElmtId();
+                    nbrVal = buf[trace->GetPhys_Offset(t)] - val[e];
+                }
+                else
+                {
+                    continue;
+                }
+
+                if (bitwiseOr)
+                {
+                    out[e] = NekDouble(boost::uint64_t(out[e]) |
+                                       boost::uint64_t(nbrVal));
+                }
+                else
+                {
+                    out[e] = max(out[e], nbrVal);
+                }
+            }
+        }
+
+        val = out;
+    }
+
+    void JacobianFreeNewtonKrylov::BuildPreconditioner(const NekDouble time)
+    {
+        int e, i, j, c;
+        int nElmts = m_field->GetExpSize();
+        int maxCols = 0;
+
+        m_jacBlocks .resize(nElmts);
+        m_precBlocks.resize(nElmts);
+        m_precPivots.resize(nElmts);
+        for (e = 0; e < nElmts; ++e)
+        {
+            int nb = m_nVar * m_field->GetExp(e)->GetTotPoints();
+            if (m_jacBlocks[e].num_elements() != nb * nb)
+            {
+                m_jacBlocks [e] = Array<OneD, NekDouble>(nb * nb, 0.0);
+                m_precBlocks[e] = Array<OneD, NekDouble>(nb * nb, 0.0);
+                m_precPivots[e] = Array<OneD, int>(nb, 0);
+            }
+            maxCols = max(maxCols, nb);
+        }
+        m_blockWork = Array<OneD, NekDouble>(maxCols, 0.0);
+        m_comm->AllReduce(maxCols, LibUtilities::ReduceMax);
+
+        NekDouble sqrtEps = sqrt(numeric_limits<NekDouble>::epsilon());
+        Array<OneD, NekDouble> h(nElmts, 0.0);
+        Vmath::Vcopy(m_nDofs, m_y, 1, m_pert, 1);
+
+        for (c = 0; c < m_nColours; ++c)
+        {
+            for (j = 0; j < maxCols; ++j)
+            {
+                for (e = 0; e < nElmts; ++e)
+                {
+                    int nq = m_field->GetExp(e)->GetTotPoints();
+                    if (m_elmtColour[e] != c || j >= m_nVar * nq)
+                    {
+                        continue;
+                    }
+                    int idx = (j / nq) * m_nPts + m_field->GetPhys_Offset(e)
+                            + j % nq;
+                    h[e] = sqrtEps * max(fabs(m_y[idx]), 1.0);
+                    m_pert[idx] += h[e];
+                }
+
+                EvaluateRhs(m_pert, m_fpert, time);
+
+                for (e = 0; e < nElmts; ++e)
+                {
+                    int nq = m_field->GetExp(e)->GetTotPoints();
+                    int nb = m_nVar * nq;
+                    if (m_elmtColour[e] != c || j >= nb)
+                    {
+                        continue;
+                    }
+                    int offset = m_field->GetPhys_Offset(e);
+                    int idx    = (j / nq) * m_nPts + offset + j % nq;
+                    m_pert[idx] = m_y[idx];
+
+                    NekDouble *col = &m_jacBlocks[e][j * nb];
+                    for (i = 0; i < m_nVar; ++i)
+                    {
+                        Vmath::Vsub(nq, &m_fpert[i * m_nPts + offset], 1,
+                                        &m_fy   [i * m_nPts + offset], 1,
+                                        col + i * nq, 1);
+                    }
+                    Vmath::Smul(nb, 1.0 / h[e], col, 1, col, 1);
+                }
+            }
+        }
+
+        m_precLambda         = 0.0;
+        m_solvesSinceRebuild = 0;
+    }
+
+    /**
+     * Form and factorise the blocks \f$ I - \lambda J_{ee} \f$.
+     */
+    void JacobianFreeNewtonKrylov::FactorPreconditioner(const NekDouble lambda)
+    {
+        int nElmts = m_field->GetExpSize();
+
+        for (int e = 0; e < nElmts; ++e)
+        {
+            int nb = m_nVar * m_field->GetExp(e)->GetTotPoints();
+            int info;
+
+            Vmath::Smul(nb * nb, -lambda, m_jacBlocks[e], 1,
+                        m_precBlocks[e], 1);
+            for (int i = 0; i < nb; ++i)
+            {
+                m_precBlocks[e][i * nb + i] += 1.0;
+            }
+
+            Lapack::Dgetrf(nb, nb, m_precBlocks[e].get(), nb,
+                           m_precPivots[e].get(), info);
+            ASSERTL0(info == 0, "Preconditioner block factorisation failed.");
+        }
+
+        m_precLambda = lambda;
+    }
+
+    NekDouble JacobianFreeNewtonKrylov::Dot(
+        const Array<OneD, const NekDouble> &a,
+        const Array<OneD, const NekDouble> &b)
+    {
+        NekDouble dot = Vmath::Dot(m_nDofs, a, 1, b, 1);
+        m_comm->AllReduce(dot, LibUtilities::ReduceSum);
+        return dot;
+    }
+}
+}
@@ -0,0 +1,211 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: JacobianFreeNewtonKrylov.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Jacobian-free Newton-Krylov solver for implicit stages
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_SOLVERUTILS_CORE_JACOBIANFREENEWTONKRYLOV_H
+#define NEKTAR_SOLVERUTILS_CORE_JACOBIANFREENEWTONKRYLOV_H
+
+#include <vector>
+
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/TimeIntegration/TimeIntegrationScheme.h>
+#include <MultiRegions/ExpList.h>
+#include <SolverUtils/SolverUtilsDeclspec.h>
+
+namespace Nektar {
+namespace SolverUtils {
+
+    /**
+     * @brief Jacobian-free Newton-Krylov solution of the implicit stage
+     * equations of a discontinuous discretisation.
+     *
+     * Solves \f$ \boldsymbol{y} - \lambda \boldsymbol{f}(\boldsymbol{y}, t)
+     * = \boldsymbol{b} \f$, as required by the DoImplicitSolve operator of
+     * the diagonally implicit time integration schemes, where
+     * \f$\boldsymbol{f}\f$ is the right-hand side given by the projection
+     * and right-hand side operators of the system.
+     *
+     * Each Newton correction is found with restarted GMRES. Products with
+     * the Jacobian are approximated by finite differences of the
+     * right-hand side, so that the Jacobian is never formed. The
+     * element-block-Jacobi preconditioner consists of the element diagonal
+     * blocks of the Jacobian, found by finite differences in which all
+     * elements of one colour, no two of which are within two traces of each
+     * other on any process, are perturbed at once. The blocks are kept for several solves and refactorised when
+     * \f$\lambda\f$ changes.
+     *
+     * The solver is controlled by the session parameters
+     * - JFNKNewtonTolerance: relative Newton residual reduction (1e-6);
+     * - JFNKNewtonMaxIterations: Newton iterations per solve (10);
+     * - JFNKKrylovTolerance: relative GMRES residual reduction (1e-2);
+     * - JFNKKrylovDimension: GMRES restart length (30);
+     * - JFNKKrylovMaxIterations: GMRES iterations per correction (200);
+     * - JFNKPreconditionerUpdate: solves between preconditioner rebuilds
+     *   (10);
+     *
+     * and the solver information JFNKPreconditioner (BlockJacobi or None).
+     */
+    class JacobianFreeNewtonKrylov
+    {
+    public:
+        SOLVER_UTILS_EXPORT JacobianFreeNewtonKrylov(
+            const LibUtilities::SessionReaderSharedPtr         &session,
+            const MultiRegions::ExpListSharedPtr               &field,
+            const LibUtilities::TimeIntegrationSchemeOperators &ode);
+
+        /// Solve y - lambda f(y, time) = rhs for y.
+        SOLVER_UTILS_EXPORT void Solve(
+            const Array<OneD, const Array<OneD, NekDouble> > &rhs,
+                  Array<OneD,       Array<OneD, NekDouble> > &y,
+            const NekDouble                                   time,
+            const NekDouble                                   lambda);
+
+        /// Total number of Newton and GMRES iterations and right-hand side
+        /// evaluations performed.
+        void GetStatistics(int &nNewton, int &nKrylov, int &nRhs) const
+        {
+            nNewton = m_nNewtonIts;
+            nKrylov = m_nKrylovIts;
+            nRhs    = m_nRhsEvals;
+        }
+
+    private:
+        MultiRegions::ExpListSharedPtr               m_field;
+        LibUtilities::TimeIntegrationSchemeOperators m_ode;
+        LibUtilities::CommSharedPtr                  m_comm;
+        bool                                         m_verbose;
+
+        NekDouble m_newtonTol;
+        int       m_maxNewtonIts;
+        NekDouble m_krylovTol;
+        int       m_krylovDim;
+        int       m_maxKrylovIts;
+        bool      m_blockJacobi;
+        int       m_precondUpdate;
+
+        /// Number of variables, quadrature points per variable and unknowns.
+        int m_nVar;
+        int m_nPts;
+        int m_nDofs;
+
+        /// Current iterate, its right-hand side and work vectors, stored as
+        /// all points of the first variable, then of the second, etc.
+        Array<OneD, NekDouble>               m_rhs;
+        Array<OneD, NekDouble>               m_y;
+        Array<OneD, NekDouble>               m_fy;
+        Array<OneD, NekDouble>               m_res;
+        Array<OneD, NekDouble>               m_delta;
+        Array<OneD, NekDouble>               m_pert;
+        Array<OneD, NekDouble>               m_fpert;
+        Array<OneD, NekDouble>               m_tmp;
+        /// State, projected state and right-hand side passed to the
+        /// system operators.
+        Array<OneD, Array<OneD, NekDouble> > m_in;
+        Array<OneD, Array<OneD, NekDouble> > m_proj;
+        Array<OneD, Array<OneD, NekDouble> > m_out;
+        /// GMRES basis.
+        std::vector<Array<OneD, NekDouble> > m_basis;
+
+        /// Colour of each element and number of colours on all processes.
+        Array<OneD, int>                     m_elmtColour;
+        int                                  m_nColours;
+        /// Element Jacobian blocks, factorised preconditioner blocks and
+        /// their pivots.
+        std::vector<Array<OneD, NekDouble> > m_jacBlocks;
+        std::vector<Array<OneD, NekDouble> > m_precBlocks;
+        std::vector<Array<OneD, int> >       m_precPivots;
+        Array<OneD, NekDouble>               m_blockWork;
+        NekDouble                            m_precLambda;
+        int                                  m_solvesSinceRebuild;
+
+        int m_nNewtonIts;
+        int m_nKrylovIts;
+        int m_nRhsEvals;
+
+        void Initialise(int nVar);
+
+        void EvaluateRhs(
+            const Array<OneD, const NekDouble> &y,
+                  Array<OneD,       NekDouble> &f,
+            const NekDouble                     time);
+
+        void ApplyJacobian(
+            const Array<OneD, const NekDouble> &v,
+                  Array<OneD,       NekDouble> &out,
+            const NekDouble                     time,
+            const NekDouble                     lambda);
+
+        void ApplyPreconditioner(
+            const Array<OneD, const NekDouble> &in,
+                  Array<OneD,       NekDouble> &out);
+
+        int Gmres(
+            const Array<OneD, const NekDouble> &b,
+                  Array<OneD,       NekDouble> &x,
+            const NekDouble                     time,
+            const NekDouble                     lambda,
+            const NekDouble                     tol);
+
+        /// Markers for the neighbours of an element across its traces.
+        enum NeighbourType
+        {
+            eNoNeighbour     = -1,
+            eRemoteNeighbour = -2
+        };
+
+        /// Largest number of colours held in the bit sets of the colouring.
+        static const int kMaxColours = 52;
+
+        void ColourElements();
+
+        void ReduceOverNeighbours(
+            const std::vector<std::vector<int> > &nbrs,
+                  Array<OneD, NekDouble>         &val,
+            const bool                            bitwiseOr);
+
+        void BuildPreconditioner(const NekDouble time);
+
+        void FactorPreconditioner(const NekDouble lambda);
+
+        NekDouble Dot(
+            const Array<OneD, const NekDouble> &a,
+            const Array<OneD, const NekDouble> &b);
+    };
+
+    typedef boost::shared_ptr<JacobianFreeNewtonKrylov>
+        JacobianFreeNewtonKrylovSharedPtr;
+}
+}
+
+#endif
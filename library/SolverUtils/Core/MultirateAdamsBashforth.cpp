@@ -0,0 +1,309 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: MultirateAdamsBashforth.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Multirate Adams-Bashforth time integration.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+#include <LibUtilities/Communication/Comm.h>
+#include <SolverUtils/Core/MultirateAdamsBashforth.h>
+
+namespace Nektar {
+namespace SolverUtils {
+
+    /**
+     * @param field      Field defining the elements and their quadrature
+     *                   points.
+     * @param order      Order of the Adams-Bashforth scheme, 1 or 2.
+     * @param maxLevels  Maximum number of rate groups.
+     */
+    MultirateAdamsBashforth::MultirateAdamsBashforth(
+        const MultiRegions::ExpListSharedPtr &field,
+        const int                             order,
+        const int                             maxLevels)
+        : m_field             (field),
+          m_order             (order),
+          m_maxLevels         (maxLevels),
+          m_nLevels           (1),
+          m_nElmtRhs          (0.0),
+          m_nElmtRhsSingleRate(0.0)
+    {
+        ASSERTL0(m_order == 1 || m_order == 2,
+                 "Multirate Adams-Bashforth is only available for "
+                 "orders 1 and 2.");
+        ASSERTL0(m_maxLevels >= 1, "At least one rate group is required.");
+
+        int nElmts  = m_field->GetExpSize();
+        m_elmtLevel = Array<OneD, int>(nElmts, 0);
+        SetRateGroups(Array<OneD, NekDouble>(nElmts, 1.0));
+    }
+
+    /**
+     * Element @a e is placed in the slowest group \f$k < L_{max}\f$ with
+     * \f$2^k \Delta t_{min} \leq \Delta t_e\f$, where \f$\Delta t_{min}\f$
+     * is the smallest limit over all processes. The right-hand side history
+     * is discarded, so that the next step of each group is a first-order
+     * step.
+     *
+     * @param elmtTimeStep  Time-step limit of each element. Only the ratios
+     *                      between the limits are used.
+     */
+    void MultirateAdamsBashforth::SetRateGroups(
+        const Array<OneD, const NekDouble> &elmtTimeStep)
+    {
+        LibUtilities::CommSharedPtr comm = m_field->GetComm();
+        int nElmts = m_field->GetExpSize();
+
+        NekDouble minTimeStep = nElmts > 0 ?
+            Vmath::Vmin(nElmts, elmtTimeStep, 1) : 1.0e300;
+        comm->AllReduce(minTimeStep, LibUtilities::ReduceMin);
+
+        int maxLevel = 0;
+        for (int e = 0; e < nElmts; ++e)
+        {
+            int level = 0;
+            while (level < m_maxLevels - 1 &&
+                   minTimeStep * (1 << (level + 1)) <= elmtTimeStep[e])
+            {
+                ++level;
+            }
+            m_elmtLevel[e] = level;
+            maxLevel       = std::max(maxLevel, level);
+        }
+        comm->AllReduce(maxLevel, LibUtilities::ReduceMax);
+        m_nLevels = maxLevel + 1;
+
+        // Elements of the groups up to each level and the quadrature point
+        // ranges of each group.
+        m_levelElmts .resize(m_nLevels);
+        m_levelRanges.assign(m_nLevels, RangeVector());
+        for (int k = 0; k < m_nLevels; ++k)
+        {
+            int cnt = 0;
+            for (int e = 0; e < nElmts; ++e)
+            {
+                cnt += m_elmtLevel[e] <= k;
+            }
+
+            m_levelElmts[k] = Array<OneD, int>(cnt);
+            for (int e = 0, n = 0; e < nElmts; ++e)
+            {
+                if (m_elmtLevel[e] <= k)
+                {
+                    m_levelElmts[k][n++] = e;
+                }
+            }
+        }
+
+        for (int e = 0; e < nElmts; ++e)
+        {
+            RangeVector &ranges = m_levelRanges[m_elmtLevel[e]];
+            int offset = m_field->GetPhys_Offset(e);
+            int nPts   = m_field->GetExp(e)->GetTotPoints();
+
+            if (!ranges.empty() &&
+                ranges.back().first + ranges.back().second == offset)
+            {
+                ranges.back().second += nPts;
+            }
+            else
+            {
+                ranges.push_back(std::make_pair(offset, nPts));
+            }
+        }
+
+        m_time    .assign(m_nLevels, 0.0);
+        m_prevTime.assign(m_nLevels, 0.0);
+        m_started .assign(m_nLevels, false);
+    }
+
+    /**
+     * A group \f$k\f$ takes steps of \f$2^{k-L+1}\f$ times the macro step,
+     * which must not exceed the limit of any of its elements.
+     */
+    NekDouble MultirateAdamsBashforth::GetMaxTimeStep(
+        const Array<OneD, const NekDouble> &elmtTimeStep)
+    {
+        int nElmts = m_field->GetExpSize();
+        NekDouble timestep = 1.0e300;
+
+        for (int e = 0; e < nElmts; ++e)
+        {
+            timestep = std::min(timestep, elmtTimeStep[e] *
+                                (1 << (m_nLevels - 1 - m_elmtLevel[e])));
+        }
+        m_field->GetComm()->AllReduce(timestep, LibUtilities::ReduceMin);
+
+        return timestep;
+    }
+
+    /**
+     * @param timestep  Macro step.
+     * @param time      Time at the start of the macro step.
+     * @param ode       Right-hand side and projection operators.
+     * @param u         Solution, advanced in place.
+     */
+    void MultirateAdamsBashforth::TimeIntegrate(
+        const NekDouble                                     timestep,
+        const NekDouble                                     time,
+        const LibUtilities::TimeIntegrationSchemeOperators &ode,
+              Array<OneD, Array<OneD, NekDouble> >         &u)
+    {
+        int nVar     = u.num_elements();
+        int nPts     = u[0].num_elements();
+        int nSub     = GetNumSubSteps();
+        NekDouble h  = timestep / nSub;
+        RangeVector::const_iterator r;
+
+        if (m_rhs.num_elements() != nVar)
+        {
+            m_rhs   = Array<OneD, Array<OneD, NekDouble> >(nVar);
+            m_f     = Array<OneD, Array<OneD, NekDouble> >(nVar);
+            m_prevF = Array<OneD, Array<OneD, NekDouble> >(nVar);
+            for (int i = 0; i < nVar; ++i)
+            {
+                m_rhs  [i] = Array<OneD, NekDouble>(nPts, 0.0);
+                m_f    [i] = Array<OneD, NekDouble>(nPts, 0.0);
+                m_prevF[i] = Array<OneD, NekDouble>(nPts, 0.0);
+            }
+        }
+
+        for (int j = 0; j < nSub; ++j)
+        {
+            NekDouble t = time + j * h;
+
+            // Slowest group starting one of its steps at this substep.
+            int level = 0;
+            while (level < m_nLevels - 1 && j % (2 << level) == 0)
+            {
+                ++level;
+            }
+
+            SetActiveElmts(level);
+            ode.DoProjection(u, u, t);
+            ode.DoOdeRhs    (u, m_rhs, t);
+
+            m_nElmtRhs           += m_levelElmts[level].num_elements();
+            m_nElmtRhsSingleRate += m_field->GetExpSize();
+
+            // Update the right-hand side history of the started groups.
+            for (int k = 0; k <= level; ++k)
+            {
+                for (r = m_levelRanges[k].begin();
+                     r != m_levelRanges[k].end(); ++r)
+                {
+                    for (int i = 0; i < nVar; ++i)
+                    {
+                        Vmath::Vcopy(r->second, &m_f  [i][r->first], 1,
+                                                &m_prevF[i][r->first], 1);
+                        Vmath::Vcopy(r->second, &m_rhs[i][r->first], 1,
+                                                &m_f  [i][r->first], 1);
+                    }
+                }
+
+                // Without a history the first step is a forward Euler step.
+                m_prevTime[k] = m_started[k] ? m_time[k] : t - h * (1 << k);
+                m_time    [k] = t;
+                if (!m_started[k])
+                {
+                    for (r = m_levelRanges[k].begin();
+                         r != m_levelRanges[k].end(); ++r)
+                    {
+                        for (int i = 0; i < nVar; ++i)
+                        {
+                            Vmath::Vcopy(r->second, &m_f    [i][r->first], 1,
+                                                    &m_prevF[i][r->first], 1);
+                        }
+                    }
+                    m_started[k] = true;
+                }
+            }
+
+            // Advance all groups by integrating the extrapolant of their
+            // right-hand side from t to t + h.
+            for (int k = 0; k < m_nLevels; ++k)
+            {
+                NekDouble c = 0.0;
+                if (m_order == 2)
+                {
+                    c = (t - m_time[k] + 0.5 * h) /
+                        (m_time[k] - m_prevTime[k]);
+                }
+
+                for (r = m_levelRanges[k].begin();
+                     r != m_levelRanges[k].end(); ++r)
+                {
+                    for (int i = 0; i < nVar; ++i)
+                    {
+                        Vmath::Svtvp(r->second, h * (1.0 + c),
+                                     &m_f    [i][r->first], 1,
+                                     &u      [i][r->first], 1,
+                                     &u      [i][r->first], 1);
+                        Vmath::Svtvp(r->second, -h * c,
+                                     &m_prevF[i][r->first], 1,
+                                     &u      [i][r->first], 1,
+                                     &u      [i][r->first], 1);
+                    }
+                }
+            }
+        }
+
+        SetActiveElmts(m_nLevels - 1);
+    }
+
+    std::vector<int> MultirateAdamsBashforth::GetLevelSizes() const
+    {
+        std::vector<int> sizes(m_nLevels, 0);
+        for (int e = 0; e < m_elmtLevel.num_elements(); ++e)
+        {
+            ++sizes[m_elmtLevel[e]];
+        }
+        return sizes;
+    }
+
+    /**
+     * Restrict the right-hand side to the groups up to @a level, or remove
+     * the restriction if all groups are required.
+     */
+    void MultirateAdamsBashforth::SetActiveElmts(int level)
+    {
+        if (m_activeElmtsFunc.empty())
+        {
+            return;
+        }
+
+        m_activeElmtsFunc(level == m_nLevels - 1, m_levelElmts[level]);
+    }
+}
+}
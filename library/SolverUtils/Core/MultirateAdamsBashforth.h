@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: MultirateAdamsBashforth.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Multirate Adams-Bashforth time integration.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_SOLVERUTILS_CORE_MULTIRATEADAMSBASHFORTH_H
+#define NEKTAR_SOLVERUTILS_CORE_MULTIRATEADAMSBASHFORTH_H
+
+#include <utility>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+
+#include <LibUtilities/TimeIntegration/TimeIntegrationScheme.h>
+#include <MultiRegions/ExpList.h>
+#include <SolverUtils/SolverUtilsDeclspec.h>
+
+namespace Nektar {
+namespace SolverUtils {
+
+    /**
+     * @brief Multirate Adams-Bashforth time integration of a discontinuous
+     * discretisation, in which elements are advanced in rate groups.
+     *
+     * Each element is assigned to the rate group \f$k\f$ for which the
+     * step \f$2^k h\f$ satisfies its time-step limit, where \f$h\f$ is the
+     * step of the fastest group. A macro step of \f$2^{L-1} h\f$ is made of
+     * \f$2^{L-1}\f$ substeps of size \f$h\f$. At the start of each of its own
+     * steps the right-hand side of a group is evaluated, and in every substep
+     * all groups are advanced by integrating their Adams-Bashforth
+     * extrapolant of the right-hand side over the substep (the
+     * "fastest-first" scheme of Gear and Wells). Hence the slow groups take
+     * exact Adams-Bashforth steps of their own size, while their states are
+     * available at every substep, so that the fluxes across the interfaces
+     * between groups are always evaluated from states at the same time.
+     *
+     * The right-hand side is evaluated through the usual ODE operators. Before
+     * each evaluation the callback defined by #DefineActiveElmts is given the
+     * elements whose right-hand side is required, so that the system can skip
+     * the element-wise work on the remaining ones.
+     */
+    class MultirateAdamsBashforth
+    {
+    public:
+        typedef boost::function<
+            void (bool, const Array<OneD, const int> &)> ActiveElmtsFuncType;
+
+        SOLVER_UTILS_EXPORT MultirateAdamsBashforth(
+            const MultiRegions::ExpListSharedPtr &field,
+            const int                             order,
+            const int                             maxLevels);
+
+        /// Define the callback restricting the right-hand side evaluation.
+        template<typename FuncPointerT, typename ObjectPointerT>
+        void DefineActiveElmts(FuncPointerT func, ObjectPointerT obj)
+        {
+            m_activeElmtsFunc = boost::bind(func, obj, _1, _2);
+        }
+
+        /// Assign the elements to rate groups from their time-step limits.
+        SOLVER_UTILS_EXPORT void SetRateGroups(
+            const Array<OneD, const NekDouble> &elmtTimeStep);
+
+        /// Largest macro step satisfying the element time-step limits.
+        SOLVER_UTILS_EXPORT NekDouble GetMaxTimeStep(
+            const Array<OneD, const NekDouble> &elmtTimeStep);
+
+        /// Advance the solution by one macro step.
+        SOLVER_UTILS_EXPORT void TimeIntegrate(
+            const NekDouble                                     timestep,
+            const NekDouble                                     time,
+            const LibUtilities::TimeIntegrationSchemeOperators &ode,
+                  Array<OneD, Array<OneD, NekDouble> >         &u);
+
+        /// Number of rate groups.
+        int GetNumLevels() const
+        {
+            return m_nLevels;
+        }
+
+        /// Number of substeps of the fastest group in a macro step.
+        int GetNumSubSteps() const
+        {
+            return 1 << (m_nLevels - 1);
+        }
+
+        /// Number of local elements in each rate group.
+        SOLVER_UTILS_EXPORT std::vector<int> GetLevelSizes() const;
+
+        /// Number of element right-hand side evaluations performed, and the
+        /// number a single-rate scheme with the same step would perform.
+        void GetWork(NekDouble &multirate, NekDouble &singleRate) const
+        {
+            multirate  = m_nElmtRhs;
+            singleRate = m_nElmtRhsSingleRate;
+        }
+
+    private:
+        typedef std::vector<std::pair<int, int> > RangeVector;
+
+        MultiRegions::ExpListSharedPtr         m_field;
+        /// Order of the Adams-Bashforth scheme (1 or 2).
+        int                                    m_order;
+        /// Maximum number of rate groups.
+        int                                    m_maxLevels;
+        /// Number of rate groups.
+        int                                    m_nLevels;
+        /// Rate group of each element.
+        Array<OneD, int>                       m_elmtLevel;
+        /// Elements of rate groups 0 to k, for each k.
+        std::vector<Array<OneD, int> >         m_levelElmts;
+        /// Contiguous ranges (offset, size) of quadrature points of each
+        /// rate group.
+        std::vector<RangeVector>               m_levelRanges;
+        /// Right-hand side evaluation.
+        Array<OneD, Array<OneD, NekDouble> >   m_rhs;
+        /// Latest and previous right-hand side of each element, evaluated at
+        /// the times #m_time and #m_prevTime of its rate group.
+        Array<OneD, Array<OneD, NekDouble> >   m_f;
+        Array<OneD, Array<OneD, NekDouble> >   m_prevF;
+        std::vector<NekDouble>                 m_time;
+        std::vector<NekDouble>                 m_prevTime;
+        /// Indicates if a rate group has a right-hand side history.
+        std::vector<bool>                      m_started;
+        /// Callback restricting the right-hand side evaluation.
+        ActiveElmtsFuncType                    m_activeElmtsFunc;
+        NekDouble                              m_nElmtRhs;
+        NekDouble                              m_nElmtRhsSingleRate;
+
+        void SetActiveElmts(int level);
+    };
+
+    typedef boost::shared_ptr<MultirateAdamsBashforth>
+        MultirateAdamsBashforthSharedPtr;
+}
+}
+
+#endif
@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: WorkspaceArena.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Arena of reusable workspace for per-call temporaries.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+#include <SolverUtils/Core/WorkspaceArena.h>
+
+namespace Nektar {
+namespace SolverUtils {
+
+    namespace
+    {
+        unsigned int totalBuffers    = 0;
+        unsigned int totalHeapAllocs = 0;
+    }
+
+    WorkspaceArena::Scope::Scope(WorkspaceArena &arena)
+        : m_arena    (arena),
+          m_top      (arena.m_top),
+          m_nOverflow(arena.m_overflow.size())
+    {
+        ++m_arena.m_depth;
+    }
+
+    WorkspaceArena::Scope::~Scope()
+    {
+        m_arena.Release(m_top, m_nOverflow);
+    }
+
+    WorkspaceArena::WorkspaceArena()
+        : m_top          (0),
+          m_overflowSize (0),
+          m_peak         (0),
+          m_depth        (0),
+          m_numBuffers   (0),
+          m_numHeapAllocs(0)
+    {
+    }
+
+    /**
+     * Should be called when the sizes of the temporaries are known, e.g.
+     * during initialisation, so that the first evaluation is also free of
+     * allocations. The block is never shrunk.
+     */
+    void WorkspaceArena::Reserve(unsigned int size)
+    {
+        ASSERTL0(m_depth == 0,
+                 "Workspace cannot be reserved while buffers are in use.");
+
+        if (size > m_block.num_elements())
+        {
+            m_block = Array<OneD, NekDouble>(size);
+            ++m_numHeapAllocs;
+            ++totalHeapAllocs;
+        }
+    }
+
+    Array<OneD, NekDouble> WorkspaceArena::Allocate(unsigned int size)
+    {
+        ASSERTL1(m_depth > 0,
+                 "Workspace must be allocated within a WorkspaceArena::Scope.");
+
+        ++m_numBuffers;
+        ++totalBuffers;
+
+        if (size == 0)
+        {
+            return Array<OneD, NekDouble>();
+        }
+
+        if (m_top + size <= m_block.num_elements())
+        {
+            Array<OneD, NekDouble> result(size, m_block + m_top);
+            m_top += size;
+            m_peak = std::max(m_peak, m_top + m_overflowSize);
+            return result;
+        }
+
+        // Block exhausted: serve from the heap until the outermost scope is
+        // released.
+        m_overflow.push_back(Array<OneD, NekDouble>(size));
+        m_overflowSize += size;
+        m_peak = std::max(m_peak, m_top + m_overflowSize);
+        ++m_numHeapAllocs;
+        ++totalHeapAllocs;
+
+        return m_overflow.back();
+    }
+
+    Array<OneD, NekDouble> WorkspaceArena::Allocate(
+        unsigned int size, NekDouble initValue)
+    {
+        Array<OneD, NekDouble> result = Allocate(size);
+        Vmath::Fill(size, initValue, result.get(), 1);
+        return result;
+    }
+
+    Array<OneD, Array<OneD, NekDouble> > WorkspaceArena::AllocateVector(
+        unsigned int n, unsigned int size)
+    {
+        Array<OneD, Array<OneD, NekDouble> > result(n);
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            result[i] = Allocate(size);
+        }
+        return result;
+    }
+
+    Array<OneD, Array<OneD, NekDouble> > WorkspaceArena::AllocateVector(
+        unsigned int n, unsigned int size, NekDouble initValue)
+    {
+        Array<OneD, Array<OneD, NekDouble> > result(n);
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            result[i] = Allocate(size, initValue);
+        }
+        return result;
+    }
+
+    void WorkspaceArena::GetTotalStatistics(
+        unsigned int &numBuffers, unsigned int &numHeapAllocs)
+    {
+        numBuffers    = totalBuffers;
+        numHeapAllocs = totalHeapAllocs;
+    }
+
+    void WorkspaceArena::Release(unsigned int top, unsigned int nOverflow)
+    {
+        m_top = top;
+        while (m_overflow.size() > nOverflow)
+        {
+            m_overflowSize -= m_overflow.back().num_elements();
+            m_overflow.pop_back();
+        }
+
+        // Enlarge the block to the peak usage once no buffers are in use.
+        if (--m_depth == 0 && m_peak > m_block.num_elements())
+        {
+            m_block = Array<OneD, NekDouble>(m_peak);
+            ++m_numHeapAllocs;
+            ++totalHeapAllocs;
+        }
+    }
+
+}
+}
@@ -0,0 +1,143 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: WorkspaceArena.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Arena of reusable workspace for per-call temporaries.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_SOLVERUTILS_CORE_WORKSPACEARENA_H
+#define NEKTAR_SOLVERUTILS_CORE_WORKSPACEARENA_H
+
+#include <vector>
+
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <SolverUtils/SolverUtilsDeclspec.h>
+
+namespace Nektar {
+namespace SolverUtils {
+
+    /**
+     * @brief Stack-like arena of workspace handing out buffers from a
+     * single preallocated block.
+     *
+     * Buffers are views into the block and are obtained within a
+     * WorkspaceArena::Scope; they are released, and must no longer be used,
+     * once the scope is destroyed. If the block is exhausted, the request is
+     * served from a separate heap allocation and the block is enlarged to the
+     * observed peak usage once the outermost scope is released, so that
+     * subsequent calls of the same size require no allocation.
+     */
+    class WorkspaceArena
+    {
+    public:
+        /// Scoped release of all buffers handed out during its lifetime.
+        class Scope
+        {
+        public:
+            SOLVER_UTILS_EXPORT Scope(WorkspaceArena &arena);
+            SOLVER_UTILS_EXPORT ~Scope();
+
+        private:
+            WorkspaceArena &m_arena;
+            unsigned int    m_top;
+            unsigned int    m_nOverflow;
+
+            Scope(const Scope &);
+            Scope &operator=(const Scope &);
+        };
+
+        SOLVER_UTILS_EXPORT WorkspaceArena();
+
+        /// Ensure at least @a size values are available without allocation.
+        SOLVER_UTILS_EXPORT void Reserve(unsigned int size);
+
+        /// Return an uninitialised buffer of @a size values.
+        SOLVER_UTILS_EXPORT Array<OneD, NekDouble> Allocate(
+            unsigned int size);
+
+        /// Return a buffer of @a size values set to @a initValue.
+        SOLVER_UTILS_EXPORT Array<OneD, NekDouble> Allocate(
+            unsigned int size, NekDouble initValue);
+
+        /// Return @a n uninitialised buffers of @a size values.
+        SOLVER_UTILS_EXPORT Array<OneD, Array<OneD, NekDouble> >
+            AllocateVector(unsigned int n, unsigned int size);
+
+        /// Return @a n buffers of @a size values set to @a initValue.
+        SOLVER_UTILS_EXPORT Array<OneD, Array<OneD, NekDouble> >
+            AllocateVector(unsigned int n, unsigned int size,
+                           NekDouble initValue);
+
+        /// Number of buffers handed out by this arena.
+        unsigned int GetNumBuffers() const
+        {
+            return m_numBuffers;
+        }
+
+        /// Number of heap allocations performed by this arena.
+        unsigned int GetNumHeapAllocations() const
+        {
+            return m_numHeapAllocs;
+        }
+
+        /// Peak number of values in use at once.
+        unsigned int GetPeakUsage() const
+        {
+            return m_peak;
+        }
+
+        /// Number of buffers and heap allocations summed over all arenas.
+        SOLVER_UTILS_EXPORT static void GetTotalStatistics(
+            unsigned int &numBuffers, unsigned int &numHeapAllocs);
+
+    private:
+        /// Preallocated block.
+        Array<OneD, NekDouble>               m_block;
+        /// Buffers allocated while the block was exhausted.
+        std::vector<Array<OneD, NekDouble> > m_overflow;
+        /// Number of values of the block in use.
+        unsigned int                         m_top;
+        /// Number of values in overflow buffers.
+        unsigned int                         m_overflowSize;
+        /// Peak of m_top + m_overflowSize.
+        unsigned int                         m_peak;
+        /// Number of open scopes.
+        unsigned int                         m_depth;
+        unsigned int                         m_numBuffers;
+        unsigned int                         m_numHeapAllocs;
+
+        void Release(unsigned int top, unsigned int nOverflow);
+    };
+
+}
+}
+
+#endif
@@ -44,6 +44,7 @@
 #include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
 #include <MultiRegions/ExpList.h>
 #include <SolverUtils/SolverUtilsDeclspec.h>
+#include <SolverUtils/Core/WorkspaceArena.h>
 #include <SolverUtils/RiemannSolvers/RiemannSolver.h>
 
 namespace Nektar
@@ -127,12 +128,20 @@ namespace Nektar
             {
                 return v_GetFluxTensor();
             }
+
+            /// Returns the workspace used for temporaries of Diffuse.
+            inline const WorkspaceArena &GetWorkspace() const
+            {
+                return m_workspace;
+            }
             
         protected:
             DiffusionFluxVecCB              m_fluxVector;
             DiffusionFluxVecCBNS            m_fluxVectorNS;
             RiemannSolverSharedPtr          m_riemann;
             DiffusionArtificialDiffusion    m_ArtificialDiffusionVector;
+            /// Workspace for temporaries of v_Diffuse.
+            WorkspaceArena                  m_workspace;
 
             virtual void v_InitObject(
                 LibUtilities::SessionReaderSharedPtr              pSession,
@@ -68,6 +68,14 @@ namespace Nektar
                 m_traceNormals[i] = Array<OneD, NekDouble> (nTracePts);
             }
             pFields[0]->GetTrace()->GetNormals(m_traceNormals);
+
+            // Auxiliary field and flux storage of v_Diffuse, plus the trace
+            // temporaries of the numerical flux routines.
+            int nVariables = pFields.num_elements();
+            int nPts       = pFields[0]->GetTotPoints();
+            int nCoeffs    = pFields[0]->GetNcoeffs();
+            m_workspace.Reserve(nDim * nVariables * (nPts + nTracePts) +
+                                2 * nCoeffs + nPts + 11 * nTracePts);
         }
         
         void DiffusionLDG::v_Diffuse(
@@ -82,35 +90,19 @@ namespace Nektar
             int nCoeffs   = fields[0]->GetNcoeffs();
             int nTracePts = fields[0]->GetTrace()->GetTotPoints();
             
-            Array<OneD, NekDouble>  qcoeffs(nCoeffs);
-            Array<OneD, NekDouble>  temp   (nCoeffs);
+            WorkspaceArena::Scope scope(m_workspace);
 
-            Array<OneD, Array<OneD, NekDouble> > fluxvector(nDim);
+            Array<OneD, NekDouble>  qcoeffs = m_workspace.Allocate(nCoeffs);
 
             Array<OneD, Array<OneD, Array<OneD, NekDouble> > > flux  (nDim);
             Array<OneD, Array<OneD, Array<OneD, NekDouble> > > qfield(nDim);
-            Array<OneD, Array<OneD, Array<OneD, NekDouble> > > qfieldStd(nDim);
 
             for (j = 0; j < nDim; ++j)
             {
-                qfield[j] = 
-                    Array<OneD, Array<OneD, NekDouble> >(nConvectiveFields);
-                qfieldStd[j] = 
-                Array<OneD, Array<OneD, NekDouble> >(nConvectiveFields);
-                flux[j]   = 
-                    Array<OneD, Array<OneD, NekDouble> >(nConvectiveFields);
-                
-                for (i = 0; i < nConvectiveFields; ++i)
-                {
-                    qfield[j][i] = Array<OneD, NekDouble>(nPts, 0.0);
-                    qfieldStd[j][i] = Array<OneD, NekDouble>(nPts, 0.0);
-                    flux[j][i]   = Array<OneD, NekDouble>(nTracePts, 0.0);
-                }
-            }
-            
-            for (k = 0; k < nDim; ++k)
-            {
-                fluxvector[k] = Array<OneD, NekDouble>(nPts, 0.0);
+                qfield[j] = m_workspace.AllocateVector(
+                    nConvectiveFields, nPts, 0.0);
+                flux[j]   = m_workspace.AllocateVector(
+                    nConvectiveFields, nTracePts, 0.0);
             }
                         
             // Compute q_{\eta} and q_{\xi}
@@ -136,7 +128,7 @@ namespace Nektar
 
             if (m_ArtificialDiffusionVector)
             {
-                Array<OneD, NekDouble> muvar(nPts, 0.0);
+                Array<OneD, NekDouble> muvar = m_workspace.Allocate(nPts, 0.0);
                 m_ArtificialDiffusionVector(inarray, muvar);
 	        
 	        int numConvFields = nConvectiveFields;
@@ -154,8 +146,10 @@ namespace Nektar
                     }
                 }
 
-                Array<OneD, NekDouble> FwdMuVar(nTracePts, 0.0);
-                Array<OneD, NekDouble> BwdMuVar(nTracePts, 0.0);
+                Array<OneD, NekDouble> FwdMuVar =
+                    m_workspace.Allocate(nTracePts, 0.0);
+                Array<OneD, NekDouble> BwdMuVar =
+                    m_workspace.Allocate(nTracePts, 0.0);
 
                 fields[0]->GetFwdBwdTracePhys(muvar,FwdMuVar,BwdMuVar);
 
@@ -197,7 +191,7 @@ namespace Nektar
                 }
             }
 
-            Array<OneD, NekDouble>  tmp = Array<OneD, NekDouble>(nCoeffs, 0.0);
+            Array<OneD, NekDouble>  tmp = m_workspace.Allocate(nCoeffs, 0.0);
             Array<OneD, Array<OneD, NekDouble> > qdbase(nDim);
 
             for (i = 0; i < nConvectiveFields; ++i)
@@ -227,10 +221,14 @@ namespace Nektar
             int nvariables = fields.num_elements();
             int nDim       = uflux.num_elements();
             
-            Array<OneD, NekDouble > Fwd     (nTracePts);
-            Array<OneD, NekDouble > Bwd     (nTracePts);
-            Array<OneD, NekDouble > Vn      (nTracePts, 0.0);
-            Array<OneD, NekDouble > fluxtemp(nTracePts, 0.0);
+            WorkspaceArena::Scope scope(m_workspace);
+
+            Array<OneD, NekDouble > Fwd      = m_workspace.Allocate(nTracePts);
+            Array<OneD, NekDouble > Bwd      = m_workspace.Allocate(nTracePts);
+            Array<OneD, NekDouble > Vn       =
+                m_workspace.Allocate(nTracePts, 0.0);
+            Array<OneD, NekDouble > fluxtemp =
+                m_workspace.Allocate(nTracePts, 0.0);
 
             // Get the normal velocity Vn
             for(i = 0; i < nDim; ++i)
@@ -307,7 +305,9 @@ namespace Nektar
             int cnt         = 0;
             int nBndRegions = fields[var]->GetBndCondExpansions().num_elements();
             int nTracePts   = fields[0]->GetTrace()->GetTotPoints();
-            Array<OneD, NekDouble > uplus(nTracePts);
+            WorkspaceArena::Scope scope(m_workspace);
+
+            Array<OneD, NekDouble > uplus = m_workspace.Allocate(nTracePts);
             
             fields[var]->ExtractTracePhys(ufield, uplus);
             for (i = 0; i < nBndRegions; ++i)
@@ -365,15 +365,20 @@ namespace Nektar
             int nDim       = qfield.num_elements();
             
             NekDouble C11 = 0.0;
-            Array<OneD, NekDouble > Fwd(nTracePts);
-            Array<OneD, NekDouble > Bwd(nTracePts);
-            Array<OneD, NekDouble > Vn (nTracePts, 0.0);
+            WorkspaceArena::Scope scope(m_workspace);
+
+            Array<OneD, NekDouble > Fwd = m_workspace.Allocate(nTracePts);
+            Array<OneD, NekDouble > Bwd = m_workspace.Allocate(nTracePts);
+            Array<OneD, NekDouble > Vn  = m_workspace.Allocate(nTracePts, 0.0);
             
-            Array<OneD, NekDouble > qFwd     (nTracePts);
-            Array<OneD, NekDouble > qBwd     (nTracePts);
-            Array<OneD, NekDouble > qfluxtemp(nTracePts, 0.0);
+            Array<OneD, NekDouble > qFwd      =
+                m_workspace.Allocate(nTracePts);
+            Array<OneD, NekDouble > qBwd      =
+                m_workspace.Allocate(nTracePts);
+            Array<OneD, NekDouble > qfluxtemp =
+                m_workspace.Allocate(nTracePts, 0.0);
             
-            Array<OneD, NekDouble > uterm(nTracePts);
+            Array<OneD, NekDouble > uterm = m_workspace.Allocate(nTracePts);
             
             /*
             // Setting up the normals
@@ -396,7 +401,7 @@ namespace Nektar
             // qflux = \hat{q} \cdot u = q \cdot n - C_(11)*(u^+ - u^-)
             for (i = 0; i < nvariables; ++i)
             {
-                qflux[i] = Array<OneD, NekDouble> (nTracePts, 0.0);
+                Vmath::Zero(nTracePts, qflux[i], 1);
                 for (j = 0; j < nDim; ++j)
                 {
                     //  Compute Fwd and Bwd value of ufield of jth direction
@@ -479,8 +484,9 @@ namespace Nektar
             int nBndRegions = fields[var]->GetBndCondExpansions().num_elements();
             int nTracePts   = fields[0]->GetTrace()->GetTotPoints();
             
-            Array<OneD, NekDouble > uterm(nTracePts);
-            Array<OneD, NekDouble > qtemp(nTracePts);
+            WorkspaceArena::Scope scope(m_workspace);
+
+            Array<OneD, NekDouble > qtemp = m_workspace.Allocate(nTracePts);
             int cnt = 0;
             
             /*
@@ -151,6 +151,11 @@ namespace Nektar
                 }
             }
 
+            // Coefficient and hat-flux storage of v_Diffuse, plus the trace
+            // temporaries of the numerical flux routines.
+            m_workspace.Reserve(nConvectiveFields * pFields[0]->GetNcoeffs() +
+                                2 * nSolutionPts + 9 * nTracePts);
+
         }
         
         /**
@@ -864,11 +869,10 @@ namespace Nektar
             int nSolutionPts = fields[0]->GetTotPoints();
             int nCoeffs      = fields[0]->GetNcoeffs();
             
-            Array<OneD, Array<OneD, NekDouble> > outarrayCoeff(nConvectiveFields);
-            for (i = 0; i < nConvectiveFields; ++i)
-            {
-                outarrayCoeff[i]  = Array<OneD, NekDouble>(nCoeffs);
-            }
+            WorkspaceArena::Scope scope(m_workspace);
+
+            Array<OneD, Array<OneD, NekDouble> > outarrayCoeff =
+                m_workspace.AllocateVector(nConvectiveFields, nCoeffs);
                    
             // Compute interface numerical fluxes for inarray in physical space 
             v_NumFluxforScalar(fields, inarray, m_IF1);
@@ -954,14 +958,16 @@ namespace Nektar
                 // 2D problems 
                 case 2:
                 {                       
+                    // Temporary vectors, overwritten for each direction
+                    Array<OneD, NekDouble> u1_hat =
+                        m_workspace.Allocate(nSolutionPts);
+                    Array<OneD, NekDouble> u2_hat =
+                        m_workspace.Allocate(nSolutionPts);
+
                     for(i = 0; i < nConvectiveFields; ++i)
                     {               
                         for (j = 0; j < nDim; ++j)
                         {                             
-                            // Temporary vectors
-                            Array<OneD, NekDouble> u1_hat(nSolutionPts, 0.0);
-                            Array<OneD, NekDouble> u2_hat(nSolutionPts, 0.0);
-                             
                             if (j == 0) 
                             {
                                 Vmath::Vmul(nSolutionPts, &inarray[i][0], 1,
@@ -1072,11 +1078,13 @@ namespace Nektar
 
                     // Computing the standard second-order discontinuous 
                     // derivatives 
+                    Array<OneD, NekDouble> f_hat =
+                        m_workspace.Allocate(nSolutionPts);
+                    Array<OneD, NekDouble> g_hat =
+                        m_workspace.Allocate(nSolutionPts);
+
                     for (i = 0; i < nConvectiveFields; ++i)
                     {
-                        Array<OneD, NekDouble> f_hat(nSolutionPts, 0.0);
-                        Array<OneD, NekDouble> g_hat(nSolutionPts, 0.0);
-                        
                         for (j = 0; j < nSolutionPts; j++)
                         {
                             f_hat[j] = (m_D1[i][0][j] * m_gmat[0][j] + 
@@ -1163,10 +1171,14 @@ namespace Nektar
             int nvariables = fields.num_elements();
             int nDim       = fields[0]->GetCoordim(0);  
             
-            Array<OneD, NekDouble > Fwd     (nTracePts);
-            Array<OneD, NekDouble > Bwd     (nTracePts);
-            Array<OneD, NekDouble > Vn      (nTracePts, 0.0);
-            Array<OneD, NekDouble > fluxtemp(nTracePts, 0.0);
+            WorkspaceArena::Scope scope(m_workspace);
+
+            Array<OneD, NekDouble > Fwd      = m_workspace.Allocate(nTracePts);
+            Array<OneD, NekDouble > Bwd      = m_workspace.Allocate(nTracePts);
+            Array<OneD, NekDouble > Vn       =
+                m_workspace.Allocate(nTracePts, 0.0);
+            Array<OneD, NekDouble > fluxtemp =
+                m_workspace.Allocate(nTracePts, 0.0);
                                     
             // Get the normal velocity Vn
             for (i = 0; i < nDim; ++i)
@@ -1242,7 +1254,8 @@ namespace Nektar
             int nTracePts   = fields[0]->GetTrace()->GetTotPoints();
             
             // Extract physical values of the fields at the trace space
-            Array<OneD, NekDouble > uplus(nTracePts);
+            WorkspaceArena::Scope scope(m_workspace);
+            Array<OneD, NekDouble > uplus = m_workspace.Allocate(nTracePts);
             fields[var]->ExtractTracePhys(ufield, uplus);
             
             // Impose boundary conditions
@@ -1306,14 +1319,19 @@ namespace Nektar
             int nDim       = fields[0]->GetCoordim(0);  
             
             NekDouble C11 = 0.0;
-            Array<OneD, NekDouble > Fwd(nTracePts);
-            Array<OneD, NekDouble > Bwd(nTracePts);
-            Array<OneD, NekDouble > Vn (nTracePts, 0.0);
+            WorkspaceArena::Scope scope(m_workspace);
+
+            Array<OneD, NekDouble > Fwd = m_workspace.Allocate(nTracePts);
+            Array<OneD, NekDouble > Bwd = m_workspace.Allocate(nTracePts);
+            Array<OneD, NekDouble > Vn  = m_workspace.Allocate(nTracePts, 0.0);
             
-            Array<OneD, NekDouble > qFwd     (nTracePts);
-            Array<OneD, NekDouble > qBwd     (nTracePts);
-            Array<OneD, NekDouble > qfluxtemp(nTracePts, 0.0);            
-            Array<OneD, NekDouble > uterm(nTracePts);
+            Array<OneD, NekDouble > qFwd      =
+                m_workspace.Allocate(nTracePts);
+            Array<OneD, NekDouble > qBwd      =
+                m_workspace.Allocate(nTracePts);
+            Array<OneD, NekDouble > qfluxtemp =
+                m_workspace.Allocate(nTracePts, 0.0);
+            Array<OneD, NekDouble > uterm = m_workspace.Allocate(nTracePts);
                         
             // Get the normal velocity Vn
             for(i = 0; i < nDim; ++i)
@@ -1326,7 +1344,7 @@ namespace Nektar
             // qflux = \hat{q} \cdot u = q \cdot n - C_(11)*(u^+ - u^-)
             for (i = 0; i < nvariables; ++i)
             {
-                qflux[i] = Array<OneD, NekDouble> (nTracePts, 0.0);
+                Vmath::Zero(nTracePts, qflux[i], 1);
                 for (j = 0; j < nDim; ++j)
                 {
                     //  Compute Fwd and Bwd value of ufield of jth direction
@@ -1403,8 +1421,9 @@ namespace Nektar
             int nBndRegions = fields[var]->GetBndCondExpansions().num_elements();
             int nTracePts   = fields[0]->GetTrace()->GetTotPoints();
             
-            Array<OneD, NekDouble > uterm(nTracePts);
-            Array<OneD, NekDouble > qtemp(nTracePts);
+            WorkspaceArena::Scope scope(m_workspace);
+
+            Array<OneD, NekDouble > qtemp = m_workspace.Allocate(nTracePts);
             int cnt = 0;
                         
             fields[var]->ExtractTracePhys(qfield, qtemp);
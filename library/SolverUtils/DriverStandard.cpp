@@ -35,7 +35,11 @@
 
 #include <iomanip>
 
+#include <boost/filesystem.hpp>
+
 #include <SolverUtils/DriverStandard.h>
+#include <SolverUtils/UnsteadySystem.h>
+#include <LocalRegions/MetricRegistry.h>
 
 namespace Nektar
 {
@@ -83,15 +87,33 @@ namespace Nektar
             m_equ[0]->DoInitialise();
             m_equ[0]->DoSolve();
 
+            while (RebalanceRequested())
+            {
+                Rebalance();
+                m_equ[0]->DoSolve();
+            }
+
             time(&endtime);
 
             m_equ[0]->Output();
+
+            // Report sharing of local matrices between congruent elements.
+            int metricHits, metricMisses;
+            LocalRegions::MetricRegistry::GetStatistics(
+                metricHits, metricMisses);
+            m_comm->AllReduce(metricHits,   LibUtilities::ReduceSum);
+            m_comm->AllReduce(metricMisses, LibUtilities::ReduceSum);
         
             if (m_comm->GetRank() == 0)
             {
                 CPUtime = difftime(endtime, starttime);
                 cout << "-------------------------------------------" << endl;
                 cout << "Total Computation Time = " << CPUtime << "s" << endl;
+                if (m_session->DefinesCmdLineArgument("verbose"))
+                {
+                    cout << "Shared element metrics = " << metricHits
+                         << " hits, " << metricMisses << " misses" << endl;
+                }
                 cout << "-------------------------------------------" << endl;
             }
 
@@ -119,6 +141,71 @@ namespace Nektar
                 }
             }
         }
+
+        /**
+         * Whether the equation system stopped time-stepping because the load
+         * of the processes is unbalanced.
+         */
+        bool DriverStandard::RebalanceRequested()
+        {
+            UnsteadySystemSharedPtr equ =
+                boost::dynamic_pointer_cast<UnsteadySystem>(m_equ[0]);
+            return equ && equ->RebalanceRequested();
+        }
+
+        /**
+         * Repartitions the mesh using the load measured by the equation
+         * system and replaces it by a new equation system on the new
+         * partition, which continues from the current solution.
+         *
+         * The solution is passed on through a field file, which allows each
+         * process to read the coefficients of its new elements regardless of
+         * where they were previously held or of their polynomial order. The
+         * old equation system is released before the new one is created, so
+         * the two are not held in memory together. Its filters are passed to
+         * the new equation system, so their output continues. The field file
+         * is removed once the new equation system has been initialised.
+         */
+        void DriverStandard::Rebalance()
+        {
+            UnsteadySystemSharedPtr equ =
+                boost::dynamic_pointer_cast<UnsteadySystem>(m_equ[0]);
+
+            std::map<int, NekDouble> weights;
+            equ->GetElementWeights(weights);
+
+            std::string file = m_session->GetSessionName() + "_rebalance.chk";
+            equ->WriteFld(file);
+
+            NekDouble time = equ->GetFinalTime();
+            int step, nchk;
+            std::vector<FilterSharedPtr> filters;
+            equ->GetResumeState(step, nchk, filters);
+
+            equ.reset();
+            m_equ[0].reset();
+
+            m_session->Repartition(weights);
+
+            std::string vEquation = m_session->GetSolverInfo("EqType");
+            if (m_session->DefinesSolverInfo("SolverType"))
+            {
+                vEquation = m_session->GetSolverInfo("SolverType");
+            }
+            m_equ[0] = GetEquationSystemFactory().CreateInstance(
+                vEquation, m_session);
+
+            equ = boost::dynamic_pointer_cast<UnsteadySystem>(m_equ[0]);
+            equ->SetResumeState(file, time, step, nchk, filters);
+            m_equ[0]->DoInitialise();
+
+            m_comm->Block();
+            if (m_comm->GetRank() == 0)
+            {
+                boost::system::error_code ec;
+                boost::filesystem::remove_all(file, ec);
+            }
+        }
     }
 }
 
@@ -72,6 +72,10 @@ namespace Nektar
             SOLVER_UTILS_EXPORT virtual void v_Execute(ostream &out = cout);
 		
             static std::string driverLookupId;
+
+        private:
+            bool RebalanceRequested();
+            void Rebalance();
 	};
     }	
 } //end of namespace
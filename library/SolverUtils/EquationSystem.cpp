@@ -48,6 +48,7 @@
 #include <MultiRegions/ExpList3D.h>     // for ExpList3D
 #include <MultiRegions/ExpList3DHomogeneous1D.h>
 #include <MultiRegions/ExpList3DHomogeneous2D.h>
+#include <Collections/CollectionOptimisation.h>
 
 #include <SolverUtils/AdvectionSystem.h>
 #include <SolverUtils/Diffusion/Diffusion.h>
@@ -121,7 +122,10 @@ namespace Nektar
 
             // Instantiate a field reader/writer
             m_fld = MemoryManager<LibUtilities::FieldIO>
-                ::AllocateSharedPtr(m_session->GetComm());
+                ::AllocateSharedPtr(
+                    m_session->GetComm(),
+                    m_session->GetSolverInfoAsEnum<
+                        LibUtilities::FieldIOFormat>("IOFormat"));
 
             // Read the geometry and the expansion information
             m_graph = SpatialDomains::MeshGraph::Read(m_session);
@@ -662,6 +666,9 @@ namespace Nektar
 
             // Zero all physical fields initially
             ZeroPhysFields();
+
+            // Agree on and store any collection autotuning results
+            Collections::CollectionOptimisation::SynchroniseCache(m_comm);
         }
 
         /**
@@ -58,5 +58,14 @@ namespace Nektar
         {
         }
 
+        bool Filter::v_SupportsRebalance()
+        {
+            return false;
+        }
+
+        void Filter::v_Rebalance(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+        {
+        }
+
     }
 }
@@ -71,6 +71,8 @@ namespace Nektar
             SOLVER_UTILS_EXPORT inline void Update(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time);
             SOLVER_UTILS_EXPORT inline void Finalise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time);
             SOLVER_UTILS_EXPORT inline bool IsTimeDependent();
+            SOLVER_UTILS_EXPORT inline bool SupportsRebalance();
+            SOLVER_UTILS_EXPORT inline void Rebalance(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time);
 
         protected:
             LibUtilities::SessionReaderSharedPtr m_session;
@@ -79,6 +81,8 @@ namespace Nektar
             virtual void v_Update(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time) = 0;
             virtual void v_Finalise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time) = 0;
             virtual bool v_IsTimeDependent() = 0;
+            virtual bool v_SupportsRebalance();
+            virtual void v_Rebalance(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time);
         };
 
         inline void Filter::Initialise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
@@ -100,6 +104,24 @@ namespace Nektar
         {
             return v_IsTimeDependent();
         }
+
+        /**
+         * Whether the filter may continue on the fields of a new equation
+         * system after the mesh has been repartitioned.
+         */
+        inline bool Filter::SupportsRebalance()
+        {
+            return v_SupportsRebalance();
+        }
+
+        /**
+         * Called in place of Initialise when the filter continues on the
+         * fields of a new partition of the mesh.
+         */
+        inline void Filter::Rebalance(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+        {
+            v_Rebalance(pFields, time);
+        }
     }
 }
 #endif /* NEKTAR_SOLVERUTILS_FILTER_FILTER_H */
@@ -33,6 +33,9 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/bind.hpp>
+
 #include <SolverUtils/Filters/FilterCheckpoint.h>
 
 namespace Nektar
@@ -44,7 +47,10 @@ namespace Nektar
         FilterCheckpoint::FilterCheckpoint(
             const LibUtilities::SessionReaderSharedPtr &pSession,
             const std::map<std::string, std::string> &pParams) :
-            Filter(pSession)
+            Filter(pSession),
+            m_async(false),
+            m_maxPending(2),
+            m_stop(false)
         {
             if (pParams.find("OutputFile") == pParams.end())
             {
@@ -61,19 +67,65 @@ namespace Nektar
             m_outputFrequency = atoi(pParams.find("OutputFrequency")->second.c_str());
             m_outputIndex = 0;
             m_index = 0;
-            m_fld = MemoryManager<LibUtilities::FieldIO>::AllocateSharedPtr(pSession->GetComm());
+            m_fld = MemoryManager<LibUtilities::FieldIO>::AllocateSharedPtr(
+                pSession->GetComm(),
+                pSession->GetSolverInfoAsEnum<LibUtilities::FieldIOFormat>(
+                    "IOFormat"));
+
+            std::map<std::string, std::string>::const_iterator it;
+            if ((it = pParams.find("Asynchronous")) != pParams.end())
+            {
+                m_async = boost::iequals(it->second, "true") ||
+                          it->second == "1";
+            }
+            if ((it = pParams.find("MaxPending")) != pParams.end())
+            {
+                m_maxPending = atoi(it->second.c_str());
+                ASSERTL0(m_maxPending > 0,
+                         "Parameter 'MaxPending' must be positive.");
+            }
 
+            // The binary format is written collectively through the
+            // communicator, which must not be used off the solver thread.
+            if (m_async && m_fld->GetFormat() == LibUtilities::eBinaryFormat)
+            {
+                if (pSession->GetComm()->GetRank() == 0)
+                {
+                    NEKERROR(ErrorUtil::ewarning,
+                             "Asynchronous checkpoints are not supported "
+                             "with the Binary IOFormat; writing "
+                             "synchronously.");
+                }
+                m_async = false;
+            }
         }
 
         FilterCheckpoint::~FilterCheckpoint()
         {
-
+            if (m_thread)
+            {
+                try
+                {
+                    StopWriter();
+                }
+                catch (...)
+                {
+                }
+            }
         }
 
         void FilterCheckpoint::v_Initialise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
         {
             m_index = 0;
             m_outputIndex = 0;
+
+            if (m_async && !m_thread)
+            {
+                m_stop = false;
+                m_thread = boost::shared_ptr<boost::thread>(
+                    new boost::thread(
+                        boost::bind(&FilterCheckpoint::WriterThread, this)));
+            }
         }
 
         void FilterCheckpoint::v_Update(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
@@ -101,18 +153,136 @@ namespace Nektar
                     pFields[0]->AppendFieldData(FieldDef[i], FieldData[i], pFields[j]->UpdateCoeffs());
                 }
             }
-            m_fld->Write(vOutputFilename.str(),FieldDef,FieldData);
+
+            if (!m_thread)
+            {
+                m_fld->Write(vOutputFilename.str(),FieldDef,FieldData);
+                m_outputIndex++;
+                return;
+            }
+
+            // FieldData holds a copy of the coefficients, so the solver may
+            // continue while the I/O thread compresses and writes it.
+            CheckpointJobSharedPtr job(new CheckpointJob());
+            job->m_fieldDefs.swap(FieldDef);
+            job->m_fieldData.swap(FieldData);
+
+            // Creating the output directory and Info.xml requires
+            // communication in parallel, so is performed here. The I/O
+            // thread then only writes the partition of this process.
+            job->m_filename = m_fld->SetUpOutput(
+                vOutputFilename.str(), job->m_fieldDefs,
+                LibUtilities::NullFieldMetaDataMap);
+
+            Enqueue(job);
             m_outputIndex++;
         }
 
         void FilterCheckpoint::v_Finalise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
         {
-
+            // Wait for any outstanding checkpoints to reach disk.
+            if (m_thread)
+            {
+                StopWriter();
+            }
         }
 
         bool FilterCheckpoint::v_IsTimeDependent()
         {
             return true;
         }
+
+        /**
+         * The output counters and any I/O thread are kept when the mesh is
+         * repartitioned, so checkpoint numbering continues.
+         */
+        bool FilterCheckpoint::v_SupportsRebalance()
+        {
+            return true;
+        }
+
+        /**
+         * Adds a snapshot to the output queue. If m_maxPending snapshots are
+         * already held by the I/O thread, the solver waits for the oldest to
+         * be written, bounding the memory used by buffered checkpoints.
+         */
+        void FilterCheckpoint::Enqueue(const CheckpointJobSharedPtr &job)
+        {
+            boost::unique_lock<boost::mutex> lock(m_mutex);
+            while (m_queue.size() >= m_maxPending && m_error.empty())
+            {
+                m_queueCond.wait(lock);
+            }
+            ASSERTL0(m_error.empty(),
+                     "Checkpoint output failed: " + m_error);
+
+            m_queue.push_back(job);
+            lock.unlock();
+            m_queueCond.notify_all();
+        }
+
+        /**
+         * Main loop of the I/O thread. A snapshot stays at the front of the
+         * queue while it is written, so that it counts towards m_maxPending.
+         */
+        void FilterCheckpoint::WriterThread()
+        {
+            while (true)
+            {
+                CheckpointJobSharedPtr job;
+                {
+                    boost::unique_lock<boost::mutex> lock(m_mutex);
+                    while (m_queue.empty() && !m_stop)
+                    {
+                        m_queueCond.wait(lock);
+                    }
+                    if (m_queue.empty())
+                    {
+                        return;
+                    }
+                    job = m_queue.front();
+                }
+
+                std::string error;
+                try
+                {
+                    m_fld->WritePartition(job->m_filename,
+                                          job->m_fieldDefs,
+                                          job->m_fieldData,
+                                          LibUtilities::NullFieldMetaDataMap);
+                }
+                catch (const std::exception &e)
+                {
+                    error = e.what();
+                }
+
+                {
+                    boost::unique_lock<boost::mutex> lock(m_mutex);
+                    m_queue.pop_front();
+                    if (!error.empty() && m_error.empty())
+                    {
+                        m_error = error;
+                    }
+                }
+                m_queueCond.notify_all();
+            }
+        }
+
+        /**
+         * Writes all queued snapshots and terminates the I/O thread.
+         */
+        void FilterCheckpoint::StopWriter()
+        {
+            {
+                boost::unique_lock<boost::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_queueCond.notify_all();
+            m_thread->join();
+            m_thread.reset();
+
+            ASSERTL0(m_error.empty(),
+                     "Checkpoint output failed: " + m_error);
+        }
     }
 }
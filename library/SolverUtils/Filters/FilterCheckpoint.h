@@ -36,6 +36,12 @@
 #ifndef NEKTAR_SOLVERUTILS_FILTERS_FILTERCHECKPOINT_H
 #define NEKTAR_SOLVERUTILS_FILTERS_FILTERCHECKPOINT_H
 
+#include <deque>
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/thread.hpp>
+
 #include <SolverUtils/Filters/Filter.h>
 
 namespace Nektar
@@ -69,13 +75,42 @@ namespace Nektar
             virtual void v_Update(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time);
             virtual void v_Finalise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time);
             virtual bool v_IsTimeDependent();
+            virtual bool v_SupportsRebalance();
 
         private:
+            /// Snapshot of the fields awaiting output by the I/O thread.
+            struct CheckpointJob
+            {
+                /// Partition file returned by FieldIO::SetUpOutput.
+                std::string m_filename;
+                std::vector<LibUtilities::FieldDefinitionsSharedPtr> m_fieldDefs;
+                std::vector<std::vector<NekDouble> > m_fieldData;
+            };
+            typedef boost::shared_ptr<CheckpointJob> CheckpointJobSharedPtr;
+
             unsigned int m_index;
             unsigned int m_outputIndex;
             unsigned int m_outputFrequency;
             std::string m_outputFile;
             LibUtilities::FieldIOSharedPtr m_fld;
+
+            /// Write checkpoints on a separate I/O thread.
+            bool m_async;
+            /// Maximum number of snapshots held by the I/O thread.
+            unsigned int m_maxPending;
+            /// Snapshots being or waiting to be written.
+            std::deque<CheckpointJobSharedPtr> m_queue;
+            boost::mutex m_mutex;
+            boost::condition_variable m_queueCond;
+            boost::shared_ptr<boost::thread> m_thread;
+            /// Set when no further snapshots will be queued.
+            bool m_stop;
+            /// Error raised by the I/O thread, reported on the solver thread.
+            std::string m_error;
+
+            void Enqueue(const CheckpointJobSharedPtr &job);
+            void WriterThread();
+            void StopWriter();
         };
     }
 }
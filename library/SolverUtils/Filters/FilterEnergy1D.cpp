@@ -174,5 +174,10 @@ namespace Nektar
         {
             return true;
         }
+
+        bool FilterEnergy1D::v_SupportsRebalance()
+        {
+            return true;
+        }
     }
 }
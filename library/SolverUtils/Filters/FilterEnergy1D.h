@@ -83,6 +83,7 @@ namespace Nektar
                 const Array<OneD, const MultiRegions::ExpListSharedPtr> &pField,
                 const NekDouble                                         &time);
             virtual bool v_IsTimeDependent();
+            virtual bool v_SupportsRebalance();
 
         private:
             /// Output file.
@@ -118,7 +118,6 @@ namespace Nektar
                      "No history points in stream.");
 
             m_index = 0;
-            m_historyList.clear();
 
             // Read history points
             Array<OneD, NekDouble>  gloCoord(3,0.0);
@@ -153,6 +152,198 @@ namespace Nektar
                 }
             }
 
+            LocatePoints(pFields);
+
+            int vHP = m_historyPoints.size();
+            if (pFields[0]->GetComm()->GetRank() == 0)
+            {
+                // Open output stream
+                m_outputStream.open(m_outputFile.c_str());
+                m_outputStream << "# History data for variables (:";
+
+                for (i = 0; i < pFields.num_elements(); ++i)
+                {
+                    m_outputStream << m_session->GetVariable(i) <<",";
+                }
+
+                if(m_isHomogeneous1D)
+                {
+                    m_outputStream << ") at points:";
+                }
+                else
+                {
+                    m_outputStream << ") at points:" << endl;
+                }
+
+                for (i = 0; i < vHP; ++i)
+                {
+                    m_historyPoints[i]->GetCoords(  gloCoord[0],
+                                                    gloCoord[1],
+                                                    gloCoord[2]);
+
+                    m_outputStream << "# \t" << i;
+                    m_outputStream.width(8);
+                    m_outputStream << gloCoord[0];
+                    m_outputStream.width(8);
+                    m_outputStream << gloCoord[1];
+                    m_outputStream.width(8);
+                    m_outputStream << gloCoord[2];
+                    m_outputStream << endl;
+                }
+
+                if(m_isHomogeneous1D)
+                {
+                    m_outputStream << "(in Wavespace)" << endl;
+                }
+            }
+            v_Update(pFields, time);
+        }
+
+
+        /**
+         *
+         */
+        void FilterHistoryPoints::v_Update(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+        {
+            // Only output every m_outputFrequency.
+            if ((m_index++) % m_outputFrequency)
+            {
+                return;
+            }
+
+            int j         = 0;
+            int k         = 0;
+            int numPoints = m_historyPoints.size();
+            int numFields = pFields.num_elements();
+            LibUtilities::CommSharedPtr vComm = pFields[0]->GetComm();
+            Array<OneD, NekDouble> data(numPoints*numFields, 0.0);
+            Array<OneD, NekDouble> gloCoord(3, 0.0);
+            std::list<std::pair<SpatialDomains::PointGeomSharedPtr, Array<OneD, NekDouble> > >::iterator x;
+            
+            Array<OneD, NekDouble> physvals;
+            Array<OneD, NekDouble> locCoord;
+            int expId;
+
+            // Pull out data values field by field
+            for (j = 0; j < numFields; ++j)
+            {
+                if(m_isHomogeneous1D)
+                {
+                    for (k = 0, x = m_historyList.begin(); x != m_historyList.end(); 
+                         ++x, ++k)
+                    {
+                        locCoord = (*x).second;
+                        expId    = (*x).first->GetVid();
+
+                        physvals = pFields[j]->GetPlane(m_outputPlane)->UpdatePhys() + pFields[j]->GetPhys_Offset(expId);
+                        
+                        // transform elemental data if required. 
+                        if(pFields[j]->GetPhysState() == false)
+                        {
+                            pFields[j]->GetPlane(m_outputPlane)->GetExp(expId)->BwdTrans(pFields[j]->GetPlane(m_outputPlane)->GetCoeffs() + pFields[j]->GetCoeff_Offset(expId),physvals);
+                        }
+
+                        // interpolate point can do with zero plane methods
+                        data[m_historyLocalPointMap[k]*numFields+j] = pFields[j]->GetExp(expId)->StdPhysEvaluate(locCoord,physvals);
+                        
+                    }
+                }
+                else
+                {
+                    for (k = 0, x = m_historyList.begin(); x != m_historyList.end(); ++x, ++k)
+                    {
+                        locCoord = (*x).second;
+                        expId    = (*x).first->GetVid();
+
+                        physvals = pFields[j]->UpdatePhys() + pFields[j]->GetPhys_Offset(expId);
+                        
+                        // transform elemental data if required. 
+                        if(pFields[j]->GetPhysState() == false)
+                        {
+                            pFields[j]->GetExp(expId)->BwdTrans(pFields[j]->GetCoeffs() + pFields[j]->GetCoeff_Offset(expId),physvals);
+                        }
+
+                        // interpolate point
+                        data[m_historyLocalPointMap[k]*numFields+j] = pFields[j]->GetExp(expId)->StdPhysEvaluate(locCoord,physvals);
+                    }
+                }
+            }
+
+            // Exchange history data
+            // This could be improved to reduce communication but works for now
+            vComm->AllReduce(data, LibUtilities::ReduceSum);
+
+            // Only the root process writes out history data
+            if (vComm->GetRank() == 0)
+            {
+
+                // Write data values point by point
+                for (k = 0; k < m_historyPoints.size(); ++k)
+                {
+                    m_outputStream.width(8);
+                    m_outputStream << setprecision(6) << time;
+                    for (int j = 0; j < numFields; ++j)
+                    {
+                        m_outputStream.width(25);
+                        m_outputStream << setprecision(16) << data[k*numFields+j];
+                    }
+                    m_outputStream << endl;
+                }
+            }
+        }
+
+
+        /**
+         *
+         */
+        void FilterHistoryPoints::v_Finalise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+        {
+            if (pFields[0]->GetComm()->GetRank() == 0)
+            {
+                m_outputStream.close();
+            }
+        }
+
+
+        /**
+         *
+         */
+        bool FilterHistoryPoints::v_IsTimeDependent()
+        {
+            return true;
+        }
+
+
+        bool FilterHistoryPoints::v_SupportsRebalance()
+        {
+            return true;
+        }
+
+
+        /**
+         * The history points are reassigned to the processes of the new
+         * partition. The output file and counter are kept.
+         */
+        void FilterHistoryPoints::v_Rebalance(
+            const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+            const NekDouble &time)
+        {
+            LocatePoints(pFields);
+        }
+
+
+        /**
+         * Assigns each history point to the unique process holding the
+         * element in which it lies, and stores its local coordinates.
+         */
+        void FilterHistoryPoints::LocatePoints(
+            const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields)
+        {
+            int i;
+            Array<OneD, NekDouble> gloCoord(3, 0.0);
+
+            m_historyList.clear();
+            m_historyLocalPointMap.clear();
 
             // Determine the unique process responsible for each history point
             // For points on a partition boundary, must select a single process
@@ -312,161 +503,7 @@ namespace Nektar
                              << sqrt(dist[i]) << " from the manifold." << endl;
                     }
                 }
-
-                // Open output stream
-                m_outputStream.open(m_outputFile.c_str());
-                m_outputStream << "# History data for variables (:";
-
-                for (i = 0; i < pFields.num_elements(); ++i)
-                {
-                    m_outputStream << m_session->GetVariable(i) <<",";
-                }
-
-                if(m_isHomogeneous1D)
-                {
-                    m_outputStream << ") at points:";
-                }
-                else
-                {
-                    m_outputStream << ") at points:" << endl;
-                }
-
-                for (i = 0; i < vHP; ++i)
-                {
-                    m_historyPoints[i]->GetCoords(  gloCoord[0],
-                                                    gloCoord[1],
-                                                    gloCoord[2]);
-
-                    m_outputStream << "# \t" << i;
-                    m_outputStream.width(8);
-                    m_outputStream << gloCoord[0];
-                    m_outputStream.width(8);
-                    m_outputStream << gloCoord[1];
-                    m_outputStream.width(8);
-                    m_outputStream << gloCoord[2];
-                    m_outputStream << endl;
-                }
-
-                if(m_isHomogeneous1D)
-                {
-                    m_outputStream << "(in Wavespace)" << endl;
-                }
-            }
-            v_Update(pFields, time);
-        }
-
-
-        /**
-         *
-         */
-        void FilterHistoryPoints::v_Update(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
-        {
-            // Only output every m_outputFrequency.
-            if ((m_index++) % m_outputFrequency)
-            {
-                return;
             }
-
-            int j         = 0;
-            int k         = 0;
-            int numPoints = m_historyPoints.size();
-            int numFields = pFields.num_elements();
-            LibUtilities::CommSharedPtr vComm = pFields[0]->GetComm();
-            Array<OneD, NekDouble> data(numPoints*numFields, 0.0);
-            Array<OneD, NekDouble> gloCoord(3, 0.0);
-            std::list<std::pair<SpatialDomains::PointGeomSharedPtr, Array<OneD, NekDouble> > >::iterator x;
-            
-            Array<OneD, NekDouble> physvals;
-            Array<OneD, NekDouble> locCoord;
-            int expId;
-
-            // Pull out data values field by field
-            for (j = 0; j < numFields; ++j)
-            {
-                if(m_isHomogeneous1D)
-                {
-                    for (k = 0, x = m_historyList.begin(); x != m_historyList.end(); 
-                         ++x, ++k)
-                    {
-                        locCoord = (*x).second;
-                        expId    = (*x).first->GetVid();
-
-                        physvals = pFields[j]->GetPlane(m_outputPlane)->UpdatePhys() + pFields[j]->GetPhys_Offset(expId);
-                        
-                        // transform elemental data if required. 
-                        if(pFields[j]->GetPhysState() == false)
-                        {
-                            pFields[j]->GetPlane(m_outputPlane)->GetExp(expId)->BwdTrans(pFields[j]->GetPlane(m_outputPlane)->GetCoeffs() + pFields[j]->GetCoeff_Offset(expId),physvals);
-                        }
-
-                        // interpolate point can do with zero plane methods
-                        data[m_historyLocalPointMap[k]*numFields+j] = pFields[j]->GetExp(expId)->StdPhysEvaluate(locCoord,physvals);
-                        
-                    }
-                }
-                else
-                {
-                    for (k = 0, x = m_historyList.begin(); x != m_historyList.end(); ++x, ++k)
-                    {
-                        locCoord = (*x).second;
-                        expId    = (*x).first->GetVid();
-
-                        physvals = pFields[j]->UpdatePhys() + pFields[j]->GetPhys_Offset(expId);
-                        
-                        // transform elemental data if required. 
-                        if(pFields[j]->GetPhysState() == false)
-                        {
-                            pFields[j]->GetExp(expId)->BwdTrans(pFields[j]->GetCoeffs() + pFields[j]->GetCoeff_Offset(expId),physvals);
-                        }
-
-                        // interpolate point
-                        data[m_historyLocalPointMap[k]*numFields+j] = pFields[j]->GetExp(expId)->StdPhysEvaluate(locCoord,physvals);
-                    }
-                }
-            }
-
-            // Exchange history data
-            // This could be improved to reduce communication but works for now
-            vComm->AllReduce(data, LibUtilities::ReduceSum);
-
-            // Only the root process writes out history data
-            if (vComm->GetRank() == 0)
-            {
-
-                // Write data values point by point
-                for (k = 0; k < m_historyPoints.size(); ++k)
-                {
-                    m_outputStream.width(8);
-                    m_outputStream << setprecision(6) << time;
-                    for (int j = 0; j < numFields; ++j)
-                    {
-                        m_outputStream.width(25);
-                        m_outputStream << setprecision(16) << data[k*numFields+j];
-                    }
-                    m_outputStream << endl;
-                }
-            }
-        }
-
-
-        /**
-         *
-         */
-        void FilterHistoryPoints::v_Finalise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
-        {
-            if (pFields[0]->GetComm()->GetRank() == 0)
-            {
-                m_outputStream.close();
-            }
-        }
-
-
-        /**
-         *
-         */
-        bool FilterHistoryPoints::v_IsTimeDependent()
-        {
-            return true;
         }
     }
 }
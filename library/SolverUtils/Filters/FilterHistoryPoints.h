@@ -76,6 +76,13 @@ class FilterHistoryPoints : public Filter
             const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
             const NekDouble &time);
         SOLVER_UTILS_EXPORT virtual bool v_IsTimeDependent();
+        SOLVER_UTILS_EXPORT virtual bool v_SupportsRebalance();
+        SOLVER_UTILS_EXPORT virtual void v_Rebalance(
+            const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
+            const NekDouble &time);
+
+        void LocatePoints(
+            const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields);
 
         SpatialDomains::PointGeomVector         m_historyPoints;
         unsigned int                            m_index;
@@ -40,6 +40,7 @@
 #include <LibUtilities/BasicUtils/Timer.h>
 #include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
 #include <SolverUtils/UnsteadySystem.h>
+#include <SolverUtils/Core/WorkspaceArena.h>
 
 namespace Nektar
 {	
@@ -65,7 +66,14 @@ namespace Nektar
         UnsteadySystem::UnsteadySystem(
             const LibUtilities::SessionReaderSharedPtr& pSession)
             : EquationSystem(pSession),
-              m_infosteps(10)
+              m_infosteps(10),
+              m_rebalanceSteps(0),
+              m_rebalanceTol(1.2),
+              m_loadTime(0.0),
+              m_lastLoadTime(0.0),
+              m_rebalance(false),
+              m_initialStep(0),
+              m_nchk(1)
 
         {
         }
@@ -99,6 +107,70 @@ namespace Nektar
                 // Set up time to be dumped in field information
                 m_fieldMetaDataMap["Time"] =
                         boost::lexical_cast<std::string>(m_time);
+
+                // Dynamic load balancing, which relies on repartitioning
+                // the mesh when running in parallel.
+                m_session->LoadParameter("RebalanceSteps",
+                                         m_rebalanceSteps, 0);
+                m_session->LoadParameter("RebalanceTolerance",
+                                         m_rebalanceTol, 1.2);
+                if (m_rebalanceSteps &&
+                    m_session->GetComm()->GetRowComm()->GetSize() == 1)
+                {
+                    m_rebalanceSteps = 0;
+                }
+                ASSERTL0(!m_rebalanceSteps ||
+                         m_HomogeneousType == eNotHomogeneous,
+                         "RebalanceSteps is not available for homogeneous "
+                         "expansions.");
+
+                // The load of a process excludes its waits in trace
+                // exchanges, which is the only communication of explicit
+                // discontinuous schemes. The history of a multistep scheme
+                // is not carried over to the repartitioned fields.
+                ASSERTL0(!m_rebalanceSteps ||
+                         (m_projectionType == MultiRegions::eDiscontinuous &&
+                          m_explicitAdvection && m_explicitDiffusion),
+                         "RebalanceSteps requires an explicit discontinuous "
+                         "Galerkin discretisation.");
+                ASSERTL0(!m_rebalanceSteps ||
+                         m_intScheme->GetIntegrationSteps() == 1,
+                         "RebalanceSteps is not available for multistep "
+                         "time-integration schemes.");
+
+                // Local time-stepping with element rate groups
+                int nLevels;
+                m_session->LoadParameter("MultirateLevels", nLevels, 1);
+                if (nLevels > 1)
+                {
+                    int order = 0;
+                    switch (m_intScheme->GetIntegrationMethod())
+                    {
+                        case LibUtilities::eForwardEuler:
+                        case LibUtilities::eAdamsBashforthOrder1:
+                            order = 1;
+                            break;
+                        case LibUtilities::eAdamsBashforthOrder2:
+                            order = 2;
+                            break;
+                        default:
+                            ASSERTL0(false,
+                                     "MultirateLevels requires the "
+                                     "ForwardEuler, AdamsBashforthOrder1 or "
+                                     "AdamsBashforthOrder2 scheme.");
+                    }
+                    ASSERTL0(m_projectionType == MultiRegions::eDiscontinuous,
+                             "MultirateLevels requires a discontinuous "
+                             "projection.");
+                    ASSERTL0(m_HomogeneousType == eNotHomogeneous,
+                             "MultirateLevels is not available for "
+                             "homogeneous expansions.");
+
+                    m_multirate = MemoryManager<MultirateAdamsBashforth>::
+                        AllocateSharedPtr(m_fields[0], order, nLevels);
+                    m_multirate->DefineActiveElmts(
+                        &UnsteadySystem::SetActiveElmts, this);
+                }
             }
 
             // By default attempt to forward transform initial condition.
@@ -113,6 +185,10 @@ namespace Nektar
                                                                 x->first, 
                                                                 m_session, 
                                                                 x->second));
+                ASSERTL0(!m_rebalanceSteps ||
+                         m_filters.back()->SupportsRebalance(),
+                         "Filter " + x->first + " is not available with "
+                         "RebalanceSteps.");
             }
         }
         
@@ -149,6 +225,25 @@ namespace Nektar
                     TimeStability = 1.0;
                     break;
                 }
+                case LibUtilities::eRungeKutta3_SSP:
+                {
+                    TimeStability = 2.512;
+                    break;
+                }
+                case LibUtilities::eRungeKutta4_LowStorage:
+                {
+                    TimeStability = 4.65;
+                    break;
+                }
+                case LibUtilities::eBackwardEuler:
+                case LibUtilities::eDIRKOrder2:
+                case LibUtilities::eDIRKOrder3:
+                {
+                    // Unconditionally stable, so the CFL number is taken
+                    // relative to the characteristic element time scale.
+                    TimeStability = 1.0;
+                    break;
+                }
                 default:
                 {
                     ASSERTL0(
@@ -168,7 +263,7 @@ namespace Nektar
         {
             ASSERTL0(m_intScheme != 0, "No time integration scheme.");
 
-            int i, nchk = 1;
+            int i, nchk = m_nchk;
             int nvariables = 0;
             int nfields = m_fields.num_elements();
 
@@ -212,11 +307,19 @@ namespace Nektar
             m_intSoln = m_intScheme->InitializeScheme(
                 m_timestep, fields, m_time, m_ode);
 
-            // Initialise filters
+            // Initialise filters, or continue those of the equation system
+            // this one replaced when the processes were rebalanced.
             std::vector<FilterSharedPtr>::iterator x;
             for (x = m_filters.begin(); x != m_filters.end(); ++x)
             {
-                (*x)->Initialise(m_fields, m_time);
+                if (m_resumeFile.empty())
+                {
+                    (*x)->Initialise(m_fields, m_time);
+                }
+                else
+                {
+                    (*x)->Rebalance(m_fields, m_time);
+                }
             }
 
             // Ensure that there is no conflict of parameters
@@ -239,9 +342,26 @@ namespace Nektar
                      "Only one of IO_CheckTime and IO_CheckSteps "
                      "should be set!");
 
+            // Assign the elements to rate groups from their time-step limits
+            // at the initial condition.
+            Array<OneD, NekDouble> elmtTimeStep;
+            if (m_multirate)
+            {
+                elmtTimeStep = Array<OneD, NekDouble>(
+                    m_fields[0]->GetExpSize());
+                GetElmtTimeSteps(fields, elmtTimeStep);
+                m_multirate->SetRateGroups(elmtTimeStep);
+
+                // A prescribed time-step is the step of the fastest group.
+                if (!m_cflSafetyFactor)
+                {
+                    m_timestep *= m_multirate->GetNumSubSteps();
+                }
+            }
+
             Timer     timer;
             bool      doCheckTime   = false;
-            int       step          = 0;
+            int       step          = m_initialStep;
             NekDouble intTime       = 0.0;
             NekDouble lastCheckTime = 0.0;
             NekDouble cpuTime       = 0.0;
@@ -252,7 +372,16 @@ namespace Nektar
             {
                 if (m_cflSafetyFactor)
                 {
-                    m_timestep = GetTimeStep(fields);
+                    if (m_multirate)
+                    {
+                        GetElmtTimeSteps(fields, elmtTimeStep);
+                        m_timestep = m_cflSafetyFactor *
+                            m_multirate->GetMaxTimeStep(elmtTimeStep);
+                    }
+                    else
+                    {
+                        m_timestep = GetTimeStep(fields);
+                    }
                     
                     // Ensure that the final timestep finishes at the final
                     // time, or at a prescribed IO_CheckTime.
@@ -275,15 +404,32 @@ namespace Nektar
                     break;
                 }
 
+                NekDouble exchTime =
+                    MultiRegions::AssemblyMapDG::GetTraceExchangeTime();
+
                 timer.Start();
-                fields = m_intScheme->TimeIntegrate(
-                    step, m_timestep, m_intSoln, m_ode);
+                if (m_multirate)
+                {
+                    m_multirate->TimeIntegrate(m_timestep, m_time, m_ode,
+                                               fields);
+                }
+                else
+                {
+                    fields = m_intScheme->TimeIntegrate(
+                        step - m_initialStep, m_timestep, m_intSoln, m_ode);
+                }
                 timer.Stop();
 
                 m_time  += m_timestep;
                 elapsed  = timer.TimePerTest(1);
                 intTime += elapsed;
                 cpuTime += elapsed;
+
+                // The load of this process excludes the time spent waiting
+                // for others in trace exchanges.
+                m_loadTime += elapsed - (
+                    MultiRegions::AssemblyMapDG::GetTraceExchangeTime() -
+                    exchTime);
 		
                 // Write out status information
                 if (m_session->GetComm()->GetRank() == 0 && 
@@ -366,6 +512,16 @@ namespace Nektar
                     doCheckTime = false;
                 }
 
+                // Stop to repartition the mesh if the load is unbalanced.
+                if (m_rebalanceSteps && !((step + 1) % m_rebalanceSteps) &&
+                    CheckLoadBalance())
+                {
+                    m_rebalance   = true;
+                    m_initialStep = step + 1;
+                    m_nchk        = nchk;
+                    return;
+                }
+
                 // Step advance
                 ++step;
             }
@@ -383,6 +539,44 @@ namespace Nektar
                 {
                     cout << "Time-integration  : " << intTime  << "s"   << endl;
                 }
+
+                if (m_session->DefinesCmdLineArgument("verbose"))
+                {
+                    unsigned int nBuffers, nHeapAllocs;
+                    WorkspaceArena::GetTotalStatistics(nBuffers, nHeapAllocs);
+                    cout << "Workspace buffers : " << nBuffers << " ("
+                         << nHeapAllocs << " heap allocations)" << endl;
+                }
+            }
+
+            if (m_multirate && m_session->DefinesCmdLineArgument("verbose"))
+            {
+                // Rate group sizes and element right-hand side evaluations
+                // relative to a single-rate scheme, summed over processes.
+                LibUtilities::CommSharedPtr comm = m_session->GetComm();
+                int nLevels = m_multirate->GetNumLevels();
+                std::vector<int> sizes = m_multirate->GetLevelSizes();
+                Array<OneD, NekDouble> work(2);
+                m_multirate->GetWork(work[0], work[1]);
+                comm->AllReduce(work, LibUtilities::ReduceSum);
+
+                for (i = 0; i < nLevels; ++i)
+                {
+                    comm->AllReduce(sizes[i], LibUtilities::ReduceSum);
+                }
+
+                if (comm->GetRank() == 0)
+                {
+                    cout << "Multirate levels  : " << nLevels << " (";
+                    for (i = 0; i < nLevels; ++i)
+                    {
+                        cout << (i ? ", " : "") << sizes[i];
+                    }
+                    cout << " elements)" << endl
+                         << "Multirate work    : "
+                         << 100.0 * work[0] / max(work[1], 1.0)
+                         << "% of single-rate" << endl;
+                }
             }
             
             // If homogeneous, transform back into physical space if necessary.
@@ -426,10 +620,134 @@ namespace Nektar
          */
         void UnsteadySystem::v_DoInitialise()
         {
+            if (!m_resumeFile.empty())
+            {
+                // Continue from the state saved when the processes were
+                // rebalanced.
+                SetBoundaryConditions(m_time);
+                ImportFld(m_resumeFile, m_fields);
+                for (int i = 0; i < m_fields.num_elements(); ++i)
+                {
+                    m_fields[i]->BwdTrans(m_fields[i]->GetCoeffs(),
+                                          m_fields[i]->UpdatePhys());
+                    m_fields[i]->SetPhysState(true);
+                }
+                m_fieldMetaDataMap["Time"] =
+                    boost::lexical_cast<std::string>(m_time);
+                return;
+            }
+
             CheckForRestartTime(m_time);
             SetBoundaryConditions(m_time);
             SetInitialConditions(m_time);
         }
+
+        /**
+         * @brief Determines whether the load of the processes is unbalanced.
+         *
+         * The load of each process is its compute time since the last check,
+         * excluding time spent waiting in trace exchanges. The processes are
+         * considered unbalanced when the maximum load exceeds the mean by
+         * more than the factor RebalanceTolerance.
+         */
+        bool UnsteadySystem::CheckLoadBalance()
+        {
+            LibUtilities::CommSharedPtr comm = m_session->GetComm();
+            NekDouble maxLoad = m_loadTime, sumLoad = m_loadTime;
+            comm->AllReduce(maxLoad, LibUtilities::ReduceMax);
+            comm->AllReduce(sumLoad, LibUtilities::ReduceSum);
+
+            NekDouble meanLoad = sumLoad / comm->GetSize();
+            bool unbalanced = maxLoad > m_rebalanceTol * meanLoad;
+
+            if (unbalanced && comm->GetRank() == 0)
+            {
+                cout << "Rebalancing: maximum process load is "
+                     << maxLoad / meanLoad << " times the mean" << endl;
+            }
+
+            m_lastLoadTime = m_loadTime;
+            m_loadTime     = 0.0;
+            return unbalanced;
+        }
+
+        bool UnsteadySystem::RebalanceRequested() const
+        {
+            return m_rebalance;
+        }
+
+        /**
+         * @brief Computes a weight for every element of the mesh from the
+         * measured load of the processes.
+         *
+         * The load of each process is shared between its elements in
+         * proportion to their number of quadrature points, which accounts for
+         * differing polynomial orders. The weights of all elements, indexed by
+         * their global ID, are returned on every process.
+         */
+        void UnsteadySystem::GetElementWeights(
+            std::map<int, NekDouble> &pWeights)
+        {
+            LibUtilities::CommSharedPtr comm = m_session->GetComm();
+            int e, nElmt = m_fields[0]->GetExpSize();
+            int maxId = 0, nPts = m_fields[0]->GetTotPoints();
+
+            for (e = 0; e < nElmt; ++e)
+            {
+                maxId = max(maxId,
+                            m_fields[0]->GetExp(e)->GetGeom()->GetGlobalID());
+            }
+            comm->AllReduce(maxId, LibUtilities::ReduceMax);
+
+            Array<OneD, NekDouble> weights(maxId + 1, 0.0);
+            for (e = 0; e < nElmt; ++e)
+            {
+                LocalRegions::ExpansionSharedPtr exp = m_fields[0]->GetExp(e);
+                weights[exp->GetGeom()->GetGlobalID()] =
+                    m_lastLoadTime * exp->GetTotPoints() / nPts;
+            }
+            comm->AllReduce(weights, LibUtilities::ReduceSum);
+
+            pWeights.clear();
+            for (e = 0; e <= maxId; ++e)
+            {
+                if (weights[e] > 0.0)
+                {
+                    pWeights[e] = weights[e];
+                }
+            }
+        }
+
+        void UnsteadySystem::GetResumeState(
+            int                          &pStep,
+            int                          &pNchk,
+            std::vector<FilterSharedPtr> &pFilters)
+        {
+            pStep    = m_initialStep;
+            pNchk    = m_nchk;
+            pFilters = m_filters;
+        }
+
+        /**
+         * @brief Sets the state from which DoInitialise and DoSolve continue
+         * after the processes have been rebalanced.
+         *
+         * The filters of the previous equation system replace those of this
+         * one, so that their output continues rather than restarts.
+         */
+        void UnsteadySystem::SetResumeState(
+            const std::string                  &pFile,
+            NekDouble                           pTime,
+            int                                 pStep,
+            int                                 pNchk,
+            const std::vector<FilterSharedPtr> &pFilters)
+        {
+            m_resumeFile  = pFile;
+            m_time        = pTime;
+            m_initialStep = pStep;
+            m_nchk        = pNchk;
+            m_filters     = pFilters;
+        }
         
         /**
          * @brief Prints a summary with some information regards the 
@@ -884,6 +1202,43 @@ namespace Nektar
             return 0.0;
         }
 
+        /**
+         * @brief Return the time-step limit of each element at unit CFL
+         * number, used to assign the elements to the rate groups of the
+         * multirate integrator.
+         */
+        void UnsteadySystem::GetElmtTimeSteps(
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD, NekDouble>                     &tstep)
+        {
+            v_GetElmtTimeSteps(inarray, tstep);
+        }
+
+        /**
+         * @see UnsteadySystem::GetElmtTimeSteps
+         */
+        void UnsteadySystem::v_GetElmtTimeSteps(
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD, NekDouble>                     &tstep)
+        {
+            ASSERTL0(false, "Element time-step limits not defined for this "
+                            "class");
+        }
+
+        /**
+         * @brief Restrict the element-wise work of the right-hand side to
+         * the elements @a elmts, or to all elements if @a allElmts is set.
+         *
+         * Called by the multirate integrator before each right-hand side
+         * evaluation. By default the right-hand side is evaluated everywhere,
+         * which is correct but does not save any work.
+         */
+        void UnsteadySystem::v_SetActiveElmts(
+            bool                           allElmts,
+            const Array<OneD, const int>  &elmts)
+        {
+        }
+
         bool UnsteadySystem::v_PreIntegrate(int step)
         {
             return false;
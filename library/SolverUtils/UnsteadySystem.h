@@ -39,6 +39,7 @@
 #include <LibUtilities/TimeIntegration/TimeIntegrationWrapper.h>
 #include <SolverUtils/EquationSystem.h>
 #include <SolverUtils/Filters/Filter.h>
+#include <SolverUtils/Core/MultirateAdamsBashforth.h>
 
 namespace Nektar
 {
@@ -55,6 +56,34 @@ namespace Nektar
             SOLVER_UTILS_EXPORT NekDouble GetTimeStep(
                 const Array<OneD, const Array<OneD, NekDouble> > &inarray);
 		
+            /// Time-step limit of each element at unit CFL number.
+            SOLVER_UTILS_EXPORT void GetElmtTimeSteps(
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD, NekDouble>                     &tstep);
+
+            /// Whether time-stepping stopped to rebalance the processes.
+            SOLVER_UTILS_EXPORT bool RebalanceRequested() const;
+
+            /// Element weights from the load measured on each process.
+            SOLVER_UTILS_EXPORT void GetElementWeights(
+                std::map<int, NekDouble> &pWeights);
+
+            /// Step, checkpoint number and filters with which to resume
+            /// time-stepping.
+            SOLVER_UTILS_EXPORT void GetResumeState(
+                int                          &pStep,
+                int                          &pNchk,
+                std::vector<FilterSharedPtr> &pFilters);
+
+            /// Resume time-stepping from a field file instead of the initial
+            /// conditions.
+            SOLVER_UTILS_EXPORT void SetResumeState(
+                const std::string                  &pFile,
+                NekDouble                           pTime,
+                int                                 pStep,
+                int                                 pNchk,
+                const std::vector<FilterSharedPtr> &pFilters);
+
             /// CFL safety factor (comprise between 0 to 1).
             NekDouble m_cflSafetyFactor;
 		                        
@@ -83,6 +112,28 @@ namespace Nektar
 
             std::vector<FilterSharedPtr>                    m_filters;
 
+            /// Multirate integrator, if local time-stepping is enabled.
+            MultirateAdamsBashforthSharedPtr                m_multirate;
+
+            /// Number of steps between checks of the load balance, or zero
+            /// to disable rebalancing.
+            int                                             m_rebalanceSteps;
+            /// Ratio of the maximum to the mean process load above which the
+            /// mesh is repartitioned.
+            NekDouble                                       m_rebalanceTol;
+            /// Compute time of this process since the last check.
+            NekDouble                                       m_loadTime;
+            /// Compute time of this process before the last rebalance.
+            NekDouble                                       m_lastLoadTime;
+            /// Set when time-stepping stopped to rebalance the processes.
+            bool                                            m_rebalance;
+            /// Step at which time-stepping starts.
+            int                                             m_initialStep;
+            /// Number of the next checkpoint file.
+            int                                             m_nchk;
+            /// Field file from which to resume time-stepping.
+            std::string                                     m_resumeFile;
+
             /// Initialises UnsteadySystem class members.
             SOLVER_UTILS_EXPORT UnsteadySystem(
                 const LibUtilities::SessionReaderSharedPtr& pSession);
@@ -131,12 +182,29 @@ namespace Nektar
             SOLVER_UTILS_EXPORT virtual NekDouble v_GetTimeStep(
                 const Array<OneD, const Array<OneD, NekDouble> > &inarray);
 
+            SOLVER_UTILS_EXPORT virtual void v_GetElmtTimeSteps(
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD, NekDouble>                     &tstep);
+
+            SOLVER_UTILS_EXPORT virtual void v_SetActiveElmts(
+                bool                           allElmts,
+                const Array<OneD, const int>  &elmts);
+
             SOLVER_UTILS_EXPORT virtual bool v_PreIntegrate(int step);
             SOLVER_UTILS_EXPORT virtual bool v_PostIntegrate(int step);
             SOLVER_UTILS_EXPORT virtual bool v_SteadyStateCheck(int step);
 
             SOLVER_UTILS_EXPORT void CheckForRestartTime(NekDouble &time);
 
+            SOLVER_UTILS_EXPORT bool CheckLoadBalance();
+
+            /// Restrict the right-hand side evaluation to a set of elements.
+            SOLVER_UTILS_EXPORT void SetActiveElmts(
+                bool                           allElmts,
+                const Array<OneD, const int>  &elmts)
+            {
+                v_SetActiveElmts(allElmts, elmts);
+            }
 
         private:
             ///
@@ -155,6 +223,8 @@ namespace Nektar
                 NekDouble C11,
                 NekDouble time=0.0);
         };
+
+        typedef boost::shared_ptr<UnsteadySystem> UnsteadySystemSharedPtr;
     }
 }
 
@@ -213,7 +213,8 @@ namespace SpatialDomains
 
     /**
      * Returns cached value if available, otherwise computes Jacobian and
-     * stores result in cache.
+     * stores result in cache. Regular elements store a single value which is
+     * reused for every target point distribution.
      *
      * @param   keyTgt      Target point distributions.
      * @returns             Jacobian evaluated at target point
@@ -231,6 +232,13 @@ namespace SpatialDomains
             return x->second;
         }
 
+        // The Jacobian of a regular element is a single constant, which is
+        // shared between all point distributions.
+        if (m_type != eDeformed && !m_jacCache.empty())
+        {
+            return m_jacCache.begin()->second;
+        }
+
         m_jacCache[keyTgt] = ComputeJac(keyTgt);
 
         return m_jacCache[keyTgt];
@@ -252,7 +260,8 @@ namespace SpatialDomains
 
     /**
      * Returns cached value if available, otherwise computes derivative
-     * factors and stores result in cache.
+     * factors and stores result in cache. As for the Jacobian, regular
+     * elements store a single set of factors for all point distributions.
      *
      * @param   keyTgt      Target point distributions.
      * @returns             Derivative factors evaluated at target point
@@ -270,6 +279,13 @@ namespace SpatialDomains
             return x->second;
         }
 
+        // Derivative factors of a regular element are constant, so are
+        // shared between all point distributions.
+        if (m_type != eDeformed && !m_derivFactorCache.empty())
+        {
+            return m_derivFactorCache.begin()->second;
+        }
+
         m_derivFactorCache[keyTgt] = ComputeDerivFactors(keyTgt);
 
         return m_derivFactorCache[keyTgt];
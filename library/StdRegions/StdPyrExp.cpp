@@ -1878,6 +1878,50 @@ namespace Nektar
             return cnt + K;
         }
 
+        /**
+         * @brief Return the coefficient ordering in a flattened form suitable
+         * for sum-factorisation over multiple elements.
+         *
+         * Modes are visited in \f$ (p,q,r) \f$ lexicographic order. For each
+         * of the \f$ (p,q) \f$ pairs (with \f$ q \f$ running fastest)
+         * \a nModesPQ holds the number of \f$ r \f$ modes. \a coeffMap
+         * and \a zModeMap then hold, for each mode in turn, its coefficient
+         * index and the column of the \f$ \eta_3 \f$ basis it uses.
+         */
+        void StdPyrExp::GetSumFacModeMap(
+            Array<OneD, int> &nModesPQ,
+            Array<OneD, int> &coeffMap,
+            Array<OneD, int> &zModeMap) const
+        {
+            map<int, map<int, map<int, pair<int, int> > > >::const_iterator it_p;
+            map<int, map<int,          pair<int, int> > >  ::const_iterator it_q;
+            map<int,                   pair<int, int> >    ::const_iterator it_r;
+
+            int pqcnt = 0;
+            for (it_p = m_idxMap.begin(); it_p != m_idxMap.end(); ++it_p)
+            {
+                pqcnt += it_p->second.size();
+            }
+
+            nModesPQ = Array<OneD, int>(pqcnt);
+            coeffMap = Array<OneD, int>(m_ncoeffs);
+            zModeMap = Array<OneD, int>(m_ncoeffs);
+
+            int cnt = 0, cnt2 = 0;
+            for (it_p = m_idxMap.begin(); it_p != m_idxMap.end(); ++it_p)
+            {
+                for (it_q = it_p->second.begin(); it_q != it_p->second.end(); ++it_q)
+                {
+                    nModesPQ[cnt2++] = it_q->second.size();
+                    for (it_r = it_q->second.begin(); it_r != it_q->second.end(); ++it_r)
+                    {
+                        coeffMap[cnt]   = it_r->second.first;
+                        zModeMap[cnt++] = it_r->second.second;
+                    }
+                }
+            }
+        }
+
         void StdPyrExp::v_MultiplyByStdQuadratureMetric(
             const Array<OneD, const NekDouble>& inarray,
                   Array<OneD,       NekDouble>& outarray)
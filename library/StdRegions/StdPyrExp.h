@@ -100,6 +100,11 @@ namespace Nektar
 
             STD_REGIONS_EXPORT int GetTetMode(int I, int J, int K);
 
+            STD_REGIONS_EXPORT void GetSumFacModeMap(
+                Array<OneD, int> &nModesPQ,
+                Array<OneD, int> &coeffMap,
+                Array<OneD, int> &zModeMap) const;
+
         protected:
             //---------------------------------------
             // Differentiation/integration Methods
@@ -2002,6 +2002,152 @@ namespace Nektar
             }
         }
 
+        BOOST_AUTO_TEST_CASE(TestPrismHelmholtz_SumFac_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(3u, 0u, -1.0, -1.0, -1.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(3u, 1u,  1.0, -1.0, -1.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, -1.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, -1.0));
+            SpatialDomains::PointGeomSharedPtr v4(new SpatialDomains::PointGeom(3u, 4u, -1.0, -1.0,  1.0));
+            SpatialDomains::PointGeomSharedPtr v5(new SpatialDomains::PointGeom(3u, 5u, -1.0,  1.0,  1.0));
+            
+            SpatialDomains::PrismGeomSharedPtr prismGeom = CreatePrism(v0, v1, v2, v3, v4, v5);
+            
+            Nektar::LibUtilities::PointsType     PointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            const Nektar::LibUtilities::PointsKey PointsKeyDir1(5, PointsTypeDir1);
+            Nektar::LibUtilities::BasisType       basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::BasisKey  basisKeyDir1(basisTypeDir1,4,PointsKeyDir1);
+
+            Nektar::LibUtilities::PointsType      PointsTypeDir2 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            const Nektar::LibUtilities::PointsKey PointsKeyDir2(7, PointsTypeDir2);
+            Nektar::LibUtilities::BasisType       basisTypeDir2 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::BasisKey  basisKeyDir2(basisTypeDir2,6,PointsKeyDir2);
+
+            Nektar::LibUtilities::PointsType     PointsTypeDir3 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            const Nektar::LibUtilities::PointsKey PointsKeyDir3(8, PointsTypeDir3);
+            Nektar::LibUtilities::BasisType       basisTypeDir3 = Nektar::LibUtilities::eModified_B;
+            const Nektar::LibUtilities::BasisKey  basisKeyDir3(basisTypeDir3,8,PointsKeyDir3);
+            
+            Nektar::LocalRegions::PrismExpSharedPtr Exp = 
+                MemoryManager<Nektar::LocalRegions::PrismExp>::AllocateSharedPtr(basisKeyDir1,
+                                                                                 basisKeyDir2,
+                                                                                 basisKeyDir3,
+                                                                                 prismGeom);
+
+            int nelmts = 10;
+            
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+                        
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation  colOpt(dummySession, Collections::eSumFac);
+            Collections::OperatorImpMap          impTypes = colOpt.GetOperatorImpMap(Exp);
+            Collections::Collection              c(CollExp, impTypes);
+
+            Array<OneD, NekDouble> coeffs(nelmts*Exp->GetNcoeffs(),  1.0);
+            Array<OneD, NekDouble> phys1(nelmts*Exp->GetTotPoints(), 0.0);
+            Array<OneD, NekDouble> phys2(nelmts*Exp->GetTotPoints(), 0.0);
+            Array<OneD, NekDouble> tmp;
+            
+            for(int i = 0; i < nelmts; ++i)
+            {
+                Exp->BwdTrans(coeffs + i*Exp->GetNcoeffs(), tmp = phys1+i*Exp->GetTotPoints());
+            }
+            c.ApplyOperator(Collections::eBwdTrans, coeffs, phys2);
+
+            double epsilon = 1.0e-8;
+            for(int i = 0; i < phys1.num_elements(); ++i)
+            {
+                BOOST_CHECK_CLOSE(phys1[i],phys2[i], epsilon);
+            }
+
+        }
 
+        BOOST_AUTO_TEST_CASE(TestPrismHelmholtz_IterPerExp_UniformP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(3u, 0u, -1.0, -1.0, -1.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(3u, 1u,  1.0, -1.0, -1.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, -1.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, -1.0));
+            SpatialDomains::PointGeomSharedPtr v4(new SpatialDomains::PointGeom(3u, 4u, -1.0, -1.0,  1.0));
+            SpatialDomains::PointGeomSharedPtr v5(new SpatialDomains::PointGeom(3u, 5u, -1.0,  1.0,  1.0));
+            
+            SpatialDomains::PrismGeomSharedPtr prismGeom = CreatePrism(v0, v1, v2, v3, v4, v5);
+            
+            Nektar::LibUtilities::PointsType     PointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            const Nektar::LibUtilities::PointsKey PointsKeyDir1(5, PointsTypeDir1);
+            Nektar::LibUtilities::BasisType       basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::BasisKey  basisKeyDir1(basisTypeDir1,4,PointsKeyDir1);
+
+            Nektar::LibUtilities::PointsType      PointsTypeDir2 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            const Nektar::LibUtilities::PointsKey PointsKeyDir2(5, PointsTypeDir2);
+            Nektar::LibUtilities::BasisType       basisTypeDir2 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::BasisKey  basisKeyDir2(basisTypeDir2,4,PointsKeyDir2);
+
+            Nektar::LibUtilities::PointsType     PointsTypeDir3 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            const Nektar::LibUtilities::PointsKey PointsKeyDir3(4, PointsTypeDir3);
+            Nektar::LibUtilities::BasisType       basisTypeDir3 = Nektar::LibUtilities::eModified_B;
+            const Nektar::LibUtilities::BasisKey  basisKeyDir3(basisTypeDir3,4,PointsKeyDir3);
+
+
+            
+            Nektar::LocalRegions::PrismExpSharedPtr Exp = 
+                MemoryManager<Nektar::LocalRegions::PrismExp>::AllocateSharedPtr(basisKeyDir1,
+                                                                                 basisKeyDir2,
+                                                                                 basisKeyDir3,
+                                                                                 prismGeom);
+
+            int nelmts = 10;
+            
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+                        
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eIterPerExp);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(Exp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            StdRegions::ConstFactorMap factors;
+            factors[StdRegions::eFactorLambda] = 1.5;
+
+            const int nm = Exp->GetNcoeffs();
+            Array<OneD, NekDouble> coeffsIn (nelmts*nm);
+            Array<OneD, NekDouble> coeffsRef(nelmts*nm);
+            Array<OneD, NekDouble> coeffs   (nelmts*nm), tmp;
+
+            for (int i = 0; i < nm; ++i)
+            {
+                coeffsIn[i] = 1.0/(i+1.0);
+            }
+            for (int i = 1; i < nelmts; ++i)
+            {
+                Vmath::Vcopy(nm, coeffsIn, 1, tmp = coeffsIn + i*nm, 1);
+            }
+
+            StdRegions::StdMatrixKey mkey(StdRegions::eHelmholtz,
+                                          Exp->DetShapeType(), *Exp, factors);
+            for (int i = 0; i < nelmts; ++i)
+            {
+                Exp->GeneralMatrixOp(coeffsIn + i*nm,
+                                     tmp = coeffsRef + i*nm, mkey);
+            }
+
+            c.UpdateFactors(Collections::eHelmholtz, factors);
+            c.ApplyOperator(Collections::eHelmholtz, coeffsIn, coeffs);
+
+            double epsilon = 1.0e-8;
+            for(int i = 0; i < coeffsRef.num_elements(); ++i)
+            {
+                coeffsRef[i] = (fabs(coeffsRef[i]) < 1e-14)? 0.0: coeffsRef[i];
+                coeffs[i]    = (fabs(coeffs[i])    < 1e-14)? 0.0: coeffs[i];
+                BOOST_CHECK_CLOSE(coeffsRef[i],coeffs[i], epsilon);
+            }
+        }
     }
 }
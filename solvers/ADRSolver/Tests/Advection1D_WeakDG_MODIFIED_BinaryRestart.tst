@@ -0,0 +1,18 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>1D unsteady WeakDG advection MODIFIED, P=3, restart from binary checkpoint</description>
+    <executable>ADRSolver</executable>
+    <parameters>Advection1D_WeakDG_MODIFIED_BinaryRestart.xml</parameters>
+    <files>
+        <file description="Session File">Advection1D_WeakDG_MODIFIED_BinaryRestart.xml</file>
+        <file description="Restart File">Advection1D_WeakDG_MODIFIED_BinaryRestart.rst</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-12">0.00962912</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="u" tolerance="1e-12">0.0195379</value>
+        </metric>
+    </metrics>
+</test>
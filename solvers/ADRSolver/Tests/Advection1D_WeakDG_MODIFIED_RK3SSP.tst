@@ -0,0 +1,17 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>1D unsteady WeakDG advection MODIFIED, P=3, SSP-RK3</description>
+    <executable>ADRSolver</executable>
+    <parameters>Advection1D_WeakDG_MODIFIED_RK3SSP.xml</parameters>
+    <files>
+        <file description="Session File">Advection1D_WeakDG_MODIFIED_RK3SSP.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-12">0.00962579</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="u" tolerance="1e-12">0.017829</value>
+        </metric>
+    </metrics>
+</test>
@@ -256,6 +256,87 @@ void APE::DoOdeRhs(const Array<OneD, const Array<OneD, NekDouble> >&inarray,
 }
 
 
+/**
+ * @brief Return the time-step limit of the CFL condition.
+ */
+NekDouble APE::v_GetTimeStep(
+        const Array<OneD, const Array<OneD, NekDouble> > &inarray)
+{
+    int nElmts = m_fields[0]->GetExpSize();
+    Array<OneD, NekDouble> tstep(nElmts);
+
+    GetElmtTimeSteps(inarray, tstep);
+
+    NekDouble timestep = m_cflSafetyFactor * Vmath::Vmin(nElmts, tstep, 1);
+    m_comm->AllReduce(timestep, LibUtilities::ReduceMin);
+    return timestep;
+}
+
+
+/**
+ * @brief Compute the time-step limit of each element at unit CFL number.
+ *
+ * The limit is based on the fastest acoustic wave c + |u0| of the base flow
+ * in the element, its characteristic length and polynomial order.
+ */
+void APE::v_GetElmtTimeSteps(
+        const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+        Array<OneD, NekDouble> &tstep)
+{
+    int nElmts = m_fields[0]->GetExpSize();
+    int nq = m_fields[0]->GetTotPoints();
+    const Array<OneD, int> expOrder = GetNumExpModesPerExp();
+    NekDouble alpha = MaxTimeStepEstimator();
+
+    // Wave speed c + |u0|, with c^2 = gamma*p0/rho0
+    Array<OneD, NekDouble> c(nq), umag(nq, 0.0);
+    Vmath::Vdiv(nq, m_basefield[0], 1, m_basefield[1], 1, c, 1);
+    Vmath::Smul(nq, m_gamma, c, 1, c, 1);
+    Vmath::Vsqrt(nq, c, 1, c, 1);
+    for (int i = 0; i < m_spacedim; ++i)
+    {
+        Vmath::Vvtvp(nq, m_basefield[i + 2], 1, m_basefield[i + 2], 1,
+                     umag, 1, umag, 1);
+    }
+    Vmath::Vsqrt(nq, umag, 1, umag, 1);
+    Vmath::Vadd(nq, c, 1, umag, 1, c, 1);
+
+    for (int n = 0; n < nElmts; ++n)
+    {
+        LocalRegions::ExpansionSharedPtr exp = m_fields[0]->GetExp(n);
+        int offset = m_fields[0]->GetPhys_Offset(n);
+        int npoints = exp->GetTotPoints();
+
+        Array<OneD, NekDouble> one(npoints, 1.0);
+        NekDouble length = pow(exp->Integral(one),
+                               1.0 / exp->GetShapeDimension());
+        NekDouble vmax = Vmath::Vmax(npoints, &c[offset], 1);
+        NekDouble p = max(expOrder[n] - 1, 1);
+
+        tstep[n] = alpha * length / (vmax * p * p);
+    }
+}
+
+
+/**
+ * @brief Restrict the advection volume terms to the elements being advanced
+ * by the multirate integrator.
+ */
+void APE::v_SetActiveElmts(
+        bool allElmts,
+        const Array<OneD, const int> &elmts)
+{
+    if (allElmts)
+    {
+        m_advection->ClearActiveElmts();
+    }
+    else
+    {
+        m_advection->SetActiveElmts(elmts);
+    }
+}
+
+
 /**
  * @brief Compute the projection and call the method for imposing the
  * boundary conditions in case of discontinuous projection.
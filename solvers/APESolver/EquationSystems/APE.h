@@ -101,6 +101,17 @@ class APE : public UnsteadySystem
 
         void AddSource(Array< OneD, Array< OneD, NekDouble > >& outarray);
 
+        virtual NekDouble v_GetTimeStep(
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray);
+
+        virtual void v_GetElmtTimeSteps(
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                Array<OneD, NekDouble> &tstep);
+
+        virtual void v_SetActiveElmts(
+                bool allElmts,
+                const Array<OneD, const int> &elmts);
+
         virtual void v_ExtraFldOutput(std::vector<Array<OneD, NekDouble> > &fieldcoeffs,
                                       std::vector<std::string>             &variables);
 
@@ -59,8 +59,22 @@ namespace Nektar
      * time-integrated using the Rush-Larsen method and for each variable y,
      * the corresponding y_inf and tau_y value is computed by Update(). The tau
      * values are stored in separate storage to inarray/outarray, #m_gates_tau.
+     *
+     * Cell models may instead implement v_UpdateBlock, which evaluates the
+     * model for a contiguous block of points in a single loop. In this case
+     * TimeIntegrate processes the points in small blocks, performing all
+     * substeps of a block before moving to the next, so that the model
+     * variables are read from and written to memory once per PDE timestep
+     * rather than once per arithmetic operation. Setting the CellModelKernel
+     * solver info to Array selects the array-based integration through
+     * v_Update instead, which by default wraps the block kernel over all
+     * points. Models whose array implementation differs from their block
+     * kernel, such as CourtemancheRamirezNattel98, override v_Update.
      */
 
+    /// Number of points processed together by the fused kernel.
+    static const int s_blockSize = 32;
+
     /**
      * Cell model base class constructor.
      */
@@ -73,6 +87,8 @@ namespace Nektar
         m_substeps = pSession->GetParameter("Substeps");
         m_nvar = 0;
         m_useNodal = false;
+        m_hasFusedKernel = false;
+        m_useFused = false;
 
         // Number of points in nodal space is the number of coefficients
         // in modified basis
@@ -140,6 +156,9 @@ namespace Nektar
             m_gates_tau[i] = Array<OneD, NekDouble>(m_nq);
         }
 
+        m_useFused = m_hasFusedKernel &&
+            !m_session->MatchSolverInfo("CellModelKernel", "Array");
+
         if (m_session->DefinesFunction("CellModelInitialConditions"))
         {
             LoadCellModel();
@@ -215,17 +234,42 @@ namespace Nektar
         NekDouble delta_t = (time - m_lastTime)/m_substeps;
 
 
-        // Perform substepping
-        for (unsigned int i = 0; i < m_substeps - 1; ++i)
+        if (m_useFused)
+        {
+            TimeIntegrateFused(delta_t);
+        }
+        else
         {
+            // Perform substepping
+            for (unsigned int i = 0; i < m_substeps - 1; ++i)
+            {
+                Update(m_cellSol, m_wsp, time);
+                // Voltage
+                Vmath::Svtvp(m_nq, delta_t, m_wsp[0], 1, m_cellSol[0], 1, m_cellSol[0], 1);
+                // Ion concentrations
+                for (unsigned int j = 0; j < m_concentrations.size(); ++j)
+                {
+                    Vmath::Svtvp(m_nq, delta_t, m_wsp[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1);
+                }
+                // Gating variables: Rush-Larsen scheme
+                for (unsigned int j = 0; j < m_gates.size(); ++j)
+                {
+                    Vmath::Sdiv(m_nq, -delta_t, m_gates_tau[j], 1, m_gates_tau[j], 1);
+                    Vmath::Vexp(m_nq, m_gates_tau[j], 1, m_gates_tau[j], 1);
+                    Vmath::Vsub(m_nq, m_cellSol[m_gates[j]], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
+                    Vmath::Vvtvp(m_nq, m_cellSol[m_gates[j]], 1, m_gates_tau[j], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
+                }
+            }
+
+            // Perform final cell model step
             Update(m_cellSol, m_wsp, time);
-            // Voltage
-            Vmath::Svtvp(m_nq, delta_t, m_wsp[0], 1, m_cellSol[0], 1, m_cellSol[0], 1);
+
             // Ion concentrations
             for (unsigned int j = 0; j < m_concentrations.size(); ++j)
             {
                 Vmath::Svtvp(m_nq, delta_t, m_wsp[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1);
             }
+
             // Gating variables: Rush-Larsen scheme
             for (unsigned int j = 0; j < m_gates.size(); ++j)
             {
@@ -236,9 +280,6 @@ namespace Nektar
             }
         }
 
-        // Perform final cell model step
-        Update(m_cellSol, m_wsp, time);
-
         // Output dV/dt from last step but integrate remaining cell model vars
         // Transform cell model I_total from nodal to modal space
         if (m_useNodal)
@@ -269,22 +310,116 @@ namespace Nektar
             Vmath::Vcopy(m_nq, m_wsp[0], 1, outarray[0], 1);
         }
 
-        // Ion concentrations
-        for (unsigned int j = 0; j < m_concentrations.size(); ++j)
+        m_lastTime = time;
+    }
+
+    /**
+     * Integrates the cell model over the substeps of one PDE time-step using
+     * the fused kernel. The points are processed in blocks of #s_blockSize,
+     * with all substeps of a block completed before the next, so that the
+     * cell model variables of the block remain in cache. The same schemes as
+     * the array implementation are used.
+     */
+    void CellModel::TimeIntegrateFused(const NekDouble delta_t)
+    {
+        const int nGates = m_gates.size();
+        const int nConc  = m_concentrations.size();
+
+        std::vector<NekDouble *> y  (m_nvar);
+        std::vector<NekDouble *> dy (m_nvar);
+        std::vector<NekDouble *> tau(nGates + 1);
+
+        for (int p = 0; p < m_nq; p += s_blockSize)
         {
-            Vmath::Svtvp(m_nq, delta_t, m_wsp[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1);
+            const int n = std::min(s_blockSize, m_nq - p);
+
+            for (int k = 0; k < m_nvar; ++k)
+            {
+                y[k]  = &m_cellSol[k][p];
+                dy[k] = &m_wsp[k][p];
+            }
+            for (int j = 0; j < nGates; ++j)
+            {
+                tau[j] = &m_gates_tau[j][p];
+            }
+
+            for (int s = 0; s < m_substeps; ++s)
+            {
+                v_UpdateBlock(n, &y[0], &dy[0], &tau[0]);
+
+                // Voltage, except on the final substep
+                if (s < m_substeps - 1)
+                {
+                    for (int i = 0; i < n; ++i)
+                    {
+                        y[0][i] += delta_t * dy[0][i];
+                    }
+                }
+
+                // Ion concentrations
+                for (int j = 0; j < nConc; ++j)
+                {
+                    NekDouble       *c  = y [m_concentrations[j]];
+                    const NekDouble *dc = dy[m_concentrations[j]];
+                    for (int i = 0; i < n; ++i)
+                    {
+                        c[i] += delta_t * dc[i];
+                    }
+                }
+
+                // Gating variables: Rush-Larsen scheme
+                for (int j = 0; j < nGates; ++j)
+                {
+                    NekDouble       *g    = y [m_gates[j]];
+                    const NekDouble *ginf = dy[m_gates[j]];
+                    const NekDouble *gtau = tau[j];
+                    for (int i = 0; i < n; ++i)
+                    {
+                        g[i] = (g[i] - ginf[i]) * exp(-delta_t / gtau[i])
+                             + ginf[i];
+                    }
+                }
+            }
         }
+    }
 
-        // Gating variables: Rush-Larsen scheme
-        for (unsigned int j = 0; j < m_gates.size(); ++j)
+    /**
+     * Evaluates the fused kernel over all points of the given arrays.
+     */
+    void CellModel::v_Update(
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &outarray,
+            const NekDouble time)
+    {
+        ASSERTL0(m_hasFusedKernel,
+                 "Cell model must implement v_Update or v_UpdateBlock.");
+
+        const int nGates = m_gates.size();
+
+        std::vector<const NekDouble *> y  (m_nvar);
+        std::vector<NekDouble *>       dy (m_nvar);
+        std::vector<NekDouble *>       tau(nGates + 1);
+
+        for (int k = 0; k < m_nvar; ++k)
+        {
+            y[k]  = &inarray[k][0];
+            dy[k] = &outarray[k][0];
+        }
+        for (int j = 0; j < nGates; ++j)
         {
-            Vmath::Sdiv(m_nq, -delta_t, m_gates_tau[j], 1, m_gates_tau[j], 1);
-            Vmath::Vexp(m_nq, m_gates_tau[j], 1, m_gates_tau[j], 1);
-            Vmath::Vsub(m_nq, m_cellSol[m_gates[j]], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
-            Vmath::Vvtvp(m_nq, m_cellSol[m_gates[j]], 1, m_gates_tau[j], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
+            tau[j] = &m_gates_tau[j][0];
         }
 
-        m_lastTime = time;
+        v_UpdateBlock(m_nq, &y[0], &dy[0], &tau[0]);
+    }
+
+    void CellModel::v_UpdateBlock(
+            const int                n,
+            const NekDouble * const *in,
+                  NekDouble * const *out,
+                  NekDouble * const *tau)
+    {
+        ASSERTL0(false, "v_UpdateBlock not implemented for this cell model.");
     }
 
     Array<OneD, NekDouble> CellModel::GetCellSolutionCoeffs(unsigned int idx)
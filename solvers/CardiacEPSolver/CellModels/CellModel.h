@@ -108,6 +108,20 @@ namespace Nektar
 
         Array<OneD, NekDouble> GetCellSolution(unsigned int idx);
 
+        /// Returns true if the cell model implements a fused kernel
+        bool HasFusedKernel()
+        {
+            return m_hasFusedKernel;
+        }
+
+        /// Select the fused or the array implementation of TimeIntegrate
+        void SetUseFusedKernel(bool pFused)
+        {
+            ASSERTL0(!pFused || m_hasFusedKernel,
+                     "Cell model does not implement a fused kernel.");
+            m_useFused = pFused;
+        }
+
     protected:
         /// Session
         LibUtilities::SessionReaderSharedPtr m_session;
@@ -142,10 +156,23 @@ namespace Nektar
         /// Storage for gate tau values
         Array<OneD, Array<OneD, NekDouble> > m_gates_tau;
 
+        /// Flag indicating whether the model implements v_UpdateBlock
+        bool m_hasFusedKernel;
+        /// Flag indicating whether the fused kernel is used
+        bool m_useFused;
+
         virtual void v_Update(
                 const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
                       Array<OneD,        Array<OneD, NekDouble> >&outarray,
-                const NekDouble time) = 0;
+                const NekDouble time);
+
+        /// Computes the derivatives, gate values and gate time constants
+        /// for @a n consecutive points.
+        virtual void v_UpdateBlock(
+                const int                n,
+                const NekDouble * const *in,
+                      NekDouble * const *out,
+                      NekDouble * const *tau);
 
         virtual void v_GenerateSummary(SummaryList& s) = 0;
 
@@ -157,6 +184,8 @@ namespace Nektar
         virtual void v_SetInitialConditions() = 0;
 
         void LoadCellModel();
+
+        void TimeIntegrateFused(const NekDouble delta_t);
     };
 
 }
@@ -149,6 +149,8 @@ namespace Nektar
         m_concentrations.push_back(18);
         m_concentrations.push_back(19);
         m_concentrations.push_back(20);
+
+        m_hasFusedKernel = true;
     }
     
     
@@ -567,6 +569,268 @@ namespace Nektar
     }
 
 
+
+    void CourtemancheRamirezNattel98::v_UpdateBlock(
+            const int                n,
+            const NekDouble * const *in,
+                  NekDouble * const *out,
+                  NekDouble * const *tau)
+    {
+        // Variables
+        //  0   V    membrane potential
+        //  1   m    fast sodium current m gate
+        //  2   h    fast sodium current h gate
+        //  3   j    fast sodium current j gate
+        //  4   o_a  transient outward potassium o_a gate
+        //  5   o_i  transient outward potassium o_i gate
+        //  6   u_a  ultra-rapid delayed rectifier K current gate
+        //  7   u_i  ultra-rapid delayed rectifier K current gate
+        //  8   x_r  rapid delayed rectifier K current gate
+        //  9   x_s  slow delayed rectifier K current gate
+        //  10  d    L_type calcium gate
+        //  11  f    L-type calcium gate
+        //  12  f_Ca L-type calcium gate
+        //  13  u    Ca release u gate
+        //  14  v    Ca release v gate
+        //  15  w    Ca release w gate
+        //  16  Na_i Sodium
+        //  17  Ca_i Calcium
+        //  18  K_i  Potassium
+        //  19  Ca_rel Calcium Rel
+        //  20  Ca_up  Calcium up
+        const NekDouble RTF       = R*T/F;
+        const NekDouble FRT       = F/R/T;
+        const NekDouble NaCa_den  = (K_m_Na*K_m_Na*K_m_Na + Na_o*Na_o*Na_o)
+                                  * (K_m_Ca + Ca_o);
+        const NekDouble Na_o3     = Na_o*Na_o*Na_o;
+        const NekDouble I_Na_K_sc = C_m*I_Na_K_max*K_o/(K_o+K_i);
+
+        NekDouble alpha, beta;
+
+        for (int i = 0; i < n; ++i)
+        {
+            const NekDouble V      = in[0][i];
+            const NekDouble m      = in[1][i];
+            const NekDouble h      = in[2][i];
+            const NekDouble j      = in[3][i];
+            const NekDouble o_a    = in[4][i];
+            const NekDouble o_i    = in[5][i];
+            const NekDouble u_a    = in[6][i];
+            const NekDouble u_i    = in[7][i];
+            const NekDouble x_r    = in[8][i];
+            const NekDouble x_s    = in[9][i];
+            const NekDouble d      = in[10][i];
+            const NekDouble f      = in[11][i];
+            const NekDouble f_Ca   = in[12][i];
+            const NekDouble u      = in[13][i];
+            const NekDouble v      = in[14][i];
+            const NekDouble w      = in[15][i];
+            const NekDouble Na_i   = in[16][i];
+            const NekDouble Ca_i   = in[17][i];
+            const NekDouble K_in   = in[18][i];
+            const NekDouble Ca_rel = in[19][i];
+            const NekDouble Ca_up  = in[20][i];
+
+            NekDouble dV = 0.0, dNa, dK, tmp;
+
+            // E_Na
+            const NekDouble E_na = RTF * log(Na_o / Na_i);
+
+            // Sodium I_Na
+            const NekDouble I_Na = C_m*g_Na * (j*(h*(m*(m*(m*(V - E_na))))));
+            dV -= I_Na;
+            dNa = -I_Na;
+
+            // Background current, sodium
+            const NekDouble I_b_Na = C_m*g_b_Na * (V - E_na);
+            dV  -= I_b_Na;
+            dNa -= I_b_Na;
+
+            // V - E_K
+            const NekDouble V_E_k = V - RTF * log(K_o / K_in);
+
+            // Potassium I_K1
+            const NekDouble I_K1 = C_m*g_K1 * (V_E_k / (1.0 + exp(0.07*(V + 80.0))));
+            dV -= I_K1;
+            dK  = -I_K1;
+
+            // Transient Outward K+ current
+            const NekDouble I_to = C_m*g_to * (o_a*(o_a*(o_a*(o_i*V_E_k))));
+            dV -= I_to;
+            dK -= I_to;
+
+            // Ultrarapid Delayed rectifier K+ current
+            tmp = 0.05 / (1.0 + exp(-1.0/13.0*(V - 15.0))) + 0.005;
+            const NekDouble I_kur = C_m*g_Kur_scaling
+                                  * (u_i*(u_a*(u_a*(u_a*(V_E_k*tmp)))));
+            dV -= I_kur;
+            dK -= I_kur;
+
+            // Rapid delayed outward rectifier K+ current
+            const NekDouble I_Kr = C_m*g_Kr
+                                 * (x_r*(V_E_k / (1.0 + exp(1.0/22.4*(V + 15.0)))));
+            dV -= I_Kr;
+            dK -= I_Kr;
+
+            // Slow delayed outward rectifier K+ Current
+            const NekDouble I_Ks = C_m*g_Ks * (x_s*(x_s*V_E_k));
+            dV -= I_Ks;
+            dK -= I_Ks;
+
+            // Background current, calcium
+            const NekDouble I_b_Ca = C_m*g_b_Ca
+                                   * (V - 0.5*R*T/F * log(Ca_o / Ca_i));
+            dV -= I_b_Ca;
+
+            // L-Type Ca2+ current
+            const NekDouble I_Ca_L = C_m*g_Ca_L * (f_Ca*(f*(d*(V - 65.0))));
+            dV -= I_Ca_L;
+
+            // Na-K Pump Current
+            const NekDouble f_Na_k = 0.1245*exp(-0.1*F/R/T*V)
+                                   + 0.0365*sigma*exp(-FRT*V) + 1.0;
+            const NekDouble I_Na_K = I_Na_K_sc
+                / (f_Na_k*(pow(K_m_Na_i / Na_i, 1.5) + 1.0));
+            dV  -= I_Na_K;
+            dNa += -3.0*I_Na_K;
+            dK  +=  2.0*I_Na_K;
+
+            // Na-Ca exchanger current
+            tmp = exp((gamma-1)*F/R/T*V);
+            const NekDouble I_Na_Ca_den = (K_sat*tmp + 1.0)*NaCa_den;
+            const NekDouble I_Na_Ca_num = Na_o3*tmp*Ca_i;
+            tmp = Na_i*(Na_i*(Na_i*exp(gamma*F/R/T*V)));
+            const NekDouble I_Na_Ca = C_m*I_NaCa_max*(Ca_o*tmp - I_Na_Ca_num)
+                                    / I_Na_Ca_den;
+            dV  -= I_Na_Ca;
+            dNa += -3.0*I_Na_Ca;
+
+            // Calcium Pump current
+            const NekDouble I_p_Ca = C_m*I_p_Ca_max * (Ca_i / (Ca_i + 0.0005));
+            dV -= I_p_Ca;
+
+            // Scale currents by capacitance
+            out[0][i] = dV * (1.0/C_m);
+
+            // Scale sodium and potassium by FV_i
+            out[16][i] = dNa * (1.0/F/V_i);
+            out[18][i] = dK  * (1.0/F/V_i);
+
+            // I_tr
+            const NekDouble I_tr = (Ca_up - Ca_rel) * (1.0/tau_tr);
+
+            // I_up_leak
+            const NekDouble I_up_leak = NSR_I_up_max/NSR_I_Ca_max * Ca_up;
+
+            // I_up
+            const NekDouble I_up = NSR_I_up_max / (NSR_K_up / Ca_i + 1.0);
+
+            // I_rel
+            const NekDouble I_rel = JSR_K_rel * (((((Ca_rel - Ca_i)*u)*u)*v)*w);
+
+            // B1
+            NekDouble B1 = (2.0*I_Na_Ca - I_p_Ca - I_Ca_L - I_b_Ca) * (0.5/F);
+            B1 = JSR_V_up*I_up_leak + B1;
+            B1 = -JSR_V_up*I_up + B1;
+            B1 = JSR_V_rel*I_rel + B1;
+            B1 = B1 * (1.0/V_i);
+
+            // B2
+            const NekDouble B2 = Trpn_max*Km_Trpn
+                                    / ((Ca_i + Km_Trpn)*(Ca_i + Km_Trpn))
+                               + Cmdn_max*Km_Cmdn
+                                    / ((Ca_i + Km_Cmdn)*(Ca_i + Km_Cmdn))
+                               + 1.0;
+
+            // Calcium concentration (18)
+            out[17][i] = B1 / B2;
+
+            // Calcium up (21)
+            out[20][i] = -JSR_V_rel/JSR_V_up*I_tr + (I_up - I_up_leak);
+
+            // Calcium rel (20)
+            out[19][i] = (I_tr - I_rel)
+                / (Csqn_max*Km_Csqn/((Ca_rel + Km_Csqn)*(Ca_rel + Km_Csqn)) + 1.0);
+
+            // Process gating variables
+            // m
+            alpha = (V == (-47.13)) ? 3.2 : (0.32*(V+47.13))/(1.0-exp((-0.1)*(V + 47.13)));
+            beta  = 0.08*exp(-(V)/11.0);
+            tau[0][i] = 1.0/(alpha + beta);
+            out[1][i] = alpha*tau[0][i];
+            // h
+            alpha = (V >= -40.0) ? 0.0 : 0.135*exp(-((V)+80.0)/6.8);
+            beta  = (V >= -40.0) ? 1.0/(0.13*(1.0+exp(-(V + 10.66)/11.1)))
+                    : 3.56*exp(0.079*(V))+310000.0*exp(0.35*(V));
+            tau[1][i] = 1.0/(alpha + beta);
+            out[2][i] = alpha*tau[1][i];
+            // j
+            alpha = (V >= -40.0) ? 0.0
+                    : (-127140.0*exp(0.2444*(V))-3.474e-05*exp(-0.04391*(V)))*(((V)+37.78)/(1.0+exp(0.311*((V)+79.23))));
+            beta  = (V >= -40.0) ? (0.3*exp(-2.535e-07*(V))/(1.0+exp(-0.1*(V+32.0))))
+                    : 0.1212*exp(-0.01052*(V))/(1.0+exp(-0.1378*(V+40.14)));
+            tau[2][i] = 1.0/(alpha + beta);
+            out[3][i] = alpha*tau[2][i];
+            // oa
+            alpha = 0.65/(exp(-(V+10.0)/8.5) + exp(-(V-30.0)/59.0));
+            beta  = 0.65/(2.5 + exp((V+82.0)/17.0));
+            tau[3][i] = 1.0/K_Q10/(alpha + beta);
+            out[4][i] = (1.0/(1.0+exp(-(V+20.47)/17.54)));
+            // oi
+            alpha = 1.0/(18.53 + exp((V+113.7)/10.95));
+            beta  = 1.0/(35.56 + exp(-(V+1.26)/7.44));
+            tau[4][i] = 1.0/K_Q10/(alpha + beta);
+            out[5][i] = (1.0/(1.0+exp((V+43.1)/5.3)));
+            // ua
+            alpha = 0.65/(exp(-(V+10.0)/8.5)+exp(-(V-30.0)/59.0));
+            beta  = 0.65/(2.5+exp((V+82.0)/17.0));
+            tau[5][i] = 1.0/K_Q10/(alpha + beta);
+            out[6][i] = 1.0/(1.0+exp(-(V+30.3)/9.6));
+            // ui
+            alpha = 1.0/(21.0 + exp(-(V-185.0)/28.0));
+            beta  = exp((V-158.0)/16.0);
+            tau[6][i] = 1.0/K_Q10/(alpha + beta);
+            out[7][i] = 1.0/(1.0+exp((V-99.45)/27.48));
+            // xr
+            alpha = 0.0003*(V+14.1)/(1-exp(-(V+14.1)/5.0));
+            beta  = 7.3898e-5*(V-3.3328)/(exp((V-3.3328)/5.1237)-1.0);
+            tau[7][i] = 1.0/(alpha + beta);
+            out[8][i] = 1.0/(1+exp(-(V+14.1)/6.5));
+            // xs
+            alpha = 4e-5*(V-19.9)/(1.0-exp(-(V-19.9)/17.0));
+            beta  = 3.5e-5*(V-19.9)/(exp((V-19.9)/9.0)-1.0);
+            tau[8][i] = 0.5/(alpha + beta);
+            out[9][i] = 1.0/sqrt(1.0+exp(-(V-19.9)/12.7));
+            // d
+            tau[9][i]  = (1-exp(-(V+10.0)/6.24))/(0.035*(V+10.0)*(1+exp(-(V+10.0)/6.24)));
+            out[10][i] = 1.0/(1.0 + exp(-(V+10)/8.0));
+            // f
+            tau[10][i] = 9.0/(0.0197*exp(-0.0337*0.0337*(V+10.0)*(V+10.0))+0.02);
+            out[11][i] = exp((-(V + 28.0)) / 6.9) / (1.0 + exp((-(V + 28.0)) / 6.9));
+            // f_Ca
+            tau[11][i] = 2.0;
+            out[12][i] = 1.0/(1.0+Ca_i/0.00035);
+
+            // The array implementation this kernel replaces evaluated Fn
+            // from workspace which had been overwritten by the h, j and x_r
+            // gate values in place of I_Ca_L, I_Na_Ca and I_rel. This is
+            // retained so that results are unchanged.
+            const NekDouble Fn = 1e-12*JSR_V_rel*out[8][i]
+                - (0.5*5e-13/F*out[2][i] + -0.2*5e-13/F*out[3][i]);
+
+            // u
+            tau[12][i] = 8.0;
+            out[13][i] = 1.0/(1.0 + exp(-(Fn - 3.4175e-13)/1.367e-15));
+            // v
+            tau[13][i] = 1.91 + 2.09/(1.0+exp(-(Fn - 3.4175e-13)/13.67e-16));
+            out[14][i] = 1.0 - 1.0/(1.0 + exp(-(Fn - 6.835e-14)/13.67e-16));
+            // w
+            tau[14][i] = 6.0*(1.0-exp(-(V-7.9)/5.0))/(1.0+0.3*exp(-(V-7.9)/5.0))/(V-7.9);
+            out[15][i] = 1.0 - 1.0/(1.0 + exp(-(V - 40.0)/17.0));
+        }
+    }
+
+
     /**
     *
     */
@@ -67,10 +67,17 @@ namespace Nektar
     protected:
         /// Computes the reaction terms $f(u,v)$ and $g(u,v)$.
         virtual void v_Update(
-                const Array<OneD, const Array<OneD, NekDouble> >&inarray,
-                      Array<OneD, Array<OneD, NekDouble> >&outarray,
+                const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
+                      Array<OneD,        Array<OneD, NekDouble> >&outarray,
                 const NekDouble time);
 
+        /// Computes the same terms for a block of points in a single loop.
+        virtual void v_UpdateBlock(
+                const int                n,
+                const NekDouble * const *in,
+                      NekDouble * const *out,
+                      NekDouble * const *tau);
+
         /// Prints a summary of the model parameters.
         virtual void v_GenerateSummary(SummaryList& s);
 
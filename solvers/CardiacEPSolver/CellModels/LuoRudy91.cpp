@@ -42,36 +42,39 @@ namespace Nektar
         m_gates.push_back(5);
         m_gates.push_back(6);
         m_concentrations.push_back(7);
+
+        m_hasFusedKernel = true;
     }
     
     
     
     
     
-    void LuoRudy91::v_Update(
-                     const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
-                           Array<OneD,        Array<OneD, NekDouble> >&outarray,
-                                                           const NekDouble time)
+    void LuoRudy91::v_UpdateBlock(
+            const int                n,
+            const NekDouble * const *in,
+                  NekDouble * const *out,
+                  NekDouble * const *tau)
     {
-        for (unsigned int i = 0; i < m_nq; ++i)
+        for (int i = 0; i < n; ++i)
         {
             // Inputs:
             // Time units: millisecond
-            NekDouble var_chaste_interface__membrane__V = inarray[0][i];
+            NekDouble var_chaste_interface__membrane__V = in[0][i];
             // Units: millivolt; Initial value: -84.3801107371
-            NekDouble var_chaste_interface__fast_sodium_current_m_gate__m = inarray[1][i];
+            NekDouble var_chaste_interface__fast_sodium_current_m_gate__m = in[1][i];
             // Units: dimensionless; Initial value: 0.00171338077730188
-            NekDouble var_chaste_interface__fast_sodium_current_h_gate__h = inarray[2][i];
+            NekDouble var_chaste_interface__fast_sodium_current_h_gate__h = in[2][i];
             // Units: dimensionless; Initial value: 0.982660523699656
-            NekDouble var_chaste_interface__fast_sodium_current_j_gate__j = inarray[3][i];
+            NekDouble var_chaste_interface__fast_sodium_current_j_gate__j = in[3][i];
             // Units: dimensionless; Initial value: 0.989108212766685
-            NekDouble var_chaste_interface__slow_inward_current_d_gate__d = inarray[4][i];
+            NekDouble var_chaste_interface__slow_inward_current_d_gate__d = in[4][i];
             // Units: dimensionless; Initial value: 0.00302126301779861
-            NekDouble var_chaste_interface__slow_inward_current_f_gate__f = inarray[5][i];
+            NekDouble var_chaste_interface__slow_inward_current_f_gate__f = in[5][i];
             // Units: dimensionless; Initial value: 0.999967936476325
-            NekDouble var_chaste_interface__time_dependent_potassium_current_X_gate__X = inarray[6][i];
+            NekDouble var_chaste_interface__time_dependent_potassium_current_X_gate__X = in[6][i];
             // Units: dimensionless; Initial value: 0.0417603108167287
-            NekDouble var_chaste_interface__intracellular_calcium_concentration__Cai = inarray[7][i];
+            NekDouble var_chaste_interface__intracellular_calcium_concentration__Cai = in[7][i];
             // Units: millimolar; Initial value: 0.00017948816388306
 
             
@@ -242,20 +245,20 @@ namespace Nektar
     	    const NekDouble X_inf = var_time_dependent_potassium_current_X_gate__alpha_X/(var_time_dependent_potassium_current_X_gate__alpha_X + var_time_dependent_potassium_current_X_gate__beta_X);
     	    const NekDouble X_tau = 1.0/(var_time_dependent_potassium_current_X_gate__alpha_X + var_time_dependent_potassium_current_X_gate__beta_X);
 
-            outarray[0][i] = d_dt_chaste_interface__membrane__V;
-            outarray[1][i] = m_inf;
-            m_gates_tau[0][i] = m_tau;
-            outarray[2][i] = h_inf;
-            m_gates_tau[1][i] = h_tau;
-            outarray[3][i] = j_inf;
-            m_gates_tau[2][i] = j_tau;
-            outarray[4][i] = d_inf;
-            m_gates_tau[3][i] = d_tau;
-            outarray[5][i] = f_inf;
-            m_gates_tau[4][i] = f_tau;
-            outarray[6][i] = X_inf;
-            m_gates_tau[5][i] = X_tau;
-            outarray[7][i] = d_dt_chaste_interface__intracellular_calcium_concentration__Cai;
+            out[0][i] = d_dt_chaste_interface__membrane__V;
+            out[1][i] = m_inf;
+            tau[0][i] = m_tau;
+            out[2][i] = h_inf;
+            tau[1][i] = h_tau;
+            out[3][i] = j_inf;
+            tau[2][i] = j_tau;
+            out[4][i] = d_inf;
+            tau[3][i] = d_tau;
+            out[5][i] = f_inf;
+            tau[4][i] = f_tau;
+            out[6][i] = X_inf;
+            tau[5][i] = X_tau;
+            out[7][i] = d_dt_chaste_interface__intracellular_calcium_concentration__Cai;
         }
     }
 
@@ -139,58 +139,61 @@ TenTusscher06::TenTusscher06(
     m_concentrations.push_back(16);
     m_concentrations.push_back(17);
     m_concentrations.push_back(18);
+
+    m_hasFusedKernel = true;
 }
 
 
 /**
  *
  */
-void TenTusscher06::v_Update(
-        const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
-        Array<OneD,        Array<OneD, NekDouble> >&outarray,
-        const NekDouble time)
+void TenTusscher06::v_UpdateBlock(
+        const int                n,
+        const NekDouble * const *in,
+              NekDouble * const *out,
+              NekDouble * const *tau)
 {
-    for (unsigned int i = 0; i < m_nq; ++i)
+    for (int i = 0; i < n; ++i)
     {
         // Inputs:
         // Time units: millisecond
-        NekDouble var_chaste_interface__membrane__V = inarray[0][i];
+        NekDouble var_chaste_interface__membrane__V = in[0][i];
         // Units: millivolt; Initial value: -85.23
-        NekDouble var_chaste_interface__rapid_time_dependent_potassium_current_Xr1_gate__Xr1 = inarray[1][i];
+        NekDouble var_chaste_interface__rapid_time_dependent_potassium_current_Xr1_gate__Xr1 = in[1][i];
         // Units: dimensionless; Initial value: 0.00621
-        NekDouble var_chaste_interface__rapid_time_dependent_potassium_current_Xr2_gate__Xr2 = inarray[2][i];
+        NekDouble var_chaste_interface__rapid_time_dependent_potassium_current_Xr2_gate__Xr2 = in[2][i];
         // Units: dimensionless; Initial value: 0.4712
-        NekDouble var_chaste_interface__slow_time_dependent_potassium_current_Xs_gate__Xs = inarray[3][i];
+        NekDouble var_chaste_interface__slow_time_dependent_potassium_current_Xs_gate__Xs = in[3][i];
         // Units: dimensionless; Initial value: 0.0095
-        NekDouble var_chaste_interface__fast_sodium_current_m_gate__m = inarray[4][i];
+        NekDouble var_chaste_interface__fast_sodium_current_m_gate__m = in[4][i];
         // Units: dimensionless; Initial value: 0.00172
-        NekDouble var_chaste_interface__fast_sodium_current_h_gate__h = inarray[5][i];
+        NekDouble var_chaste_interface__fast_sodium_current_h_gate__h = in[5][i];
         // Units: dimensionless; Initial value: 0.7444
-        NekDouble var_chaste_interface__fast_sodium_current_j_gate__j = inarray[6][i];
+        NekDouble var_chaste_interface__fast_sodium_current_j_gate__j = in[6][i];
         // Units: dimensionless; Initial value: 0.7045
-        NekDouble var_chaste_interface__L_type_Ca_current_d_gate__d = inarray[7][i];
+        NekDouble var_chaste_interface__L_type_Ca_current_d_gate__d = in[7][i];
         // Units: dimensionless; Initial value: 3.373e-5
-        NekDouble var_chaste_interface__L_type_Ca_current_f_gate__f = inarray[8][i];
+        NekDouble var_chaste_interface__L_type_Ca_current_f_gate__f = in[8][i];
         // Units: dimensionless; Initial value: 0.7888
-        NekDouble var_chaste_interface__L_type_Ca_current_f2_gate__f2 = inarray[9][i];
+        NekDouble var_chaste_interface__L_type_Ca_current_f2_gate__f2 = in[9][i];
         // Units: dimensionless; Initial value: 0.9755
-        NekDouble var_chaste_interface__L_type_Ca_current_fCass_gate__fCass = inarray[10][i];
+        NekDouble var_chaste_interface__L_type_Ca_current_fCass_gate__fCass = in[10][i];
         // Units: dimensionless; Initial value: 0.9953
-        NekDouble var_chaste_interface__transient_outward_current_s_gate__s = inarray[11][i];
+        NekDouble var_chaste_interface__transient_outward_current_s_gate__s = in[11][i];
         // Units: dimensionless; Initial value: 0.999998
-        NekDouble var_chaste_interface__transient_outward_current_r_gate__r = inarray[12][i];
+        NekDouble var_chaste_interface__transient_outward_current_r_gate__r = in[12][i];
         // Units: dimensionless; Initial value: 2.42e-8
-        NekDouble var_chaste_interface__calcium_dynamics__Ca_i = inarray[13][i];
+        NekDouble var_chaste_interface__calcium_dynamics__Ca_i = in[13][i];
         // Units: millimolar; Initial value: 0.000126
-        NekDouble var_chaste_interface__calcium_dynamics__Ca_SR = inarray[14][i];
+        NekDouble var_chaste_interface__calcium_dynamics__Ca_SR = in[14][i];
         // Units: millimolar; Initial value: 3.64
-        NekDouble var_chaste_interface__calcium_dynamics__Ca_ss = inarray[15][i];
+        NekDouble var_chaste_interface__calcium_dynamics__Ca_ss = in[15][i];
         // Units: millimolar; Initial value: 0.00036
-        NekDouble var_chaste_interface__calcium_dynamics__R_prime = inarray[16][i];
+        NekDouble var_chaste_interface__calcium_dynamics__R_prime = in[16][i];
         // Units: dimensionless; Initial value: 0.9073
-        NekDouble var_chaste_interface__sodium_dynamics__Na_i = inarray[17][i];
+        NekDouble var_chaste_interface__sodium_dynamics__Na_i = in[17][i];
         // Units: millimolar; Initial value: 8.604
-        NekDouble var_chaste_interface__potassium_dynamics__K_i = inarray[18][i];
+        NekDouble var_chaste_interface__potassium_dynamics__K_i = in[18][i];
         // Units: millimolar; Initial value: 136.89
 
 
@@ -454,37 +457,37 @@ void TenTusscher06::v_Update(
         const NekDouble var_membrane__d_V_d_environment__time = ((-1.0) / 1.0) * (var_membrane__i_K1 + var_membrane__i_to + var_membrane__i_Kr + var_membrane__i_Ks + var_membrane__i_CaL + var_membrane__i_NaK + var_membrane__i_Na + var_membrane__i_b_Na + var_membrane__i_NaCa + var_membrane__i_b_Ca + var_membrane__i_p_K + var_membrane__i_p_Ca + var_membrane__i_Stim); // 'millivolt per millisecond'
         const NekDouble var_chaste_interface__membrane__d_V_d_environment__time = var_membrane__d_V_d_environment__time; // ___units_1
         d_dt_chaste_interface__membrane__V = var_chaste_interface__membrane__d_V_d_environment__time; // 'millivolt per millisecond'
-        outarray[0][i] = d_dt_chaste_interface__membrane__V;
-        outarray[1][i] = var_rapid_time_dependent_potassium_current_Xr1_gate__xr1_inf;
-        m_gates_tau[0][i] = var_rapid_time_dependent_potassium_current_Xr1_gate__tau_xr1;
-        outarray[2][i] = var_rapid_time_dependent_potassium_current_Xr2_gate__xr2_inf;
-        m_gates_tau[1][i] = var_rapid_time_dependent_potassium_current_Xr2_gate__tau_xr2;
-        outarray[3][i] = var_slow_time_dependent_potassium_current_Xs_gate__xs_inf;
-        m_gates_tau[2][i] = var_slow_time_dependent_potassium_current_Xs_gate__tau_xs;
-        outarray[4][i] = var_fast_sodium_current_m_gate__m_inf;
-        m_gates_tau[3][i] = var_fast_sodium_current_m_gate__tau_m;
-        outarray[5][i] = var_fast_sodium_current_h_gate__h_inf;
-        m_gates_tau[4][i] = var_fast_sodium_current_h_gate__tau_h;
-        outarray[6][i] = var_fast_sodium_current_j_gate__j_inf;
-        m_gates_tau[5][i] = var_fast_sodium_current_j_gate__tau_j;
-        outarray[7][i] = var_L_type_Ca_current_d_gate__d_inf;
-        m_gates_tau[6][i] = var_L_type_Ca_current_d_gate__tau_d;
-        outarray[8][i] = var_L_type_Ca_current_f_gate__f_inf;
-        m_gates_tau[7][i] = var_L_type_Ca_current_f_gate__tau_f;
-        outarray[9][i] = var_L_type_Ca_current_f2_gate__f2_inf;
-        m_gates_tau[8][i] = var_L_type_Ca_current_f2_gate__tau_f2;
-        outarray[10][i] = var_L_type_Ca_current_fCass_gate__fCass_inf;
-        m_gates_tau[9][i] = var_L_type_Ca_current_fCass_gate__tau_fCass;
-        outarray[11][i] = var_transient_outward_current_s_gate__s_inf;
-        m_gates_tau[10][i] = var_transient_outward_current_s_gate__tau_s;
-        outarray[12][i] = var_transient_outward_current_r_gate__r_inf;
-        m_gates_tau[11][i] = var_transient_outward_current_r_gate__tau_r;
-        outarray[13][i] = d_dt_chaste_interface__calcium_dynamics__Ca_i;
-        outarray[14][i] = d_dt_chaste_interface__calcium_dynamics__Ca_SR;
-        outarray[15][i] = d_dt_chaste_interface__calcium_dynamics__Ca_ss;
-        outarray[16][i] = d_dt_chaste_interface__calcium_dynamics__R_prime;
-        outarray[17][i] = d_dt_chaste_interface__sodium_dynamics__Na_i;
-        outarray[18][i] = d_dt_chaste_interface__potassium_dynamics__K_i;
+        out[0][i] = d_dt_chaste_interface__membrane__V;
+        out[1][i] = var_rapid_time_dependent_potassium_current_Xr1_gate__xr1_inf;
+        tau[0][i] = var_rapid_time_dependent_potassium_current_Xr1_gate__tau_xr1;
+        out[2][i] = var_rapid_time_dependent_potassium_current_Xr2_gate__xr2_inf;
+        tau[1][i] = var_rapid_time_dependent_potassium_current_Xr2_gate__tau_xr2;
+        out[3][i] = var_slow_time_dependent_potassium_current_Xs_gate__xs_inf;
+        tau[2][i] = var_slow_time_dependent_potassium_current_Xs_gate__tau_xs;
+        out[4][i] = var_fast_sodium_current_m_gate__m_inf;
+        tau[3][i] = var_fast_sodium_current_m_gate__tau_m;
+        out[5][i] = var_fast_sodium_current_h_gate__h_inf;
+        tau[4][i] = var_fast_sodium_current_h_gate__tau_h;
+        out[6][i] = var_fast_sodium_current_j_gate__j_inf;
+        tau[5][i] = var_fast_sodium_current_j_gate__tau_j;
+        out[7][i] = var_L_type_Ca_current_d_gate__d_inf;
+        tau[6][i] = var_L_type_Ca_current_d_gate__tau_d;
+        out[8][i] = var_L_type_Ca_current_f_gate__f_inf;
+        tau[7][i] = var_L_type_Ca_current_f_gate__tau_f;
+        out[9][i] = var_L_type_Ca_current_f2_gate__f2_inf;
+        tau[8][i] = var_L_type_Ca_current_f2_gate__tau_f2;
+        out[10][i] = var_L_type_Ca_current_fCass_gate__fCass_inf;
+        tau[9][i] = var_L_type_Ca_current_fCass_gate__tau_fCass;
+        out[11][i] = var_transient_outward_current_s_gate__s_inf;
+        tau[10][i] = var_transient_outward_current_s_gate__tau_s;
+        out[12][i] = var_transient_outward_current_r_gate__r_inf;
+        tau[11][i] = var_transient_outward_current_r_gate__tau_r;
+        out[13][i] = d_dt_chaste_interface__calcium_dynamics__Ca_i;
+        out[14][i] = d_dt_chaste_interface__calcium_dynamics__Ca_SR;
+        out[15][i] = d_dt_chaste_interface__calcium_dynamics__Ca_ss;
+        out[16][i] = d_dt_chaste_interface__calcium_dynamics__R_prime;
+        out[17][i] = d_dt_chaste_interface__sodium_dynamics__Na_i;
+        out[18][i] = d_dt_chaste_interface__potassium_dynamics__K_i;
     }
 
 }
@@ -62,10 +62,11 @@ namespace Nektar
         virtual ~TenTusscher06() {}
 
     protected:
-        virtual void v_Update(
-               const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
-                     Array<OneD,        Array<OneD, NekDouble> >&outarray,
-               const NekDouble time);
+        virtual void v_UpdateBlock(
+               const int                n,
+               const NekDouble * const *in,
+                     NekDouble * const *out,
+                     NekDouble * const *tau);
 
         /// Prints a summary of the model parameters.
         virtual void v_GenerateSummary(SummaryList& s);
@@ -0,0 +1,174 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File CellModelBenchmark.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Compares the array and fused cell model kernels.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <cmath>
+
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+#include <SpatialDomains/MeshGraph.h>
+#include <MultiRegions/ExpList2D.h>
+#include <MultiRegions/ExpList3D.h>
+#include <CardiacEPSolver/CellModels/CellModel.h>
+
+using namespace std;
+using namespace Nektar;
+
+/**
+ * Runs the cell model for NumSteps time-steps, advancing the transmembrane
+ * potential with forward Euler, and returns the time taken.
+ */
+NekDouble RunCellModel(
+    CellModelSharedPtr                    &pCell,
+    Array<OneD, Array<OneD, NekDouble> >  &pSol,
+    const NekDouble                        pDeltaT,
+    const unsigned int                     pSteps)
+{
+    const int nq = pSol[0].num_elements();
+    Array<OneD, Array<OneD, NekDouble> > wsp(1);
+    wsp[0] = Array<OneD, NekDouble>(nq, 0.0);
+
+    NekDouble time = 0.0;
+    Timer     timer;
+
+    timer.Start();
+    for (unsigned int i = 0; i < pSteps; ++i)
+    {
+        time += pDeltaT;
+        pCell->TimeIntegrate(pSol, wsp, time);
+        Vmath::Svtvp(nq, pDeltaT, wsp[0], 1, pSol[0], 1, pSol[0], 1);
+    }
+    timer.Stop();
+
+    return timer.TimePerTest(1);
+}
+
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReaderSharedPtr        vSession;
+    SpatialDomains::MeshGraphSharedPtr          vGraph;
+    MultiRegions::ExpListSharedPtr              vExp;
+    std::string                                 vCellModel;
+    CellModelSharedPtr                          vCell[2];
+    Array<OneD, Array<OneD, NekDouble> >        vSol[2];
+    NekDouble                                   vTime[2];
+    NekDouble                                   vDeltaT;
+    unsigned int                                nSteps;
+
+    vSession = LibUtilities::SessionReader::CreateInstance(argc, argv);
+
+    try
+    {
+        // Read the mesh and set up the expansion on which the cell model
+        // is evaluated
+        vGraph = SpatialDomains::MeshGraph::Read(vSession);
+
+        switch (vGraph->GetMeshDimension())
+        {
+            case 2:
+                vExp = MemoryManager<MultiRegions::ExpList2D>
+                                ::AllocateSharedPtr(vSession, vGraph);
+                break;
+            case 3:
+                vExp = MemoryManager<MultiRegions::ExpList3D>
+                                ::AllocateSharedPtr(vSession, vGraph);
+                break;
+            default:
+                ASSERTL0(false, "Mesh must be two or three dimensional.");
+        }
+
+        vSession->LoadSolverInfo("CELLMODEL", vCellModel, "");
+        ASSERTL0(vCellModel != "", "Cell Model not specified.");
+
+        vDeltaT = vSession->GetParameter("TimeStep");
+        nSteps  = vSession->GetParameter("NumSteps");
+
+        const int nq = vExp->GetNpoints();
+        Array<OneD, NekDouble> x0(nq), x1(nq), x2(nq);
+        vExp->GetCoords(x0, x1, x2);
+
+        LibUtilities::EquationSharedPtr e =
+                            vSession->GetFunction("InitialConditions", "u");
+
+        // Set up one cell model using the array kernel and one using the
+        // fused kernel, starting from the same state
+        for (int k = 0; k < 2; ++k)
+        {
+            vCell[k] = GetCellModelFactory().CreateInstance(
+                                                vCellModel, vSession, vExp);
+            vCell[k]->Initialise();
+
+            ASSERTL0(vCell[k]->HasFusedKernel(),
+                     "Cell model does not implement a fused kernel.");
+            vCell[k]->SetUseFusedKernel(k == 1);
+
+            vSol[k]    = Array<OneD, Array<OneD, NekDouble> >(1);
+            vSol[k][0] = Array<OneD, NekDouble>(nq);
+            e->Evaluate(x0, x1, x2, 0.0, vSol[k][0]);
+        }
+
+        for (int k = 0; k < 2; ++k)
+        {
+            vTime[k] = RunCellModel(vCell[k], vSol[k], vDeltaT, nSteps);
+        }
+
+        // Compare the cell states of the two kernels
+        NekDouble diff = 0.0;
+        for (unsigned int i = 0; i < vCell[0]->GetNumCellVariables(); ++i)
+        {
+            Array<OneD, NekDouble> s0 = vCell[0]->GetCellSolution(i);
+            Array<OneD, NekDouble> s1 = vCell[1]->GetCellSolution(i);
+            for (int j = 0; j < nq; ++j)
+            {
+                diff = max(diff, fabs(s0[j] - s1[j]));
+            }
+        }
+
+        cout << "Points:          " << nq                  << endl;
+        cout << "Array kernel:    " << vTime[0] << " s"    << endl;
+        cout << "Fused kernel:    " << vTime[1] << " s"    << endl;
+        cout << "Speed-up:        " << vTime[0] / vTime[1] << endl;
+        cout << "Max difference: "  << diff                << endl;
+    }
+    catch (...)
+    {
+        cerr << "An error occured" << endl;
+    }
+
+    vSession->Finalise();
+
+    return 0;
+}
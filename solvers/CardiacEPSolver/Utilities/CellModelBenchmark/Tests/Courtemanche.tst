@@ -0,0 +1,21 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Array and fused Courtemanche cell model kernels</description>
+    <executable>CellModelBenchmark</executable>
+    <parameters>Courtemanche.xml</parameters>
+    <files>
+        <file description="Session File">Courtemanche.xml</file>
+    </files>
+    <metrics>
+        <metric type="Regex" id="1">
+            <regex>
+                ^Max difference:\s*([-+]?[0-9]*\.?[0-9]+(?:[eE][-+]?[0-9]+)?)
+            </regex>
+            <matches>
+                <match>
+                    <field tolerance="1e-06">0</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
@@ -2735,6 +2735,32 @@ namespace Nektar
         }
     }
 
+    /**
+     * @brief Set up the Jacobian-free Newton-Krylov solver used by implicit
+     * time integration schemes. The right-hand side and projection
+     * operators must already have been defined in #m_ode.
+     */
+    void CompressibleFlowSystem::InitImplicitSolve()
+    {
+        m_jfnk = MemoryManager<SolverUtils::JacobianFreeNewtonKrylov>::
+            AllocateSharedPtr(m_session, m_fields[0], m_ode);
+        m_ode.DefineImplicitSolve(
+            &CompressibleFlowSystem::DoImplicitSolve, this);
+    }
+
+    /**
+     * @brief Solve \f$ \boldsymbol{u} - \lambda \boldsymbol{f}(\boldsymbol{u})
+     * = \boldsymbol{b} \f$ for a stage of an implicit scheme.
+     */
+    void CompressibleFlowSystem::DoImplicitSolve(
+        const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+              Array<OneD,       Array<OneD, NekDouble> > &outarray,
+        const NekDouble                                   time,
+        const NekDouble                                   lambda)
+    {
+        m_jfnk->Solve(inarray, outarray, time, lambda);
+    }
+
     /**
      * @brief Perform post-integration checks, presently just to check steady
      * state behaviour.
@@ -2864,12 +2890,31 @@ namespace Nektar
      */
     NekDouble CompressibleFlowSystem::v_GetTimeStep(
         const Array<OneD, const Array<OneD, NekDouble> > &inarray)
+    {
+        int nElements = m_fields[0]->GetExpSize();
+        Array<OneD, NekDouble> tstep(nElements, 0.0);
+
+        GetElmtTimeSteps(inarray, tstep);
+
+        // Get the minimum time-step limit and return the time-step
+        NekDouble TimeStep = m_cflSafetyFactor *
+            Vmath::Vmin(nElements, tstep, 1);
+        m_comm->AllReduce(TimeStep, LibUtilities::ReduceMin);
+        return TimeStep;
+    }
+
+    /**
+     * @brief Calculate the time-step limit of each element at unit CFL
+     * number.
+     */
+    void CompressibleFlowSystem::v_GetElmtTimeSteps(
+        const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+              Array<OneD, NekDouble>                     &tstep)
     {
         int n;
         int nElements = m_fields[0]->GetExpSize();
         const Array<OneD, int> ExpOrder = GetNumExpModesPerExp();
 
-        Array<OneD, NekDouble> tstep      (nElements, 0.0);
         Array<OneD, NekDouble> stdVelocity(nElements);
 
         // Get standard velocity to compute the time-step limit
@@ -2893,15 +2938,28 @@ namespace Nektar
                 minLength *= 2.0;
             }
 
-            tstep[n] = m_cflSafetyFactor * alpha * minLength
+            tstep[n] = alpha * minLength
                      / (stdVelocity[n] * cLambda
                         * (ExpOrder[n] - 1) * (ExpOrder[n] - 1));
         }
+    }
 
-        // Get the minimum time-step limit and return the time-step
-        NekDouble TimeStep = Vmath::Vmin(nElements, tstep, 1);
-        m_comm->AllReduce(TimeStep, LibUtilities::ReduceMin);
-        return TimeStep;
+    /**
+     * @brief Restrict the volume terms of the advection operator to the
+     * elements being advanced by the multirate integrator.
+     */
+    void CompressibleFlowSystem::v_SetActiveElmts(
+        bool                           allElmts,
+        const Array<OneD, const int>  &elmts)
+    {
+        if (allElmts)
+        {
+            m_advection->ClearActiveElmts();
+        }
+        else
+        {
+            m_advection->SetActiveElmts(elmts);
+        }
     }
 
     /**
@@ -41,6 +41,7 @@
 #include <SolverUtils/AdvectionSystem.h>
 #include <SolverUtils/Diffusion/Diffusion.h>
 #include <SolverUtils/Forcing/Forcing.h>
+#include <SolverUtils/Core/JacobianFreeNewtonKrylov.h>
 #include <StdRegions/StdQuadExp.h>
 #include <StdRegions/StdHexExp.h>
 
@@ -134,6 +135,9 @@ namespace Nektar
         // Storage for L2 norm error
         Array<OneD, Array<OneD, NekDouble> > m_un;
 
+        // Nonlinear solver for implicit time integration
+        SolverUtils::JacobianFreeNewtonKrylovSharedPtr m_jfnk;
+
         CompressibleFlowSystem(
             const LibUtilities::SessionReaderSharedPtr& pSession);
 
@@ -243,6 +247,13 @@ namespace Nektar
             const Array<OneD, const Array<OneD, NekDouble> > &inarray,
                   Array<OneD,                   NekDouble>   &stdV);
 
+        void InitImplicitSolve();
+        void DoImplicitSolve(
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &outarray,
+            const NekDouble                                   time,
+            const NekDouble                                   lambda);
+
         virtual bool v_PostIntegrate(int step);
         bool CalcSteadyState(bool output);
 
@@ -267,6 +278,12 @@ namespace Nektar
                   Array<OneD,       Array<OneD, NekDouble> > outarrayForcing);
         virtual NekDouble v_GetTimeStep(
             const Array<OneD, const Array<OneD, NekDouble> > &inarray);
+        virtual void v_GetElmtTimeSteps(
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD, NekDouble>                     &tstep);
+        virtual void v_SetActiveElmts(
+            bool                           allElmts,
+            const Array<OneD, const int>  &elmts);
         virtual void v_SetInitialConditions(
             NekDouble initialtime           = 0.0,
             bool      dumpInitialConditions = true,
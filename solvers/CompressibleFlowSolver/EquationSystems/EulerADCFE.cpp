@@ -84,16 +84,12 @@ namespace Nektar
             m_problemType = (ProblemType)0;
         }
 
-        if (m_explicitAdvection)
-        {
-            m_ode.DefineOdeRhs    (&EulerADCFE::
-            DoOdeRhs, this);
-            m_ode.DefineProjection(&EulerADCFE::
-            DoOdeProjection, this);
-        }
-        else
+        m_ode.DefineOdeRhs     (&EulerADCFE::DoOdeRhs,        this);
+        m_ode.DefineProjection (&EulerADCFE::DoOdeProjection, this);
+
+        if (!m_explicitAdvection)
         {
-            ASSERTL0(false, "Implicit CFE not set up.");
+            InitImplicitSolve();
         }
     }
 
@@ -78,14 +78,12 @@ namespace Nektar
             m_problemType = (ProblemType)0;
         }
         
-        if (m_explicitAdvection)
-        {
-            m_ode.DefineOdeRhs     (&EulerCFE::DoOdeRhs,        this);
-            m_ode.DefineProjection (&EulerCFE::DoOdeProjection, this);
-        }
-        else
+        m_ode.DefineOdeRhs     (&EulerCFE::DoOdeRhs,        this);
+        m_ode.DefineProjection (&EulerCFE::DoOdeProjection, this);
+
+        if (!m_explicitAdvection)
         {
-            ASSERTL0(false, "Implicit CFE not set up.");
+            InitImplicitSolve();
         }
     }
     
@@ -70,14 +70,12 @@ namespace Nektar
             m_problemType = (ProblemType)0;
         }
 
-        if (m_explicitAdvection)
-        {
-            m_ode.DefineOdeRhs     (&NavierStokesCFE::DoOdeRhs,        this);
-            m_ode.DefineProjection (&NavierStokesCFE::DoOdeProjection, this);
-        }
-        else
+        m_ode.DefineOdeRhs     (&NavierStokesCFE::DoOdeRhs,        this);
+        m_ode.DefineProjection (&NavierStokesCFE::DoOdeProjection, this);
+
+        if (!m_explicitAdvection)
         {
-            ASSERTL0(false, "Implicit CFE not set up.");
+            InitImplicitSolve();
         }
     }
 
@@ -37,8 +37,13 @@
 
 namespace Nektar
 {
+    const int CompressibleSolver::m_blockSize;
+
     CompressibleSolver::CompressibleSolver() : RiemannSolver(),
-                                               m_pointSolve(true)
+                                               m_pointSolve(true),
+                                               m_blockSolve(true),
+                                               m_blockZero   (m_blockSize, 0.0),
+                                               m_blockScratch(2*m_blockSize)
     {
         m_requiresRotation = true;
     }
@@ -53,25 +58,64 @@ namespace Nektar
         {
             int expDim      = nDim;
             int nvariables  = Fwd.num_elements();
+            int nTracePts   = Fwd[0].num_elements();
             
             NekDouble rhouf, rhovf;
             
             // Check if PDE-based SC is used
             if (expDim == 1)
             {
-                for (int i = 0; i < Fwd[0].num_elements(); ++i)
+                if (m_blockSolve)
                 {
-                    v_PointSolve(
-                        Fwd [0][i], Fwd [1][i], 0.0,   0.0,   Fwd [2][i],
-                        Bwd [0][i], Bwd [1][i], 0.0,   0.0,   Bwd [2][i],
-                        flux[0][i], flux[1][i], rhouf, rhovf, flux[2][i]);
+                    const NekDouble *zero = m_blockZero.get();
+                    NekDouble *rhovfBlk   = m_blockScratch.get();
+                    NekDouble *rhowfBlk   = m_blockScratch.get() + m_blockSize;
+
+                    for (int i = 0; i < nTracePts; i += m_blockSize)
+                    {
+                        v_BlockSolve(
+                            std::min(m_blockSize, nTracePts - i),
+                            &Fwd [0][i], &Fwd [1][i], zero,     zero,
+                            &Fwd [2][i],
+                            &Bwd [0][i], &Bwd [1][i], zero,     zero,
+                            &Bwd [2][i],
+                            &flux[0][i], &flux[1][i], rhovfBlk, rhowfBlk,
+                            &flux[2][i]);
+                    }
+                }
+                else
+                {
+                    for (int i = 0; i < nTracePts; ++i)
+                    {
+                        v_PointSolve(
+                            Fwd [0][i], Fwd [1][i], 0.0,   0.0,   Fwd [2][i],
+                            Bwd [0][i], Bwd [1][i], 0.0,   0.0,   Bwd [2][i],
+                            flux[0][i], flux[1][i], rhouf, rhovf, flux[2][i]);
+                    }
                 }
             }
             else if (expDim == 2)
             {
-                if (nvariables == expDim+2)
+                if (nvariables == expDim+2 && m_blockSolve)
                 {
-                    for (int i = 0; i < Fwd[0].num_elements(); ++i)
+                    const NekDouble *zero = m_blockZero.get();
+                    NekDouble *rhowfBlk   = m_blockScratch.get();
+
+                    for (int i = 0; i < nTracePts; i += m_blockSize)
+                    {
+                        v_BlockSolve(
+                            std::min(m_blockSize, nTracePts - i),
+                            &Fwd [0][i], &Fwd [1][i], &Fwd [2][i], zero,
+                            &Fwd [3][i],
+                            &Bwd [0][i], &Bwd [1][i], &Bwd [2][i], zero,
+                            &Bwd [3][i],
+                            &flux[0][i], &flux[1][i], &flux[2][i], rhowfBlk,
+                            &flux[3][i]);
+                    }
+                }
+                else if (nvariables == expDim+2)
+                {
+                    for (int i = 0; i < nTracePts; ++i)
                     {
                         v_PointSolve(
                             Fwd [0][i], Fwd [1][i], Fwd [2][i], 0.0,   Fwd [3][i],
@@ -94,12 +138,29 @@ namespace Nektar
             }
             else if (expDim == 3)
             {
-                for (int i = 0; i < Fwd[0].num_elements(); ++i)
+                if (m_blockSolve)
                 {
-                    v_PointSolve(
-                        Fwd [0][i], Fwd [1][i], Fwd [2][i], Fwd [3][i], Fwd [4][i],
-                        Bwd [0][i], Bwd [1][i], Bwd [2][i], Bwd [3][i], Bwd [4][i],
-                        flux[0][i], flux[1][i], flux[2][i], flux[3][i], flux[4][i]);
+                    for (int i = 0; i < nTracePts; i += m_blockSize)
+                    {
+                        v_BlockSolve(
+                            std::min(m_blockSize, nTracePts - i),
+                            &Fwd [0][i], &Fwd [1][i], &Fwd [2][i], &Fwd [3][i],
+                            &Fwd [4][i],
+                            &Bwd [0][i], &Bwd [1][i], &Bwd [2][i], &Bwd [3][i],
+                            &Bwd [4][i],
+                            &flux[0][i], &flux[1][i], &flux[2][i], &flux[3][i],
+                            &flux[4][i]);
+                    }
+                }
+                else
+                {
+                    for (int i = 0; i < nTracePts; ++i)
+                    {
+                        v_PointSolve(
+                            Fwd [0][i], Fwd [1][i], Fwd [2][i], Fwd [3][i], Fwd [4][i],
+                            Bwd [0][i], Bwd [1][i], Bwd [2][i], Bwd [3][i], Bwd [4][i],
+                            flux[0][i], flux[1][i], flux[2][i], flux[3][i], flux[4][i]);
+                    }
                 }
                 if (nvariables > expDim+2)
                 {
@@ -118,4 +179,32 @@ namespace Nektar
             v_ArraySolve(Fwd, Bwd, flux);
         }
     }
+
+    /**
+     * @brief Solve the inviscid Riemann problem for a block of at most
+     * #m_blockSize trace points.
+     *
+     * The states and fluxes are stored as one array per conserved variable,
+     * so that implementations can evaluate the flux with straight-line code
+     * over the block, which the compiler is able to vectorise. Absent velocity
+     * components are passed as zero states. The default implementation falls
+     * back to #v_PointSolve for each point.
+     */
+    void CompressibleSolver::v_BlockSolve(
+        const int nPts,
+        const NekDouble *rhoL, const NekDouble *rhouL, const NekDouble *rhovL,
+        const NekDouble *rhowL, const NekDouble *EL,
+        const NekDouble *rhoR, const NekDouble *rhouR, const NekDouble *rhovR,
+        const NekDouble *rhowR, const NekDouble *ER,
+        NekDouble *rhof, NekDouble *rhouf, NekDouble *rhovf,
+        NekDouble *rhowf, NekDouble *Ef)
+    {
+        for (int i = 0; i < nPts; ++i)
+        {
+            v_PointSolve(
+                rhoL[i], rhouL[i], rhovL[i], rhowL[i], EL[i],
+                rhoR[i], rhouR[i], rhovR[i], rhowR[i], ER[i],
+                rhof[i], rhouf[i], rhovf[i], rhowf[i], Ef[i]);
+        }
+    }
 }
@@ -36,6 +36,9 @@
 #ifndef NEKTAR_SOLVERS_COMPRESSIBLEFLOWSOLVER_RIEMANNSOLVER_COMPRESSIBLESOLVER
 #define NEKTAR_SOLVERS_COMPRESSIBLEFLOWSOLVER_RIEMANNSOLVER_COMPRESSIBLESOLVER
 
+#include <algorithm>
+
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
 #include <SolverUtils/RiemannSolvers/RiemannSolver.h>
 
 using namespace Nektar::SolverUtils;
@@ -44,8 +47,23 @@ namespace Nektar
 {
     class CompressibleSolver : public RiemannSolver
     {
+    public:
+        /// Select between the blocked and the per-point inviscid solve.
+        void SetBlockSolve(bool blockSolve)
+        {
+            m_blockSolve = blockSolve;
+        }
+
     protected:
+        /// Number of trace points handed to #v_BlockSolve at a time.
+        static const int m_blockSize = 64;
+
         bool m_pointSolve;
+        bool m_blockSolve;
+        /// Zero left/right states for absent velocity components.
+        Array<OneD, NekDouble> m_blockZero;
+        /// Storage for the fluxes of absent velocity components.
+        Array<OneD, NekDouble> m_blockScratch;
         
         CompressibleSolver();
         
@@ -71,6 +89,28 @@ namespace Nektar
             ASSERTL0(false, "This function should be defined by subclasses.");
         }
         
+        virtual void v_BlockSolve(
+            const int nPts,
+            const NekDouble *rhoL, const NekDouble *rhouL, const NekDouble *rhovL,
+            const NekDouble *rhowL, const NekDouble *EL,
+            const NekDouble *rhoR, const NekDouble *rhouR, const NekDouble *rhovR,
+            const NekDouble *rhowR, const NekDouble *ER,
+            NekDouble *rhof, NekDouble *rhouf, NekDouble *rhovf,
+            NekDouble *rhowf, NekDouble *Ef);
+
+        /// Copy block-local fluxes to the outputs of #v_BlockSolve.
+        void StoreBlockFlux(
+            const int nPts, NekDouble f[][m_blockSize],
+            NekDouble *rhof, NekDouble *rhouf, NekDouble *rhovf,
+            NekDouble *rhowf, NekDouble *Ef)
+        {
+            std::copy(f[0], f[0] + nPts, rhof);
+            std::copy(f[1], f[1] + nPts, rhouf);
+            std::copy(f[2], f[2] + nPts, rhovf);
+            std::copy(f[3], f[3] + nPts, rhowf);
+            std::copy(f[4], f[4] + nPts, Ef);
+        }
+
         virtual void v_PointSolveVisc(
             NekDouble  rhoL, NekDouble  rhouL, NekDouble  rhovL, NekDouble  rhowL, NekDouble  EL, NekDouble EpsL,
             NekDouble  rhoR, NekDouble  rhouR, NekDouble  rhovR, NekDouble  rhowR, NekDouble  ER, NekDouble EpsR,
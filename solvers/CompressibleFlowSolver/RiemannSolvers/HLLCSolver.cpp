@@ -266,4 +266,99 @@ namespace Nektar
             }
         }
     }
+
+    /**
+     * @brief HLLC Riemann solver for a block of trace points.
+     *
+     * The upwind and star region cases of #v_PointSolve are evaluated for
+     * every point and selected without branching, and the fluxes are written
+     * to block-local storage, so that the compiler is free to vectorise the
+     * loop.
+     */
+    void HLLCSolver::v_BlockSolve(
+        const int nPts,
+        const NekDouble *rhoL, const NekDouble *rhouL, const NekDouble *rhovL,
+        const NekDouble *rhowL, const NekDouble *EL,
+        const NekDouble *rhoR, const NekDouble *rhouR, const NekDouble *rhovR,
+        const NekDouble *rhowR, const NekDouble *ER,
+        NekDouble *rhof, NekDouble *rhouf, NekDouble *rhovf,
+        NekDouble *rhowf, NekDouble *Ef)
+    {
+        const NekDouble gamma = m_params["gamma"]();
+        NekDouble f[5][m_blockSize];
+
+        for (int i = 0; i < nPts; ++i)
+        {
+            // Left and right velocities
+            NekDouble uL = rhouL[i] / rhoL[i];
+            NekDouble vL = rhovL[i] / rhoL[i];
+            NekDouble wL = rhowL[i] / rhoL[i];
+            NekDouble uR = rhouR[i] / rhoR[i];
+            NekDouble vR = rhovR[i] / rhoR[i];
+            NekDouble wR = rhowR[i] / rhoR[i];
+
+            // Left and right pressure, sound speed and enthalpy.
+            NekDouble pL = (gamma - 1.0) *
+                (EL[i] - 0.5 * (rhouL[i] * uL + rhovL[i] * vL + rhowL[i] * wL));
+            NekDouble pR = (gamma - 1.0) *
+                (ER[i] - 0.5 * (rhouR[i] * uR + rhovR[i] * vR + rhowR[i] * wR));
+            NekDouble cL = sqrt(gamma * pL / rhoL[i]);
+            NekDouble cR = sqrt(gamma * pR / rhoR[i]);
+            NekDouble hL = (EL[i] + pL) / rhoL[i];
+            NekDouble hR = (ER[i] + pR) / rhoR[i];
+
+            // Square root of rhoL and rhoR.
+            NekDouble srL  = sqrt(rhoL[i]);
+            NekDouble srR  = sqrt(rhoR[i]);
+            NekDouble srLR = srL + srR;
+
+            // Velocity Roe averages
+            NekDouble uRoe = (srL * uL + srR * uR) / srLR;
+            NekDouble vRoe = (srL * vL + srR * vR) / srLR;
+            NekDouble wRoe = (srL * wL + srR * wR) / srLR;
+            NekDouble hRoe = (srL * hL + srR * hR) / srLR;
+            NekDouble cRoe = sqrt((gamma - 1.0)*(hRoe - 0.5 *
+                (uRoe * uRoe + vRoe * vRoe + wRoe * wRoe)));
+
+            // Maximum wave speeds
+            NekDouble SL = std::min(uL-cL, uRoe-cRoe);
+            NekDouble SR = std::max(uR+cR, uRoe+cRoe);
+
+            // Left and right states and fluxes
+            NekDouble qL[5] = {rhoL[i], rhouL[i], rhovL[i], rhowL[i], EL[i]};
+            NekDouble qR[5] = {rhoR[i], rhouR[i], rhovR[i], rhowR[i], ER[i]};
+            NekDouble fL[5] = {
+                rhouL[i], rhouL[i] * uL + pL, rhouL[i] * vL, rhouL[i] * wL,
+                uL * (EL[i] + pL)};
+            NekDouble fR[5] = {
+                rhouR[i], rhouR[i] * uR + pR, rhouR[i] * vR, rhouR[i] * wR,
+                uR * (ER[i] + pR)};
+
+            // Contact wave speed and star region states
+            NekDouble SM = (pR - pL + rhouL[i] * (SL - uL) -
+                            rhouR[i] * (SR - uR)) /
+                (rhoL[i] * (SL - uL) - rhoR[i] * (SR - uR));
+            NekDouble rhoML = rhoL[i] * (SL - uL) / (SL - SM);
+            NekDouble rhoMR = rhoR[i] * (SR - uR) / (SR - SM);
+            NekDouble qML[5] = {
+                rhoML, rhoML * SM, rhoML * vL, rhoML * wL,
+                rhoML * (EL[i] / rhoL[i] +
+                         (SM - uL) * (SM + pL / (rhoL[i] * (SL - uL))))};
+            NekDouble qMR[5] = {
+                rhoMR, rhoMR * SM, rhoMR * vR, rhoMR * wR,
+                rhoMR * (ER[i] / rhoR[i] +
+                         (SM - uR) * (SM + pR / (rhoR[i] * (SR - uR))))};
+
+            for (int n = 0; n < 5; ++n)
+            {
+                NekDouble fML = fL[n] + SL * (qML[n] - qL[n]);
+                NekDouble fMR = fR[n] + SR * (qMR[n] - qR[n]);
+                NekDouble fn  = SM >= 0.0 ? fML   : fMR;
+                fn            = SR <= 0.0 ? fR[n] : fn;
+                f[n][i]       = SL >= 0.0 ? fL[n] : fn;
+            }
+        }
+
+        StoreBlockFlux(nPts, f, rhof, rhouf, rhovf, rhowf, Ef);
+    }
 }
@@ -57,6 +57,15 @@ namespace Nektar
             NekDouble  rhoL, NekDouble  rhouL, NekDouble  rhovL, NekDouble  rhowL, NekDouble  EL,
             NekDouble  rhoR, NekDouble  rhouR, NekDouble  rhovR, NekDouble  rhowR, NekDouble  ER,
             NekDouble &rhof, NekDouble &rhouf, NekDouble &rhovf, NekDouble &rhowf, NekDouble &Ef);
+
+        virtual void v_BlockSolve(
+            const int nPts,
+            const NekDouble *rhoL, const NekDouble *rhouL, const NekDouble *rhovL,
+            const NekDouble *rhowL, const NekDouble *EL,
+            const NekDouble *rhoR, const NekDouble *rhouR, const NekDouble *rhovR,
+            const NekDouble *rhowR, const NekDouble *ER,
+            NekDouble *rhof, NekDouble *rhouf, NekDouble *rhovf,
+            NekDouble *rhowf, NekDouble *Ef);
         
         virtual void v_PointSolveVisc(
             NekDouble  rhoL, NekDouble  rhouL, NekDouble  rhovL, NekDouble  rhowL, NekDouble  EL, NekDouble  EpsL,
@@ -143,4 +143,88 @@ namespace Nektar
                      tmp2 * (ER - EL)) * tmp1;
         }
     }
+
+    /**
+     * @brief HLL Riemann solver for a block of trace points.
+     *
+     * The upwind cases of #v_PointSolve are folded into the HLL flux by
+     * clipping the wave speeds, and the fluxes are written to block-local
+     * storage, so that the compiler is free to vectorise the loop.
+     */
+    void HLLSolver::v_BlockSolve(
+        const int nPts,
+        const NekDouble *rhoL, const NekDouble *rhouL, const NekDouble *rhovL,
+        const NekDouble *rhowL, const NekDouble *EL,
+        const NekDouble *rhoR, const NekDouble *rhouR, const NekDouble *rhovR,
+        const NekDouble *rhowR, const NekDouble *ER,
+        NekDouble *rhof, NekDouble *rhouf, NekDouble *rhovf,
+        NekDouble *rhowf, NekDouble *Ef)
+    {
+        const NekDouble gamma = m_params["gamma"]();
+        NekDouble f[5][m_blockSize];
+
+        for (int i = 0; i < nPts; ++i)
+        {
+            // Left and right velocities
+            NekDouble uL = rhouL[i] / rhoL[i];
+            NekDouble vL = rhovL[i] / rhoL[i];
+            NekDouble wL = rhowL[i] / rhoL[i];
+            NekDouble uR = rhouR[i] / rhoR[i];
+            NekDouble vR = rhovR[i] / rhoR[i];
+            NekDouble wR = rhowR[i] / rhoR[i];
+
+            // Left and right pressure, sound speed and enthalpy.
+            NekDouble pL = (gamma - 1.0) *
+                (EL[i] - 0.5 * (rhouL[i] * uL + rhovL[i] * vL + rhowL[i] * wL));
+            NekDouble pR = (gamma - 1.0) *
+                (ER[i] - 0.5 * (rhouR[i] * uR + rhovR[i] * vR + rhowR[i] * wR));
+            NekDouble cL = sqrt(gamma * pL / rhoL[i]);
+            NekDouble cR = sqrt(gamma * pR / rhoR[i]);
+            NekDouble hL = (EL[i] + pL) / rhoL[i];
+            NekDouble hR = (ER[i] + pR) / rhoR[i];
+
+            // Square root of rhoL and rhoR.
+            NekDouble srL  = sqrt(rhoL[i]);
+            NekDouble srR  = sqrt(rhoR[i]);
+            NekDouble srLR = srL + srR;
+
+            // Velocity Roe averages
+            NekDouble uRoe = (srL * uL + srR * uR) / srLR;
+            NekDouble vRoe = (srL * vL + srR * vR) / srLR;
+            NekDouble wRoe = (srL * wL + srR * wR) / srLR;
+            NekDouble hRoe = (srL * hL + srR * hR) / srLR;
+            NekDouble cRoe = sqrt((gamma - 1.0)*(hRoe - 0.5 *
+                (uRoe * uRoe + vRoe * vRoe + wRoe * wRoe)));
+
+            // Maximum wave speeds
+            NekDouble SL = std::min(uL-cL, uRoe-cRoe);
+            NekDouble SR = std::max(uR+cR, uRoe+cRoe);
+
+            // Left and right states and fluxes
+            NekDouble qL[5] = {rhoL[i], rhouL[i], rhovL[i], rhowL[i], EL[i]};
+            NekDouble qR[5] = {rhoR[i], rhouR[i], rhovR[i], rhowR[i], ER[i]};
+            NekDouble fL[5] = {
+                rhouL[i], rhouL[i] * uL + pL, rhouL[i] * vL, rhouL[i] * wL,
+                uL * (EL[i] + pL)};
+            NekDouble fR[5] = {
+                rhouR[i], rhouR[i] * uR + pR, rhouR[i] * vR, rhouR[i] * wR,
+                uR * (ER[i] + pR)};
+
+            // Clipping the wave speeds at zero recovers the upwind fluxes
+            // from the HLL flux when both waves travel in the same direction.
+            SL = std::min(SL, 0.0);
+            SR = std::max(SR, 0.0);
+
+            NekDouble tmp1 = 1.0 / (SR - SL);
+            NekDouble tmp2 = SR * SL;
+
+            for (int n = 0; n < 5; ++n)
+            {
+                f[n][i] = (SR * fL[n] - SL * fR[n] +
+                           tmp2 * (qR[n] - qL[n])) * tmp1;
+            }
+        }
+
+        StoreBlockFlux(nPts, f, rhof, rhouf, rhovf, rhowf, Ef);
+    }
 }
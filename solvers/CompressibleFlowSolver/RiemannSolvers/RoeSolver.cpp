@@ -49,38 +49,18 @@ namespace Nektar
     }
 
     /**
-     * @brief Roe Riemann solver.
-     *
-     * Stated equations numbers are from:
-     *
-     *   "Riemann Solvers and Numerical Methods for Fluid Dynamics: A Practical
-     *   Introduction", E. F. Toro (3rd edition, 2009).
-     *
-     * We follow the algorithm prescribed following equation 11.70.
-     *
-     * @param rhoL      Density left state.
-     * @param rhoR      Density right state.  
-     * @param rhouL     x-momentum component left state.  
-     * @param rhouR     x-momentum component right state.  
-     * @param rhovL     y-momentum component left state.  
-     * @param rhovR     y-momentum component right state.  
-     * @param rhowL     z-momentum component left state.  
-     * @param rhowR     z-momentum component right state.
-     * @param EL        Energy left state.  
-     * @param ER        Energy right state. 
-     * @param rhof      Computed Riemann flux for density.
-     * @param rhouf     Computed Riemann flux for x-momentum component 
-     * @param rhovf     Computed Riemann flux for y-momentum component 
-     * @param rhowf     Computed Riemann flux for z-momentum component 
-     * @param Ef        Computed Riemann flux for energy.
+     * @brief Flux of the Roe Riemann solver at a single point, shared by the
+     * point and block solves.
      */
-    void RoeSolver::v_PointSolve(
-        double  rhoL, double  rhouL, double  rhovL, double  rhowL, double  EL,
-        double  rhoR, double  rhouR, double  rhovR, double  rhowR, double  ER,
-        double &rhof, double &rhouf, double &rhovf, double &rhowf, double &Ef)
-    {        
-        static NekDouble gamma = m_params["gamma"]();
-        
+    inline void RoeSolver::RoeKernel(
+        const NekDouble gamma,
+        NekDouble  rhoL, NekDouble  rhouL, NekDouble  rhovL, NekDouble  rhowL,
+        NekDouble  EL,
+        NekDouble  rhoR, NekDouble  rhouR, NekDouble  rhovR, NekDouble  rhowR,
+        NekDouble  ER,
+        NekDouble &rhof, NekDouble &rhouf, NekDouble &rhovf, NekDouble &rhowf,
+        NekDouble &Ef)
+    {
         // Left and right velocities
         NekDouble uL = rhouL / rhoL;
         NekDouble vL = rhovL / rhoL;
@@ -171,4 +151,73 @@ namespace Nektar
             Ef    -= ahat*k[i][4];
         }
     }
+
+    /**
+     * @brief Roe Riemann solver.
+     *
+     * Stated equations numbers are from:
+     *
+     *   "Riemann Solvers and Numerical Methods for Fluid Dynamics: A Practical
+     *   Introduction", E. F. Toro (3rd edition, 2009).
+     *
+     * We follow the algorithm prescribed following equation 11.70.
+     *
+     * @param rhoL      Density left state.
+     * @param rhoR      Density right state.  
+     * @param rhouL     x-momentum component left state.  
+     * @param rhouR     x-momentum component right state.  
+     * @param rhovL     y-momentum component left state.  
+     * @param rhovR     y-momentum component right state.  
+     * @param rhowL     z-momentum component left state.  
+     * @param rhowR     z-momentum component right state.
+     * @param EL        Energy left state.  
+     * @param ER        Energy right state. 
+     * @param rhof      Computed Riemann flux for density.
+     * @param rhouf     Computed Riemann flux for x-momentum component 
+     * @param rhovf     Computed Riemann flux for y-momentum component 
+     * @param rhowf     Computed Riemann flux for z-momentum component 
+     * @param Ef        Computed Riemann flux for energy.
+     */
+    void RoeSolver::v_PointSolve(
+        double  rhoL, double  rhouL, double  rhovL, double  rhowL, double  EL,
+        double  rhoR, double  rhouR, double  rhovR, double  rhowR, double  ER,
+        double &rhof, double &rhouf, double &rhovf, double &rhowf, double &Ef)
+    {        
+        static NekDouble gamma = m_params["gamma"]();
+
+        RoeKernel(gamma,
+                  rhoL, rhouL, rhovL, rhowL, EL,
+                  rhoR, rhouR, rhovR, rhowR, ER,
+                  rhof, rhouf, rhovf, rhowf, Ef);
+    }
+
+    /**
+     * @brief Roe Riemann solver for a block of trace points.
+     *
+     * The fluxes are first written to block-local storage, which cannot alias
+     * the states, so that the compiler is free to vectorise the loop over the
+     * branch-free #RoeKernel.
+     */
+    void RoeSolver::v_BlockSolve(
+        const int nPts,
+        const NekDouble *rhoL, const NekDouble *rhouL, const NekDouble *rhovL,
+        const NekDouble *rhowL, const NekDouble *EL,
+        const NekDouble *rhoR, const NekDouble *rhouR, const NekDouble *rhovR,
+        const NekDouble *rhowR, const NekDouble *ER,
+        NekDouble *rhof, NekDouble *rhouf, NekDouble *rhovf,
+        NekDouble *rhowf, NekDouble *Ef)
+    {
+        const NekDouble gamma = m_params["gamma"]();
+        NekDouble f[5][m_blockSize];
+
+        for (int i = 0; i < nPts; ++i)
+        {
+            RoeKernel(gamma,
+                      rhoL[i], rhouL[i], rhovL[i], rhowL[i], EL[i],
+                      rhoR[i], rhouR[i], rhovR[i], rhowR[i], ER[i],
+                      f[0][i], f[1][i],  f[2][i],  f[3][i],  f[4][i]);
+        }
+
+        StoreBlockFlux(nPts, f, rhof, rhouf, rhovf, rhowf, Ef);
+    }
 }
@@ -58,6 +58,24 @@ namespace Nektar
             double  rhoL, double  rhouL, double  rhovL, double  rhowL, double  EL,
             double  rhoR, double  rhouR, double  rhovR, double  rhowR, double  ER,
             double &rhof, double &rhouf, double &rhovf, double &rhowf, double &Ef);
+
+        virtual void v_BlockSolve(
+            const int nPts,
+            const NekDouble *rhoL, const NekDouble *rhouL, const NekDouble *rhovL,
+            const NekDouble *rhowL, const NekDouble *EL,
+            const NekDouble *rhoR, const NekDouble *rhouR, const NekDouble *rhovR,
+            const NekDouble *rhowR, const NekDouble *ER,
+            NekDouble *rhof, NekDouble *rhouf, NekDouble *rhovf,
+            NekDouble *rhowf, NekDouble *Ef);
+
+        static void RoeKernel(
+            const NekDouble gamma,
+            NekDouble  rhoL, NekDouble  rhouL, NekDouble  rhovL, NekDouble  rhowL,
+            NekDouble  EL,
+            NekDouble  rhoR, NekDouble  rhouR, NekDouble  rhovR, NekDouble  rhowR,
+            NekDouble  ER,
+            NekDouble &rhof, NekDouble &rhouf, NekDouble &rhovf, NekDouble &rhowf,
+            NekDouble &Ef);
     };
 }
 
@@ -0,0 +1,27 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Euler Isentropic Vortex P=3, parallel, reading a mesh written with --write-chunks</description>
+    <executable>CompressibleFlowSolver</executable>
+    <parameters>--use-metis IsentropicVortex16_P3_par_chunks</parameters>
+    <processes>3</processes>
+    <files>
+        <file description="Mesh Chunk">IsentropicVortex16_P3_par_chunks/C0000000.xml</file>
+        <file description="Mesh Chunk">IsentropicVortex16_P3_par_chunks/C0000001.xml</file>
+        <file description="Mesh Chunk">IsentropicVortex16_P3_par_chunks/C0000002.xml</file>
+        <file description="Mesh Chunk">IsentropicVortex16_P3_par_chunks/C0000003.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="rho" tolerance="1e-12">0.000592878</value>
+            <value variable="rhou" tolerance="1e-12">0.00108625</value>
+            <value variable="rhov" tolerance="1e-12">0.00165438</value>
+            <value variable="E" tolerance="1e-12">0.00373868</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="rho" tolerance="1e-12">0.00119803</value>
+            <value variable="rhou" tolerance="1e-12">0.00223555</value>
+            <value variable="rhov" tolerance="1e-12">0.00351521</value>
+            <value variable="E" tolerance="1e-12">0.0098072</value>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,40 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Euler Isentropic Vortex P=3, implicit DIRK3 with JFNK</description>
+    <executable>CompressibleFlowSolver</executable>
+    <parameters>--verbose IsentropicVortex16_P3_Implicit.xml</parameters>
+    <files>
+        <file description="Session File">IsentropicVortex16_P3_Implicit.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="rho" tolerance="1e-12">0.000592878</value>
+            <value variable="rhou" tolerance="1e-12">0.00108625</value>
+            <value variable="rhov" tolerance="1e-12">0.00165438</value>
+            <value variable="E" tolerance="1e-12">0.00373868</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="rho" tolerance="1e-12">0.00119803</value>
+            <value variable="rhou" tolerance="1e-12">0.00223556</value>
+            <value variable="rhov" tolerance="1e-12">0.0035152</value>
+            <value variable="E" tolerance="1e-12">0.00980719</value>
+        </metric>
+        <metric type="Regex" id="3">
+            <regex>^JFNK: Newton iterations = (\d+), GMRES iterations = (\d+).*</regex>
+            <matches>
+                <match>
+                    <field>2</field>
+                    <field>4</field>
+                </match>
+                <match>
+                    <field>2</field>
+                    <field>4</field>
+                </match>
+                <match>
+                    <field>2</field>
+                    <field>4</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,23 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Euler Isentropic Vortex graded mesh, single-rate AB2</description>
+    <executable>CompressibleFlowSolver</executable>
+    <parameters>IsentropicVortexGraded_AB2.xml</parameters>
+    <files>
+        <file description="Session File">IsentropicVortexGraded_AB2.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="rho" tolerance="1e-12">0.00870367</value>
+            <value variable="rhou" tolerance="1e-12">0.0158165</value>
+            <value variable="rhov" tolerance="1e-12">0.02289</value>
+            <value variable="E" tolerance="1e-12">0.0517603</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="rho" tolerance="1e-12">0.0169244</value>
+            <value variable="rhou" tolerance="1e-12">0.0253084</value>
+            <value variable="rhov" tolerance="1e-12">0.0341246</value>
+            <value variable="E" tolerance="1e-12">0.0848948</value>
+        </metric>
+    </metrics>
+</test>
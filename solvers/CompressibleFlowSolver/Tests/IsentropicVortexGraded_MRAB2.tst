@@ -0,0 +1,31 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Euler Isentropic Vortex graded mesh, multirate AB2 with two rate groups</description>
+    <executable>CompressibleFlowSolver</executable>
+    <parameters>--verbose IsentropicVortexGraded_MRAB2.xml</parameters>
+    <files>
+        <file description="Session File">IsentropicVortexGraded_MRAB2.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="rho" tolerance="1e-12">0.00870069</value>
+            <value variable="rhou" tolerance="1e-12">0.0158215</value>
+            <value variable="rhov" tolerance="1e-12">0.0228873</value>
+            <value variable="E" tolerance="1e-12">0.0517495</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="rho" tolerance="1e-12">0.0170251</value>
+            <value variable="rhou" tolerance="1e-12">0.0252833</value>
+            <value variable="rhov" tolerance="1e-12">0.0342419</value>
+            <value variable="E" tolerance="1e-12">0.0850045</value>
+        </metric>
+        <metric type="Regex" id="3">
+            <regex>^Multirate levels\s*:\s*(\d+).*</regex>
+            <matches>
+                <match>
+                    <field>2</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
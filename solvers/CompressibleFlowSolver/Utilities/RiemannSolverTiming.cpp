@@ -0,0 +1,204 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: RiemannSolverTiming.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Timing of the point and block compressible Riemann solves.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <CompressibleFlowSolver/RiemannSolvers/CompressibleSolver.h>
+
+using namespace std;
+using namespace Nektar;
+
+/**
+ * Trace data of the benchmark, exposed to the Riemann solvers in the same way
+ * as by CompressibleFlowSystem.
+ */
+struct TraceData
+{
+    NekDouble                            m_gamma;
+    Array<OneD, Array<OneD, NekDouble> > m_vecLocs;
+    Array<OneD, Array<OneD, NekDouble> > m_normals;
+
+    NekDouble GetGamma()
+    {
+        return m_gamma;
+    }
+
+    const Array<OneD, const Array<OneD, NekDouble> > &GetVecLocs()
+    {
+        return m_vecLocs;
+    }
+
+    const Array<OneD, const Array<OneD, NekDouble> > &GetNormals()
+    {
+        return m_normals;
+    }
+};
+
+NekDouble Random(NekDouble lo, NekDouble hi)
+{
+    return lo + (hi - lo) * rand() / NekDouble(RAND_MAX);
+}
+
+/**
+ * Fill @p q with random subsonic and supersonic states.
+ */
+void RandomStates(
+    int nDim, int nPts, NekDouble gamma,
+    Array<OneD, Array<OneD, NekDouble> > &q)
+{
+    for (int i = 0; i < nPts; ++i)
+    {
+        NekDouble rho = Random(0.5, 1.5);
+        NekDouble p   = Random(0.5, 1.5);
+        NekDouble ke  = 0.0;
+
+        for (int d = 0; d < nDim; ++d)
+        {
+            NekDouble u = Random(-1.5, 1.5);
+            q[d+1][i]   = rho * u;
+            ke         += 0.5 * rho * u * u;
+        }
+
+        q[0][i]      = rho;
+        q[nDim+1][i] = p / (gamma - 1.0) + ke;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc > 3)
+    {
+        fprintf(stderr, "Usage: RiemannSolverTiming [nPts] [nRepeats]\n");
+        exit(1);
+    }
+
+    int nPts     = argc > 1 ? atoi(argv[1]) : 100000;
+    int nRepeats = argc > 2 ? atoi(argv[2]) : 20;
+
+    const char *names[] = {
+        "AUSM0", "AUSM1", "AUSM2", "AUSM3", "ExactToro", "HLL", "HLLC",
+        "LaxFriedrichs", "Roe"
+    };
+    const int nSolvers = sizeof(names) / sizeof(names[0]);
+
+    TraceData data;
+    data.m_gamma = 1.4;
+
+    cout << "Trace points: " << nPts << ", repeats: " << nRepeats << endl;
+    cout << "dim  solver          point (s)    block (s)    speedup  "
+         << "max diff" << endl;
+
+    for (int nDim = 1; nDim <= 3; ++nDim)
+    {
+        int nVar = nDim + 2;
+
+        // Velocity locations and normals aligned with the x-axis.
+        data.m_vecLocs    = Array<OneD, Array<OneD, NekDouble> >(1);
+        data.m_vecLocs[0] = Array<OneD, NekDouble>(nDim);
+        data.m_normals    = Array<OneD, Array<OneD, NekDouble> >(nDim);
+        for (int d = 0; d < nDim; ++d)
+        {
+            data.m_vecLocs[0][d] = 1 + d;
+            data.m_normals[d]    = Array<OneD, NekDouble>(nPts, d ? 0.0 : 1.0);
+        }
+
+        Array<OneD, Array<OneD, NekDouble> > Fwd(nVar), Bwd(nVar);
+        Array<OneD, Array<OneD, NekDouble> > pointFlux(nVar), blockFlux(nVar);
+        for (int j = 0; j < nVar; ++j)
+        {
+            Fwd      [j] = Array<OneD, NekDouble>(nPts);
+            Bwd      [j] = Array<OneD, NekDouble>(nPts);
+            pointFlux[j] = Array<OneD, NekDouble>(nPts);
+            blockFlux[j] = Array<OneD, NekDouble>(nPts);
+        }
+
+        srand(nDim);
+        RandomStates(nDim, nPts, data.m_gamma, Fwd);
+        RandomStates(nDim, nPts, data.m_gamma, Bwd);
+
+        for (int s = 0; s < nSolvers; ++s)
+        {
+            RiemannSolverSharedPtr riemann =
+                GetRiemannSolverFactory().CreateInstance(names[s]);
+            riemann->SetParam ("gamma",   &TraceData::GetGamma,   &data);
+            riemann->SetAuxVec("vecLocs", &TraceData::GetVecLocs, &data);
+            riemann->SetVector("N",       &TraceData::GetNormals, &data);
+
+            boost::shared_ptr<CompressibleSolver> solver =
+                boost::dynamic_pointer_cast<CompressibleSolver>(riemann);
+            ASSERTL0(solver, "Not a compressible Riemann solver.");
+
+            Timer     timer;
+            NekDouble time[2];
+
+            for (int b = 0; b < 2; ++b)
+            {
+                Array<OneD, Array<OneD, NekDouble> > &flux =
+                    b ? blockFlux : pointFlux;
+
+                solver->SetBlockSolve(b == 1);
+                solver->Solve(nDim, Fwd, Bwd, flux);
+
+                timer.Start();
+                for (int r = 0; r < nRepeats; ++r)
+                {
+                    solver->Solve(nDim, Fwd, Bwd, flux);
+                }
+                timer.Stop();
+                time[b] = timer.TimePerTest(nRepeats);
+            }
+
+            NekDouble maxDiff = 0.0;
+            for (int j = 0; j < nVar; ++j)
+            {
+                for (int i = 0; i < nPts; ++i)
+                {
+                    maxDiff = max(maxDiff,
+                                  fabs(pointFlux[j][i] - blockFlux[j][i]) /
+                                  (1.0 + fabs(pointFlux[j][i])));
+                }
+            }
+
+            printf("%-4d %-15s %-12.4e %-12.4e %-8.2f %.2e\n", nDim,
+                   names[s], time[0], time[1], time[0] / time[1], maxDiff);
+        }
+    }
+
+    return 0;
+}
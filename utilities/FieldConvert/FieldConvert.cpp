@@ -65,6 +65,10 @@ int main(int argc, char* argv[])
         ("onlyshape", po::value<string>(),
                  "Only use element with defined shape type i.e. -onlyshape "
                  " Tetrahedron")
+        ("io-threads", po::value<int>(),
+                "Number of threads used to compress and decompress field "
+                "data (0 for all cores). Output files are written with "
+                "blocked compression.")
         ("procid", po::value<int>(),
                 "Process as single procid of a partition of size nproc "
                 "(-nproc must be specified).")
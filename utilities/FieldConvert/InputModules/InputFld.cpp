@@ -124,6 +124,11 @@ void InputFld::Process(po::variables_map &vm)
             m_f->m_fld = MemoryManager<LibUtilities::FieldIO>
                 ::AllocateSharedPtr(c);
         }
+
+        if(vm.count("io-threads"))
+        {
+            m_f->m_fld->SetCompressionThreads(vm["io-threads"].as<int>());
+        }
     }
 
 
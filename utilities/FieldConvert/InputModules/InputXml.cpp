@@ -231,6 +231,10 @@ void InputXml::Process(po::variables_map &vm)
     m_f->m_graph = SpatialDomains::MeshGraph::Read(m_f->m_session,rng);
     m_f->m_fld = MemoryManager<LibUtilities::FieldIO>
                     ::AllocateSharedPtr(m_f->m_session->GetComm());
+    if(vm.count("io-threads"))
+    {
+        m_f->m_fld->SetCompressionThreads(vm["io-threads"].as<int>());
+    }
 
     // currently load all field (possibly could read data from
     // expansion list but it is re-arranged in expansion)
@@ -265,27 +265,38 @@ void ProcessInterpField::InterpolateField(
 {
     int expdim = field0[0]->GetCoordim(0);
 
-    Array<OneD, NekDouble> coords(expdim), Lcoords(expdim);
+    Array<OneD, NekDouble> Lcoords(expdim);
     int nq1 = field1[0]->GetTotPoints();
     int elmtid, offset;
-    int r, f;
+    int r, f, d;
     static int intpts = 0;
 
     ASSERTL0(field0.size() == field1.size(),
              "Input field dimension must be same as output dimension");
 
+    // Obtain nearest Element and LocalCoordinate of all points to
+    // interpolate
+    Array<OneD, Array<OneD, NekDouble> > coords(expdim), locCoords;
+    Array<OneD, int> elmtIds;
+    coords[0] = x;
+    if (expdim > 1)
+    {
+        coords[1] = y;
+    }
+    if (expdim == 3)
+    {
+        coords[2] = z;
+    }
+    field0[0]->GetExpIndices(coords, elmtIds, locCoords, 1e-3, true);
+
     for (r = 0; r < nq1; r++)
     {
-        coords[0] = x[r];
-        coords[1] = y[r];
-        if (expdim == 3)
+        elmtid = elmtIds[r];
+        for (d = 0; d < expdim; ++d)
         {
-            coords[2] = z[r];
+            Lcoords[d] = locCoords[d][r];
         }
 
-        // Obtain nearest Element and LocalCoordinate to interpolate
-        elmtid = field0[0]->GetExpIndex(coords, Lcoords, 1e-3,true);
-
         if(elmtid >= 0)
         {
             offset = field0[0]->GetPhys_Offset(field0[0]->
@@ -62,6 +62,8 @@ ProcessInterpPointDataToFld::ProcessInterpPointDataToFld(FieldSharedPtr f)
 
     m_config["interpcoord"] = ConfigOption(false, "-1",
                                     "coordinate id ot use for interpolation");
+    m_config["threads"] = ConfigOption(false, "1",
+                    "number of threads for weight computation (0: all cores)");
 
 }
 
@@ -109,6 +111,7 @@ void ProcessInterpPointDataToFld::Process(po::variables_map &vm)
             &ProcessInterpPointDataToFld::PrintProgressbar, this);
         cout << "Interpolating:       ";
     }
+    m_f->m_fieldPts->SetNumThreads(m_config["threads"].as<int>());
     m_f->m_fieldPts->Interpolate(coords, intFields, coord_id);
 
     for(i = 0; i < totpoints; ++i)
@@ -339,10 +339,10 @@ void ProcessInterpPoints::InterpolateFieldToPts(
 {
     int expdim = field0[0]->GetCoordim(0);
 
-    Array<OneD, NekDouble> coords(expdim), Lcoords(expdim);
+    Array<OneD, NekDouble> Lcoords(expdim);
     int nq1 = pts[0].num_elements();
     int elmtid, offset;
-    int r, f;
+    int r, f, d;
     int intpts = 0;
 
     // resize data field
@@ -353,18 +353,23 @@ void ProcessInterpPoints::InterpolateFieldToPts(
         m_f->m_data[f].resize(nq1);
     }
 
+    // Obtain Element and LocalCoordinate of all points to interpolate
+    Array<OneD, Array<OneD, NekDouble> > coords(expdim), locCoords;
+    Array<OneD, int> elmtIds;
+    for (d = 0; d < expdim; ++d)
+    {
+        coords[d] = pts[d];
+    }
+    field0[0]->GetExpIndices(coords, elmtIds, locCoords, 1e-3);
+
     for (r = 0; r < nq1; r++)
     {
-        coords[0] = pts[0][r];
-        coords[1] = pts[1][r];
-        if (expdim == 3)
+        elmtid = elmtIds[r];
+        for (d = 0; d < expdim; ++d)
         {
-            coords[2] = pts[2][r];
+            Lcoords[d] = locCoords[d][r];
         }
 
-        // Obtain Element and LocalCoordinate to interpolate
-        elmtid = field0[0]->GetExpIndex(coords, Lcoords, 1e-3);
-
         if(elmtid >= 0)
         {
             offset = field0[0]->GetPhys_Offset(field0[0]->